@@ -129,6 +129,18 @@ AircraftLanding::~AircraftLanding(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* AircraftLanding::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   AircraftLanding* aircraft_landing_pointer = new AircraftLanding(*this);
+
+   aircraft_landing_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(aircraft_landing_pointer);
+}
+
+
 // double get_short_period_gain(void) method
 
 double AircraftLanding::get_short_period_gain(void)
@@ -286,6 +298,10 @@ double AircraftLanding::get_elevator_weight(void)
 void AircraftLanding::set_short_period_gain(double new_short_period_gain)
 {
    short_period_gain = new_short_period_gain;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -294,6 +310,10 @@ void AircraftLanding::set_short_period_gain(double new_short_period_gain)
 void AircraftLanding::set_short_period_resonant_frequency(double new_short_period_resonant_frequency)
 {
    short_period_resonant_frequency = new_short_period_resonant_frequency;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -302,6 +322,10 @@ void AircraftLanding::set_short_period_resonant_frequency(double new_short_perio
 void AircraftLanding::set_path_time_constant(double new_path_time_constant)
 {
    path_time_constant = new_path_time_constant;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -310,6 +334,10 @@ void AircraftLanding::set_path_time_constant(double new_path_time_constant)
 void AircraftLanding::set_short_period_damping_factor(double new_short_period_damping_factor)
 {
    short_period_damping_factor = new_short_period_damping_factor;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -318,6 +346,10 @@ void AircraftLanding::set_short_period_damping_factor(double new_short_period_da
 void AircraftLanding::set_velocity(double new_velocity)
 {
    velocity = new_velocity;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -326,6 +358,10 @@ void AircraftLanding::set_velocity(double new_velocity)
 void AircraftLanding::set_landing_time(double new_landing_time)
 {
    landing_time = new_landing_time;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -334,6 +370,10 @@ void AircraftLanding::set_landing_time(double new_landing_time)
 void AircraftLanding::set_initial_pitch_angle_rate(double new_initial_pitch_angle_rate)
 {
    initial_pitch_angle_rate = new_initial_pitch_angle_rate;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -342,6 +382,10 @@ void AircraftLanding::set_initial_pitch_angle_rate(double new_initial_pitch_angl
 void AircraftLanding::set_initial_pitch_angle(double new_initial_pitch_angle)
 {
    initial_pitch_angle = new_initial_pitch_angle;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -350,6 +394,10 @@ void AircraftLanding::set_initial_pitch_angle(double new_initial_pitch_angle)
 void AircraftLanding::set_initial_altitude_rate(double new_initial_altitude_rate)
 {
    initial_altitude_rate = new_initial_altitude_rate;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -358,6 +406,10 @@ void AircraftLanding::set_initial_altitude_rate(double new_initial_altitude_rate
 void AircraftLanding::set_initial_altitude(double new_initial_altitude)
 {
    initial_altitude = new_initial_altitude;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -370,6 +422,10 @@ double new_pitch_angle_weight, double new_altitude_rate_weight, double new_altit
    pitch_angle_weight = new_pitch_angle_weight;   
    altitude_rate_weight = new_altitude_rate_weight;   
    altitude_weight = new_altitude_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -383,6 +439,10 @@ double new_landing_altitude_weight)
    landing_pitch_angle_weight = new_landing_pitch_angle_weight;   
    landing_altitude_rate_weight = new_landing_altitude_rate_weight;   
    landing_altitude_weight = new_landing_altitude_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -391,6 +451,10 @@ double new_landing_altitude_weight)
 void AircraftLanding::set_elevator_weight(double new_elevator_weight)
 {
    elevator_weight = new_elevator_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -46,6 +46,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    double get_short_period_gain(void);
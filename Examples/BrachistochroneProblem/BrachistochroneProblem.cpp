@@ -74,6 +74,18 @@ BrachistochroneProblem::~BrachistochroneProblem(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* BrachistochroneProblem::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   BrachistochroneProblem* brachistochrone_problem_pointer = new BrachistochroneProblem(*this);
+
+   brachistochrone_problem_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(brachistochrone_problem_pointer);
+}
+
+
 // double get_xa(void) method
 
 double BrachistochroneProblem::get_xa(void)
@@ -127,6 +139,10 @@ int BrachistochroneProblem::get_initial_size(void)
 void BrachistochroneProblem::set_xa(double new_xa)
 {
    xa = new_xa;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -135,6 +151,10 @@ void BrachistochroneProblem::set_xa(double new_xa)
 void BrachistochroneProblem::set_ya(double  new_ya)
 {
    ya = new_ya;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -143,6 +163,10 @@ void BrachistochroneProblem::set_ya(double  new_ya)
 void BrachistochroneProblem::set_xb(double  new_xb)
 {
    xb = new_xb;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -151,6 +175,10 @@ void BrachistochroneProblem::set_xb(double  new_xb)
 void BrachistochroneProblem::set_yb(double  new_yb)
 {
    yb = new_yb;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -161,6 +189,10 @@ void BrachistochroneProblem::set_tolerance(double new_tolerance)
    tolerance = new_tolerance;
 
    ordinary_differential_equations.set_tolerance(tolerance);
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -171,6 +203,10 @@ void BrachistochroneProblem::set_initial_size(int new_initial_size)
    initial_size =  new_initial_size;
 
    ordinary_differential_equations.set_initial_size(initial_size);
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -182,6 +218,10 @@ void BrachistochroneProblem::set_problem(double new_xa, double new_ya, double ne
    ya = new_ya;
    xb = new_xb;
    yb = new_yb;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
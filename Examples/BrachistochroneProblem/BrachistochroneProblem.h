@@ -45,6 +45,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    double get_xa(void);
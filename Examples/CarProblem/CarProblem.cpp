@@ -128,6 +128,18 @@ CarProblem::~CarProblem(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* CarProblem::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   CarProblem* car_problem_pointer = new CarProblem(*this);
+
+   car_problem_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(car_problem_pointer);
+}
+
+
 // double get_initial_position(void) method
 
 double CarProblem::get_initial_position(void)
@@ -205,6 +217,10 @@ double CarProblem::get_final_time_weight(void)
 void CarProblem::set_initial_position(double new_initial_position)
 {
    initial_position = new_initial_position;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -213,6 +229,10 @@ void CarProblem::set_initial_position(double new_initial_position)
 void CarProblem::set_initial_velocity(double new_initial_velocity)
 {
    initial_velocity = new_initial_velocity;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -221,6 +241,10 @@ void CarProblem::set_initial_velocity(double new_initial_velocity)
 void CarProblem::set_final_position_goal(double new_final_position_goal)
 {
    final_position_goal = new_final_position_goal;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -229,6 +253,10 @@ void CarProblem::set_final_position_goal(double new_final_position_goal)
 void CarProblem::set_final_velocity_goal(double new_final_velocity_goal)
 {
    final_velocity_goal = new_final_velocity_goal;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -237,6 +265,10 @@ void CarProblem::set_final_velocity_goal(double new_final_velocity_goal)
 void CarProblem::set_maximum_acceleration(double new_maximum_acceleration)
 {
    maximum_acceleration = new_maximum_acceleration;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -245,6 +277,10 @@ void CarProblem::set_maximum_acceleration(double new_maximum_acceleration)
 void CarProblem::set_maximum_deceleration(double new_maximum_deceleration)
 {
    maximum_deceleration = new_maximum_deceleration;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -253,6 +289,10 @@ void CarProblem::set_maximum_deceleration(double new_maximum_deceleration)
 void CarProblem::set_final_position_error_weight(double new_final_position_error_weight)
 {
    final_position_error_weight = new_final_position_error_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -261,6 +301,10 @@ void CarProblem::set_final_position_error_weight(double new_final_position_error
 void CarProblem::set_final_velocity_error_weight(double new_final_velocity_error_weight)
 {
    final_velocity_error_weight = new_final_velocity_error_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -269,6 +313,10 @@ void CarProblem::set_final_velocity_error_weight(double new_final_velocity_error
 void CarProblem::set_final_time_weight(double new_final_time_weight)
 {
    final_time_weight = new_final_time_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
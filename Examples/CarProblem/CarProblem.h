@@ -42,6 +42,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    double get_initial_position(void);
@@ -87,6 +87,18 @@ CarProblemNeurocomputing::~CarProblemNeurocomputing(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* CarProblemNeurocomputing::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   CarProblemNeurocomputing* car_problem_neurocomputing_pointer = new CarProblemNeurocomputing(*this);
+
+   car_problem_neurocomputing_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(car_problem_neurocomputing_pointer);
+}
+
+
 // double get_initial_position(void) method
 
 double CarProblemNeurocomputing::get_initial_position(void)
@@ -164,6 +176,10 @@ double CarProblemNeurocomputing::get_final_time_weight(void)
 void CarProblemNeurocomputing::set_initial_position(double new_initial_position)
 {
    initial_position = new_initial_position;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -172,6 +188,10 @@ void CarProblemNeurocomputing::set_initial_position(double new_initial_position)
 void CarProblemNeurocomputing::set_initial_velocity(double new_initial_velocity)
 {
    initial_velocity = new_initial_velocity;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -180,6 +200,10 @@ void CarProblemNeurocomputing::set_initial_velocity(double new_initial_velocity)
 void CarProblemNeurocomputing::set_final_position_goal(double new_final_position_goal)
 {
    final_position_goal = new_final_position_goal;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -188,6 +212,10 @@ void CarProblemNeurocomputing::set_final_position_goal(double new_final_position
 void CarProblemNeurocomputing::set_final_velocity_goal(double new_final_velocity_goal)
 {
    final_velocity_goal = new_final_velocity_goal;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -196,6 +224,10 @@ void CarProblemNeurocomputing::set_final_velocity_goal(double new_final_velocity
 void CarProblemNeurocomputing::set_minimum_acceleration(double newMinimumAcceleration)
 {
    minimum_acceleration = newMinimumAcceleration;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -204,6 +236,10 @@ void CarProblemNeurocomputing::set_minimum_acceleration(double newMinimumAcceler
 void CarProblemNeurocomputing::set_maximum_acceleration(double new_maximum_acceleration)
 {
    maximum_acceleration = new_maximum_acceleration;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -213,6 +249,10 @@ void CarProblemNeurocomputing
 ::set_final_position_error_weight(double new_final_position_error_weight)
 {
    final_position_error_weight = new_final_position_error_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -221,6 +261,10 @@ void CarProblemNeurocomputing
 void CarProblemNeurocomputing::set_final_velocity_error_weight(double new_final_velocity_error_weight)
 {
    final_velocity_error_weight = new_final_velocity_error_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -229,6 +273,10 @@ void CarProblemNeurocomputing::set_final_velocity_error_weight(double new_final_
 void CarProblemNeurocomputing::set_final_time_weight(double new_final_time_weight)
 {
    final_time_weight = new_final_time_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -83,6 +83,18 @@ CatenaryProblem::~CatenaryProblem(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* CatenaryProblem::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   CatenaryProblem* catenary_problem_pointer = new CatenaryProblem(*this);
+
+   catenary_problem_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(catenary_problem_pointer);
+}
+
+
 // double get_xa(void) method
 
 double CatenaryProblem::get_xa(void)
@@ -144,6 +156,10 @@ double CatenaryProblem::get_potential_energy_weight(void)
 void CatenaryProblem::set_xa(double new_xa)
 {
    xa = new_xa;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -152,6 +168,10 @@ void CatenaryProblem::set_xa(double new_xa)
 void CatenaryProblem::set_ya(double  new_ya)
 {
    ya = new_ya;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -160,6 +180,10 @@ void CatenaryProblem::set_ya(double  new_ya)
 void CatenaryProblem::set_xb(double new_xb)
 {
    xb = new_xb;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -168,6 +192,10 @@ void CatenaryProblem::set_xb(double new_xb)
 void CatenaryProblem::set_yb(double  new_yb)
 {
    yb = new_yb;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -176,6 +204,10 @@ void CatenaryProblem::set_yb(double  new_yb)
 void CatenaryProblem::set_length_goal(double new_length_goal)
 {
    length_goal = new_length_goal;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -184,6 +216,10 @@ void CatenaryProblem::set_length_goal(double new_length_goal)
 void CatenaryProblem::set_length_error_weight(double new_length_error_weight)
 {
    length_error_weight = new_length_error_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -192,6 +228,10 @@ void CatenaryProblem::set_length_error_weight(double new_length_error_weight)
 void CatenaryProblem::set_potential_energy_weight(double new_potential_energy_weight)
 {
    potential_energy_weight = new_potential_energy_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -44,6 +44,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    double get_xa(void);
@@ -49,6 +49,18 @@ DeJongFunction::~DeJongFunction(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* DeJongFunction::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   DeJongFunction* De_Jong_function_pointer = new DeJongFunction(*this);
+
+   De_Jong_function_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(De_Jong_function_pointer);
+}
+
+
 // int get_variables_number(void) method
 
 int DeJongFunction::get_variables_number(void)
@@ -78,6 +90,10 @@ void DeJongFunction::set_variables_number(int new_variables_number)
    }
 
    multilayer_perceptron_pointer->initialize_independent_parameters_uniform(-5.12, 5.12);
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -47,6 +47,18 @@ EasomFunction::~EasomFunction(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* EasomFunction::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   EasomFunction* Easom_function_pointer = new EasomFunction(*this);
+
+   Easom_function_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(Easom_function_pointer);
+}
+
+
 // double calculate_objective(void) method
 
 double EasomFunction::calculate_objective(void)
@@ -48,6 +48,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Objective methods
 
    double calculate_objective(void);
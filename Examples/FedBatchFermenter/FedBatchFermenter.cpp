@@ -106,6 +106,18 @@ FedBatchFermenter::~FedBatchFermenter(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* FedBatchFermenter::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   FedBatchFermenter* fed_batch_fermenter_pointer = new FedBatchFermenter(*this);
+
+   fed_batch_fermenter_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(fed_batch_fermenter_pointer);
+}
+
+
 // double get_final_time(void) method
 
 double FedBatchFermenter::get_final_time(void)
@@ -193,6 +205,10 @@ void FedBatchFermenter::set_final_time(double newFinalTime)
    // Set final time
 
    final_time = newFinalTime;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -201,6 +217,10 @@ void FedBatchFermenter::set_final_time(double newFinalTime)
 void FedBatchFermenter::set_initial_cell_mass_concentration(double newInitialCellMassConcentration)
 {
    initialCellMassConcentration = newInitialCellMassConcentration;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -209,6 +229,10 @@ void FedBatchFermenter::set_initial_cell_mass_concentration(double newInitialCel
 void FedBatchFermenter::set_initial_substrate_concentration(double newInitialSubstrateConcentration)
 {
    initialSubstrateConcentration = newInitialSubstrateConcentration;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -217,6 +241,10 @@ void FedBatchFermenter::set_initial_substrate_concentration(double newInitialSub
 void FedBatchFermenter::set_initial_product_concentration(double newInitialProductConcentration)
 {
    initialProductConcentration = newInitialProductConcentration;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -225,6 +253,10 @@ void FedBatchFermenter::set_initial_product_concentration(double newInitialProdu
 void FedBatchFermenter::set_initial_broth_volume(double newInitialBrothVolume)
 {
    initialBrothVolume = newInitialBrothVolume;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -233,6 +265,10 @@ void FedBatchFermenter::set_initial_broth_volume(double newInitialBrothVolume)
 void FedBatchFermenter::set_fermenter_volume(double newFermenterVolume)
 {
    fermenterVolume = newFermenterVolume;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -241,6 +277,10 @@ void FedBatchFermenter::set_fermenter_volume(double newFermenterVolume)
 void FedBatchFermenter::set_minimum_feed_rate(double newMinimumFeedRate)
 {
    minimumFeedRate = newMinimumFeedRate;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -249,6 +289,10 @@ void FedBatchFermenter::set_minimum_feed_rate(double newMinimumFeedRate)
 void FedBatchFermenter::set_maximum_feed_rate(double newMaximumFeedRate)
 {
    maximum_feed_rate = newMaximumFeedRate;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -257,6 +301,10 @@ void FedBatchFermenter::set_maximum_feed_rate(double newMaximumFeedRate)
 void FedBatchFermenter::set_volume_error_weight(double newVolumeErrorWeight)
 {
    volumeErrorWeight = newVolumeErrorWeight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -265,6 +313,10 @@ void FedBatchFermenter::set_volume_error_weight(double newVolumeErrorWeight)
 void FedBatchFermenter::set_yield_weight(double newYieldWeight)
 {
    yieldWeight = newYieldWeight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
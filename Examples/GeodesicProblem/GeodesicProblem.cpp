@@ -69,6 +69,18 @@ GeodesicProblem::~GeodesicProblem(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* GeodesicProblem::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   GeodesicProblem* geodesic_problem_pointer = new GeodesicProblem(*this);
+
+   geodesic_problem_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(geodesic_problem_pointer);
+}
+
+
 // double get_xa(void) method
 
 double GeodesicProblem::get_xa(void)
@@ -106,6 +118,10 @@ double GeodesicProblem::get_yb(void)
 void GeodesicProblem::set_xa(double new_xa)
 {
    xa = new_xa;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -114,6 +130,10 @@ void GeodesicProblem::set_xa(double new_xa)
 void GeodesicProblem::set_ya(double new_ya)
 {
    ya = new_ya;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
    
@@ -122,6 +142,10 @@ void GeodesicProblem::set_ya(double new_ya)
 void GeodesicProblem::set_xb(double new_xb)
 {
    xb = new_xb;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -130,6 +154,10 @@ void GeodesicProblem::set_xb(double new_xb)
 void GeodesicProblem::set_yb(double new_yb)
 {
    yb = new_yb;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
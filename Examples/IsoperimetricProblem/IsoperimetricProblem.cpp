@@ -75,6 +75,18 @@ IsoperimetricProblem::~IsoperimetricProblem(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* IsoperimetricProblem::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   IsoperimetricProblem* isoperimetric_problem_pointer = new IsoperimetricProblem(*this);
+
+   isoperimetric_problem_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(isoperimetric_problem_pointer);
+}
+
+
 // double get_perimeter_goal(void) method
 
 double IsoperimetricProblem::get_perimeter_goal(void)
@@ -112,6 +124,10 @@ void IsoperimetricProblem::get_perimeter_goal(double newPerimeterGoal)
 void IsoperimetricProblem::set_area_weight(double newAreaWeight)
 {
    area_weight = newAreaWeight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -120,6 +136,10 @@ void IsoperimetricProblem::set_area_weight(double newAreaWeight)
 void IsoperimetricProblem::set_perimeter_error_weight(double newPerimeterErrorWeight)
 {
    perimeter_error_weight = newPerimeterErrorWeight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -41,6 +41,10 @@ public:
 
    // METHODS
    
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    double get_perimeter_goal(void);
@@ -62,6 +62,18 @@ MinimumDragProblem::~MinimumDragProblem(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* MinimumDragProblem::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   MinimumDragProblem* minimum_drag_problem_pointer = new MinimumDragProblem(*this);
+
+   minimum_drag_problem_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(minimum_drag_problem_pointer);
+}
+
+
 // Vector<double> calculate_particular_solution(const Vector<double>&) method
 
 Vector<double> MinimumDragProblem::calculate_particular_solution(const Vector<double>& input)
@@ -42,6 +42,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Boundary conditions methods
 
    Vector<double> calculate_particular_solution(const Vector<double>&);
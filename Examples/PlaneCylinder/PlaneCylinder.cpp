@@ -48,6 +48,18 @@ PlaneCylinder::~PlaneCylinder(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* PlaneCylinder::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   PlaneCylinder* plane_cylinder_pointer = new PlaneCylinder(*this);
+
+   plane_cylinder_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(plane_cylinder_pointer);
+}
+
+
 // double get_penalty(void) method
 
 double PlaneCylinder::get_penalty(void)
@@ -76,6 +88,10 @@ void PlaneCylinder::set_penalty(double newPenalty)
    // Set penalty
 
    penalty = newPenalty;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
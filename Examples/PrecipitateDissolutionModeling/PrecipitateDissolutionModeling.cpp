@@ -82,6 +82,18 @@ PrecipitateDissolutionModeling::~PrecipitateDissolutionModeling(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* PrecipitateDissolutionModeling::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   PrecipitateDissolutionModeling* precipitate_dissolution_modeling_pointer = new PrecipitateDissolutionModeling(*this);
+
+   precipitate_dissolution_modeling_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(precipitate_dissolution_modeling_pointer);
+}
+
+
 // double getMinimumVickersHardness(void) method
 
 double PrecipitateDissolutionModeling::getMinimumVickersHardness(void)
@@ -143,6 +155,10 @@ double PrecipitateDissolutionModeling::getRegularizationWeight(void)
 void PrecipitateDissolutionModeling::setMinimumVickersHardness(double newMinimumVickersHardness)
 {
    minimumVickersHardness = newMinimumVickersHardness;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -151,6 +167,10 @@ void PrecipitateDissolutionModeling::setMinimumVickersHardness(double newMinimum
 void PrecipitateDissolutionModeling::setMaximumVickersHardness(double newMaximumVickersHardness)
 {
    maximumVickersHardness = newMaximumVickersHardness;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -159,6 +179,10 @@ void PrecipitateDissolutionModeling::setMaximumVickersHardness(double newMaximum
 void PrecipitateDissolutionModeling::setReferenceTemperature(double newReferenceTemperature)
 {
    referenceTemperature = newReferenceTemperature;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -167,6 +191,10 @@ void PrecipitateDissolutionModeling::setReferenceTemperature(double newReference
 void PrecipitateDissolutionModeling::setReferenceTime(double newReferenceTime)
 {
    referenceTime = newReferenceTime;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -175,6 +203,10 @@ void PrecipitateDissolutionModeling::setReferenceTime(double newReferenceTime)
 void PrecipitateDissolutionModeling::set_Minkowski_parameter(double newMinkowskiParameter)
 {
    Minkowski_parameter = newMinkowskiParameter;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -183,6 +215,10 @@ void PrecipitateDissolutionModeling::set_Minkowski_parameter(double newMinkowski
 void PrecipitateDissolutionModeling::setMinkowskiErrorWeight(double newMinkowskiErrorWeight)
 {
    minkowskiErrorWeight = newMinkowskiErrorWeight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -191,6 +227,10 @@ void PrecipitateDissolutionModeling::setMinkowskiErrorWeight(double newMinkowski
 void PrecipitateDissolutionModeling::setRegularizationWeight(double newRegularizationWeight)
 {
    regularizationWeight = newRegularizationWeight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -280,6 +320,10 @@ void PrecipitateDissolutionModeling::loadVickersHardnessTest(const char* filenam
    vickersHardnessData = newVickersHardnessData;
 
    file.close();
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -72,6 +72,10 @@ public:
    
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Evaluation methods
 
    // Get methods
@@ -45,6 +45,18 @@ RastriginFunction::~RastriginFunction(void)
 // METHODS
 
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* RastriginFunction::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   RastriginFunction* Rastrigin_function_pointer = new RastriginFunction(*this);
+
+   Rastrigin_function_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(Rastrigin_function_pointer);
+}
+
+
 // int get_variables_number(void) method
 
 int RastriginFunction::get_variables_number(void)
@@ -58,6 +70,10 @@ int RastriginFunction::get_variables_number(void)
 void RastriginFunction::set_variables_number(int new_variables_number)
 {
    variables_number = new_variables_number;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -43,6 +43,18 @@ RosenbrockFunction::~RosenbrockFunction(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* RosenbrockFunction::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   RosenbrockFunction* Rosenbrock_function_pointer = new RosenbrockFunction(*this);
+
+   Rosenbrock_function_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(Rosenbrock_function_pointer);
+}
+
+
 // int get_variables_number(void) method
 
 int RosenbrockFunction::get_variables_number(void)
@@ -56,6 +68,10 @@ int RosenbrockFunction::get_variables_number(void)
 void RosenbrockFunction::set_variables_number(int new_variables_number)
 {
    variables_number = new_variables_number;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
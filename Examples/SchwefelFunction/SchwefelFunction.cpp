@@ -44,6 +44,18 @@ SchwefelFunction::~SchwefelFunction(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* SchwefelFunction::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   SchwefelFunction* Schwefel_function_pointer = new SchwefelFunction(*this);
+
+   Schwefel_function_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(Schwefel_function_pointer);
+}
+
+
 // int get_variables_number(void) method
 
 int SchwefelFunction::get_variables_number(void)
@@ -79,6 +91,10 @@ void SchwefelFunction::set_variables_number(int new_variables_number)
 
    multilayer_perceptron_pointer->initialize_independent_parameters_uniform(minimum, maximum);
 
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -40,6 +40,18 @@ SixHumpCamelBackFunction::~SixHumpCamelBackFunction(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* SixHumpCamelBackFunction::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   SixHumpCamelBackFunction* six_hump_camel_back_function_pointer = new SixHumpCamelBackFunction(*this);
+
+   six_hump_camel_back_function_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(six_hump_camel_back_function_pointer);
+}
+
+
 // double calculate_objective(void) method
 
 double SixHumpCamelBackFunction::calculate_objective(void)
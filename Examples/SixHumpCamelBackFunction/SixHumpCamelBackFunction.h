@@ -44,6 +44,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Objective methods
 
    double calculate_objective(void);
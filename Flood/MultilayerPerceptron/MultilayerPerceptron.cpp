@@ -45,6 +45,8 @@ namespace Flood
 MultilayerPerceptron::MultilayerPerceptron
 (int new_inputs_number, const Vector<int>& new_hidden_layers_size, int new_outputs_number)
 {
+   version = 0;
+
    // Set network architecture
 
    set_network_architecture(new_inputs_number, new_hidden_layers_size, new_outputs_number);
@@ -77,6 +79,8 @@ MultilayerPerceptron::MultilayerPerceptron
 
 MultilayerPerceptron::MultilayerPerceptron(int new_inputs_number, int new_hidden_layer_size, int new_outputs_number)
 {
+   version = 0;
+
    // Set network architecture
   
    Vector<int> new_hidden_layers_size(1, new_hidden_layer_size);
@@ -105,6 +109,8 @@ MultilayerPerceptron::MultilayerPerceptron(int new_inputs_number, int new_hidden
 
 MultilayerPerceptron::MultilayerPerceptron(int new_independent_parameters_number)
 {
+   version = 0;
+
    // Network architecture
 
    Vector<int> new_hidden_layers_size;
@@ -129,6 +135,8 @@ MultilayerPerceptron::MultilayerPerceptron(int new_independent_parameters_number
 
 MultilayerPerceptron::MultilayerPerceptron(const char* filename)
 {
+   version = 0;
+
    load(filename);
 }
 
@@ -140,6 +148,8 @@ MultilayerPerceptron::MultilayerPerceptron(const char* filename)
 
 MultilayerPerceptron::MultilayerPerceptron(void)
 {
+   version = 0;
+
    // Network architecture
 
    Vector<int> new_hidden_layers_size;
@@ -163,13 +173,16 @@ MultilayerPerceptron::MultilayerPerceptron(void)
 
 MultilayerPerceptron::MultilayerPerceptron(const MultilayerPerceptron& other_multilayer_perceptron)
 {
+   version = 0;
+
    // Network architecture 
 
    inputs_number = other_multilayer_perceptron.inputs_number;
    hidden_layers_size = other_multilayer_perceptron.hidden_layers_size;
    outputs_number = other_multilayer_perceptron.outputs_number; 
 
-   set_network_architecture(inputs_number, hidden_layers_size, outputs_number);
+   // The layers are copied, and not initialized at random first, so that copying does not change the state of the 
+   // random number generator
 
    hidden_layers_activation_function = other_multilayer_perceptron.hidden_layers_activation_function;
    output_layer_activation_function = other_multilayer_perceptron.output_layer_activation_function;
@@ -258,6 +271,17 @@ MultilayerPerceptron::~MultilayerPerceptron(void)
 }
 
 
+// MultilayerPerceptron* clone(void) method
+
+/// This method returns a new multilayer perceptron object of the same type as this one, with the same members.
+/// Derived classes must redefine this method, so that the copy is not sliced.
+
+MultilayerPerceptron* MultilayerPerceptron::clone(void)
+{
+   return(new MultilayerPerceptron(*this));
+}
+
+
 // ASSIGNMENT OPERATOR
 
 /// Assignment operator. It assigns to this object the members of an existing multilayer perceptron object.
@@ -267,6 +291,8 @@ MultilayerPerceptron& MultilayerPerceptron::operator = (const MultilayerPerceptr
 {
    if(this != &other_multilayer_perceptron) 
    {
+      version++;
+
       // Network architecture 
 
       inputs_number = other_multilayer_perceptron.inputs_number;
@@ -3188,6 +3214,31 @@ bool MultilayerPerceptron::get_display(void)
 }
 
 
+// int get_version(void) method
+
+/// This method returns the version of the multilayer perceptron, which is incremented every time that its 
+/// architecture, activation functions, scaling methods, variables statistics, bounds or any other member which 
+/// changes its outputs but the parameters is modified by this class. 
+/// Objects which cache quantities derived from the multilayer perceptron for some parameters can compare versions 
+/// to know when to recompute them.
+
+int MultilayerPerceptron::get_version(void)
+{
+   return(version);
+}
+
+
+// void update_version(void) method
+
+/// This method increments the version of the multilayer perceptron. 
+/// It must be called after modifying any member through the references returned by the get methods.
+
+void MultilayerPerceptron::update_version(void)
+{
+   version++;
+}
+
+
 // void set(void) method
 
 void MultilayerPerceptron::set(void)
@@ -3198,6 +3249,8 @@ void MultilayerPerceptron::set(void)
    set_independent_parameters_number(0);
 
    set_default();
+
+   version++;
 }
 
 
@@ -3210,6 +3263,8 @@ void MultilayerPerceptron::set(int new_inputs_number, const Vector<int>& new_hid
    set_independent_parameters_number(0);
 
    set_default();
+
+   version++;
 }
 
 
@@ -3224,6 +3279,8 @@ void MultilayerPerceptron::set(int new_inputs_number, int new_hidden_layer_size,
    set_independent_parameters_number(0);
 
    set_default();
+
+   version++;
 }
 
 
@@ -3237,6 +3294,8 @@ void MultilayerPerceptron::set(int new_independent_parameters_number)
    set_independent_parameters_number(new_independent_parameters_number);
 
    set_default();
+
+   version++;
 }
 
 
@@ -3275,6 +3334,8 @@ void MultilayerPerceptron::set_default(void)
    
    display = true;
    display_range_out_warning = false;
+
+   version++;
 }
 
 
@@ -3379,6 +3440,8 @@ void MultilayerPerceptron::set_network_architecture
    set_hidden_layers_activation_function(new_hidden_layers_activation_function);
 
    set_output_layer_activation_function(Linear);
+
+   version++;
 }
 
 
@@ -3397,6 +3460,8 @@ void MultilayerPerceptron::set_network_architecture
    Vector<int> new_hidden_layers_size(1, new_hidden_layer_size);
 
    set_network_architecture(new_inputs_number, new_hidden_layers_size, new_outputs_number);
+
+   version++;
 }
 
 
@@ -3413,6 +3478,8 @@ void MultilayerPerceptron::set_hidden_layers_size(const Vector<int>& new_hidden_
    // Set new architecture      
 
    set_network_architecture(inputs_number, new_hidden_layers_size, outputs_number);
+
+   version++;
 }
 
 
@@ -3428,6 +3495,8 @@ void MultilayerPerceptron::set_hidden_layer_size(int new_hidden_layer_size)
    Vector<int> new_hidden_layers_size(1, new_hidden_layer_size);
 
    set_network_architecture(inputs_number, hidden_layers_size, outputs_number);
+
+   version++;
 }
 
 
@@ -3893,6 +3962,8 @@ void MultilayerPerceptron::set_hidden_layers_activation_function
    {
       set_hidden_layer_activation_function(i, new_hidden_layers_activation_function[i]);
    }
+
+   version++;
 }
 
 
@@ -3955,6 +4026,8 @@ void MultilayerPerceptron::set_hidden_layer_activation_function
       }          
       break;
    }
+
+   version++;
 }
 
 
@@ -4016,6 +4089,8 @@ void MultilayerPerceptron::set_output_layer_activation_function
       }
       break;
    }
+
+   version++;
 }
 
 
@@ -4030,6 +4105,8 @@ set_hidden_layers_activation_function(const Vector<std::string>& new_hidden_laye
    {
       set_hidden_layer_activation_function(i, new_hidden_layers_activation_function[i]);
    }
+
+   version++;
 }
 
 
@@ -4065,6 +4142,8 @@ void MultilayerPerceptron::set_hidden_layer_activation_function(int hidden_layer
    
       exit(1);   
    }
+
+   version++;
 }
 
 
@@ -4100,6 +4179,8 @@ void MultilayerPerceptron::set_output_layer_activation_function(const std::strin
    
       exit(1);   
    }
+
+   version++;
 }
 
 
@@ -4113,6 +4194,8 @@ void MultilayerPerceptron::set_inputs_scaling_method
 (const MultilayerPerceptron::ScalingMethod& new_inputs_scaling_method)
 {
    inputs_scaling_method = new_inputs_scaling_method;   
+
+   version++;
 }
 
 
@@ -4126,6 +4209,8 @@ void MultilayerPerceptron::set_outputs_unscaling_method
 (const MultilayerPerceptron::ScalingMethod& new_outputs_unscaling_method)
 {
    outputs_unscaling_method = new_outputs_unscaling_method;
+
+   version++;
 }
 
 
@@ -4135,6 +4220,8 @@ void MultilayerPerceptron::set_variables_scaling_method(const ScalingMethod& new
 {
    inputs_scaling_method = new_variables_scaling_method;   
    outputs_unscaling_method = new_variables_scaling_method;
+
+   version++;
 }
 
 
@@ -4162,6 +4249,8 @@ void MultilayerPerceptron::set_inputs_scaling_method(const std::string& new_inpu
 
       exit(1);   
    }
+
+   version++;
 }
 
 
@@ -4189,6 +4278,8 @@ void MultilayerPerceptron::set_outputs_unscaling_method(const std::string& new_o
 
       exit(1);   
    }
+
+   version++;
 }
 
 
@@ -4713,6 +4804,8 @@ void MultilayerPerceptron::set_input_variables_mean(const Vector<double>& new_in
    // Set mean of input variables
 
    input_variables_mean = new_input_variables_mean;
+
+   version++;
 }
 
 
@@ -4753,6 +4846,8 @@ void MultilayerPerceptron::set_input_variable_mean(int input_variable_index, dou
    // Set mean of single input variable
 
    input_variables_mean[input_variable_index] = new_input_variable_mean;
+
+   version++;
 }
 
 
@@ -4784,6 +4879,8 @@ void MultilayerPerceptron::set_output_variables_mean(const Vector<double>& new_o
    // Set mean of output variables
 
    output_variables_mean = new_output_variables_mean;
+
+   version++;
 }
 
 
@@ -4823,6 +4920,8 @@ void MultilayerPerceptron::set_output_variable_mean(int output_variable_index, d
    // Set mean of single output variable
 
    output_variables_mean[output_variable_index] = new_output_variable_mean;
+
+   version++;
 }
 
 
@@ -4856,6 +4955,8 @@ void MultilayerPerceptron
    // Set standard deviation of input variables
 
    input_variables_standard_deviation = new_input_variables_standard_deviation;
+
+   version++;
 }
 
 
@@ -4897,6 +4998,8 @@ void MultilayerPerceptron
    // Set standard deviation of single input variable
 
    input_variables_standard_deviation[input_variable_index] = new_input_variable_standard_deviation;
+
+   version++;
 }
 
 
@@ -4930,6 +5033,8 @@ void MultilayerPerceptron
    // Set standard deviation of output variables
 
    output_variables_standard_deviation = new_output_variables_standard_deviation;
+
+   version++;
 }
 
 
@@ -4970,6 +5075,8 @@ void MultilayerPerceptron
    // Set standard deviation of single output variable
 
    output_variables_standard_deviation[output_variable_index] = new_output_variable_standard_deviation;
+
+   version++;
 }
 
 
@@ -5031,6 +5138,8 @@ void MultilayerPerceptron::set_input_variables_mean_standard_deviation
 
    input_variables_mean = new_input_variables_mean_standard_deviation[0];
    input_variables_standard_deviation = new_input_variables_mean_standard_deviation[1];
+
+   version++;
 }
 
 
@@ -5077,6 +5186,8 @@ void MultilayerPerceptron::set_output_variables_mean_standard_deviation
 
    output_variables_mean = new_output_variables_mean_standard_deviation[0];   
    output_variables_standard_deviation = new_output_variables_mean_standard_deviation[1];
+
+   version++;
 }
 
 
@@ -5107,6 +5218,8 @@ void MultilayerPerceptron::set_input_variables_minimum(const Vector<double>& new
    // Set minimum of input variables
 
    input_variables_minimum = new_input_variables_minimum;
+
+   version++;
 }
 
 
@@ -5144,6 +5257,8 @@ void MultilayerPerceptron::set_input_variable_minimum(int input_variable_index,
    // Set minimum of single input variable
 
    input_variables_minimum[input_variable_index] = new_input_variable_minimum;
+
+   version++;
 }
 
 
@@ -5175,6 +5290,8 @@ void MultilayerPerceptron::set_output_variables_minimum(const Vector<double>& ne
    // Set minimum of output variables
 
    output_variables_minimum = new_output_variables_minimum;
+
+   version++;
 }
 
 
@@ -5213,6 +5330,8 @@ void MultilayerPerceptron::set_output_variable_minimum(int output_variable_index
    // Set minimum of single output variable
 
    output_variables_minimum[output_variable_index] = new_output_variable_minimum;
+
+   version++;
 }
 
 
@@ -5243,6 +5362,8 @@ void MultilayerPerceptron::set_input_variables_maximum(const Vector<double>& new
    // Set maximum of input variables
 
    input_variables_maximum = new_input_variables_maximum;
+
+   version++;
 }
 
 
@@ -5280,6 +5401,8 @@ void MultilayerPerceptron::set_input_variable_maximum(int input_variable_index,
    // Set maximum of single input variable
 
    input_variables_maximum[input_variable_index] = new_input_variable_maximum;
+
+   version++;
 }
 
 
@@ -5311,6 +5434,8 @@ void MultilayerPerceptron::set_output_variables_maximum(const Vector<double>& ne
    // Set maximum of output variables
 
    output_variables_maximum = new_output_variables_maximum;
+
+   version++;
 }
 
 
@@ -5348,6 +5473,8 @@ void MultilayerPerceptron::set_output_variable_maximum(int output_variable_index
    // Set maximum of single output variable
 
    output_variables_maximum[output_variable_index] = new_output_variable_maximum;
+
+   version++;
 }
 
 
@@ -5408,6 +5535,8 @@ void MultilayerPerceptron
 
    input_variables_minimum = new_input_variables_minimum_maximum[0];
    input_variables_maximum = new_input_variables_minimum_maximum[1];
+
+   version++;
 }
 
 
@@ -5468,6 +5597,8 @@ void MultilayerPerceptron
 
    output_variables_minimum = new_output_variables_minimum_maximum[0];
    output_variables_maximum = new_output_variables_minimum_maximum[0];
+
+   version++;
 }
 
 
@@ -5498,6 +5629,8 @@ void MultilayerPerceptron::set_output_variables_lower_bound(const Vector<double>
    // Set lower bound of output variables
 
    output_variables_lower_bound = new_output_variables_lower_bound;
+
+   version++;
 }
 
 
@@ -5536,6 +5669,8 @@ void MultilayerPerceptron
    // Set lower bound of single output variable
 
    output_variables_lower_bound[output_variable_index] = new_output_variable_lower_bound;
+
+   version++;
 }
 
 
@@ -5566,6 +5701,8 @@ void MultilayerPerceptron::set_output_variables_upper_bound(const Vector<double>
    // Set upper bound of output variables
 
    output_variables_upper_bound = new_output_variables_upper_bound;
+
+   version++;
 }
 
 
@@ -5604,6 +5741,8 @@ void MultilayerPerceptron
    // Set upper bound of single output variable
 
    output_variables_upper_bound[output_variable_index] = new_output_variable_upper_bound;
+
+   version++;
 }
 
 
@@ -5652,6 +5791,8 @@ void MultilayerPerceptron
 
    output_variables_lower_bound = new_output_variables_bounds[0];
    output_variables_upper_bound = new_output_variables_bounds[1];
+
+   version++;
 }
 
 
@@ -5731,6 +5872,8 @@ void MultilayerPerceptron::set_variables_statistics(const Vector< Vector<double>
    set_output_variables_standard_deviation(new_variables_statistics[5]);
    set_output_variables_minimum(new_variables_statistics[6]);
    set_output_variables_maximum(new_variables_statistics[7]);
+
+   version++;
 }
  
 
@@ -5745,6 +5888,8 @@ void MultilayerPerceptron::set_numerical_differentiation_method
 (const MultilayerPerceptron::NumericalDifferentiationMethod& new_numerical_differentiation_method)
 {
    numerical_differentiation_method = new_numerical_differentiation_method;
+
+   version++;
 }
 
 
@@ -5768,6 +5913,8 @@ void MultilayerPerceptron::set_numerical_differentiation_method(const std::strin
 
 	  exit(1);   
    }	
+
+   version++;
 }
 
 
@@ -5777,6 +5924,8 @@ void MultilayerPerceptron::set_numerical_epsilon_method
 (const MultilayerPerceptron::NumericalEpsilonMethod& new_numerical_epsilon_method)
 {
    numerical_epsilon_method = new_numerical_epsilon_method;
+
+   version++;
 }
 
 
@@ -5800,6 +5949,8 @@ void MultilayerPerceptron::set_numerical_epsilon_method(const std::string& new_n
 
       exit(1);   
    }	
+
+   version++;
 }
 
 
@@ -5830,6 +5981,8 @@ void MultilayerPerceptron::set_numerical_epsilon(double new_numerical_epsilon)
    // Set numerical epsilon
 
    numerical_epsilon = new_numerical_epsilon;
+
+   version++;
 }
 
 
@@ -5869,6 +6022,8 @@ void MultilayerPerceptron::set_independent_parameters_number(int new_independent
    // Bound independent parameters
 
    bound_independent_parameters();
+
+   version++;
 }
 
 
@@ -5954,6 +6109,8 @@ void MultilayerPerceptron::set_independent_parameters_scaling_method
 (const MultilayerPerceptron::ScalingMethod& new_independent_parameters_scaling_method)
 {
    independent_parameters_scaling_method = new_independent_parameters_scaling_method;   
+
+   version++;
 }
 
 
@@ -5982,6 +6139,8 @@ void MultilayerPerceptron::set_independent_parameters_scaling_method
 
        exit(1);   
     }
+
+   version++;
 }
 
 
@@ -6235,6 +6394,8 @@ void MultilayerPerceptron::set_independent_parameters_mean(const Vector<double>&
    // Set mean of independent parameters
 
    independent_parameters_mean = new_independent_parameters_mean;                                                   
+
+   version++;
 }
 
 
@@ -6280,6 +6441,8 @@ void MultilayerPerceptron
    // Set mean of single independent parameter
 
    independent_parameters_mean[independent_parameter_index] = new_independent_parameter_mean;
+
+   version++;
 }
 
 
@@ -6315,6 +6478,8 @@ void MultilayerPerceptron
    // Set standard deviation of independent parameters
 
    independent_parameters_standard_deviation = new_independent_parameters_standard_deviation;  
+
+   version++;
 }
 
 
@@ -6361,6 +6526,8 @@ void MultilayerPerceptron::set_independent_parameter_standard_deviation
    // Set standard deviation of single independent parameter
 
    independent_parameters_standard_deviation[independent_parameter_index] = new_independent_parameter_standard_deviation;
+
+   version++;
 }
 
 
@@ -6428,6 +6595,8 @@ void MultilayerPerceptron::set_independent_parameters_mean_standard_deviation
 
    independent_parameters_mean = new_independent_parameters_mean_standard_deviation[0];
    independent_parameters_standard_deviation = new_independent_parameters_mean_standard_deviation[1];
+
+   version++;
 }
 
 
@@ -6462,6 +6631,8 @@ void MultilayerPerceptron::set_independent_parameters_minimum(const Vector<doubl
    // Set minimum of independent parameters
 
    independent_parameters_minimum = new_independent_parameters_minimum;                                                   
+
+   version++;
 }
 
 
@@ -6503,6 +6674,8 @@ void MultilayerPerceptron
    // Set minimum of single independent parameter
 
    independent_parameters_minimum[independent_parameter_index] = new_independent_parameter_minimum;
+
+   version++;
 }
 
 
@@ -6538,6 +6711,8 @@ void MultilayerPerceptron::set_independent_parameters_maximum(const Vector<doubl
    // Set maximum of independent parameters
 
    independent_parameters_maximum = new_independent_parameters_maximum;  
+
+   version++;
 }
 
 
@@ -6580,6 +6755,8 @@ void MultilayerPerceptron::set_independent_parameter_maximum(int independent_par
    // Set maximum of single independent parameter
 
    independent_parameters_maximum[independent_parameter_index] = new_independent_parameter_maximum;
+
+   version++;
 }
 
 
@@ -6643,6 +6820,8 @@ void MultilayerPerceptron
 
    independent_parameters_minimum = new_independent_parameters_minimum_maximum[0];
    independent_parameters_maximum = new_independent_parameters_minimum_maximum[1];
+
+   version++;
 }
 
 
@@ -6678,6 +6857,8 @@ void MultilayerPerceptron
    // Set lower bound of independent parameters
 
    independent_parameters_lower_bound = new_independent_parameters_lower_bound; 
+
+   version++;
 }
 
 
@@ -6721,6 +6902,8 @@ void MultilayerPerceptron
    // Set lower bound of single independent parameter
 
    independent_parameters_lower_bound[independent_parameter_index] = new_independent_parameter_lower_bound;
+
+   version++;
 }
 
 
@@ -6756,6 +6939,8 @@ void MultilayerPerceptron
    // Set upper bound of independent parameters
 
    independent_parameters_upper_bound = new_independent_parameters_upper_bound;
+
+   version++;
 }
 
 
@@ -6798,6 +6983,8 @@ void MultilayerPerceptron::set_independent_parameter_upper_bound
    // Set upper bound of single independent parameter
 
    independent_parameters_upper_bound[independent_parameter_index] = new_independent_parameter_upper_bound;
+
+   version++;
 }
 
 
@@ -6848,6 +7035,8 @@ void MultilayerPerceptron::set_independent_parameters_bounds
 
    independent_parameters_lower_bound = new_independent_parameters_bounds[0];
    independent_parameters_upper_bound = new_independent_parameters_bounds[1];
+
+   version++;
 }
 
 
@@ -6890,6 +7079,8 @@ void MultilayerPerceptron
 
    set_independent_parameters_minimum(new_independent_parameters_statistics[2]);
    set_independent_parameters_maximum(new_independent_parameters_statistics[3]);
+
+   version++;
 }
 
 
@@ -6970,6 +7161,8 @@ void MultilayerPerceptron::set_scaling_method
    inputs_scaling_method = new_scaling_method;   
    outputs_unscaling_method = new_scaling_method;
    independent_parameters_scaling_method = new_scaling_method;   
+
+   version++;
 }
 
 
@@ -8328,6 +8521,64 @@ Vector<double> MultilayerPerceptron::calculate_bounded_output(const Vector<doubl
 }  
 
 
+// Vector<double> calculate_unscaled_output_derivative(void) method
+
+/// This method returns the derivatives of the unscaled outputs with respect to the scaled outputs. 
+/// Since the unscaling of the outputs is a linear transformation, these derivatives do not depend on the outputs. 
+
+Vector<double> MultilayerPerceptron::calculate_unscaled_output_derivative(void)
+{
+   Vector<double> unscaled_output_derivative(outputs_number, 1.0);
+
+   switch(outputs_unscaling_method)
+   {
+      case None:
+      {
+         return(unscaled_output_derivative);
+      }
+      break;
+
+      case MeanStandardDeviation:
+      {
+         for(int i = 0; i < outputs_number; i++)
+         {
+            if(output_variables_standard_deviation[i] >= 1e-99)
+            {
+               unscaled_output_derivative[i] = output_variables_standard_deviation[i];
+            }
+         }
+
+         return(unscaled_output_derivative);
+      }
+      break;
+
+      case MinimumMaximum:
+      {
+         for(int i = 0; i < outputs_number; i++)
+         {
+            if(output_variables_maximum[i]-output_variables_minimum[i] >= 1e-99)
+            {
+               unscaled_output_derivative[i] = 0.5*(output_variables_maximum[i]-output_variables_minimum[i]);
+            }
+         }
+
+         return(unscaled_output_derivative);
+      }
+      break;
+
+      default:
+      {
+         std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                   << "Vector<double> calculate_unscaled_output_derivative(void) method." << std::endl
+                   << "Unknown outputs unscaling method." << std::endl;
+ 
+         exit(1);
+      }
+      break;
+   }
+}
+
+
 // Vector<double> calculate_output(const Vector<double>&) method
 
 /// This method calculates the output vector from the neural network in response to an input vector, when no 
@@ -9119,6 +9370,360 @@ Matrix<double> MultilayerPerceptron::calculate_sensitivity_numerical_differentia
 
 
 
+// Vector<double> calculate_neural_parameters_gradient(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&) method
+
+/// This method returns the gradient, with respect to the neural parameters, of an error term which depends on the 
+/// outputs from the neural network for a single input. 
+/// It is computed with the back-propagation algorithm. 
+/// The bounding of the outputs is not taken into account. 
+/// @param scaled_input Scaled input to the neural network. 
+/// @param forward_propagation_derivative Forward propagation values and derivatives for the scaled input, 
+/// as returned by the calculate_forward_propagation_derivative(const Vector<double>&) method. 
+/// @param output_gradient Derivatives of the error term with respect to the unscaled outputs. 
+
+Vector<double> MultilayerPerceptron::calculate_neural_parameters_gradient
+(const Vector<double>& scaled_input, const Vector< Vector<double> >& forward_propagation_derivative, const Vector<double>& output_gradient)
+{
+   int hidden_layers_number = get_hidden_layers_number();
+
+   int neural_parameters_number = get_neural_parameters_number();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(scaled_input.get_size() != inputs_number)
+   {
+      std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                << "Vector<double> calculate_neural_parameters_gradient(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&) method." << std::endl
+                << "Size of scaled input must be equal to number of inputs." << std::endl;
+
+      exit(1);
+   }
+   else if(forward_propagation_derivative.get_size() != 2*hidden_layers_number+2)
+   {
+      std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                << "Vector<double> calculate_neural_parameters_gradient(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&) method." << std::endl
+                << "Size of forward propagation derivative must be equal to 2*hidden_layers_number+2." << std::endl;
+
+      exit(1);
+   }
+   else if(output_gradient.get_size() != outputs_number)
+   {
+      std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                << "Vector<double> calculate_neural_parameters_gradient(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&) method." << std::endl
+                << "Size of output gradient must be equal to number of outputs." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // The hidden layers and the output layer are processed together, the output layer being the last one
+
+   int layers_number = hidden_layers_number + 1;
+
+   Vector<int> layers_size(layers_number);
+   Vector<int> layers_position(layers_number);
+
+   int position = 0;
+
+   for(int l = 0; l < layers_number; l++)
+   {
+      layers_size[l] = (l < hidden_layers_number) ? hidden_layers_size[l] : outputs_number;
+
+      layers_position[l] = position;
+
+      Vector<Perceptron>& layer = (l < hidden_layers_number) ? hidden_layers[l] : output_layer;
+
+      position += layers_size[l]*(layer[0].get_inputs_number()+1);
+   }
+
+   // Output layer errors
+
+   Vector<double> unscaled_output_derivative = calculate_unscaled_output_derivative();
+
+   Vector< Vector<double> > layers_error(layers_number);
+
+   layers_error[layers_number-1] = forward_propagation_derivative[2*layers_number-1]*unscaled_output_derivative*output_gradient;
+
+   // Hidden layers errors
+
+   for(int l = layers_number-2; l >= 0; l--)
+   {
+      Vector<Perceptron>& next_layer = (l+1 < hidden_layers_number) ? hidden_layers[l+1] : output_layer;
+
+      Vector<double> back_propagation(layers_size[l], 0.0);
+
+      for(int k = 0; k < layers_size[l+1]; k++)
+      {
+         Vector<double>& synaptic_weights = next_layer[k].get_synaptic_weights();
+
+         for(int j = 0; j < layers_size[l]; j++)
+         {
+            back_propagation[j] += synaptic_weights[j]*layers_error[l+1][k];
+         }
+      }
+
+      layers_error[l] = forward_propagation_derivative[2*l+1]*back_propagation;
+   }
+
+   // Gradient
+
+   Vector<double> gradient(neural_parameters_number);
+
+   for(int l = 0; l < layers_number; l++)
+   {
+      const Vector<double>& layer_input = (l == 0) ? scaled_input : forward_propagation_derivative[2*(l-1)];
+
+      int layer_inputs_number = layer_input.get_size();
+
+      for(int j = 0; j < layers_size[l]; j++)
+      {
+         int index = layers_position[l] + j*(layer_inputs_number+1);
+
+         gradient[index] = layers_error[l][j];
+
+         for(int i = 0; i < layer_inputs_number; i++)
+         {
+            gradient[index+1+i] = layers_error[l][j]*layer_input[i];
+         }
+      }
+   }
+
+   return(gradient);
+}
+
+
+// Vector<double> calculate_neural_parameters_vector_dot_Hessian(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&, const Vector<double>&, const Vector<double>&) method
+
+/// This method returns the product of a vector with the Hessian matrix, with respect to the neural parameters, of an 
+/// error term which depends on the outputs from the neural network for a single input. 
+/// It implements the R-operator technique, which propagates the directional derivatives of the forward propagation 
+/// values and of the back-propagation errors along the given vector. 
+/// The cost is about that of one extra gradient evaluation, and the result is exact. 
+/// The error term must be a sum of functions of the individual outputs, so that its second derivatives with respect 
+/// to the outputs form a diagonal matrix. 
+/// The bounding of the outputs is not taken into account. 
+/// @param scaled_input Scaled input to the neural network. 
+/// @param forward_propagation_second_derivative Forward propagation values and derivatives for the scaled input, 
+/// as returned by the calculate_forward_propagation_second_derivative(const Vector<double>&) method. 
+/// @param output_gradient Derivatives of the error term with respect to the unscaled outputs. 
+/// @param output_second_derivative Second derivatives of the error term with respect to the unscaled outputs. 
+/// @param vector Vector in the dot product, of size the number of neural parameters. 
+
+Vector<double> MultilayerPerceptron::calculate_neural_parameters_vector_dot_Hessian
+(const Vector<double>& scaled_input, const Vector< Vector<double> >& forward_propagation_second_derivative, 
+const Vector<double>& output_gradient, const Vector<double>& output_second_derivative, const Vector<double>& vector)
+{
+   int hidden_layers_number = get_hidden_layers_number();
+
+   int neural_parameters_number = get_neural_parameters_number();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(scaled_input.get_size() != inputs_number)
+   {
+      std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                << "Vector<double> calculate_neural_parameters_vector_dot_Hessian(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&, const Vector<double>&, const Vector<double>&) method." << std::endl
+                << "Size of scaled input must be equal to number of inputs." << std::endl;
+
+      exit(1);
+   }
+   else if(forward_propagation_second_derivative.get_size() != 3*hidden_layers_number+3)
+   {
+      std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                << "Vector<double> calculate_neural_parameters_vector_dot_Hessian(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&, const Vector<double>&, const Vector<double>&) method." << std::endl
+                << "Size of forward propagation second derivative must be equal to 3*hidden_layers_number+3." << std::endl;
+
+      exit(1);
+   }
+   else if(output_gradient.get_size() != outputs_number || output_second_derivative.get_size() != outputs_number)
+   {
+      std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                << "Vector<double> calculate_neural_parameters_vector_dot_Hessian(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&, const Vector<double>&, const Vector<double>&) method." << std::endl
+                << "Size of output gradient and output second derivative must be equal to number of outputs." << std::endl;
+
+      exit(1);
+   }
+   else if(vector.get_size() != neural_parameters_number)
+   {
+      std::cerr << "Flood Error: MultilayerPerceptron class." << std::endl
+                << "Vector<double> calculate_neural_parameters_vector_dot_Hessian(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&, const Vector<double>&, const Vector<double>&) method." << std::endl
+                << "Size of vector must be equal to number of neural parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // The hidden layers and the output layer are processed together, the output layer being the last one
+
+   int layers_number = hidden_layers_number + 1;
+
+   Vector<int> layers_size(layers_number);
+   Vector<int> layers_position(layers_number);
+
+   int position = 0;
+
+   for(int l = 0; l < layers_number; l++)
+   {
+      layers_size[l] = (l < hidden_layers_number) ? hidden_layers_size[l] : outputs_number;
+
+      layers_position[l] = position;
+
+      Vector<Perceptron>& layer = (l < hidden_layers_number) ? hidden_layers[l] : output_layer;
+
+      position += layers_size[l]*(layer[0].get_inputs_number()+1);
+   }
+
+   // Layers input, activation derivative and activation second derivative
+
+   Vector< Vector<double> > layers_input(layers_number);
+   Vector< Vector<double> > layers_activation_derivative(layers_number);
+   Vector< Vector<double> > layers_activation_second_derivative(layers_number);
+
+   layers_input[0] = scaled_input;
+
+   for(int l = 0; l < layers_number; l++)
+   {
+      if(l > 0)
+      {
+         layers_input[l] = forward_propagation_second_derivative[3*(l-1)];
+      }
+
+      layers_activation_derivative[l] = forward_propagation_second_derivative[3*l+1];
+      layers_activation_second_derivative[l] = forward_propagation_second_derivative[3*l+2];
+   }
+
+   // Forward pass of the R-operator
+
+   Vector< Vector<double> > layers_input_R(layers_number);
+   Vector< Vector<double> > layers_combination_R(layers_number);
+
+   layers_input_R[0].set(inputs_number, 0.0);
+
+   for(int l = 0; l < layers_number; l++)
+   {
+      Vector<Perceptron>& layer = (l < hidden_layers_number) ? hidden_layers[l] : output_layer;
+
+      int layer_inputs_number = layers_input[l].get_size();
+
+      layers_combination_R[l].set(layers_size[l]);
+
+      for(int j = 0; j < layers_size[l]; j++)
+      {
+         Vector<double>& synaptic_weights = layer[j].get_synaptic_weights();
+
+         int index = layers_position[l] + j*(layer_inputs_number+1);
+
+         double combination_R = vector[index];
+
+         for(int i = 0; i < layer_inputs_number; i++)
+         {
+            combination_R += vector[index+1+i]*layers_input[l][i] + synaptic_weights[i]*layers_input_R[l][i];
+         }
+
+         layers_combination_R[l][j] = combination_R;
+      }
+
+      if(l < hidden_layers_number)
+      {
+         layers_input_R[l+1] = layers_activation_derivative[l]*layers_combination_R[l];
+      }
+   }
+
+   // Output layer errors and their R-operator
+
+   Vector<double> unscaled_output_derivative = calculate_unscaled_output_derivative();
+
+   Vector< Vector<double> > layers_error(layers_number);
+   Vector< Vector<double> > layers_error_R(layers_number);
+
+   layers_error[layers_number-1].set(outputs_number);
+   layers_error_R[layers_number-1].set(outputs_number);
+
+   for(int k = 0; k < outputs_number; k++)
+   {
+      double scaled_output_gradient = unscaled_output_derivative[k]*output_gradient[k];
+
+      double output_R = unscaled_output_derivative[k]*layers_activation_derivative[layers_number-1][k]*layers_combination_R[layers_number-1][k];
+
+      double scaled_output_gradient_R = unscaled_output_derivative[k]*output_second_derivative[k]*output_R;
+
+      layers_error[layers_number-1][k] = layers_activation_derivative[layers_number-1][k]*scaled_output_gradient;
+
+      layers_error_R[layers_number-1][k] 
+      = layers_activation_second_derivative[layers_number-1][k]*layers_combination_R[layers_number-1][k]*scaled_output_gradient
+      + layers_activation_derivative[layers_number-1][k]*scaled_output_gradient_R;
+   }
+
+   // Backward pass of the R-operator
+
+   for(int l = layers_number-2; l >= 0; l--)
+   {
+      Vector<Perceptron>& next_layer = (l+1 < hidden_layers_number) ? hidden_layers[l+1] : output_layer;
+
+      int next_layer_inputs_number = layers_size[l];
+
+      layers_error[l].set(layers_size[l], 0.0);
+      layers_error_R[l].set(layers_size[l], 0.0);
+
+      Vector<double> back_propagation(layers_size[l], 0.0);
+      Vector<double> back_propagation_R(layers_size[l], 0.0);
+
+      for(int k = 0; k < layers_size[l+1]; k++)
+      {
+         Vector<double>& synaptic_weights = next_layer[k].get_synaptic_weights();
+
+         int index = layers_position[l+1] + k*(next_layer_inputs_number+1);
+
+         for(int j = 0; j < layers_size[l]; j++)
+         {
+            back_propagation[j] += synaptic_weights[j]*layers_error[l+1][k];
+
+            back_propagation_R[j] += vector[index+1+j]*layers_error[l+1][k] + synaptic_weights[j]*layers_error_R[l+1][k];
+         }
+      }
+
+      for(int j = 0; j < layers_size[l]; j++)
+      {
+         layers_error[l][j] = layers_activation_derivative[l][j]*back_propagation[j];
+
+         layers_error_R[l][j] 
+         = layers_activation_second_derivative[l][j]*layers_combination_R[l][j]*back_propagation[j]
+         + layers_activation_derivative[l][j]*back_propagation_R[j];
+      }
+   }
+
+   // Vector Hessian product
+
+   Vector<double> vector_Hessian_product(neural_parameters_number);
+
+   for(int l = 0; l < layers_number; l++)
+   {
+      int layer_inputs_number = layers_input[l].get_size();
+
+      for(int j = 0; j < layers_size[l]; j++)
+      {
+         int index = layers_position[l] + j*(layer_inputs_number+1);
+
+         vector_Hessian_product[index] = layers_error_R[l][j];
+
+         for(int i = 0; i < layer_inputs_number; i++)
+         {
+            vector_Hessian_product[index+1+i] 
+            = layers_error_R[l][j]*layers_input[l][i] + layers_error[l][j]*layers_input_R[l][i];
+         }
+      }
+   }
+
+   return(vector_Hessian_product);
+}
+
+
 // std::string to_XML(bool) method
 
 /// This method returns a string representation of this multilayer perceptron object. The format of the string is XML-type. 
@@ -10546,6 +11151,8 @@ void MultilayerPerceptron::load(const char* filename)
          }  
 	  }
    }
+
+   version++;
 }
 
 
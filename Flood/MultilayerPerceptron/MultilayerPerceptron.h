@@ -83,6 +83,10 @@ public:
 
    enum NumericalDifferentiationMethod{ForwardDifferences, CentralDifferences};
 
+   // CLONE METHODS
+
+   virtual MultilayerPerceptron* clone(void);
+
    // GET METHODS
 
    // Network architecture
@@ -328,6 +332,12 @@ public:
 
    double get_numerical_epsilon(void);
 
+   // Version methods
+
+   int get_version(void);
+
+   void update_version(void);
+
    // Display messages
 
    bool get_display_range_out_warning(void);
@@ -620,6 +630,8 @@ public:
    Vector<double> calculate_unscaled_output(const Vector<double>&);
    Vector<double> calculate_bounded_output(const Vector<double>&);
 
+   Vector<double> calculate_unscaled_output_derivative(void);
+
    // Jacobian matrix methods
 
    Matrix<double> calculate_Jacobian(const Vector<double>&);
@@ -643,6 +655,14 @@ public:
    Matrix<double> calculate_sensitivity_forward_differences(const Vector<double>&);
    Matrix<double> calculate_sensitivity_central_differences(const Vector<double>&);
 
+   // Back-propagation methods
+
+   Vector<double> calculate_neural_parameters_gradient(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&);
+
+   // Hessian methods
+
+   Vector<double> calculate_neural_parameters_vector_dot_Hessian(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&, const Vector<double>&, const Vector<double>&);
+
    // Independent parameters methods
 
    Vector<double> scale_independent_parameters(void);
@@ -987,6 +1007,10 @@ protected:
    /// Display messages to screen. 
 
    bool display;
+
+   /// Number of modifications of the multilayer perceptron other than of its parameters.
+
+   int version;
 };
 
 }
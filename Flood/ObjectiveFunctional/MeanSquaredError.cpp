@@ -96,6 +96,41 @@ MeanSquaredError::~MeanSquaredError(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+/// This method returns a new mean squared error object with the same members as this one, but associated to another
+/// multilayer perceptron.
+/// The input-target data set is referenced by both objects, not copied.
+/// @param new_multilayer_perceptron_pointer Pointer to a multilayer perceptron object.
+
+ObjectiveFunctional* MeanSquaredError::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   MeanSquaredError* mean_squared_error_pointer = new MeanSquaredError(*this);
+
+   mean_squared_error_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(mean_squared_error_pointer);
+}
+
+
+// int get_data_set_version(void) method
+
+/// This method returns the version of the input-target data set, or zero if there is no input-target data set 
+/// associated to the mean squared error object. 
+
+int MeanSquaredError::get_data_set_version(void)
+{
+   if(input_target_data_set_pointer == NULL)
+   {
+      return(0);
+   }
+   else
+   {
+      return(input_target_data_set_pointer->get_version());
+   }
+}
+
+
 // void set(void) method
 
 /// This method sets the multilayer perceptron and input-target data set object pointers to NULL. 
@@ -160,6 +195,10 @@ void MeanSquaredError::set(MultilayerPerceptron* new_multilayer_perceptron_point
 void MeanSquaredError::set_input_target_data_set_pointer(InputTargetDataSet* new_input_target_data_set_pointer)
 {
    input_target_data_set_pointer = new_input_target_data_set_pointer;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -167,8 +206,24 @@ void MeanSquaredError::set_input_target_data_set_pointer(InputTargetDataSet* new
 
 /// This method returns the objective value of a multilayer perceptron according to the mean squared error on 
 /// an input-target data set.
+/// It is calculated by the calculate_objective(double) method with no bound.
 
 double MeanSquaredError::calculate_objective(void)
+{
+   return(calculate_objective(std::numeric_limits<double>::max()));
+}
+
+
+// double calculate_objective(double) method
+
+/// This method returns the mean squared error of a multilayer perceptron on the training instances, as the 
+/// calculate_objective(void) method does. 
+/// The sum over the training instances stops as soon as it exceeds the given bound. 
+/// The mean squared error of the instances summed so far is then returned. 
+/// It is a lower bound of the objective greater than the bound. 
+/// @param objective_bound Objective value above which the exact objective is not needed. 
+
+double MeanSquaredError::calculate_objective(double objective_bound)
 {
    // Control sentence (if debug)
 
@@ -177,7 +232,7 @@ double MeanSquaredError::calculate_objective(void)
    if(multilayer_perceptron_pointer == NULL)
    {
       std::cerr << "Flood Error: MeanSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
 
         exit(1);
@@ -185,7 +240,7 @@ double MeanSquaredError::calculate_objective(void)
    else if(input_target_data_set_pointer == NULL)
    {
       std::cerr << "Flood Error: MeanSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to input-target data set object cannot be NULL." << std::endl;
 
       exit(1);
@@ -205,7 +260,7 @@ double MeanSquaredError::calculate_objective(void)
    if(inputs_number != input_variables_number)
    {
       std::cerr << "Flood Error: MeanSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Number of inputs in multilayer perceptron must be equal to " 
                 << "number of input variables in input-target data set." << std::endl;
 
@@ -217,7 +272,7 @@ double MeanSquaredError::calculate_objective(void)
    if(outputs_number != target_variables_number)
    {
       std::cerr << "Flood Error: MeanSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Number of outputs in multilayer perceptron must be equal to " 
                 << "number of target variables in input-target data set." << std::endl;
 
@@ -233,6 +288,8 @@ double MeanSquaredError::calculate_objective(void)
 
    double training_error = 0.0;
 
+   double training_error_bound = objective_bound*training_instances_number;
+
    for(int i = 0; i < training_instances_number; i++)
    {
       // Input vector
@@ -254,6 +311,13 @@ double MeanSquaredError::calculate_objective(void)
       // Sum of squares error
 
       training_error += instance_error.dot(instance_error);           
+
+      // Stop as soon as the objective is known to exceed the bound
+
+      if(training_error > training_error_bound)
+      {
+         break;
+      }
    }
 
    return(training_error/(double)training_instances_number);
@@ -439,6 +503,487 @@ Vector<double> MeanSquaredError::calculate_objective_gradient(void)
 }
 
 
+// int get_training_instances_number(void) method
+
+/// This method returns the number of training instances in the input-target data set, or zero if there is no 
+/// input-target data set associated to the mean squared error object.
+
+int MeanSquaredError::get_training_instances_number(void)
+{
+   if(input_target_data_set_pointer == NULL)
+   {
+      return(0);
+   }
+   else
+   {
+      return(input_target_data_set_pointer->get_training_instances_number());
+   }
+}
+
+
+// Vector<double> calculate_batch_objective_gradient(const Vector<int>&) method
+
+/// This method returns an unbiased estimate of the objective gradient computed by back-propagation on a 
+/// mini-batch of training instances. 
+/// The contributions of the instances in the mini-batch are scaled by the ratio between the number of training 
+/// instances and the mini-batch size. 
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+
+Vector<double> MeanSquaredError::calculate_batch_objective_gradient(const Vector<int>& training_instances_indices)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> batch_objective_gradient(parameters_number);
+
+   calculate_batch_objective_gradient(training_instances_indices, batch_objective_gradient);
+
+   return(batch_objective_gradient);
+}
+
+
+// void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method
+
+/// This method computes the same mini-batch estimate of the objective gradient as 
+/// calculate_batch_objective_gradient(const Vector<int>&), but writes it into a vector allocated by the caller, so 
+/// that the stochastic training algorithms can reuse it from one mini-batch to the next. 
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+/// @param batch_objective_gradient Objective gradient estimate. Its size must be the number of parameters. 
+
+void MeanSquaredError::calculate_batch_objective_gradient(const Vector<int>& training_instances_indices, Vector<double>& batch_objective_gradient)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+        exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(training_instances_indices.get_size() == 0)
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Size of mini-batch must be greater than zero." << std::endl;
+
+      exit(1);
+   }
+   else if(batch_objective_gradient.get_size() != multilayer_perceptron_pointer->get_parameters_number())
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Size of batch objective gradient must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   Vector<int> hidden_layers_size = multilayer_perceptron_pointer->get_hidden_layers_size();
+
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int forward_propagation_derivative_size = 2*hidden_layers_number + 2;
+
+   Vector< Vector<double> > forward_propagation_derivative(forward_propagation_derivative_size);
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   int batch_size = training_instances_indices.get_size();
+
+   int input_variables_number = input_target_data_set_pointer->get_input_variables_number();
+   int target_variables_number = input_target_data_set_pointer->get_target_variables_number();
+
+   Vector<double> training_input_instance(input_variables_number);
+   Vector<double> training_target_instance(target_variables_number);
+
+   // Output and hidden errors
+
+   Vector<double> output_errors(outputs_number);
+   Vector< Vector<double> > hidden_errors(hidden_layers_number);
+
+   for(int h = 0; h < hidden_layers_number; h++)
+   {
+      hidden_errors[h].set_size(hidden_layers_size[h]);
+   }
+
+   // Hidden and output layers gradients
+
+   int hidden_layers_parameters_number = multilayer_perceptron_pointer->get_hidden_layers_parameters_number();
+   int output_layer_parameters_number = multilayer_perceptron_pointer->get_output_layer_parameters_number();
+
+   Vector<double> hidden_layers_error_gradient(hidden_layers_parameters_number);
+   Vector<double> output_layer_error_gradient(output_layer_parameters_number);
+
+   batch_objective_gradient.initialize(0.0);
+
+   // Main loop
+
+   int index;
+
+   for(int i = 0; i < batch_size; i++)
+   {
+      index = training_instances_indices[i];
+
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(index);
+
+      forward_propagation_derivative = multilayer_perceptron_pointer->calculate_forward_propagation_derivative(training_input_instance);
+
+      training_target_instance = input_target_data_set_pointer->get_training_target_instance(index);
+
+      output_errors = calculate_output_errors(forward_propagation_derivative, training_target_instance);
+
+      hidden_errors = calculate_hidden_errors(forward_propagation_derivative, output_errors);
+
+      hidden_layers_error_gradient = calculate_hidden_layers_error_gradient(training_input_instance, forward_propagation_derivative, hidden_errors);
+  
+      output_layer_error_gradient = calculate_output_layer_error_gradient(forward_propagation_derivative, output_errors);
+
+      for(int j = 0; j < hidden_layers_parameters_number; j++)
+      {
+         batch_objective_gradient[j] += hidden_layers_error_gradient[j];
+      }
+
+      for(int j = 0; j < output_layer_parameters_number; j++)
+      {
+         batch_objective_gradient[hidden_layers_parameters_number+j] += output_layer_error_gradient[j];
+      }
+   }
+
+   batch_objective_gradient *= (double)training_instances_number/(double)batch_size;
+}
+
+
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) method
+
+/// This method returns the product of a vector with the Hessian matrix of the mean squared error functional. 
+/// It is computed exactly by means of the calculate_vectors_dot_Hessian(const Matrix<double>&) method. 
+/// @param vector Vector in the dot product. 
+
+Vector<double> MeanSquaredError::calculate_vector_dot_Hessian(const Vector<double>& vector)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Matrix<double> vectors(1, parameters_number);
+
+   vectors.set_row(0, vector);
+
+   return(calculate_vectors_dot_Hessian(vectors).get_row(0));
+}
+
+
+// Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method
+
+/// This method returns the products of a set of vectors with the Hessian matrix of the mean squared error functional, 
+/// including the regularization term. 
+/// The products are exact, and are computed with the R-operator technique of the multilayer perceptron. 
+/// The forward propagation for each training instance is shared between all the vectors. 
+/// @param vectors Matrix whose rows are the vectors in the dot products. 
+
+Matrix<double> MeanSquaredError::calculate_vectors_dot_Hessian(const Matrix<double>& vectors)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(vectors.get_columns_number() != multilayer_perceptron_pointer->get_parameters_number())
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Number of columns must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int neural_parameters_number = multilayer_perceptron_pointer->get_neural_parameters_number();
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   // Vectors restricted to the neural parameters
+
+   int vectors_number = vectors.get_rows_number();
+
+   Vector< Vector<double> > neural_parameters_vectors(vectors_number);
+   Vector< Vector<double> > neural_parameters_vectors_Hessian_product(vectors_number);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      neural_parameters_vectors[r].set(neural_parameters_number);
+
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         neural_parameters_vectors[r][j] = vectors[r][j];
+      }
+
+      neural_parameters_vectors_Hessian_product[r].set(neural_parameters_number, 0.0);
+   }
+
+   // Main loop
+
+   Vector<double> training_input_instance(inputs_number);
+   Vector<double> training_target_instance(outputs_number);
+
+   Vector<double> scaled_input(inputs_number);
+   Vector< Vector<double> > forward_propagation_second_derivative(3*hidden_layers_number+3);
+   Vector<double> output(outputs_number);
+
+   Vector<double> output_gradient(outputs_number);
+   Vector<double> output_second_derivative(outputs_number, 2.0/(double)training_instances_number);
+
+   for(int i = 0; i < training_instances_number; i++)
+   {
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(i);
+      training_target_instance = input_target_data_set_pointer->get_training_target_instance(i);
+
+      scaled_input = multilayer_perceptron_pointer->calculate_scaled_input(training_input_instance);
+
+      forward_propagation_second_derivative 
+      = multilayer_perceptron_pointer->calculate_forward_propagation_second_derivative(scaled_input);
+
+      output = multilayer_perceptron_pointer->calculate_unscaled_output(forward_propagation_second_derivative[3*hidden_layers_number]);
+
+      output_gradient = (output - training_target_instance)*(2.0/(double)training_instances_number);
+
+      for(int r = 0; r < vectors_number; r++)
+      {
+         neural_parameters_vectors_Hessian_product[r] += multilayer_perceptron_pointer->calculate_neural_parameters_vector_dot_Hessian
+         (scaled_input, forward_propagation_second_derivative, output_gradient, output_second_derivative, neural_parameters_vectors[r]);
+      }
+   }
+
+   // Objective and regularization terms
+
+   Matrix<double> vectors_Hessian_product(vectors_number, parameters_number, 0.0);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         vectors_Hessian_product[r][j] = objective_weight*neural_parameters_vectors_Hessian_product[r][j];
+      }
+
+      if(regularization_method != None)
+      {
+         Vector<double> regularization_vector_Hessian_product = calculate_regularization_vector_dot_Hessian(vectors.get_row(r));
+
+         for(int j = 0; j < parameters_number; j++)
+         {
+            vectors_Hessian_product[r][j] += regularization_weight*regularization_vector_Hessian_product[j];
+         }
+      }
+   }
+
+   return(vectors_Hessian_product);
+}
+
+
+// Matrix<double> calculate_Hessian(void) method
+
+/// This method returns the Hessian matrix of the mean squared error objective functional. 
+/// Depending on the Hessian approximation method, it is either the exact Hessian or the Gauss-Newton approximation. 
+/// The exact Hessian is computed column by column with the R-operator technique, sharing the forward propagation 
+/// of each training instance among all the columns. 
+
+Matrix<double> MeanSquaredError::calculate_Hessian(void)
+{
+   // Increment number of Hessians count
+
+   calculate_Hessian_count++;
+
+   switch(Hessian_approximation_method)
+   {
+      case ExactHessian:
+      {
+         int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+         Matrix<double> identity(parameters_number, parameters_number);
+         identity.set_to_identity();
+
+         return(calculate_vectors_dot_Hessian(identity));
+      }
+      break;
+
+      case GaussNewton:
+      {
+         return(calculate_Gauss_Newton_Hessian());
+      }
+      break;
+
+      default:
+      {
+         std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                   << "Matrix<double> calculate_Hessian(void) method." << std::endl
+                   << "Unknown Hessian approximation method." << std::endl;
+ 
+         exit(1);
+      }
+      break;
+   }
+}
+
+
+// Matrix<double> calculate_Gauss_Newton_Hessian(void) method
+
+/// This method returns the Gauss-Newton approximation to the Hessian matrix of the mean squared error objective functional. 
+/// It is the sum over the training instances of J'*J, times the second derivative of the error with respect to the 
+/// outputs, where J is the Jacobian of the outputs with respect to the neural parameters. 
+/// Each row of J is obtained by back-propagating a unit output error. 
+/// The regularization term is added with its exact Hessian. 
+
+Matrix<double> MeanSquaredError::calculate_Gauss_Newton_Hessian(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_Gauss_Newton_Hessian(void) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_Gauss_Newton_Hessian(void) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int neural_parameters_number = multilayer_perceptron_pointer->get_neural_parameters_number();
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   double output_second_derivative = 2.0/(double)training_instances_number;
+
+   // Main loop
+
+   Matrix<double> neural_parameters_Gauss_Newton_Hessian(neural_parameters_number, neural_parameters_number, 0.0);
+
+   Vector<double> training_input_instance(inputs_number);
+
+   Vector<double> scaled_input(inputs_number);
+   Vector< Vector<double> > forward_propagation_derivative(2*hidden_layers_number+2);
+
+   Vector<double> unit_output_error(outputs_number);
+   Vector<double> output_Jacobian_row(neural_parameters_number);
+
+   for(int i = 0; i < training_instances_number; i++)
+   {
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(i);
+
+      scaled_input = multilayer_perceptron_pointer->calculate_scaled_input(training_input_instance);
+
+      forward_propagation_derivative = multilayer_perceptron_pointer->calculate_forward_propagation_derivative(scaled_input);
+
+      for(int k = 0; k < outputs_number; k++)
+      {
+         unit_output_error.initialize(0.0);
+         unit_output_error[k] = 1.0;
+
+         output_Jacobian_row 
+         = multilayer_perceptron_pointer->calculate_neural_parameters_gradient(scaled_input, forward_propagation_derivative, unit_output_error);
+
+         for(int a = 0; a < neural_parameters_number; a++)
+         {
+            for(int b = 0; b <= a; b++)
+            {
+               neural_parameters_Gauss_Newton_Hessian[a][b] += output_Jacobian_row[a]*output_Jacobian_row[b];
+            }
+         }
+      }
+   }
+
+   // Objective and regularization terms
+
+   Matrix<double> Gauss_Newton_Hessian(parameters_number, parameters_number, 0.0);
+
+   for(int a = 0; a < neural_parameters_number; a++)
+   {
+      for(int b = 0; b <= a; b++)
+      {
+         Gauss_Newton_Hessian[a][b] = objective_weight*output_second_derivative*neural_parameters_Gauss_Newton_Hessian[a][b];
+         Gauss_Newton_Hessian[b][a] = Gauss_Newton_Hessian[a][b];
+      }
+   }
+
+   if(regularization_method != None)
+   {
+      Matrix<double> regularization_Hessian = calculate_regularization_Hessian();
+
+      for(int a = 0; a < parameters_number; a++)
+      {
+         for(int b = 0; b < parameters_number; b++)
+         {
+            Gauss_Newton_Hessian[a][b] += regularization_weight*regularization_Hessian[a][b];
+         }
+      }
+   }
+
+   return(Gauss_Newton_Hessian);
+}
+
+
 // Vector<double> calculate_output_errors(const Vector< Vector<double> >&, const Vector<double>&) method
 
 /// This method returns the output errors to be used in the back-propagation algorithm for calculating the objective gradient. 
@@ -24,6 +24,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <limits>
 #include <cmath>
 
 namespace Flood
@@ -116,6 +117,23 @@ MinkowskiError::~MinkowskiError(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+/// This method returns a new Minkowski error object with the same members as this one, but associated to another
+/// multilayer perceptron.
+/// The input-target data set is referenced by both objects, not copied.
+/// @param new_multilayer_perceptron_pointer Pointer to a multilayer perceptron object.
+
+ObjectiveFunctional* MinkowskiError::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   MinkowskiError* Minkowski_error_pointer = new MinkowskiError(*this);
+
+   Minkowski_error_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(Minkowski_error_pointer);
+}
+
+
 // double get_Minkowski_parameter(void) method
 
 /// This method returns the Minkowski exponent value used to calculate the error. 
@@ -126,6 +144,24 @@ double MinkowskiError::get_Minkowski_parameter(void)
 }
 
 
+// int get_data_set_version(void) method
+
+/// This method returns the version of the input-target data set, or zero if there is no input-target data set 
+/// associated to the Minkowski error object. 
+
+int MinkowskiError::get_data_set_version(void)
+{
+   if(input_target_data_set_pointer == NULL)
+   {
+      return(0);
+   }
+   else
+   {
+      return(input_target_data_set_pointer->get_version());
+   }
+}
+
+
 // void set(void) method
 
 /// This method sets a new multilayer perceptron pointer, and sets the input-target data set pointer to NULL. 
@@ -206,6 +242,10 @@ void MinkowskiError::set(MultilayerPerceptron* new_multilayer_perceptron_pointer
 void MinkowskiError::set_input_target_data_set_pointer(InputTargetDataSet* new_input_target_data_set_pointer)
 {
    input_target_data_set_pointer = new_input_target_data_set_pointer;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -232,6 +272,10 @@ void MinkowskiError::set_Minkowski_parameter(double new_Minkowski_parameter)
    // Set Minkowski parameter
   
    Minkowski_parameter = new_Minkowski_parameter;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -239,8 +283,24 @@ void MinkowskiError::set_Minkowski_parameter(double new_Minkowski_parameter)
 
 /// This method returns the objective functional value of a multilayer perceptron according to the Minkowski 
 /// error on the training instances of an input-target data set.
+/// It is calculated by the calculate_objective(double) method with no bound.
 
 double MinkowskiError::calculate_objective(void)
+{
+   return(calculate_objective(std::numeric_limits<double>::max()));
+}
+
+
+// double calculate_objective(double) method
+
+/// This method returns the Minkowski error of a multilayer perceptron on the training instances, as the 
+/// calculate_objective(void) method does. 
+/// The sum over the training instances stops as soon as it exceeds the given bound. 
+/// The Minkowski error of the instances summed so far is then returned. 
+/// It is a lower bound of the objective greater than the bound. 
+/// @param objective_bound Objective value above which the exact objective is not needed. 
+
+double MinkowskiError::calculate_objective(double objective_bound)
 {
    // Control sentence (if debug)
 
@@ -249,7 +309,7 @@ double MinkowskiError::calculate_objective(void)
    if(multilayer_perceptron_pointer == NULL)
    {
       std::cerr << "Flood Error: MinkowskiError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
 
         exit(1);
@@ -257,7 +317,7 @@ double MinkowskiError::calculate_objective(void)
    else if(input_target_data_set_pointer == NULL)
    {
       std::cerr << "Flood Error: MinkowskiError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to input-target data set object cannot be NULL." << std::endl;
 
       exit(1);
@@ -277,7 +337,7 @@ double MinkowskiError::calculate_objective(void)
    if(inputs_number != input_variables_number)
    {
       std::cerr << "Flood Error: MinkowskiError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Number of inputs in multilayer perceptron must be equal to " 
                 << "number of input variables in input-target data set." << std::endl;
 
@@ -289,7 +349,7 @@ double MinkowskiError::calculate_objective(void)
    if(outputs_number != target_variables_number)
    {
       std::cerr << "Flood Error: MinkowskiError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Number of outputs in multilayer perceptron must be equal to " 
                 << "number of target variables in input-target data set." << std::endl;
 
@@ -327,6 +387,13 @@ double MinkowskiError::calculate_objective(void)
            
          training_error += pow(instance_error, Minkowski_parameter);
       }
+
+      // Stop as soon as the objective is known to exceed the bound
+
+      if(training_error > objective_bound)
+      {
+         break;
+      }
    }
 
    return(training_error);
@@ -1014,6 +1081,175 @@ Vector<double> MinkowskiError::calculate_objective_gradient(void)
 }
 
 
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) method
+
+/// This method returns the product of a vector with the Hessian matrix of the Minkowski error functional. 
+/// It is computed exactly by means of the calculate_vectors_dot_Hessian(const Matrix<double>&) method. 
+/// @param vector Vector in the dot product. 
+
+Vector<double> MinkowskiError::calculate_vector_dot_Hessian(const Vector<double>& vector)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Matrix<double> vectors(1, parameters_number);
+
+   vectors.set_row(0, vector);
+
+   return(calculate_vectors_dot_Hessian(vectors).get_row(0));
+}
+
+
+// Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method
+
+/// This method returns the products of a set of vectors with the Hessian matrix of the Minkowski error functional, 
+/// including the regularization term. 
+/// The products are exact, and are computed with the R-operator technique of the multilayer perceptron. 
+/// For Minkowski parameters smaller than two the second derivatives are singular at zero errors, where they are 
+/// taken to be zero. 
+/// The forward propagation for each training instance is shared between all the vectors. 
+/// @param vectors Matrix whose rows are the vectors in the dot products. 
+
+Matrix<double> MinkowskiError::calculate_vectors_dot_Hessian(const Matrix<double>& vectors)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MinkowskiError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MinkowskiError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(vectors.get_columns_number() != multilayer_perceptron_pointer->get_parameters_number())
+   {
+      std::cerr << "Flood Error: MinkowskiError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Number of columns must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int neural_parameters_number = multilayer_perceptron_pointer->get_neural_parameters_number();
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   // Vectors restricted to the neural parameters
+
+   int vectors_number = vectors.get_rows_number();
+
+   Vector< Vector<double> > neural_parameters_vectors(vectors_number);
+   Vector< Vector<double> > neural_parameters_vectors_Hessian_product(vectors_number);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      neural_parameters_vectors[r].set(neural_parameters_number);
+
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         neural_parameters_vectors[r][j] = vectors[r][j];
+      }
+
+      neural_parameters_vectors_Hessian_product[r].set(neural_parameters_number, 0.0);
+   }
+
+   // Main loop
+
+   Vector<double> training_input_instance(inputs_number);
+   Vector<double> training_target_instance(outputs_number);
+
+   Vector<double> scaled_input(inputs_number);
+   Vector< Vector<double> > forward_propagation_second_derivative(3*hidden_layers_number+3);
+   Vector<double> output(outputs_number);
+
+   Vector<double> output_gradient(outputs_number);
+   Vector<double> output_second_derivative(outputs_number);
+
+   double error;
+
+   for(int i = 0; i < training_instances_number; i++)
+   {
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(i);
+      training_target_instance = input_target_data_set_pointer->get_training_target_instance(i);
+
+      scaled_input = multilayer_perceptron_pointer->calculate_scaled_input(training_input_instance);
+
+      forward_propagation_second_derivative 
+      = multilayer_perceptron_pointer->calculate_forward_propagation_second_derivative(scaled_input);
+
+      output = multilayer_perceptron_pointer->calculate_unscaled_output(forward_propagation_second_derivative[3*hidden_layers_number]);
+
+      for(int k = 0; k < outputs_number; k++)
+      {
+         error = output[k] - training_target_instance[k];
+
+         if(error == 0.0)
+         {
+            output_gradient[k] = 0.0;
+            output_second_derivative[k] = 0.0;
+         }
+         else
+         {
+            output_gradient[k] = Minkowski_parameter*pow(fabs(error), Minkowski_parameter-1.0)*(error > 0.0 ? 1.0 : -1.0);
+            output_second_derivative[k] = Minkowski_parameter*(Minkowski_parameter-1.0)*pow(fabs(error), Minkowski_parameter-2.0);
+         }
+      }
+
+      for(int r = 0; r < vectors_number; r++)
+      {
+         neural_parameters_vectors_Hessian_product[r] += multilayer_perceptron_pointer->calculate_neural_parameters_vector_dot_Hessian
+         (scaled_input, forward_propagation_second_derivative, output_gradient, output_second_derivative, neural_parameters_vectors[r]);
+      }
+   }
+
+   // Objective and regularization terms
+
+   Matrix<double> vectors_Hessian_product(vectors_number, parameters_number, 0.0);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         vectors_Hessian_product[r][j] = objective_weight*neural_parameters_vectors_Hessian_product[r][j];
+      }
+
+      if(regularization_method != None)
+      {
+         Vector<double> regularization_vector_Hessian_product = calculate_regularization_vector_dot_Hessian(vectors.get_row(r));
+
+         for(int j = 0; j < parameters_number; j++)
+         {
+            vectors_Hessian_product[r][j] += regularization_weight*regularization_vector_Hessian_product[j];
+         }
+      }
+   }
+
+   return(vectors_Hessian_product);
+}
+
+
 // std::string to_XML(void) method 
 
 /// This method returns a string representation of this object in a XML-type format. 
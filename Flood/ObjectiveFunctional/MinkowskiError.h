@@ -54,6 +54,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    /// This method returns a pointer to the input-target data set object on which the objective functional is measured.
@@ -63,6 +67,8 @@ public:
 	   return(input_target_data_set_pointer);
    }
 
+   int get_data_set_version(void);
+
    double get_Minkowski_parameter(void);
 
    // Set methods
@@ -79,6 +85,7 @@ public:
    // Objective functional evaluation methods
 
    double calculate_objective(void);
+   double calculate_objective(double);
 
    // Validation error methods
 
@@ -93,6 +100,11 @@ public:
 
    Vector<double> calculate_objective_gradient(void);
 
+   // Hessian methods
+
+   Vector<double> calculate_vector_dot_Hessian(const Vector<double>&);
+   Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&);
+
    // Utility methods
 
    std::string to_XML(bool);   
@@ -39,6 +39,9 @@ namespace Flood
 NormalizedSquaredError::NormalizedSquaredError(void) : ObjectiveFunctional()
 {
    input_target_data_set_pointer = NULL;
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -53,6 +56,9 @@ NormalizedSquaredError::NormalizedSquaredError(MultilayerPerceptron* new_multila
 : ObjectiveFunctional(new_multilayer_perceptron_pointer)
 {
    input_target_data_set_pointer = NULL;
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -67,6 +73,9 @@ NormalizedSquaredError::NormalizedSquaredError(InputTargetDataSet* new_input_tar
 : ObjectiveFunctional()
 {
    input_target_data_set_pointer = new_input_target_data_set_pointer;
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -82,6 +91,9 @@ NormalizedSquaredError::NormalizedSquaredError(MultilayerPerceptron* new_multila
 : ObjectiveFunctional(new_multilayer_perceptron_pointer)
 {
    input_target_data_set_pointer = new_input_target_data_set_pointer; 
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -96,6 +108,41 @@ NormalizedSquaredError::~NormalizedSquaredError(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+/// This method returns a new normalized squared error object with the same members as this one, but associated to another
+/// multilayer perceptron.
+/// The input-target data set is referenced by both objects, not copied.
+/// @param new_multilayer_perceptron_pointer Pointer to a multilayer perceptron object.
+
+ObjectiveFunctional* NormalizedSquaredError::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   NormalizedSquaredError* normalized_squared_error_pointer = new NormalizedSquaredError(*this);
+
+   normalized_squared_error_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(normalized_squared_error_pointer);
+}
+
+
+// int get_data_set_version(void) method
+
+/// This method returns the version of the input-target data set, or zero if there is no input-target data set 
+/// associated to the normalized squared error object. 
+
+int NormalizedSquaredError::get_data_set_version(void)
+{
+   if(input_target_data_set_pointer == NULL)
+   {
+      return(0);
+   }
+   else
+   {
+      return(input_target_data_set_pointer->get_version());
+   }
+}
+
+
 // void set(void) method
 
 /// This method sets the multilayer perceptron and input-target data set object pointers to NULL. 
@@ -106,6 +153,9 @@ void NormalizedSquaredError::set(void)
    multilayer_perceptron_pointer = NULL;
    input_target_data_set_pointer = NULL;
    set_default();
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -120,6 +170,9 @@ void NormalizedSquaredError::set(MultilayerPerceptron* new_multilayer_perceptron
    multilayer_perceptron_pointer = new_multilayer_perceptron_pointer;
    input_target_data_set_pointer = NULL;
    set_default();
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -134,6 +187,9 @@ void NormalizedSquaredError::set(InputTargetDataSet* new_input_target_data_set_p
    multilayer_perceptron_pointer = NULL;
    input_target_data_set_pointer = new_input_target_data_set_pointer;
    set_default();
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -149,6 +205,9 @@ void NormalizedSquaredError::set(MultilayerPerceptron* new_multilayer_perceptron
    multilayer_perceptron_pointer = new_multilayer_perceptron_pointer;
    input_target_data_set_pointer = new_input_target_data_set_pointer;
    set_default();
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
 }
 
 
@@ -160,6 +219,53 @@ void NormalizedSquaredError::set(MultilayerPerceptron* new_multilayer_perceptron
 void NormalizedSquaredError::set_input_target_data_set_pointer(InputTargetDataSet* new_input_target_data_set_pointer)
 {
    input_target_data_set_pointer = new_input_target_data_set_pointer;
+
+   training_normalization_coefficient_version = -1;
+   validation_normalization_coefficient_version = -1;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
+}
+
+
+// double get_training_normalization_coefficient(void) method
+
+/// This method returns the normalization coefficient of the training instances. 
+/// It is only recalculated when the version of the input-target data set has changed since the last call.
+
+double NormalizedSquaredError::get_training_normalization_coefficient(void)
+{
+   int version = input_target_data_set_pointer->get_version();
+
+   if(training_normalization_coefficient_version != version)
+   {
+      training_normalization_coefficient = calculate_training_normalization_coefficient();
+
+      training_normalization_coefficient_version = version;
+   }
+
+   return(training_normalization_coefficient);
+}
+
+
+// double get_validation_normalization_coefficient(void) method
+
+/// This method returns the normalization coefficient of the validation instances. 
+/// It is only recalculated when the version of the input-target data set has changed since the last call.
+
+double NormalizedSquaredError::get_validation_normalization_coefficient(void)
+{
+   int version = input_target_data_set_pointer->get_version();
+
+   if(validation_normalization_coefficient_version != version)
+   {
+      validation_normalization_coefficient = calculate_validation_normalization_coefficient();
+
+      validation_normalization_coefficient_version = version;
+   }
+
+   return(validation_normalization_coefficient);
 }
 
 
@@ -253,8 +359,24 @@ double NormalizedSquaredError::calculate_validation_normalization_coefficient(vo
 
 /// This method returns the evaluation value of a multilayer perceptron according to the normalized squared error 
 /// on an input-target data set.
+/// It is calculated by the calculate_objective(double) method with no bound.
 
 double NormalizedSquaredError::calculate_objective(void)
+{
+   return(calculate_objective(std::numeric_limits<double>::max()));
+}
+
+
+// double calculate_objective(double) method
+
+/// This method returns the normalized squared error of a multilayer perceptron on the training instances, as the 
+/// calculate_objective(void) method does. 
+/// The sum over the training instances stops as soon as it exceeds the given bound. 
+/// The normalized squared error of the instances summed so far is then returned. 
+/// It is a lower bound of the objective greater than the bound. 
+/// @param objective_bound Objective value above which the exact objective is not needed. 
+
+double NormalizedSquaredError::calculate_objective(double objective_bound)
 {
    int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
    int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
@@ -266,7 +388,7 @@ double NormalizedSquaredError::calculate_objective(void)
    if(multilayer_perceptron_pointer == NULL)
    {
       std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
 
         exit(1);
@@ -274,7 +396,7 @@ double NormalizedSquaredError::calculate_objective(void)
    else if(input_target_data_set_pointer == NULL)
    {
       std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to input-target data set object cannot be NULL." << std::endl;
 
         exit(1);
@@ -286,7 +408,7 @@ double NormalizedSquaredError::calculate_objective(void)
    if(inputs_number != input_variables_number || outputs_number != target_variables_number)
    {
       std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
-				<< "double calculate_objective(void) method." << std::endl
+				<< "double calculate_objective(double) method." << std::endl
                 << "Number of inputs and outputs in multilayer perceptron must be equal to number of input and output variables in input-target data set." << std::endl;
 
       exit(1);
@@ -296,14 +418,14 @@ double NormalizedSquaredError::calculate_objective(void)
 
    int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
 
-   double training_normalization_coefficient = calculate_training_normalization_coefficient();
+   double training_normalization_coefficient = get_training_normalization_coefficient();
 
    #ifdef _DEBUG 
 
    if(training_normalization_coefficient < 1.0e-99)
    {
       std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
-				<< "double calculate_objective(void) method." << std::endl
+				<< "double calculate_objective(double) method." << std::endl
                 << "Training normalization coefficient is zero." << std::endl;
 
       exit(1);   
@@ -318,6 +440,8 @@ double NormalizedSquaredError::calculate_objective(void)
 
    double sum_squared_error = 0.0;
 
+   double sum_squared_error_bound = objective_bound*training_normalization_coefficient;
+
    for(int i = 0; i < training_instances_number; i++)
    {
       // Input vector
@@ -339,6 +463,13 @@ double NormalizedSquaredError::calculate_objective(void)
       // Sum of squares error
 
       sum_squared_error += instance_error.dot(instance_error);           
+
+      // Stop as soon as the objective is known to exceed the bound
+
+      if(sum_squared_error > sum_squared_error_bound)
+      {
+         break;
+      }
    }
 
    return(sum_squared_error/training_normalization_coefficient);
@@ -410,7 +541,7 @@ Vector<double> NormalizedSquaredError::calculate_output_errors
 
    #endif
 
-   double training_normalization_coefficient = calculate_training_normalization_coefficient();
+   double training_normalization_coefficient = get_training_normalization_coefficient();
 
    #ifdef _DEBUG 
 
@@ -952,6 +1083,491 @@ Vector<double> NormalizedSquaredError::calculate_objective_gradient(void)
 
 
 
+// int get_training_instances_number(void) method
+
+/// This method returns the number of training instances in the input-target data set, or zero if there is no 
+/// input-target data set associated to the normalized squared error object.
+
+int NormalizedSquaredError::get_training_instances_number(void)
+{
+   if(input_target_data_set_pointer == NULL)
+   {
+      return(0);
+   }
+   else
+   {
+      return(input_target_data_set_pointer->get_training_instances_number());
+   }
+}
+
+
+// Vector<double> calculate_batch_objective_gradient(const Vector<int>&) method
+
+/// This method returns an unbiased estimate of the objective gradient computed by back-propagation on a 
+/// mini-batch of training instances. 
+/// The contributions of the instances in the mini-batch are scaled by the ratio between the number of training 
+/// instances and the mini-batch size. 
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+
+Vector<double> NormalizedSquaredError::calculate_batch_objective_gradient(const Vector<int>& training_instances_indices)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> batch_objective_gradient(parameters_number);
+
+   calculate_batch_objective_gradient(training_instances_indices, batch_objective_gradient);
+
+   return(batch_objective_gradient);
+}
+
+
+// void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method
+
+/// This method computes the same mini-batch estimate of the objective gradient as 
+/// calculate_batch_objective_gradient(const Vector<int>&), but writes it into a vector allocated by the caller, so 
+/// that the stochastic training algorithms can reuse it from one mini-batch to the next. 
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+/// @param batch_objective_gradient Objective gradient estimate. Its size must be the number of parameters. 
+
+void NormalizedSquaredError::calculate_batch_objective_gradient(const Vector<int>& training_instances_indices, Vector<double>& batch_objective_gradient)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+        exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(training_instances_indices.get_size() == 0)
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Size of mini-batch must be greater than zero." << std::endl;
+
+      exit(1);
+   }
+   else if(batch_objective_gradient.get_size() != multilayer_perceptron_pointer->get_parameters_number())
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method." << std::endl
+                << "Size of batch objective gradient must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   Vector<int> hidden_layers_size = multilayer_perceptron_pointer->get_hidden_layers_size();
+
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int forward_propagation_derivative_size = 2*hidden_layers_number + 2;
+
+   Vector< Vector<double> > forward_propagation_derivative(forward_propagation_derivative_size);
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   int batch_size = training_instances_indices.get_size();
+
+   int input_variables_number = input_target_data_set_pointer->get_input_variables_number();
+   int target_variables_number = input_target_data_set_pointer->get_target_variables_number();
+
+   Vector<double> training_input_instance(input_variables_number);
+   Vector<double> training_target_instance(target_variables_number);
+
+   // Output and hidden errors
+
+   Vector<double> output_errors(outputs_number);
+   Vector< Vector<double> > hidden_errors(hidden_layers_number);
+
+   for(int h = 0; h < hidden_layers_number; h++)
+   {
+      hidden_errors[h].set_size(hidden_layers_size[h]);
+   }
+
+   // Hidden and output layers gradients
+
+   int hidden_layers_parameters_number = multilayer_perceptron_pointer->get_hidden_layers_parameters_number();
+   int output_layer_parameters_number = multilayer_perceptron_pointer->get_output_layer_parameters_number();
+
+   Vector<double> hidden_layers_error_gradient(hidden_layers_parameters_number);
+   Vector<double> output_layer_error_gradient(output_layer_parameters_number);
+
+   batch_objective_gradient.initialize(0.0);
+
+   // Main loop
+
+   int index;
+
+   for(int i = 0; i < batch_size; i++)
+   {
+      index = training_instances_indices[i];
+
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(index);
+
+      forward_propagation_derivative = multilayer_perceptron_pointer->calculate_forward_propagation_derivative(training_input_instance);
+
+      training_target_instance = input_target_data_set_pointer->get_training_target_instance(index);
+
+      output_errors = calculate_output_errors(forward_propagation_derivative, training_target_instance);
+
+      hidden_errors = calculate_hidden_errors(forward_propagation_derivative, output_errors);
+
+      hidden_layers_error_gradient = calculate_hidden_layers_error_gradient(training_input_instance, forward_propagation_derivative, hidden_errors);
+  
+      output_layer_error_gradient = calculate_output_layer_error_gradient(forward_propagation_derivative, output_errors);
+
+      for(int j = 0; j < hidden_layers_parameters_number; j++)
+      {
+         batch_objective_gradient[j] += hidden_layers_error_gradient[j];
+      }
+
+      for(int j = 0; j < output_layer_parameters_number; j++)
+      {
+         batch_objective_gradient[hidden_layers_parameters_number+j] += output_layer_error_gradient[j];
+      }
+   }
+
+   batch_objective_gradient *= (double)training_instances_number/(double)batch_size;
+}
+
+
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) method
+
+/// This method returns the product of a vector with the Hessian matrix of the normalized squared error functional. 
+/// It is computed exactly by means of the calculate_vectors_dot_Hessian(const Matrix<double>&) method. 
+/// @param vector Vector in the dot product. 
+
+Vector<double> NormalizedSquaredError::calculate_vector_dot_Hessian(const Vector<double>& vector)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Matrix<double> vectors(1, parameters_number);
+
+   vectors.set_row(0, vector);
+
+   return(calculate_vectors_dot_Hessian(vectors).get_row(0));
+}
+
+
+// Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method
+
+/// This method returns the products of a set of vectors with the Hessian matrix of the normalized squared error functional, 
+/// including the regularization term. 
+/// The products are exact, and are computed with the R-operator technique of the multilayer perceptron. 
+/// The forward propagation for each training instance is shared between all the vectors. 
+/// @param vectors Matrix whose rows are the vectors in the dot products. 
+
+Matrix<double> NormalizedSquaredError::calculate_vectors_dot_Hessian(const Matrix<double>& vectors)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(vectors.get_columns_number() != multilayer_perceptron_pointer->get_parameters_number())
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Number of columns must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int neural_parameters_number = multilayer_perceptron_pointer->get_neural_parameters_number();
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   double training_normalization_coefficient = get_training_normalization_coefficient();
+
+   // Vectors restricted to the neural parameters
+
+   int vectors_number = vectors.get_rows_number();
+
+   Vector< Vector<double> > neural_parameters_vectors(vectors_number);
+   Vector< Vector<double> > neural_parameters_vectors_Hessian_product(vectors_number);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      neural_parameters_vectors[r].set(neural_parameters_number);
+
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         neural_parameters_vectors[r][j] = vectors[r][j];
+      }
+
+      neural_parameters_vectors_Hessian_product[r].set(neural_parameters_number, 0.0);
+   }
+
+   // Main loop
+
+   Vector<double> training_input_instance(inputs_number);
+   Vector<double> training_target_instance(outputs_number);
+
+   Vector<double> scaled_input(inputs_number);
+   Vector< Vector<double> > forward_propagation_second_derivative(3*hidden_layers_number+3);
+   Vector<double> output(outputs_number);
+
+   Vector<double> output_gradient(outputs_number);
+   Vector<double> output_second_derivative(outputs_number, 2.0/training_normalization_coefficient);
+
+   for(int i = 0; i < training_instances_number; i++)
+   {
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(i);
+      training_target_instance = input_target_data_set_pointer->get_training_target_instance(i);
+
+      scaled_input = multilayer_perceptron_pointer->calculate_scaled_input(training_input_instance);
+
+      forward_propagation_second_derivative 
+      = multilayer_perceptron_pointer->calculate_forward_propagation_second_derivative(scaled_input);
+
+      output = multilayer_perceptron_pointer->calculate_unscaled_output(forward_propagation_second_derivative[3*hidden_layers_number]);
+
+      output_gradient = (output - training_target_instance)*(2.0/training_normalization_coefficient);
+
+      for(int r = 0; r < vectors_number; r++)
+      {
+         neural_parameters_vectors_Hessian_product[r] += multilayer_perceptron_pointer->calculate_neural_parameters_vector_dot_Hessian
+         (scaled_input, forward_propagation_second_derivative, output_gradient, output_second_derivative, neural_parameters_vectors[r]);
+      }
+   }
+
+   // Objective and regularization terms
+
+   Matrix<double> vectors_Hessian_product(vectors_number, parameters_number, 0.0);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         vectors_Hessian_product[r][j] = objective_weight*neural_parameters_vectors_Hessian_product[r][j];
+      }
+
+      if(regularization_method != None)
+      {
+         Vector<double> regularization_vector_Hessian_product = calculate_regularization_vector_dot_Hessian(vectors.get_row(r));
+
+         for(int j = 0; j < parameters_number; j++)
+         {
+            vectors_Hessian_product[r][j] += regularization_weight*regularization_vector_Hessian_product[j];
+         }
+      }
+   }
+
+   return(vectors_Hessian_product);
+}
+
+
+// Matrix<double> calculate_Hessian(void) method
+
+/// This method returns the Hessian matrix of the normalized squared error objective functional. 
+/// Depending on the Hessian approximation method, it is either the exact Hessian or the Gauss-Newton approximation. 
+/// The exact Hessian is computed column by column with the R-operator technique, sharing the forward propagation 
+/// of each training instance among all the columns. 
+
+Matrix<double> NormalizedSquaredError::calculate_Hessian(void)
+{
+   // Increment number of Hessians count
+
+   calculate_Hessian_count++;
+
+   switch(Hessian_approximation_method)
+   {
+      case ExactHessian:
+      {
+         int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+         Matrix<double> identity(parameters_number, parameters_number);
+         identity.set_to_identity();
+
+         return(calculate_vectors_dot_Hessian(identity));
+      }
+      break;
+
+      case GaussNewton:
+      {
+         return(calculate_Gauss_Newton_Hessian());
+      }
+      break;
+
+      default:
+      {
+         std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                   << "Matrix<double> calculate_Hessian(void) method." << std::endl
+                   << "Unknown Hessian approximation method." << std::endl;
+ 
+         exit(1);
+      }
+      break;
+   }
+}
+
+
+// Matrix<double> calculate_Gauss_Newton_Hessian(void) method
+
+/// This method returns the Gauss-Newton approximation to the Hessian matrix of the normalized squared error objective functional. 
+/// It is the sum over the training instances of J'*J, times the second derivative of the error with respect to the 
+/// outputs, where J is the Jacobian of the outputs with respect to the neural parameters. 
+/// Each row of J is obtained by back-propagating a unit output error. 
+/// The regularization term is added with its exact Hessian. 
+
+Matrix<double> NormalizedSquaredError::calculate_Gauss_Newton_Hessian(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "Matrix<double> calculate_Gauss_Newton_Hessian(void) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: NormalizedSquaredError class." << std::endl
+                << "Matrix<double> calculate_Gauss_Newton_Hessian(void) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int neural_parameters_number = multilayer_perceptron_pointer->get_neural_parameters_number();
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   double training_normalization_coefficient = get_training_normalization_coefficient();
+
+   double output_second_derivative = 2.0/training_normalization_coefficient;
+
+   // Main loop
+
+   Matrix<double> neural_parameters_Gauss_Newton_Hessian(neural_parameters_number, neural_parameters_number, 0.0);
+
+   Vector<double> training_input_instance(inputs_number);
+
+   Vector<double> scaled_input(inputs_number);
+   Vector< Vector<double> > forward_propagation_derivative(2*hidden_layers_number+2);
+
+   Vector<double> unit_output_error(outputs_number);
+   Vector<double> output_Jacobian_row(neural_parameters_number);
+
+   for(int i = 0; i < training_instances_number; i++)
+   {
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(i);
+
+      scaled_input = multilayer_perceptron_pointer->calculate_scaled_input(training_input_instance);
+
+      forward_propagation_derivative = multilayer_perceptron_pointer->calculate_forward_propagation_derivative(scaled_input);
+
+      for(int k = 0; k < outputs_number; k++)
+      {
+         unit_output_error.initialize(0.0);
+         unit_output_error[k] = 1.0;
+
+         output_Jacobian_row 
+         = multilayer_perceptron_pointer->calculate_neural_parameters_gradient(scaled_input, forward_propagation_derivative, unit_output_error);
+
+         for(int a = 0; a < neural_parameters_number; a++)
+         {
+            for(int b = 0; b <= a; b++)
+            {
+               neural_parameters_Gauss_Newton_Hessian[a][b] += output_Jacobian_row[a]*output_Jacobian_row[b];
+            }
+         }
+      }
+   }
+
+   // Objective and regularization terms
+
+   Matrix<double> Gauss_Newton_Hessian(parameters_number, parameters_number, 0.0);
+
+   for(int a = 0; a < neural_parameters_number; a++)
+   {
+      for(int b = 0; b <= a; b++)
+      {
+         Gauss_Newton_Hessian[a][b] = objective_weight*output_second_derivative*neural_parameters_Gauss_Newton_Hessian[a][b];
+         Gauss_Newton_Hessian[b][a] = Gauss_Newton_Hessian[a][b];
+      }
+   }
+
+   if(regularization_method != None)
+   {
+      Matrix<double> regularization_Hessian = calculate_regularization_Hessian();
+
+      for(int a = 0; a < parameters_number; a++)
+      {
+         for(int b = 0; b < parameters_number; b++)
+         {
+            Gauss_Newton_Hessian[a][b] += regularization_weight*regularization_Hessian[a][b];
+         }
+      }
+   }
+
+   return(Gauss_Newton_Hessian);
+}
+
+
 // double calculate_validation_error(void) method
 
 double NormalizedSquaredError::calculate_validation_error(void)
@@ -1001,7 +1617,7 @@ double NormalizedSquaredError::calculate_validation_error(void)
       return(0.0);
    }
 
-   double validation_normalization_coefficient = calculate_validation_normalization_coefficient();
+   double validation_normalization_coefficient = get_validation_normalization_coefficient();
 
    #ifdef _DEBUG 
 
@@ -55,6 +55,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    /// This method returns a pointer to the input-target data set object on which the objective functional is measured.
@@ -64,6 +68,8 @@ public:
       return(input_target_data_set_pointer);
    }
 
+   int get_data_set_version(void);
+
    // Set methods
 
    void set(void);
@@ -75,12 +81,16 @@ public:
 
    // Normalization coefficients 
 
+   double get_training_normalization_coefficient(void);
+   double get_validation_normalization_coefficient(void);
+
    double calculate_training_normalization_coefficient(void);
    double calculate_validation_normalization_coefficient(void);
 
    // Objective functional evaluation methods
 
    double calculate_objective(void);
+   double calculate_objective(double);
 
    // Validation error methods
 
@@ -95,6 +105,19 @@ public:
 
    Vector<double> calculate_objective_gradient(void);
 
+   int get_training_instances_number(void);
+
+   Vector<double> calculate_batch_objective_gradient(const Vector<int>&);
+   void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&);
+
+   // Hessian methods
+
+   Vector<double> calculate_vector_dot_Hessian(const Vector<double>&);
+   Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&);
+
+   Matrix<double> calculate_Hessian(void);
+   Matrix<double> calculate_Gauss_Newton_Hessian(void);
+
 
 private:
 
@@ -107,6 +130,24 @@ private:
    /// Mean values of all the target variables. 
 
    Vector<double> training_target_mean;
+
+   /// Normalization coefficient of the training instances for the last version of the input-target data set seen.
+
+   double training_normalization_coefficient;
+
+   /// Version of the input-target data set for which the training normalization coefficient was calculated. 
+   /// Minus one means that it has not been calculated yet.
+
+   int training_normalization_coefficient_version;
+
+   /// Normalization coefficient of the validation instances for the last version of the input-target data set seen.
+
+   double validation_normalization_coefficient;
+
+   /// Version of the input-target data set for which the validation normalization coefficient was calculated. 
+   /// Minus one means that it has not been calculated yet.
+
+   int validation_normalization_coefficient_version;
 };
 
 }
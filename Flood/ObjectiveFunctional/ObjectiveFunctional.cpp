@@ -27,6 +27,10 @@
 #include <iostream>
 #include <cmath>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 namespace Flood
 {
@@ -58,18 +62,170 @@ ObjectiveFunctional::ObjectiveFunctional(void)
 }
 
 
+// COPY CONSTRUCTOR
+
+/// Copy constructor. It creates a copy of an existing objective functional object. 
+/// The clones of the other objective functional for the threads are not copied. 
+/// @param other_objective_functional Objective functional object to be copied.
+
+ObjectiveFunctional::ObjectiveFunctional(const ObjectiveFunctional& other_objective_functional)
+{
+   multilayer_perceptron_pointer = other_objective_functional.multilayer_perceptron_pointer;
+
+   // Objective and regularization terms
+
+   objective_weight = other_objective_functional.objective_weight;
+
+   regularization_method = other_objective_functional.regularization_method;
+   regularization_weight = other_objective_functional.regularization_weight;
+
+   // Counters
+
+   calculate_evaluation_count = other_objective_functional.calculate_evaluation_count;
+   calculate_gradient_count = other_objective_functional.calculate_gradient_count;
+   calculate_Hessian_count = other_objective_functional.calculate_Hessian_count;
+
+   // Evaluation cache
+
+   evaluation_cache_size = other_objective_functional.evaluation_cache_size;
+
+   evaluation_cache_hits_count = other_objective_functional.evaluation_cache_hits_count;
+   evaluation_cache_misses_count = other_objective_functional.evaluation_cache_misses_count;
+
+   evaluation_cache_hashes = other_objective_functional.evaluation_cache_hashes;
+   evaluation_cache_parameters = other_objective_functional.evaluation_cache_parameters;
+   evaluation_cache_evaluations = other_objective_functional.evaluation_cache_evaluations;
+   evaluation_cache_gradients = other_objective_functional.evaluation_cache_gradients;
+   evaluation_cache_evaluation_flags = other_objective_functional.evaluation_cache_evaluation_flags;
+   evaluation_cache_gradient_flags = other_objective_functional.evaluation_cache_gradient_flags;
+   evaluation_cache_stamps = other_objective_functional.evaluation_cache_stamps;
+
+   evaluation_cache_clock = other_objective_functional.evaluation_cache_clock;
+   evaluation_cache_data_set_version = other_objective_functional.evaluation_cache_data_set_version;
+   evaluation_cache_multilayer_perceptron_version = other_objective_functional.evaluation_cache_multilayer_perceptron_version;
+
+   // Numerical differentiation
+
+   numerical_differentiation_method = other_objective_functional.numerical_differentiation_method;
+   numerical_epsilon_method = other_objective_functional.numerical_epsilon_method;
+   numerical_epsilon = other_objective_functional.numerical_epsilon;
+
+   threads_number = other_objective_functional.threads_number;
+
+   thread_replicas_multilayer_perceptron_version = -1;
+
+   // Hessian approximation
+
+   Hessian_approximation_method = other_objective_functional.Hessian_approximation_method;
+
+   // Utilities
+
+   display = other_objective_functional.display;
+}
+
+
 // DESTRUCTOR
 
 /// Destructor.
+/// It deletes the clones of the multilayer perceptron and the objective functional for the threads. 
 
 ObjectiveFunctional::~ObjectiveFunctional(void)
 {
+   clear_thread_replicas();
+}
+
+
+// ASSIGNMENT OPERATOR
+
+/// Assignment operator. It assigns to this object the members of an existing objective functional object. 
+/// The clones of the other objective functional for the threads are not assigned, and those of this one are 
+/// deleted. 
+/// @param other_objective_functional Objective functional object to be assigned.
+
+ObjectiveFunctional& ObjectiveFunctional::operator = (const ObjectiveFunctional& other_objective_functional)
+{
+   if(this != &other_objective_functional) 
+   {
+      clear_thread_replicas();
+
+      multilayer_perceptron_pointer = other_objective_functional.multilayer_perceptron_pointer;
+
+      // Objective and regularization terms
+
+      objective_weight = other_objective_functional.objective_weight;
+
+      regularization_method = other_objective_functional.regularization_method;
+      regularization_weight = other_objective_functional.regularization_weight;
+
+      // Counters
+
+      calculate_evaluation_count = other_objective_functional.calculate_evaluation_count;
+      calculate_gradient_count = other_objective_functional.calculate_gradient_count;
+      calculate_Hessian_count = other_objective_functional.calculate_Hessian_count;
+
+      // Evaluation cache
+
+      evaluation_cache_size = other_objective_functional.evaluation_cache_size;
+
+      evaluation_cache_hits_count = other_objective_functional.evaluation_cache_hits_count;
+      evaluation_cache_misses_count = other_objective_functional.evaluation_cache_misses_count;
+
+      evaluation_cache_hashes = other_objective_functional.evaluation_cache_hashes;
+      evaluation_cache_parameters = other_objective_functional.evaluation_cache_parameters;
+      evaluation_cache_evaluations = other_objective_functional.evaluation_cache_evaluations;
+      evaluation_cache_gradients = other_objective_functional.evaluation_cache_gradients;
+      evaluation_cache_evaluation_flags = other_objective_functional.evaluation_cache_evaluation_flags;
+      evaluation_cache_gradient_flags = other_objective_functional.evaluation_cache_gradient_flags;
+      evaluation_cache_stamps = other_objective_functional.evaluation_cache_stamps;
+
+      evaluation_cache_clock = other_objective_functional.evaluation_cache_clock;
+      evaluation_cache_data_set_version = other_objective_functional.evaluation_cache_data_set_version;
+      evaluation_cache_multilayer_perceptron_version = other_objective_functional.evaluation_cache_multilayer_perceptron_version;
+
+      // Numerical differentiation
+
+      numerical_differentiation_method = other_objective_functional.numerical_differentiation_method;
+      numerical_epsilon_method = other_objective_functional.numerical_epsilon_method;
+      numerical_epsilon = other_objective_functional.numerical_epsilon;
 
+      threads_number = other_objective_functional.threads_number;
+
+      // Hessian approximation
+
+      Hessian_approximation_method = other_objective_functional.Hessian_approximation_method;
+
+      // Utilities
+
+      display = other_objective_functional.display;
+   }
+
+   return(*this);
 }
 
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+/// This method returns a new objective functional object of the same type as this one, with the same members but
+/// associated to another multilayer perceptron.
+/// Data shared by several objective functionals, such as input-target data sets, is referenced and not copied.
+/// Derived classes which are to be used by multi-start training or other parallel training schemes must redefine
+/// this method.
+/// @param new_multilayer_perceptron_pointer Pointer to a multilayer perceptron object.
+
+ObjectiveFunctional* ObjectiveFunctional::clone(MultilayerPerceptron*)
+{
+   std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+             << "ObjectiveFunctional* clone(MultilayerPerceptron*) method." << std::endl
+             << "This method is not redefined in the derived class." << std::endl;
+
+   exit(1);
+
+   return(NULL);
+}
+
+
 // double get_objective_weight(void) method
 
 /// This method returns the weight value of the objective term in the objective functional expression. 
@@ -230,6 +386,62 @@ double ObjectiveFunctional::get_numerical_epsilon(void)
 }
 
 
+// int get_threads_number(void) method
+
+/// This method returns the number of threads for the perturbed evaluations of numerical differentiation when 
+/// compiled with OpenMP.
+/// Zero means the OpenMP default, and one means serial evaluation.
+
+int ObjectiveFunctional::get_threads_number(void)
+{
+   return(threads_number);
+}
+
+
+// HessianApproximationMethod get_Hessian_approximation_method(void) method
+
+/// This method returns the method used for calculating the Hessian matrix in those objective functionals which 
+/// implement it analytically.
+
+ObjectiveFunctional::HessianApproximationMethod ObjectiveFunctional::get_Hessian_approximation_method(void)
+{
+   return(Hessian_approximation_method);
+}
+
+
+// std::string get_Hessian_approximation_method_name(void) method
+
+/// This method returns a string with the name of the Hessian approximation method. 
+
+std::string ObjectiveFunctional::get_Hessian_approximation_method_name(void)
+{
+   switch(Hessian_approximation_method)
+   {
+      case ExactHessian:
+      {
+         return("ExactHessian");
+      }
+      break;
+
+      case GaussNewton:
+      {
+         return("GaussNewton");
+      }
+      break;
+
+      default:
+      {
+         std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                   << "std::string get_Hessian_approximation_method_name(void) method." << std::endl
+                   << "Unknown Hessian approximation method." << std::endl;
+ 
+         exit(1);
+      }
+      break;
+   }
+}
+
+
 // int get_calculate_evaluation_count(void) method
 
 /// This method returns the number of calls to the calculate_evaluation(void) method.
@@ -260,6 +472,38 @@ int ObjectiveFunctional::get_calculate_Hessian_count(void)
 }
 
 
+// int get_evaluation_cache_size(void) method
+
+/// This method returns the maximum number of vectors of parameters whose evaluation and gradient are remembered. 
+/// Zero means that the evaluation cache is not used.
+
+int ObjectiveFunctional::get_evaluation_cache_size(void)
+{
+   return(evaluation_cache_size);
+}
+
+
+// int get_evaluation_cache_hits_count(void) method
+
+/// This method returns the number of evaluations and gradients which have been found in the evaluation cache.
+
+int ObjectiveFunctional::get_evaluation_cache_hits_count(void)
+{
+   return(evaluation_cache_hits_count);
+}
+
+
+// int get_evaluation_cache_misses_count(void) method
+
+/// This method returns the number of evaluations and gradients which have been looked for in the evaluation cache 
+/// and not found.
+
+int ObjectiveFunctional::get_evaluation_cache_misses_count(void)
+{
+   return(evaluation_cache_misses_count);
+}
+
+
 // bool get_display(void) method
 
 /// This method returns true if messages from this class can be displayed on the screen, or false if messages 
@@ -271,6 +515,32 @@ bool ObjectiveFunctional::get_display(void)
 }
 
 
+// int get_training_instances_number(void) method
+
+/// This method returns the number of training instances on which the objective term is a sum of independent 
+/// contributions.
+/// It is zero by default, which means that the objective functional cannot be split into mini-batches. 
+/// Objective functionals measured on a data set override this method.
+
+int ObjectiveFunctional::get_training_instances_number(void)
+{
+   return(0);
+}
+
+
+// int get_data_set_version(void) method
+
+/// This method returns the version of the data set on which the objective functional is measured. 
+/// The evaluation cache is cleared whenever it changes. 
+/// It is zero by default, which means that the objective functional does not depend on any data set. 
+/// Objective functionals measured on a data set override this method.
+
+int ObjectiveFunctional::get_data_set_version(void)
+{
+   return(0);
+}
+
+
 // void set_multilayer_perceptron_pointer(MultilayerPerceptron*) method
 
 /// This method sets a pointer to a multilayer perceptron object which is to be associated to the objective 
@@ -281,6 +551,10 @@ bool ObjectiveFunctional::get_display(void)
 void ObjectiveFunctional::set_multilayer_perceptron_pointer(MultilayerPerceptron* new_multilayer_perceptron_pointer)
 {
    multilayer_perceptron_pointer = new_multilayer_perceptron_pointer;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -294,9 +568,12 @@ void ObjectiveFunctional::set_multilayer_perceptron_pointer(MultilayerPerceptron
 /// <li> Calculate evaluation count: 0.
 /// <li> Calculate gradient count: 0.
 /// <li> Calculate Hessian count: 0.
+/// <li> Evaluation cache size: 0.
 /// <li> Numerical differentiation method: Central differences.
 /// <li> Numerical epsilon method: Relative.
 /// <li> Numerical epsilon: 1.0e-5.
+/// <li> Threads number: 0.
+/// <li> Hessian approximation method: Exact Hessian.
 /// <li> Display: true.
 /// </ul>
 
@@ -317,12 +594,29 @@ void ObjectiveFunctional::set_default(void)
    calculate_gradient_count = 0;
    calculate_Hessian_count = 0;
 
+   // Evaluation cache
+
+   evaluation_cache_size = 0;
+
+   evaluation_cache_hits_count = 0;
+   evaluation_cache_misses_count = 0;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
+
    // Numerical differentiation
 
    numerical_differentiation_method = CentralDifferences;
    numerical_epsilon_method = Relative;
    numerical_epsilon = 1.0e-6;
 
+   threads_number = 0;
+
+   // Hessian approximation
+
+   Hessian_approximation_method = ExactHessian;
+
    // Utilities
 
    display = true;
@@ -404,6 +698,47 @@ void ObjectiveFunctional::set_numerical_epsilon_method(const std::string& new_nu
 }
 
 
+// void set_Hessian_approximation_method(const HessianApproximationMethod&) method
+
+/// This method sets the method to be used for calculating the Hessian matrix in those objective functionals which 
+/// implement it analytically. 
+/// The Gauss-Newton approximation neglects the second derivatives of the outputs with respect to the parameters. 
+/// It is cheaper than the exact Hessian, and it is positive semidefinite for the data modelling error functionals. 
+/// @param new_Hessian_approximation_method New Hessian approximation method.
+
+void ObjectiveFunctional::set_Hessian_approximation_method
+(const ObjectiveFunctional::HessianApproximationMethod& new_Hessian_approximation_method)
+{
+   Hessian_approximation_method = new_Hessian_approximation_method;
+}
+
+
+// void set_Hessian_approximation_method(const std::string&) method
+
+/// This method sets a new Hessian approximation method from a string with the name of the method. 
+/// @param new_Hessian_approximation_method_name Name of Hessian approximation method. 
+
+void ObjectiveFunctional::set_Hessian_approximation_method(const std::string& new_Hessian_approximation_method_name)
+{
+   if(new_Hessian_approximation_method_name == "ExactHessian")
+   {
+      Hessian_approximation_method = ExactHessian;
+   }
+   else if(new_Hessian_approximation_method_name == "GaussNewton")
+   {
+      Hessian_approximation_method = GaussNewton;
+   }
+   else
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "void set_Hessian_approximation_method(const std::string&) method." << std::endl
+                << "Unknown Hessian approximation method: " << new_Hessian_approximation_method_name << "." <<std::endl;
+
+      exit(1);   
+   }	
+}
+
+
 // void set_numerical_epsilon(double) method
 
 /// This method sets a new epsilon value for the calculation of the objective function gradient by means of 
@@ -433,6 +768,35 @@ void ObjectiveFunctional::set_numerical_epsilon(double new_numerical_epsilon)
 }
 
 
+// void set_threads_number(int) method
+
+/// This method sets a new number of threads for the perturbed evaluations of numerical differentiation when 
+/// compiled with OpenMP.
+/// Each thread evaluates perturbations on its own clone of the multilayer perceptron and the objective functional,
+/// so that the objective functional must redefine the clone method.
+/// @param new_threads_number Number of threads. Zero means the OpenMP default, and one means serial evaluation.
+
+void ObjectiveFunctional::set_threads_number(int new_threads_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_threads_number < 0)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "void set_threads_number(int) method." << std::endl
+                << "Number of threads must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   threads_number = new_threads_number;
+}
+
+
 // void set_objective_weight(double) method
 
 /// This method sets a new weight value for the objective term in the objective functional expression. 
@@ -456,6 +820,10 @@ void ObjectiveFunctional::set_objective_weight(double new_objective_weight)
    #endif
 
    objective_weight = new_objective_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -468,6 +836,10 @@ void ObjectiveFunctional::set_regularization_method
 (const ObjectiveFunctional::RegularizationMethod& new_regularization_method)
 {
    regularization_method = new_regularization_method;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -494,6 +866,10 @@ void ObjectiveFunctional::set_regularization_method(const std::string& new_regul
    
       exit(1);   
    }
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -520,6 +896,10 @@ void ObjectiveFunctional::set_regularization_weight(double new_regularization_we
    #endif
 
    regularization_weight = new_regularization_weight;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -595,146 +975,1031 @@ void ObjectiveFunctional::set_calculate_Hessian_count(int new_calculate_Hessian_
 }
 
 
-// void set_display(bool) method
+// void set_evaluation_cache_size(int) method
 
-/// This method sets a new display value. 
-/// If it is set to true messages from this class are to be displayed on the screen;
-/// if it is set to false messages from this class are not to be displayed on the screen.
-/// @param new_display Display value.
+/// This method sets the maximum number of vectors of parameters whose evaluation and gradient are remembered, and
+/// clears the evaluation cache. 
+/// The evaluation cache assumes that the evaluation depends only on the parameters of the multilayer perceptron, 
+/// so it must be cleared whenever anything else changes it, such as the data set. 
+/// @param new_evaluation_cache_size Size of the evaluation cache. Zero means that it is not used. 
 
-void ObjectiveFunctional::set_display(bool new_display)
+void ObjectiveFunctional::set_evaluation_cache_size(int new_evaluation_cache_size)
 {
-   display = new_display;
+   // Control sentence
+
+   if(new_evaluation_cache_size < 0)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "void set_evaluation_cache_size(int) method." << std::endl
+                << "Evaluation cache size must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   evaluation_cache_size = new_evaluation_cache_size;
+
+   clear_evaluation_cache();
 }
 
 
-// double calculate_evaluation(void) method
+// void set_evaluation_cache_hits_count(int) method
 
-/// This method calculates the evaluation value of the objective functional, 
-/// as the sum of the objective and the regularization terms. 
+/// This method sets the number of evaluations and gradients found in the evaluation cache to a new value. 
+/// @param new_evaluation_cache_hits_count New number of hits of the evaluation cache.
 
-double ObjectiveFunctional::calculate_evaluation(void)
+void ObjectiveFunctional::set_evaluation_cache_hits_count(int new_evaluation_cache_hits_count)
 {
-   // Increment number of evaluations count
-
-   calculate_evaluation_count++;
+   // Control sentence
 
-   if(regularization_method == None)
+   if(new_evaluation_cache_hits_count < 0)
    {
-      double objective = calculate_objective();
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "void set_evaluation_cache_hits_count(int) method." << std::endl
+                << "Count of evaluation cache hits must be equal or greater than 0." << std::endl;
 
-      return(objective_weight*objective);
-   }
-   else
-   {
-      double objective = calculate_objective();
-      double regularization = calculate_regularization();
-   
-      return(objective_weight*objective + regularization_weight*regularization);
+      exit(1);
    }
+
+   evaluation_cache_hits_count = new_evaluation_cache_hits_count;
 }
 
 
-// double calculate_regularization(void) method
+// void set_evaluation_cache_misses_count(int) method
 
-/// This method returns the evaluation of the regularization term in the objective functional,
-/// according to the regularization method used. 
+/// This method sets the number of evaluations and gradients not found in the evaluation cache to a new value. 
+/// @param new_evaluation_cache_misses_count New number of misses of the evaluation cache.
 
-double ObjectiveFunctional::calculate_regularization(void) 
+void ObjectiveFunctional::set_evaluation_cache_misses_count(int new_evaluation_cache_misses_count)
 {
-   switch(regularization_method)   
-   {
-      case None:
-      {
-         return(0.0);
-      }             
-      break;
+   // Control sentence
 
-      case NeuralParametersNorm:
-      {
-         double regularization = multilayer_perceptron_pointer->calculate_neural_parameters_norm();
+   if(new_evaluation_cache_misses_count < 0)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "void set_evaluation_cache_misses_count(int) method." << std::endl
+                << "Count of evaluation cache misses must be equal or greater than 0." << std::endl;
 
-         return(regularization);
-      }             
-      break;
+      exit(1);
+   }
 
-      default:
-      {
-          std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                    << "double calculate_regularization(void) method." << std::endl
-                    << "Unknown regularization method." << std::endl;
- 
-          exit(1);
-      }// end default
-      break;
-   }   
+   evaluation_cache_misses_count = new_evaluation_cache_misses_count;
 }
 
 
-// double calculate_potential_evaluation(const Vector<double>&) method
+// void clear_evaluation_cache(void) method
+
+/// This method forgets all the evaluations and gradients in the evaluation cache. 
+/// It does not change the hits and misses counts.
+
+void ObjectiveFunctional::clear_evaluation_cache(void)
+{
+   evaluation_cache_hashes.set(evaluation_cache_size, 0);
+   evaluation_cache_parameters.set(evaluation_cache_size);
+   evaluation_cache_evaluations.set(evaluation_cache_size, 0.0);
+   evaluation_cache_gradients.set(evaluation_cache_size);
+   evaluation_cache_evaluation_flags.set(evaluation_cache_size, false);
+   evaluation_cache_gradient_flags.set(evaluation_cache_size, false);
+   evaluation_cache_stamps.set(evaluation_cache_size, 0);
+
+   evaluation_cache_clock = 0;
+
+   evaluation_cache_data_set_version = -1;
+   evaluation_cache_multilayer_perceptron_version = -1;
+}
+
+
+// void clear_thread_replicas(void) method
+
+/// This method deletes the clones of the multilayer perceptron and this objective functional which the threads use 
+/// in the batched and perturbed evaluations. 
+/// They are created again by the next of those evaluations. 
+/// The setters of the objective functional which change its evaluation call this method, and the clones are also 
+/// created again when the version of the multilayer perceptron changes. 
+
+void ObjectiveFunctional::clear_thread_replicas(void)
+{
+   int replicas_number = thread_objective_functionals.get_size();
+
+   for(int t = 0; t < replicas_number; t++)
+   {
+      delete thread_objective_functionals[t];
+      delete thread_multilayer_perceptrons[t];
+   }
+
+   thread_objective_functionals.set();
+   thread_multilayer_perceptrons.set();
+
+   thread_replicas_multilayer_perceptron_version = -1;
+}
+
+
+// void set_display(bool) method
+
+/// This method sets a new display value. 
+/// If it is set to true messages from this class are to be displayed on the screen;
+/// if it is set to false messages from this class are not to be displayed on the screen.
+/// @param new_display Display value.
+
+void ObjectiveFunctional::set_display(bool new_display)
+{
+   display = new_display;
+}
+
+
+// double calculate_evaluation(void) method
+
+/// This method calculates the evaluation value of the objective functional, 
+/// as the sum of the objective and the regularization terms. 
+/// If the evaluation cache is used and it contains the parameters of the multilayer perceptron, the remembered 
+/// evaluation is returned instead. 
+
+double ObjectiveFunctional::calculate_evaluation(void)
+{
+   if(evaluation_cache_size == 0)
+   {
+      return(calculate_uncached_evaluation());
+   }
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+
+   unsigned int hash = calculate_parameters_hash(parameters);
+
+   int entry = find_evaluation_cache_entry(parameters, hash);
+
+   if(entry >= 0 && evaluation_cache_evaluation_flags[entry])
+   {
+      evaluation_cache_hits_count++;
+
+      return(evaluation_cache_evaluations[entry]);
+   }
+
+   evaluation_cache_misses_count++;
+
+   double evaluation = calculate_uncached_evaluation();
+
+   if(entry < 0)
+   {
+      entry = insert_evaluation_cache_entry(parameters, hash);
+   }
+
+   evaluation_cache_evaluations[entry] = evaluation;
+   evaluation_cache_evaluation_flags[entry] = true;
+
+   return(evaluation);
+}
+
+
+// double calculate_uncached_evaluation(void) method
+
+/// This method calculates the evaluation value of the objective functional, as the sum of the objective and the 
+/// regularization terms, without looking for it in the evaluation cache nor storing it there. 
+
+double ObjectiveFunctional::calculate_uncached_evaluation(void)
+{
+   // Increment number of evaluations count
+
+   calculate_evaluation_count++;
+
+   if(regularization_method == None)
+   {
+      double objective = calculate_objective();
+
+      return(objective_weight*objective);
+   }
+   else
+   {
+      double objective = calculate_objective();
+      double regularization = calculate_regularization();
+   
+      return(objective_weight*objective + regularization_weight*regularization);
+   }
+}
+
+
+// double calculate_evaluation(double) method
+
+/// This method calculates the evaluation value of the objective functional as the calculate_evaluation(void) 
+/// method does, but it allows the objective term to give up as soon as the evaluation is known to exceed a bound. 
+/// In that case the returned value is greater than the bound, but it is only a lower bound of the evaluation. 
+/// Otherwise the evaluation is exact. 
+/// Only exact evaluations are stored in the evaluation cache. 
+/// @param evaluation_bound Evaluation value above which the exact evaluation is not needed. 
+
+double ObjectiveFunctional::calculate_evaluation(double evaluation_bound)
+{
+   if(evaluation_cache_size == 0)
+   {
+      return(calculate_uncached_evaluation(evaluation_bound));
+   }
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+
+   unsigned int hash = calculate_parameters_hash(parameters);
+
+   int entry = find_evaluation_cache_entry(parameters, hash);
+
+   if(entry >= 0 && evaluation_cache_evaluation_flags[entry])
+   {
+      evaluation_cache_hits_count++;
+
+      return(evaluation_cache_evaluations[entry]);
+   }
+
+   evaluation_cache_misses_count++;
+
+   double evaluation = calculate_uncached_evaluation(evaluation_bound);
+
+   if(evaluation <= evaluation_bound)
+   {
+      if(entry < 0)
+      {
+         entry = insert_evaluation_cache_entry(parameters, hash);
+      }
+
+      evaluation_cache_evaluations[entry] = evaluation;
+      evaluation_cache_evaluation_flags[entry] = true;
+   }
+
+   return(evaluation);
+}
+
+
+// double calculate_uncached_evaluation(double) method
+
+/// This method calculates the evaluation value of the objective functional, or a lower bound of it greater than a 
+/// given bound, without looking for it in the evaluation cache nor storing it there. 
+/// The regularization term is calculated first, so that the bound on the evaluation can be turned into a bound on 
+/// the objective term. 
+/// If the objective weight is not positive no bound is passed to the objective term. 
+/// @param evaluation_bound Evaluation value above which the exact evaluation is not needed. 
+
+double ObjectiveFunctional::calculate_uncached_evaluation(double evaluation_bound)
+{
+   // Increment number of evaluations count
+
+   calculate_evaluation_count++;
+
+   double regularization = 0.0;
+
+   if(regularization_method != None)
+   {
+      regularization = calculate_regularization();
+   }
+
+   double objective;
+
+   if(objective_weight > 0.0)
+   {
+      objective = calculate_objective((evaluation_bound - regularization_weight*regularization)/objective_weight);
+   }
+   else
+   {
+      objective = calculate_objective();
+   }
+
+   if(regularization_method == None)
+   {
+      return(objective_weight*objective);
+   }
+   else
+   {
+      return(objective_weight*objective + regularization_weight*regularization);
+   }
+}
+
+
+// double calculate_objective(double) method
+
+/// This method returns the objective value of a multilayer perceptron, or a lower bound of it greater than a given
+/// bound. 
+/// Objective functionals which are sums over the instances of a data set should redefine it, so that they stop 
+/// summing as soon as the partial sum exceeds the bound. 
+/// By default the exact objective value is returned. 
+/// @param objective_bound Objective value above which the exact objective is not needed. 
+
+double ObjectiveFunctional::calculate_objective(double)
+{
+   return(calculate_objective());
+}
+
+
+// double calculate_regularization(void) method
+
+/// This method returns the evaluation of the regularization term in the objective functional,
+/// according to the regularization method used. 
+
+double ObjectiveFunctional::calculate_regularization(void) 
+{
+   switch(regularization_method)   
+   {
+      case None:
+      {
+         return(0.0);
+      }             
+      break;
+
+      case NeuralParametersNorm:
+      {
+         double regularization = multilayer_perceptron_pointer->calculate_neural_parameters_norm();
+
+         return(regularization);
+      }             
+      break;
+
+      default:
+      {
+          std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                    << "double calculate_regularization(void) method." << std::endl
+                    << "Unknown regularization method." << std::endl;
+ 
+          exit(1);
+      }// end default
+      break;
+   }   
+}
+
+
+// unsigned int calculate_parameters_hash(const Vector<double>&) method
+
+/// This method returns the FNV-1a hash value of the bytes of a vector of parameters, which is used as the key of the
+/// evaluation cache. 
+/// @param parameters Vector of parameters. 
+
+unsigned int ObjectiveFunctional::calculate_parameters_hash(const Vector<double>& parameters)
+{
+   int size = parameters.get_size();
+
+   unsigned int hash = 2166136261u;
+
+   for(int i = 0; i < size; i++)
+   {
+      const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&parameters[i]);
+
+      for(int j = 0; j < (int)sizeof(double); j++)
+      {
+         hash ^= bytes[j];
+         hash *= 16777619u;
+      }
+   }
+
+   return(hash);
+}
+
+
+// int find_evaluation_cache_entry(const Vector<double>&, unsigned int) method
+
+/// This method returns the entry of the evaluation cache for a vector of parameters, or -1 if it is not there. 
+/// The hash values are compared first, and the parameters are then compared exactly. 
+/// The entry found becomes the most recently used one. 
+/// The whole evaluation cache is cleared first if the data set or the multilayer perceptron, other than in its 
+/// parameters, have changed since it was filled, as their versions tell. 
+/// @param parameters Vector of parameters. 
+/// @param hash Hash value of the vector of parameters. 
+
+int ObjectiveFunctional::find_evaluation_cache_entry(const Vector<double>& parameters, unsigned int hash)
+{
+   int data_set_version = get_data_set_version();
+
+   int multilayer_perceptron_version = multilayer_perceptron_pointer->get_version();
+
+   if(data_set_version != evaluation_cache_data_set_version 
+   || multilayer_perceptron_version != evaluation_cache_multilayer_perceptron_version)
+   {
+      clear_evaluation_cache();
+
+      evaluation_cache_data_set_version = data_set_version;
+      evaluation_cache_multilayer_perceptron_version = multilayer_perceptron_version;
+   }
+
+   int size = parameters.get_size();
+
+   for(int k = 0; k < evaluation_cache_size; k++)
+   {
+      if(evaluation_cache_stamps[k] != 0 
+      && evaluation_cache_hashes[k] == hash 
+      && evaluation_cache_parameters[k].get_size() == size 
+      && evaluation_cache_parameters[k] == parameters)
+      {
+         evaluation_cache_clock++;
+
+         evaluation_cache_stamps[k] = evaluation_cache_clock;
+
+         return(k);
+      }
+   }
+
+   return(-1);
+}
+
+
+// int insert_evaluation_cache_entry(const Vector<double>&, unsigned int) method
+
+/// This method stores a vector of parameters in an empty entry of the evaluation cache, or in the least recently 
+/// used one if the cache is full, and returns that entry. 
+/// Its evaluation and gradient are unknown. 
+/// @param parameters Vector of parameters. 
+/// @param hash Hash value of the vector of parameters. 
+
+int ObjectiveFunctional::insert_evaluation_cache_entry(const Vector<double>& parameters, unsigned int hash)
+{
+   int entry = 0;
+
+   for(int k = 1; k < evaluation_cache_size; k++)
+   {
+      if(evaluation_cache_stamps[k] < evaluation_cache_stamps[entry])
+      {
+         entry = k;
+      }
+   }
+
+   evaluation_cache_clock++;
+
+   evaluation_cache_hashes[entry] = hash;
+   evaluation_cache_parameters[entry] = parameters;
+   evaluation_cache_evaluation_flags[entry] = false;
+   evaluation_cache_gradient_flags[entry] = false;
+   evaluation_cache_stamps[entry] = evaluation_cache_clock;
+
+   return(entry);
+}
+
+
+// void update_thread_replicas(int) method
+
+/// This method makes sure that there is a clone of the multilayer perceptron and this objective functional for each
+/// thread, and sets the evaluation counts of those clones to zero. 
+/// The clones are kept between calls, so that they are only created the first time, when more threads are needed, 
+/// or when the multilayer perceptron has been modified other than in its parameters, as its version tells. 
+/// Changes to the objective functional delete the clones through its setters, and the data set is shared with 
+/// them. 
+/// @param threads Number of threads. 
+
+void ObjectiveFunctional::update_thread_replicas(int threads)
+{
+   int replicas_number = thread_objective_functionals.get_size();
+
+   int multilayer_perceptron_version = multilayer_perceptron_pointer->get_version();
+
+   if(replicas_number > 0 && thread_replicas_multilayer_perceptron_version != multilayer_perceptron_version)
+   {
+      clear_thread_replicas();
+
+      replicas_number = 0;
+   }
+
+   if(replicas_number < threads)
+   {
+      thread_multilayer_perceptrons.resize(threads);
+      thread_objective_functionals.resize(threads);
+
+      for(int t = replicas_number; t < threads; t++)
+      {
+         thread_multilayer_perceptrons[t] = multilayer_perceptron_pointer->clone();
+
+         thread_objective_functionals[t] = clone(thread_multilayer_perceptrons[t]);
+      }
+
+      thread_replicas_multilayer_perceptron_version = multilayer_perceptron_version;
+   }
+
+   for(int t = 0; t < threads; t++)
+   {
+      thread_objective_functionals[t]->set_calculate_evaluation_count(0);
+   }
+}
+
+
+// double calculate_potential_evaluation(const Vector<double>&) method
 
 /// This method returns which would be the objective evaluation of a multilayer perceptron for an hypothetical 
 /// vector of parameters. It does not set that vector of parameters to the multilayer perceptron. 
 /// @param potential_parameters Vector of a potential parameters for the multilayer perceptron associated 
 /// to the objective functional.
 
-double ObjectiveFunctional::calculate_potential_evaluation(const Vector<double>& potential_parameters)
+double ObjectiveFunctional::calculate_potential_evaluation(const Vector<double>& potential_parameters)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   int size = potential_parameters.get_size();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   if(size != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "double calculate_potential_evaluation(const Vector<double>&) method." << std::endl
+                << "Size (" << size << ") must be equal to number of parameters (" << parameters_number << ")." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+
+   // Set potential parameters
+
+   multilayer_perceptron_pointer->set_parameters(potential_parameters);
+
+   // Get Objective
+
+   double potential_evaluation = calculate_evaluation();
+
+   // Restart original parameters
+
+   multilayer_perceptron_pointer->set_parameters(parameters);
+
+   return(potential_evaluation);
+}
+
+
+// Vector<double> calculate_potential_evaluation(const Matrix<double>&) method
+
+/// This method returns which would be the objective evaluations of a multilayer perceptron for a batch of 
+/// hypothetical vectors of parameters. 
+/// The potential parameters are set in turn to the multilayer perceptron, and its original parameters are restored 
+/// only once, after the last evaluation.
+/// @param potential_parameters Matrix of potential parameters, with one row for each vector of parameters.
+
+Vector<double> ObjectiveFunctional::calculate_potential_evaluation(const Matrix<double>& potential_parameters)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   int columns_number = potential_parameters.get_columns_number();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   if(columns_number != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "Vector<double> calculate_potential_evaluation(const Matrix<double>&) method." << std::endl
+                << "Number of columns (" << columns_number << ") must be equal to number of parameters (" << parameters_number << ")." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   int rows_number = potential_parameters.get_rows_number();
+
+   Vector<double> potential_evaluation(rows_number);
+
+   if(rows_number == 0)
+   {
+      return(potential_evaluation);
+   }
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+
+   for(int i = 0; i < rows_number; i++)
+   {
+      // Set potential parameters
+
+      multilayer_perceptron_pointer->set_parameters(potential_parameters.get_row(i));
+
+      // Get Objective
+
+      potential_evaluation[i] = calculate_evaluation();
+   }
+
+   // Restart original parameters
+
+   multilayer_perceptron_pointer->set_parameters(parameters);
+
+   return(potential_evaluation);
+}
+
+
+// Vector<double> calculate_potential_evaluation(const Matrix<double>&, int) method
+
+/// This method returns which would be the objective evaluations of a multilayer perceptron for a batch of 
+/// hypothetical vectors of parameters, using several threads when compiled with OpenMP. 
+/// Each thread evaluates rows on its own clone of the multilayer perceptron and this objective functional, so that
+/// the multilayer perceptron is not modified at all, and this objective functional must redefine the clone method.
+/// The evaluation counts of the clones are added to that of this objective functional.
+/// The evaluation of a row does not depend on the number of threads.
+/// @param potential_parameters Matrix of potential parameters, with one row for each vector of parameters.
+/// @param threads_number Number of threads. Zero means the OpenMP default, and one means serial evaluation.
+
+Vector<double> ObjectiveFunctional::calculate_potential_evaluation(const Matrix<double>& potential_parameters, int threads_number)
+{
+   int rows_number = potential_parameters.get_rows_number();
+
+   int threads = 1;
+
+   #ifdef _OPENMP
+
+   threads = threads_number > 0 ? threads_number : omp_get_max_threads();
+
+   #else
+
+   (void)threads_number;
+
+   #endif
+
+   if(threads > rows_number)
+   {
+      threads = rows_number;
+   }
+
+   if(threads <= 1)
+   {
+      return(calculate_potential_evaluation(potential_parameters));
+   }
+
+   // Each thread works on its own clones
+
+   update_thread_replicas(threads);
+
+   Vector<double> potential_evaluation(rows_number);
+
+   #ifdef _OPENMP
+
+   #pragma omp parallel for schedule(dynamic) num_threads(threads)
+
+   #endif
+
+   for(int i = 0; i < rows_number; i++)
+   {
+      int t = 0;
+
+      #ifdef _OPENMP
+
+      t = omp_get_thread_num();
+
+      #endif
+
+      thread_multilayer_perceptrons[t]->set_parameters(potential_parameters.get_row(i));
+
+      potential_evaluation[i] = thread_objective_functionals[t]->calculate_evaluation();
+   }
+
+   for(int t = 0; t < threads; t++)
+   {
+      calculate_evaluation_count += thread_objective_functionals[t]->get_calculate_evaluation_count();
+   }
+
+   return(potential_evaluation);
+}
+
+
+// double calculate_potential_evaluation(const Vector<double>&, double) method
+
+/// This method returns which would be the objective evaluation of a multilayer perceptron for an hypothetical 
+/// vector of parameters, or a lower bound of it greater than a given bound, as the calculate_evaluation(double) 
+/// method does. 
+/// It does not set that vector of parameters to the multilayer perceptron. 
+/// @param potential_parameters Vector of a potential parameters for the multilayer perceptron associated 
+/// to the objective functional.
+/// @param evaluation_bound Evaluation value above which the exact evaluation is not needed. 
+
+double ObjectiveFunctional::calculate_potential_evaluation(const Vector<double>& potential_parameters, double evaluation_bound)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   int size = potential_parameters.get_size();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   if(size != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "double calculate_potential_evaluation(const Vector<double>&, double) method." << std::endl
+                << "Size (" << size << ") must be equal to number of parameters (" << parameters_number << ")." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+
+   // Set potential parameters
+
+   multilayer_perceptron_pointer->set_parameters(potential_parameters);
+
+   // Get Objective
+
+   double potential_evaluation = calculate_evaluation(evaluation_bound);
+
+   // Restart original parameters
+
+   multilayer_perceptron_pointer->set_parameters(parameters);
+
+   return(potential_evaluation);
+}
+
+
+// Vector<double> calculate_potential_evaluation(const Matrix<double>&, int, double) method
+
+/// This method returns which would be the objective evaluations of a multilayer perceptron for a batch of 
+/// hypothetical vectors of parameters, as the calculate_potential_evaluation(const Matrix<double>&, int) method 
+/// does. 
+/// The evaluation of any row which exceeds the given bound might be replaced by a lower bound of it greater than 
+/// the bound, as the calculate_evaluation(double) method does. 
+/// @param potential_parameters Matrix of potential parameters, with one row for each vector of parameters.
+/// @param threads_number Number of threads. Zero means the OpenMP default, and one means serial evaluation.
+/// @param evaluation_bound Evaluation value above which the exact evaluations are not needed. 
+
+Vector<double> ObjectiveFunctional::calculate_potential_evaluation
+(const Matrix<double>& potential_parameters, int threads_number, double evaluation_bound)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   int columns_number = potential_parameters.get_columns_number();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   if(columns_number != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "Vector<double> calculate_potential_evaluation(const Matrix<double>&, int, double) method." << std::endl
+                << "Number of columns (" << columns_number << ") must be equal to number of parameters (" << parameters_number << ")." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   int rows_number = potential_parameters.get_rows_number();
+
+   Vector<double> potential_evaluation(rows_number);
+
+   if(rows_number == 0)
+   {
+      return(potential_evaluation);
+   }
+
+   int threads = 1;
+
+   #ifdef _OPENMP
+
+   threads = threads_number > 0 ? threads_number : omp_get_max_threads();
+
+   #else
+
+   (void)threads_number;
+
+   #endif
+
+   if(threads > rows_number)
+   {
+      threads = rows_number;
+   }
+
+   if(threads <= 1)
+   {
+      Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+
+      for(int i = 0; i < rows_number; i++)
+      {
+         multilayer_perceptron_pointer->set_parameters(potential_parameters.get_row(i));
+
+         potential_evaluation[i] = calculate_evaluation(evaluation_bound);
+      }
+
+      multilayer_perceptron_pointer->set_parameters(parameters);
+
+      return(potential_evaluation);
+   }
+
+   // Each thread works on its own clones
+
+   update_thread_replicas(threads);
+
+   #ifdef _OPENMP
+
+   #pragma omp parallel for schedule(dynamic) num_threads(threads)
+
+   #endif
+
+   for(int i = 0; i < rows_number; i++)
+   {
+      int t = 0;
+
+      #ifdef _OPENMP
+
+      t = omp_get_thread_num();
+
+      #endif
+
+      thread_multilayer_perceptrons[t]->set_parameters(potential_parameters.get_row(i));
+
+      potential_evaluation[i] = thread_objective_functionals[t]->calculate_evaluation(evaluation_bound);
+   }
+
+   for(int t = 0; t < threads; t++)
+   {
+      calculate_evaluation_count += thread_objective_functionals[t]->get_calculate_evaluation_count();
+   }
+
+   return(potential_evaluation);
+}
+
+
+// Vector<double> calculate_perturbed_evaluation(const Vector<double>&, const Matrix<int>&, const Matrix<double>&) method
+
+/// This method returns the objective evaluations for a batch of perturbations of a vector of parameters, as 
+/// needed by numerical differentiation. 
+/// Each perturbation adds an increment to one or two parameters. 
+/// When compiled with OpenMP and with more than one thread, the perturbations are evaluated concurrently, each 
+/// thread on its own clone of the multilayer perceptron and this objective functional, and the evaluation counts of
+/// the clones are added to that of this objective functional.
+/// The parameters of the multilayer perceptron are the same after this method as before it. 
+/// The perturbed evaluations are not looked for in the evaluation cache nor stored there. 
+/// @param parameters Vector of parameters to be perturbed.
+/// @param perturbed_parameters Matrix with the indices of the perturbed parameters, one row for each perturbation 
+/// and two columns. An index of -1 means that no parameter is perturbed.
+/// @param increments Matrix with the increments of the perturbed parameters, of the same size as the matrix of
+/// indices. 
+
+Vector<double> ObjectiveFunctional::calculate_perturbed_evaluation
+(const Vector<double>& parameters, const Matrix<int>& perturbed_parameters, const Matrix<double>& increments)
 {
-   // Control sentence (if debug)
+   int perturbations_number = perturbed_parameters.get_rows_number();
 
-   #ifdef _DEBUG 
+   Vector<double> perturbed_evaluation(perturbations_number);
 
-   int size = potential_parameters.get_size();
+   if(perturbations_number == 0)
+   {
+      return(perturbed_evaluation);
+   }
 
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+   int threads = 1;
 
-   if(size != parameters_number)
+   #ifdef _OPENMP
+
+   threads = threads_number > 0 ? threads_number : omp_get_max_threads();
+
+   #endif
+
+   if(threads > perturbations_number)
    {
-      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "double calculate_potential_evaluation(const Vector<double>&) method." << std::endl
-                << "Size (" << size << ") must be equal to number of parameters (" << parameters_number << ")." << std::endl;
+      threads = perturbations_number;
+   }
 
-      exit(1);
+   // Each thread works on its own clones and its own copy of the parameters, which it perturbs and restores
+
+   Vector<MultilayerPerceptron*> multilayer_perceptrons(threads, multilayer_perceptron_pointer);
+   Vector<ObjectiveFunctional*> objective_functionals(threads, this);
+
+   Vector< Vector<double> > potential_parameters(threads, parameters);
+
+   Vector<double> original_parameters;
+
+   if(threads > 1)
+   {
+      update_thread_replicas(threads);
+
+      for(int t = 0; t < threads; t++)
+      {
+         multilayer_perceptrons[t] = thread_multilayer_perceptrons[t];
+         objective_functionals[t] = thread_objective_functionals[t];
+      }
+   }
+   else
+   {
+      original_parameters = multilayer_perceptron_pointer->get_parameters();
    }
 
+   #ifdef _OPENMP
+
+   #pragma omp parallel for schedule(dynamic) num_threads(threads)
+
    #endif
 
-   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+   for(int k = 0; k < perturbations_number; k++)
+   {
+      int t = 0;
 
-   // Set potential parameters
+      #ifdef _OPENMP
 
-   multilayer_perceptron_pointer->set_parameters(potential_parameters);
+      t = omp_get_thread_num();
 
-   // Get Objective
+      #endif
 
-   double potential_evaluation = calculate_evaluation();
+      int i = perturbed_parameters[k][0];
+      int j = perturbed_parameters[k][1];
 
-   // Restart original parameters
+      double parameter_i = i >= 0 ? potential_parameters[t][i] : 0.0;
+      double parameter_j = j >= 0 ? potential_parameters[t][j] : 0.0;
 
-   multilayer_perceptron_pointer->set_parameters(parameters);
+      // Perturb parameters i and j
 
-   return(potential_evaluation);
+      if(i >= 0)
+      {
+         potential_parameters[t][i] += increments[k][0];
+      }
+
+      if(j >= 0)
+      {
+         potential_parameters[t][j] += increments[k][1];
+      }
+
+      multilayer_perceptrons[t]->set_parameters(potential_parameters[t]);
+
+      perturbed_evaluation[k] = objective_functionals[t]->calculate_uncached_evaluation();
+
+      // Restart parameters i and j
+
+      if(j >= 0)
+      {
+         potential_parameters[t][j] = parameter_j;
+      }
+
+      if(i >= 0)
+      {
+         potential_parameters[t][i] = parameter_i;
+      }
+   }
+
+   if(threads > 1)
+   {
+      for(int t = 0; t < threads; t++)
+      {
+         calculate_evaluation_count += objective_functionals[t]->get_calculate_evaluation_count();
+      }
+   }
+   else
+   {
+      multilayer_perceptron_pointer->set_parameters(original_parameters);
+   }
+
+   return(perturbed_evaluation);
 }
 
 
 // Vector<double> calculate_gradient(void) method
 
 /// This method returns the objective function gradient, as the sum of the objective and the regularization gradient vectors. 
+/// If the evaluation cache is used and it contains the gradient for the parameters of the multilayer perceptron, 
+/// the remembered gradient is returned instead. 
 
 Vector<double> ObjectiveFunctional::calculate_gradient(void)
 {
+   Vector<double> parameters;
+
+   unsigned int hash = 0;
+
+   int entry = -1;
+
+   if(evaluation_cache_size != 0)
+   {
+      parameters = multilayer_perceptron_pointer->get_parameters();
+
+      hash = calculate_parameters_hash(parameters);
+
+      entry = find_evaluation_cache_entry(parameters, hash);
+
+      if(entry >= 0 && evaluation_cache_gradient_flags[entry])
+      {
+         evaluation_cache_hits_count++;
+
+         return(evaluation_cache_gradients[entry]);
+      }
+
+      evaluation_cache_misses_count++;
+   }
+
    // Increment number of gradients count
  
    calculate_gradient_count++;
 
+   Vector<double> gradient;
+
    if(regularization_method == None)
    {
-      return(calculate_objective_gradient()*objective_weight);   
+      gradient = calculate_objective_gradient()*objective_weight;   
    }
    else
    {
-      return(calculate_objective_gradient()*objective_weight + calculate_regularization_gradient()*regularization_weight);
+      gradient = calculate_objective_gradient()*objective_weight + calculate_regularization_gradient()*regularization_weight;
+   }
+
+   if(evaluation_cache_size != 0)
+   {
+      // The numerical differentiation of the gradient may have filled the evaluation cache  
+
+      entry = find_evaluation_cache_entry(parameters, hash);
+
+      if(entry < 0)
+      {
+         entry = insert_evaluation_cache_entry(parameters, hash);
+      }
+
+      evaluation_cache_gradients[entry] = gradient;
+      evaluation_cache_gradient_flags[entry] = true;
    }
+
+   return(gradient);
 }
 
 
@@ -750,6 +2015,85 @@ double ObjectiveFunctional::calculate_gradient_norm(void)
 }
 
 
+// Vector<double> calculate_batch_gradient(const Vector<int>&) method
+
+/// This method returns an estimate of the objective function gradient computed from a mini-batch of training 
+/// instances, which is used by the stochastic training algorithms. 
+/// The objective term is estimated from the mini-batch, while the regularization term is computed exactly. 
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+
+Vector<double> ObjectiveFunctional::calculate_batch_gradient(const Vector<int>& training_instances_indices)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> batch_gradient(parameters_number);
+
+   calculate_batch_gradient(training_instances_indices, batch_gradient);
+
+   return(batch_gradient);
+}
+
+
+// void calculate_batch_gradient(const Vector<int>&, Vector<double>&) method
+
+/// This method computes the same mini-batch estimate of the objective function gradient as 
+/// calculate_batch_gradient(const Vector<int>&), but writes it into a vector allocated by the caller. 
+/// The stochastic training algorithms reuse that vector for every mini-batch. 
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+/// @param batch_gradient Objective function gradient estimate. Its size must be the number of parameters. 
+
+void ObjectiveFunctional::calculate_batch_gradient(const Vector<int>& training_instances_indices, Vector<double>& batch_gradient)
+{
+   // Increment number of gradients count
+ 
+   calculate_gradient_count++;
+
+   calculate_batch_objective_gradient(training_instances_indices, batch_gradient);
+
+   batch_gradient *= objective_weight;
+
+   if(regularization_method != None)
+   {
+      Vector<double> regularization_gradient = calculate_regularization_gradient();
+
+      int parameters_number = batch_gradient.get_size();
+
+      for(int i = 0; i < parameters_number; i++)
+      {
+         batch_gradient[i] += regularization_weight*regularization_gradient[i];
+      }
+   }
+}
+
+
+// Vector<double> calculate_batch_objective_gradient(const Vector<int>&) method
+
+/// This method returns an estimate of the gradient of the objective term computed from a mini-batch of training 
+/// instances. 
+/// By default the objective term cannot be split into mini-batches, so this method returns the whole objective 
+/// gradient.
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+
+Vector<double> ObjectiveFunctional::calculate_batch_objective_gradient(const Vector<int>&)
+{
+   return(calculate_objective_gradient());
+}
+
+
+// void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&) method
+
+/// This method writes an estimate of the gradient of the objective term computed from a mini-batch of training 
+/// instances into a vector allocated by the caller. 
+/// By default it copies the result of calculate_batch_objective_gradient(const Vector<int>&). 
+/// @param training_instances_indices Indices of the training instances in the mini-batch. 
+/// @param batch_objective_gradient Objective gradient estimate. 
+
+void ObjectiveFunctional::calculate_batch_objective_gradient(const Vector<int>& training_instances_indices, Vector<double>& batch_objective_gradient)
+{
+   batch_objective_gradient = calculate_batch_objective_gradient(training_instances_indices);
+}
+
+
 // Vector<double> calculate_objective_gradient(void) method
 
 /// This method returns the default objective function gradient vector, which is computed using numerical 
@@ -913,6 +2257,7 @@ Vector<double> ObjectiveFunctional::calculate_neural_parameters_gradient_numeric
 
 /// This method returns the derivatives of the objective function with respect to the neural parameters 
 /// by means of the forward differences method for numerical differentiation. 
+/// The perturbed evaluations are computed concurrently when compiled with OpenMP. 
 
 Vector<double> ObjectiveFunctional::calculate_neural_parameters_gradient_forward_differences(void)
 {
@@ -920,44 +2265,42 @@ Vector<double> ObjectiveFunctional::calculate_neural_parameters_gradient_forward
 
    Vector<double> neural_parameters_gradient(neural_parameters_number);
 
+   if(neural_parameters_number == 0)
+   {
+      return(neural_parameters_gradient);
+   }
+
    // Multilayer perceptron stuff
 
-   Vector<double> potential_neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();   
+   Vector<double> neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();   
 
    Vector<double> scaled_independent_parameters = multilayer_perceptron_pointer->scale_independent_parameters();
 
+   Vector<double> potential_parameters = neural_parameters.assemble(scaled_independent_parameters);
+
    // Objective functional stuff
 
    double evaluation = calculate_evaluation();
 
-   double evaluation_forward;
-
-   double actual_epsilon;
+   // Add epsilon to each parameter
 
-   // Calculate gradient
+   Matrix<int> perturbed_parameters(neural_parameters_number, 2, -1);
+   Matrix<double> increments(neural_parameters_number, 2, 0.0);
 
    for(int i = 0; i < neural_parameters_number; i++)
    {
-      // Calculate actual epsilon
-
-      actual_epsilon = calculate_actual_epsilon(potential_neural_parameters[i]);
-
-	  // Add epsilon to parameter
-
-      potential_neural_parameters[i] += actual_epsilon;
-
-      // Get potential evaluation
-
-      evaluation_forward = calculate_potential_evaluation(potential_neural_parameters.assemble(scaled_independent_parameters));
-
-      // Restart parameter
+      perturbed_parameters[i][0] = i;
+      increments[i][0] = calculate_actual_epsilon(neural_parameters[i]);
+   }
 
-      potential_neural_parameters[i] -= actual_epsilon;
+   Vector<double> evaluation_forward = calculate_perturbed_evaluation(potential_parameters, perturbed_parameters, increments);
 
-      // Calculate derivative
+   // Calculate gradient
 
-      neural_parameters_gradient[i] = (evaluation_forward - evaluation)/actual_epsilon;
-   }// end for 
+   for(int i = 0; i < neural_parameters_number; i++)
+   {
+      neural_parameters_gradient[i] = (evaluation_forward[i] - evaluation)/increments[i][0];
+   }
 
    return(neural_parameters_gradient);
 }
@@ -967,6 +2310,7 @@ Vector<double> ObjectiveFunctional::calculate_neural_parameters_gradient_forward
 
 /// This method returns the derivatives of the objective function with respect to the neural parameters 
 /// by means of the central differences method for numerical differentiation. 
+/// The perturbed evaluations are computed concurrently when compiled with OpenMP. 
 
 Vector<double> ObjectiveFunctional::calculate_neural_parameters_gradient_central_differences(void)
 {
@@ -974,50 +2318,41 @@ Vector<double> ObjectiveFunctional::calculate_neural_parameters_gradient_central
 
    Vector<double> neural_parameters_gradient(neural_parameters_number);
 
-   Vector<double> potential_neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();   
-
-   Vector<double> scaled_independent_parameters = multilayer_perceptron_pointer->scale_independent_parameters();
-
-   double actual_epsilon;
-
-   double evaluation_forward;
-   double evaluation_backward;
-
-   for(int i = 0; i < neural_parameters_number; i++)
+   if(neural_parameters_number == 0)
    {
-      // Calculate actual epsilon
-
-      actual_epsilon = calculate_actual_epsilon(potential_neural_parameters[i]);
-
-      // Add epsilon to parameter
-
-      potential_neural_parameters[i] += actual_epsilon;
-
-      // Get potential evaluation
-
-      evaluation_forward = calculate_potential_evaluation(potential_neural_parameters.assemble(scaled_independent_parameters));
+      return(neural_parameters_gradient);
+   }
 
-      // Restart parameter
+   Vector<double> neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();   
 
-      potential_neural_parameters[i] -= actual_epsilon;
+   Vector<double> scaled_independent_parameters = multilayer_perceptron_pointer->scale_independent_parameters();
 
-      // Substract epsilon from parameter
+   Vector<double> potential_parameters = neural_parameters.assemble(scaled_independent_parameters);
 
-      potential_neural_parameters[i] -= actual_epsilon;
+   // Add and substract epsilon to each parameter
 
-      // Get potential evaluation
+   Matrix<int> perturbed_parameters(2*neural_parameters_number, 2, -1);
+   Matrix<double> increments(2*neural_parameters_number, 2, 0.0);
 
-      evaluation_backward = calculate_potential_evaluation(potential_neural_parameters.assemble(scaled_independent_parameters));
+   for(int i = 0; i < neural_parameters_number; i++)
+   {
+      double actual_epsilon = calculate_actual_epsilon(neural_parameters[i]);
 
-      // Restart parameter
+      perturbed_parameters[2*i][0] = i;
+      increments[2*i][0] = actual_epsilon;
 
-      potential_neural_parameters[i] += actual_epsilon;
+      perturbed_parameters[2*i+1][0] = i;
+      increments[2*i+1][0] = -actual_epsilon;
+   }
 
-      // Calculate derivative
+   Vector<double> perturbed_evaluation = calculate_perturbed_evaluation(potential_parameters, perturbed_parameters, increments);
 
-      neural_parameters_gradient[i] = (evaluation_forward - evaluation_backward)/(2.0*actual_epsilon);
+   // Calculate gradient
 
-   }// end for
+   for(int i = 0; i < neural_parameters_number; i++)
+   {
+      neural_parameters_gradient[i] = (perturbed_evaluation[2*i] - perturbed_evaluation[2*i+1])/(2.0*increments[2*i][0]);
+   }
 
    return(neural_parameters_gradient);
 }
@@ -1065,16 +2400,25 @@ Vector<double> ObjectiveFunctional::calculate_independent_parameters_gradient_nu
 
 /// This method returns the derivatives of the objective function with respect to the independent parameters 
 /// by means of the forward differences method for numerical differentiation. 
+/// The perturbed evaluations are computed concurrently when compiled with OpenMP. 
 
 Vector<double> ObjectiveFunctional::calculate_independent_parameters_gradient_forward_differences(void)
 {
-
    // Multilayer perceptron stuff
 
    Vector<double> neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();
 
+   int neural_parameters_number = neural_parameters.get_size();
+
    int independent_parameters_number = multilayer_perceptron_pointer->get_independent_parameters_number();
 
+   Vector<double> independent_parameters_gradient(independent_parameters_number, 0.0);
+
+   if(independent_parameters_number == 0)
+   {
+      return(independent_parameters_gradient);
+   }
+
    Vector<double> scaled_independent_parameters = multilayer_perceptron_pointer->scale_independent_parameters();   
 
    Vector<double> independent_parameters_lower_bound 
@@ -1083,49 +2427,57 @@ Vector<double> ObjectiveFunctional::calculate_independent_parameters_gradient_fo
    Vector<double> independent_parameters_upper_bound 
    = multilayer_perceptron_pointer->get_independent_parameters_upper_bound();
 
-   // Objective functional stuff
+   Vector<double> potential_parameters = neural_parameters.assemble(scaled_independent_parameters);
 
-   double evaluation = calculate_evaluation();
+   // Independent parameters with equal lower and upper bounds are fixed, and their derivatives are zero
 
-   Vector<double> independent_parameters_gradient(independent_parameters_number);
+   bool bounds = independent_parameters_lower_bound.get_size() != 0 && independent_parameters_upper_bound.get_size() != 0;
 
-   double evaluation_forward;
-   double actual_epsilon;
+   Vector<int> free_independent_parameters(independent_parameters_number);
 
-   // Calculate gradient
+   int free_independent_parameters_number = 0;
 
    for(int i = 0; i < independent_parameters_number; i++)
    {
-      if(independent_parameters_lower_bound != 0 && independent_parameters_upper_bound != 0)
+      if(!bounds || independent_parameters_lower_bound[i] != independent_parameters_upper_bound[i])
       {
-         if(independent_parameters_lower_bound[i] == independent_parameters_upper_bound[i])
-         {
-            independent_parameters_gradient[i] = 0.0;      
-         }
+         free_independent_parameters[free_independent_parameters_number] = i;
+         free_independent_parameters_number++;
       }
-      else
-      {
-         // Calculate actual epsilon
+   }
+
+   if(free_independent_parameters_number == 0)
+   {
+      return(independent_parameters_gradient);
+   }
+
+   // Objective functional stuff
 
-         actual_epsilon = calculate_actual_epsilon(scaled_independent_parameters[i]);
+   double evaluation = calculate_evaluation();
 
-         // Add epsilon to parameter
+   // Add epsilon to each free parameter
 
-         scaled_independent_parameters[i] += actual_epsilon;
+   Matrix<int> perturbed_parameters(free_independent_parameters_number, 2, -1);
+   Matrix<double> increments(free_independent_parameters_number, 2, 0.0);
 
-         // Get potential evaluation
+   for(int k = 0; k < free_independent_parameters_number; k++)
+   {
+      int i = free_independent_parameters[k];
 
-         evaluation_forward = calculate_potential_evaluation(neural_parameters.assemble(scaled_independent_parameters));
+      perturbed_parameters[k][0] = neural_parameters_number + i;
+      increments[k][0] = calculate_actual_epsilon(scaled_independent_parameters[i]);
+   }
 
-         // Restart parameter
+   Vector<double> evaluation_forward = calculate_perturbed_evaluation(potential_parameters, perturbed_parameters, increments);
 
-         scaled_independent_parameters[i] -= actual_epsilon;
+   // Calculate gradient
 
-         // Calculate derivative
+   for(int k = 0; k < free_independent_parameters_number; k++)
+   {
+      int i = free_independent_parameters[k];
 
-         independent_parameters_gradient[i] = (evaluation_forward - evaluation)/actual_epsilon;
-      }
-   }// end for 
+      independent_parameters_gradient[i] = (evaluation_forward[k] - evaluation)/increments[k][0];
+   }
 
    return(independent_parameters_gradient);
 }
@@ -1134,7 +2486,8 @@ Vector<double> ObjectiveFunctional::calculate_independent_parameters_gradient_fo
 // Vector<double> calculate_independent_parameters_gradient_central_differences(void) method 
 
 /// This method returns the derivatives of the objective function with respect to the independent parameters 
-/// by means of the forward differences method for numerical differentiation. 
+/// by means of the central differences method for numerical differentiation. 
+/// The perturbed evaluations are computed concurrently when compiled with OpenMP. 
 
 Vector<double> ObjectiveFunctional::calculate_independent_parameters_gradient_central_differences(void)
 {
@@ -1142,8 +2495,17 @@ Vector<double> ObjectiveFunctional::calculate_independent_parameters_gradient_ce
 
    Vector<double> neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();
 
+   int neural_parameters_number = neural_parameters.get_size();
+
    int independent_parameters_number = multilayer_perceptron_pointer->get_independent_parameters_number();
 
+   Vector<double> independent_parameters_gradient(independent_parameters_number, 0.0);
+
+   if(independent_parameters_number == 0)
+   {
+      return(independent_parameters_gradient);
+   }
+
    Vector<double> scaled_independent_parameters = multilayer_perceptron_pointer->scale_independent_parameters();   
 
    Vector<double> independent_parameters_lower_bound 
@@ -1152,59 +2514,58 @@ Vector<double> ObjectiveFunctional::calculate_independent_parameters_gradient_ce
    Vector<double> independent_parameters_upper_bound 
    = multilayer_perceptron_pointer->get_independent_parameters_upper_bound();
 
-   // Calculate gradient
+   Vector<double> potential_parameters = neural_parameters.assemble(scaled_independent_parameters);
 
-   Vector<double> independent_parameters_gradient(independent_parameters_number);
+   // Independent parameters with equal lower and upper bounds are fixed, and their derivatives are zero
 
-   double actual_epsilon;
+   bool bounds = independent_parameters_lower_bound.get_size() != 0 && independent_parameters_upper_bound.get_size() != 0;
 
-   double evaluation_forward;
-   double evaluation_backward;
+   Vector<int> free_independent_parameters(independent_parameters_number);
+
+   int free_independent_parameters_number = 0;
 
    for(int i = 0; i < independent_parameters_number; i++)
    {
-      if(independent_parameters_lower_bound.get_size() != 0 && independent_parameters_upper_bound.get_size() != 0)
+      if(!bounds || independent_parameters_lower_bound[i] != independent_parameters_upper_bound[i])
       {
-         if(independent_parameters_lower_bound[i] == independent_parameters_upper_bound[i])
-         {
-            independent_parameters_gradient[i] = 0.0;      
-         }
+         free_independent_parameters[free_independent_parameters_number] = i;
+         free_independent_parameters_number++;
       }
-      else
-      {
-         // Calculate actual epsilon
-
-         actual_epsilon = calculate_actual_epsilon(scaled_independent_parameters[i]);
-
-         // Add epsilon to parameter
-
-         scaled_independent_parameters[i] += actual_epsilon;
-
-         // Get potential evaluation
+   }
 
-         evaluation_forward = calculate_potential_evaluation(neural_parameters.assemble(scaled_independent_parameters));
+   if(free_independent_parameters_number == 0)
+   {
+      return(independent_parameters_gradient);
+   }
 
-         // Restart parameter
+   // Add and substract epsilon to each free parameter
 
-         scaled_independent_parameters[i] -= actual_epsilon;
+   Matrix<int> perturbed_parameters(2*free_independent_parameters_number, 2, -1);
+   Matrix<double> increments(2*free_independent_parameters_number, 2, 0.0);
 
-         // Substract epsilon from parameter
+   for(int k = 0; k < free_independent_parameters_number; k++)
+   {
+      int i = free_independent_parameters[k];
 
-         scaled_independent_parameters[i] -= actual_epsilon;
+      double actual_epsilon = calculate_actual_epsilon(scaled_independent_parameters[i]);
 
-         // Get potential evaluation
+      perturbed_parameters[2*k][0] = neural_parameters_number + i;
+      increments[2*k][0] = actual_epsilon;
 
-         evaluation_backward = calculate_potential_evaluation(neural_parameters.assemble(scaled_independent_parameters));
+      perturbed_parameters[2*k+1][0] = neural_parameters_number + i;
+      increments[2*k+1][0] = -actual_epsilon;
+   }
 
-         // Restart parameter
+   Vector<double> perturbed_evaluation = calculate_perturbed_evaluation(potential_parameters, perturbed_parameters, increments);
 
-         scaled_independent_parameters[i] += actual_epsilon;
+   // Calculate gradient
 
-         // Calculate derivative
+   for(int k = 0; k < free_independent_parameters_number; k++)
+   {
+      int i = free_independent_parameters[k];
 
-         independent_parameters_gradient[i] = (evaluation_forward - evaluation_backward)/(2.0*actual_epsilon);
-      }
-   }// end for
+      independent_parameters_gradient[i] = (perturbed_evaluation[2*k] - perturbed_evaluation[2*k+1])/(2.0*increments[2*k][0]);
+   }
 
    return(independent_parameters_gradient);
 }
@@ -1295,19 +2656,91 @@ Vector<double> ObjectiveFunctional::calculate_potential_gradient(const Vector<do
 
 /// This method returns the Hessian matrix of the objective function calculated by means of
 /// the forward differences method for numerical differentiation. 
-/// @todo This method is not yet implemented. 
+/// The evaluation at the current parameters and the evaluations with a single perturbed parameter are shared by all
+/// the elements, and only the upper part of the matrix is computed, so that it needs about n^2/2 evaluations, while
+/// central differences need about 2n^2. 
+/// The perturbed evaluations are computed concurrently when compiled with OpenMP. 
+
+Matrix<double> ObjectiveFunctional::calculate_Hessian_forward_differences(void)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Matrix<double> Hessian(parameters_number, parameters_number);
+
+   if(parameters_number == 0)
+   {
+      return(Hessian);
+   }
+
+   Vector<double> potential_parameters = multilayer_perceptron_pointer->get_parameters();
+
+   Vector<double> actual_epsilon(parameters_number);
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      actual_epsilon[i] = calculate_actual_epsilon(potential_parameters[i]);
+   }
+
+   // Perturb each parameter, and each pair of parameters in the upper part of the Hessian matrix
+
+   int perturbations_number = 1 + parameters_number + parameters_number*(parameters_number+1)/2;
+
+   Matrix<int> perturbed_parameters(perturbations_number, 2, -1);
+   Matrix<double> increments(perturbations_number, 2, 0.0);
+
+   Matrix<int> perturbation_index(parameters_number, parameters_number, 0);
+
+   int k = 1;
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      perturbed_parameters[k][0] = i;
+      increments[k][0] = actual_epsilon[i];
+
+      k++;
+   }
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      for(int j = i; j < parameters_number; j++)
+      {
+         perturbed_parameters[k][0] = i;
+         increments[k][0] = actual_epsilon[i];
+
+         perturbed_parameters[k][1] = j;
+         increments[k][1] = actual_epsilon[j];
+
+         perturbation_index[i][j] = k;
+
+         k++;
+      }
+   }
+
+   Vector<double> perturbed_evaluation = calculate_perturbed_evaluation(potential_parameters, perturbed_parameters, increments);
+
+   double evaluation = perturbed_evaluation[0];
+
+   // Calculate second derivatives
 
-Matrix<double> ObjectiveFunctional::calculate_Hessian_forward_differences(void)
-{
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+   for(int i = 0; i < parameters_number; i++)
+   {
+      for(int j = i; j < parameters_number; j++)
+      {
+         Hessian[i][j] = (perturbed_evaluation[perturbation_index[i][j]] - perturbed_evaluation[1+i] 
+                       - perturbed_evaluation[1+j] + evaluation)
+                       /(actual_epsilon[i]*actual_epsilon[j]);
+      }
+   }
 
-   Matrix<double> Hessian(parameters_number, parameters_number);
+   // Obtain the rest of elements by symmetry
 
-   std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-             << "Matrix<double> calculate_Hessian_forward_differences(void) method." << std::endl
-             << "Numerical differentiation of Hessian matrix with forward differences is not yet implemented." << std::endl
-             << "Please use central differences." << std::endl;
-//   exit(1);
+   for(int i = 0; i < parameters_number; i++)
+   {
+      for(int j = 0; j < i; j++)
+      {
+         Hessian[i][j] = Hessian[j][i];
+      }
+   }
 
    return(Hessian);
 }
@@ -1317,6 +2750,9 @@ Matrix<double> ObjectiveFunctional::calculate_Hessian_forward_differences(void)
 
 /// This method returns the Hessian matrix of the objective function calculated by means of
 /// the central differences method for numerical differentiation. 
+/// Only the upper part of the matrix is computed, and the evaluation at the current parameters is shared by all the
+/// diagonal elements. 
+/// The perturbed evaluations are computed concurrently when compiled with OpenMP. 
 
 Matrix<double> ObjectiveFunctional::calculate_Hessian_central_differences(void)
 {
@@ -1324,91 +2760,86 @@ Matrix<double> ObjectiveFunctional::calculate_Hessian_central_differences(void)
 
    Matrix<double> Hessian(parameters_number, parameters_number);
 
-   Vector<double> potential_parameters = multilayer_perceptron_pointer->get_parameters();
-
-   double actual_epsilon_i = 0.0;
-   double actual_epsilon_j = 0.0;
+   if(parameters_number == 0)
+   {
+      return(Hessian);
+   }
 
-   double evaluation_backward_backward = 0.0; 
-   double evaluation_backward_forward = 0.0;
-   double evaluation_forward_backward = 0.0; 
-   double evaluation_forward_forward = 0.0;
+   Vector<double> potential_parameters = multilayer_perceptron_pointer->get_parameters();
 
-   // Obtain the upper part of the Hessian matrix
+   Vector<double> actual_epsilon(parameters_number);
 
    for(int i = 0; i < parameters_number; i++)
    {
-      // Calculate actual epsilon
-
-      actual_epsilon_i = calculate_actual_epsilon(potential_parameters[i]);
-
-      for(int j = i; j < parameters_number; j++)
-      {
-         // Calculate actual epsilon
-
-         actual_epsilon_j = calculate_actual_epsilon(potential_parameters[j]);
-             
-         // Perturb potential parameters i and j
-
-         potential_parameters[i] += actual_epsilon_i;
-         potential_parameters[j] += actual_epsilon_j;
-
-         // Calculate evaluation
-
-         evaluation_forward_forward = calculate_potential_evaluation(potential_parameters);
-
-         // Restart potential parameters i and j
+      actual_epsilon[i] = calculate_actual_epsilon(potential_parameters[i]);
+   }
 
-         potential_parameters[i] -= actual_epsilon_i;
-         potential_parameters[j] -= actual_epsilon_j;
+   // Perturb each pair of parameters in the upper part of the Hessian matrix. 
+   // Diagonal elements need the evaluations at x+2h, x and x-2h, and the rest at x+h+k, x+h-k, x-h+k and x-h-k
 
-         // Perturb potential parameters i and j
+   int perturbations_number = 1 + 2*parameters_number + 4*(parameters_number*(parameters_number-1)/2);
 
-         potential_parameters[i] += actual_epsilon_i;
-         potential_parameters[j] -= actual_epsilon_j;
+   Matrix<int> perturbed_parameters(perturbations_number, 2, -1);
+   Matrix<double> increments(perturbations_number, 2, 0.0);
 
-         // Calculate evaluation
+   Matrix<int> perturbation_index(parameters_number, parameters_number, 0);
 
-         evaluation_forward_backward = calculate_potential_evaluation(potential_parameters);
+   const double signs[4][2] = {{1.0, 1.0}, {1.0, -1.0}, {-1.0, 1.0}, {-1.0, -1.0}};
 
-         // Restart potential parameters i and j
+   int k = 1;
 
-         potential_parameters[i] -= actual_epsilon_i;
-         potential_parameters[j] += actual_epsilon_j;
+   for(int i = 0; i < parameters_number; i++)
+   {
+      perturbation_index[i][i] = k;
 
-         // Perturb potential parameters i and j
+      for(int l = 0; l < 4; l += 3)
+      {
+         perturbed_parameters[k][0] = i;
+         increments[k][0] = signs[l][0]*actual_epsilon[i];
 
-         potential_parameters[i] -= actual_epsilon_i;
-         potential_parameters[j] += actual_epsilon_j;
+         perturbed_parameters[k][1] = i;
+         increments[k][1] = signs[l][1]*actual_epsilon[i];
 
-         // Calculate evaluation
+         k++;
+      }
 
-         evaluation_backward_forward = calculate_potential_evaluation(potential_parameters);
+      for(int j = i+1; j < parameters_number; j++)
+      {
+         perturbation_index[i][j] = k;
 
-         // Restart potential parameters i and j
+         for(int l = 0; l < 4; l++)
+         {
+            perturbed_parameters[k][0] = i;
+            increments[k][0] = signs[l][0]*actual_epsilon[i];
 
-         potential_parameters[i] += actual_epsilon_i;
-         potential_parameters[j] -= actual_epsilon_j;
+            perturbed_parameters[k][1] = j;
+            increments[k][1] = signs[l][1]*actual_epsilon[j];
 
-         // Perturb potential parameters i and j
+            k++;
+         }
+      }
+   }
 
-         potential_parameters[i] -= actual_epsilon_i;
-         potential_parameters[j] -= actual_epsilon_j;
+   Vector<double> perturbed_evaluation = calculate_perturbed_evaluation(potential_parameters, perturbed_parameters, increments);
 
-         // Calculate evaluation
+   double evaluation = perturbed_evaluation[0];
 
-         evaluation_backward_backward = calculate_potential_evaluation(potential_parameters);
+   // Calculate second derivatives
 
-         // Restart potential parameters i and j
+   for(int i = 0; i < parameters_number; i++)
+   {
+      k = perturbation_index[i][i];
 
-         potential_parameters[i] += actual_epsilon_i;
-         potential_parameters[j] += actual_epsilon_j;
+      Hessian[i][i] = (perturbed_evaluation[k] - 2.0*evaluation + perturbed_evaluation[k+1])
+                    /(4.0*actual_epsilon[i]*actual_epsilon[i]);
 
-         // Calculate second derivative
+      for(int j = i+1; j < parameters_number; j++)
+      {
+         k = perturbation_index[i][j];
 
-         Hessian[i][j] = (evaluation_forward_forward - evaluation_forward_backward
-                       - evaluation_backward_forward + evaluation_backward_backward)
-                       /(4.0*pow(numerical_epsilon,2));
+         Hessian[i][j] = (perturbed_evaluation[k] - perturbed_evaluation[k+1]
+                       - perturbed_evaluation[k+2] + perturbed_evaluation[k+3])
+                       /(4.0*actual_epsilon[i]*actual_epsilon[j]);
       }
    }
 
@@ -1529,6 +2960,68 @@ Matrix<double> ObjectiveFunctional::calculate_potential_Hessian(const Vector<dou
 }
 
 
+// Matrix<double> calculate_regularization_Hessian(void) method
+
+/// This method returns the Hessian matrix of the regularization term. 
+/// It is computed analytically for all the regularization methods. 
+
+Matrix<double> ObjectiveFunctional::calculate_regularization_Hessian(void)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Matrix<double> regularization_Hessian(parameters_number, parameters_number, 0.0);
+
+   switch(regularization_method)   
+   {
+      case None:
+      {
+         return(regularization_Hessian);
+      }             
+      break;
+
+      case NeuralParametersNorm:
+      {  
+         Vector<double> neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();                     
+
+         int neural_parameters_number = neural_parameters.get_size();
+
+         double neural_parameters_norm = neural_parameters.calculate_norm();
+
+         if(neural_parameters_norm < 1.0e-99)
+         {
+            return(regularization_Hessian);
+         }
+
+         // The Hessian of the norm is (I - w*w'/(w'*w))/|w|
+
+         for(int i = 0; i < neural_parameters_number; i++)
+         {
+            for(int j = 0; j < neural_parameters_number; j++)
+            {
+               regularization_Hessian[i][j] 
+               = -neural_parameters[i]*neural_parameters[j]/(neural_parameters_norm*neural_parameters_norm*neural_parameters_norm);
+            }
+
+            regularization_Hessian[i][i] += 1.0/neural_parameters_norm;
+         }
+
+         return(regularization_Hessian);
+      }             
+      break;
+
+      default:
+      {
+         std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                   << "Matrix<double> calculate_regularization_Hessian(void) method." << std::endl
+                   << "Unknown regularization method." << std::endl;
+ 
+         exit(1);       	  
+      }
+      break;
+   }   
+}
+
+
 // Matrix<double> calculate_inverse_Hessian(void) method
 
 /// This method returns inverse matrix of the Hessian.
@@ -1626,69 +3119,177 @@ const Vector<double>& old_parameters, const Vector<double>& parameters, const Ve
  
    #endif
 
-   // Parameters difference Vector
-   
-   Vector<double> parameters_difference = parameters - old_parameters;
-   
+   // Update a copy of the old inverse Hessian
+
+   Matrix<double> DFP_inverse_Hessian(old_inverse_Hessian);
+
+   update_DFP_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, DFP_inverse_Hessian);
+
+   return(DFP_inverse_Hessian);               
+
+}
+
+
+// Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Matrix<double>&, const Vector<double>&, const Vector<double>&) method
+
+/// This method returns an approximation of the inverse Hessian matrix according to the 
+/// Broyden-Fletcher-Goldfarb-Shanno (BGFS) algorithm. 
+/// @param old_parameters A previous set of parameters.
+/// @param old_gradient The gradient of the objective function for that previous set of parameters.
+/// @param old_inverse_Hessian The Hessian of the objective function for that previous set of parameters.
+/// @param parameters Actual set of parameters.
+/// @param gradient The gradient of the objective function for the actual set of parameters.
+
+Matrix<double> ObjectiveFunctional::calculate_BFGS_inverse_Hessian(
+const Vector<double>& old_parameters, const Vector<double>& parameters, const Vector<double>& old_gradient, const Vector<double>& gradient, const Matrix<double>& old_inverse_Hessian)
+{
    // Control sentence (if debug)
 
    #ifdef _DEBUG 
 
-   if(parameters_difference > -1.0e-50 && parameters_difference < 1.0e-50)
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();            
+
+   int old_parameters_size = old_parameters.get_size();
+   int parameters_size = parameters.get_size();
+    
+   if(old_parameters_size != parameters_number)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Parameters difference vector is zero." << std::endl;
+                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "Size of old parameters vector must be equal to number of parameters." << std::endl;
 
       exit(1);
    }
+   else if(parameters_size != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "Size of parameters vector must be equal to number of parameters." << std::endl;
 
-   #endif
-
-   // Gradient difference Vector
-   
-   Vector<double> gradient_difference = gradient - old_gradient;
-
-   // Control sentence (if debug)
+      exit(1);
+   }
 
-   #ifdef _DEBUG 
+   int old_gradient_size = old_gradient.get_size();
+   int gradient_size = gradient.get_size();
 
-   if(gradient_difference > -1.0e-50 && gradient_difference < 1.0e-50)
+   if(old_gradient_size != parameters_number)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Gradient difference vector is zero." << std::endl;
+                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "Size of old gradient vector must be equal to number of parameters." << std::endl;
 
       exit(1);
    }
+   else if(gradient_size != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "Size of gradient vector must be equal to number of parameters." << std::endl;
 
-   #endif
+      exit(1);
+   }
 
-   // Control sentence (if debug)
+   int rows_number = old_inverse_Hessian.get_rows_number();
+   int columns_number = old_inverse_Hessian.get_columns_number();
 
-   #ifdef _DEBUG 
+   if(rows_number != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "Number of rows in old inverse Hessian must be equal to number of parameters." << std::endl;
 
-   if(old_inverse_Hessian > -1.0e-50 && old_inverse_Hessian < 1.0e-50)
+      exit(1);
+   }
+   else if(columns_number != parameters_number)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Old inverse Hessian matrix is zero." << std::endl;
+                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "Number of columns in old inverse Hessian must be equal to number of parameters." << std::endl;
 
       exit(1);
    }
 
-   if(fabs(parameters_difference.dot(gradient_difference)) < 1.0e-50)
+   #endif
+
+   // Update a copy of the old inverse Hessian
+
+   Matrix<double> BFGS_inverse_Hessian(old_inverse_Hessian);
+
+   update_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, BFGS_inverse_Hessian);
+
+   return(BFGS_inverse_Hessian);               
+}
+
+
+// void update_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&) method
+
+/// This method updates in place an approximation of the inverse Hessian matrix according to the 
+/// Davidon-Fletcher-Powel (DFP) algorithm. 
+/// Only the upper triangle is computed, and it is then mirrored into the lower triangle. 
+/// No temporary matrices are created, and the rows are distributed among threads when OpenMP is enabled. 
+/// The work vectors are local to each call, so that this method is reentrant but allocates them every time. 
+/// @param old_parameters A previous set of parameters.
+/// @param parameters Actual set of parameters.
+/// @param old_gradient The gradient of the objective function for that previous set of parameters.
+/// @param gradient The gradient of the objective function for the actual set of parameters.
+/// @param inverse_Hessian Inverse Hessian for the previous set of parameters on input, and for the actual set of parameters on output.
+
+void ObjectiveFunctional::update_DFP_inverse_Hessian(
+const Vector<double>& old_parameters, const Vector<double>& parameters, const Vector<double>& old_gradient, const Vector<double>& gradient, Matrix<double>& inverse_Hessian)
+{
+   Vector<double> parameters_difference;
+   Vector<double> gradient_difference;
+   Vector<double> inverse_Hessian_dot_gradient_difference;
+
+   update_DFP_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+   parameters_difference, gradient_difference, inverse_Hessian_dot_gradient_difference);
+}
+
+
+// void update_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method
+
+/// This method updates in place an approximation of the inverse Hessian matrix according to the 
+/// Davidon-Fletcher-Powel (DFP) algorithm, using work vectors supplied by the caller. 
+/// The work vectors are only reallocated when the number of parameters changes, so that a caller which keeps them
+/// between iterations does not allocate any memory. 
+/// This method does not use any member of the objective functional, but it is not reentrant for the work vectors: 
+/// two calls which run at the same time must not share them. 
+/// @param old_parameters A previous set of parameters.
+/// @param parameters Actual set of parameters.
+/// @param old_gradient The gradient of the objective function for that previous set of parameters.
+/// @param gradient The gradient of the objective function for the actual set of parameters.
+/// @param inverse_Hessian Inverse Hessian for the previous set of parameters on input, and for the actual set of parameters on output.
+/// @param parameters_difference Work vector for the parameters difference. 
+/// @param gradient_difference Work vector for the gradient difference. 
+/// @param inverse_Hessian_dot_gradient_difference Work vector for the dot product of the inverse Hessian and the 
+/// gradient difference. 
+
+void ObjectiveFunctional::update_DFP_inverse_Hessian(
+const Vector<double>& old_parameters, const Vector<double>& parameters, const Vector<double>& old_gradient, const Vector<double>& gradient, Matrix<double>& inverse_Hessian, 
+Vector<double>& parameters_difference, Vector<double>& gradient_difference, Vector<double>& inverse_Hessian_dot_gradient_difference)
+{
+   calculate_inverse_Hessian_update_vectors(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+   parameters_difference, gradient_difference, inverse_Hessian_dot_gradient_difference);
+
+   double parameters_difference_dot_gradient_difference = parameters_difference.dot(gradient_difference);
+   double gradient_difference_dot_inverse_Hessian_dot_gradient_difference = gradient_difference.dot(inverse_Hessian_dot_gradient_difference);
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(fabs(parameters_difference_dot_gradient_difference) < 1.0e-50)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "void update_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method." << std::endl
                 << "Denominator of first term is zero." << std::endl;
 
       exit(1);
    }
-   else if(fabs(gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference)) < 1.0e-50)
+   else if(fabs(gradient_difference_dot_inverse_Hessian_dot_gradient_difference) < 1.0e-50)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
+                << "void update_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method." << std::endl
                 << "Denominator of second term is zero." << std::endl;
 
       exit(1);
@@ -1696,198 +3297,272 @@ const Vector<double>& old_parameters, const Vector<double>& parameters, const Ve
 
    #endif
 
-   Matrix<double> DFP_inverse_Hessian = old_inverse_Hessian
-   + parameters_difference.outer(parameters_difference)
-   /parameters_difference.dot(gradient_difference)
-   - (old_inverse_Hessian.dot(gradient_difference)).outer(old_inverse_Hessian.dot(gradient_difference))
-   /gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference);
+   int parameters_number = parameters_difference.get_size();
 
-   return(DFP_inverse_Hessian);               
+   const double* s = &parameters_difference[0];
+   const double* u = &inverse_Hessian_dot_gradient_difference[0];
+
+   const double a = 1.0/parameters_difference_dot_gradient_difference;
+   const double b = 1.0/gradient_difference_dot_inverse_Hessian_dot_gradient_difference;
+
+   #pragma omp parallel for schedule(dynamic, 16)
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      double* row = inverse_Hessian[i];
+
+      for(int j = i; j < parameters_number; j++)
+      {
+         row[j] += a*s[i]*s[j] - b*u[i]*u[j];
 
+         inverse_Hessian[j][i] = row[j];
+      }
+   }
 }
 
 
-// Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Matrix<double>&, const Vector<double>&, const Vector<double>&) method
+// void update_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&) method
 
-/// This method returns an approximation of the inverse Hessian matrix according to the 
+/// This method updates in place an approximation of the inverse Hessian matrix according to the 
 /// Broyden-Fletcher-Goldfarb-Shanno (BGFS) algorithm. 
+/// The rank-two update is written in its expanded form, so that only the upper triangle is computed, in O(n^2) 
+/// operations and without temporary matrices. 
+/// The lower triangle is then mirrored, and the rows are distributed among threads when OpenMP is enabled. 
+/// The work vectors are local to each call, so that this method is reentrant but allocates them every time. 
 /// @param old_parameters A previous set of parameters.
+/// @param parameters Actual set of parameters.
 /// @param old_gradient The gradient of the objective function for that previous set of parameters.
-/// @param old_inverse_Hessian The Hessian of the objective function for that previous set of parameters.
+/// @param gradient The gradient of the objective function for the actual set of parameters.
+/// @param inverse_Hessian Inverse Hessian for the previous set of parameters on input, and for the actual set of parameters on output.
+
+void ObjectiveFunctional::update_BFGS_inverse_Hessian(
+const Vector<double>& old_parameters, const Vector<double>& parameters, const Vector<double>& old_gradient, const Vector<double>& gradient, Matrix<double>& inverse_Hessian)
+{
+   Vector<double> parameters_difference;
+   Vector<double> gradient_difference;
+   Vector<double> inverse_Hessian_dot_gradient_difference;
+
+   update_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+   parameters_difference, gradient_difference, inverse_Hessian_dot_gradient_difference);
+}
+
+
+// void update_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method
+
+/// This method updates in place an approximation of the inverse Hessian matrix according to the 
+/// Broyden-Fletcher-Goldfarb-Shanno (BGFS) algorithm, using work vectors supplied by the caller. 
+/// The work vectors are only reallocated when the number of parameters changes, so that a caller which keeps them
+/// between iterations does not allocate any memory. 
+/// This method does not use any member of the objective functional, but it is not reentrant for the work vectors: 
+/// two calls which run at the same time must not share them. 
+/// @param old_parameters A previous set of parameters.
+/// @param parameters Actual set of parameters.
+/// @param old_gradient The gradient of the objective function for that previous set of parameters.
+/// @param gradient The gradient of the objective function for the actual set of parameters.
+/// @param inverse_Hessian Inverse Hessian for the previous set of parameters on input, and for the actual set of parameters on output.
+/// @param parameters_difference Work vector for the parameters difference. 
+/// @param gradient_difference Work vector for the gradient difference. 
+/// @param inverse_Hessian_dot_gradient_difference Work vector for the dot product of the inverse Hessian and the 
+/// gradient difference. 
+
+void ObjectiveFunctional::update_BFGS_inverse_Hessian(
+const Vector<double>& old_parameters, const Vector<double>& parameters, const Vector<double>& old_gradient, const Vector<double>& gradient, Matrix<double>& inverse_Hessian, 
+Vector<double>& parameters_difference, Vector<double>& gradient_difference, Vector<double>& inverse_Hessian_dot_gradient_difference)
+{
+   calculate_inverse_Hessian_update_vectors(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+   parameters_difference, gradient_difference, inverse_Hessian_dot_gradient_difference);
+
+   double parameters_difference_dot_gradient_difference = parameters_difference.dot(gradient_difference);
+   double gradient_difference_dot_inverse_Hessian_dot_gradient_difference = gradient_difference.dot(inverse_Hessian_dot_gradient_difference);
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(fabs(parameters_difference_dot_gradient_difference) < 1.0e-50)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "void update_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method." << std::endl
+                << "Denominator of first term is zero." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   int parameters_number = parameters_difference.get_size();
+
+   const double* s = &parameters_difference[0];
+   const double* u = &inverse_Hessian_dot_gradient_difference[0];
+
+   // H + (1 + y'Hy/s'y)ss'/s'y - (Hys' + sy'H)/s'y
+
+   const double a = 1.0/parameters_difference_dot_gradient_difference;
+   const double b = (1.0 + gradient_difference_dot_inverse_Hessian_dot_gradient_difference*a)*a;
+
+   #pragma omp parallel for schedule(dynamic, 16)
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      double* row = inverse_Hessian[i];
+
+      for(int j = i; j < parameters_number; j++)
+      {
+         row[j] += b*s[i]*s[j] - a*(u[i]*s[j] + s[i]*u[j]);
+
+         inverse_Hessian[j][i] = row[j];
+      }
+   }
+}
+
+
+// void calculate_inverse_Hessian_update_vectors(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method
+
+/// This method computes the parameters difference, the gradient difference and the dot product of the inverse Hessian
+/// with the gradient difference, which are needed by the quasi-Newton inverse Hessian updates. 
+/// The work vectors are only reallocated when the number of parameters changes. 
+/// @param old_parameters A previous set of parameters.
 /// @param parameters Actual set of parameters.
+/// @param old_gradient The gradient of the objective function for that previous set of parameters.
 /// @param gradient The gradient of the objective function for the actual set of parameters.
-
-Matrix<double> ObjectiveFunctional::calculate_BFGS_inverse_Hessian(
-const Vector<double>& old_parameters, const Vector<double>& parameters, const Vector<double>& old_gradient, const Vector<double>& gradient, const Matrix<double>& old_inverse_Hessian)
+/// @param inverse_Hessian Inverse Hessian for the previous set of parameters.
+/// @param parameters_difference Parameters difference on output. 
+/// @param gradient_difference Gradient difference on output. 
+/// @param inverse_Hessian_dot_gradient_difference Dot product of the inverse Hessian and the gradient difference on 
+/// output. 
+
+void ObjectiveFunctional::calculate_inverse_Hessian_update_vectors(
+const Vector<double>& old_parameters, const Vector<double>& parameters, const Vector<double>& old_gradient, const Vector<double>& gradient, const Matrix<double>& inverse_Hessian, 
+Vector<double>& parameters_difference, Vector<double>& gradient_difference, Vector<double>& inverse_Hessian_dot_gradient_difference)
 {
+   int parameters_number = parameters.get_size();
+
    // Control sentence (if debug)
 
    #ifdef _DEBUG 
 
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();            
-
-   int old_parameters_size = old_parameters.get_size();
-   int parameters_size = parameters.get_size();
-    
-   if(old_parameters_size != parameters_number)
+   if(old_parameters.get_size() != parameters_number 
+   || old_gradient.get_size() != parameters_number || gradient.get_size() != parameters_number)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Size of old parameters vector must be equal to number of parameters." << std::endl;
+                << "void calculate_inverse_Hessian_update_vectors(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method." << std::endl
+                << "Sizes of parameters and gradient vectors must be equal." << std::endl;
 
       exit(1);
    }
-   else if(parameters_size != parameters_number)
+   else if(inverse_Hessian.get_rows_number() != parameters_number || inverse_Hessian.get_columns_number() != parameters_number)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Size of parameters vector must be equal to number of parameters." << std::endl;
+                << "void calculate_inverse_Hessian_update_vectors(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&, Vector<double>&, Vector<double>&, Vector<double>&) method." << std::endl
+                << "Numbers of rows and columns in inverse Hessian must be equal to number of parameters." << std::endl;
 
       exit(1);
    }
 
-   int old_gradient_size = old_gradient.get_size();
-   int gradient_size = gradient.get_size();
+   #endif
 
-   if(old_gradient_size != parameters_number)
+   if(parameters_difference.get_size() != parameters_number)
    {
-      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Size of old gradient vector must be equal to number of parameters." << std::endl;
-
-      exit(1);
+      parameters_difference.set(parameters_number);
    }
-   else if(gradient_size != parameters_number)
-   {
-      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Size of gradient vector must be equal to number of parameters." << std::endl;
 
-      exit(1);
+   if(gradient_difference.get_size() != parameters_number)
+   {
+      gradient_difference.set(parameters_number);
    }
 
-   int rows_number = old_inverse_Hessian.get_rows_number();
-   int columns_number = old_inverse_Hessian.get_columns_number();
-
-   if(rows_number != parameters_number)
+   if(inverse_Hessian_dot_gradient_difference.get_size() != parameters_number)
    {
-      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Number of rows in old inverse Hessian must be equal to number of parameters." << std::endl;
-
-      exit(1);
+      inverse_Hessian_dot_gradient_difference.set(parameters_number);
    }
-   else if(columns_number != parameters_number)
-   {
-      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Number of columns in old inverse Hessian must be equal to number of parameters." << std::endl;
 
-      exit(1);
+   for(int i = 0; i < parameters_number; i++)
+   {
+      parameters_difference[i] = parameters[i] - old_parameters[i];
+      gradient_difference[i] = gradient[i] - old_gradient[i];
    }
 
-   #endif
-
-   // Parameters difference Vector
-   
-   Vector<double> parameters_difference = parameters - old_parameters;
-
-   // Control sentence (if debug)
-
-   #ifdef _DEBUG 
+   #pragma omp parallel for
 
-   if(parameters_difference > -1.0e-50 && parameters_difference < 1.0e-50)
+   for(int i = 0; i < parameters_number; i++)
    {
-      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_BFGS_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Parameters difference vector is zero." << std::endl;
-
-      exit(1);
-   }
+      const double* row = inverse_Hessian[i];
 
-   #endif
+      double sum = 0.0;
 
-   // Gradient difference Vector
-   
-   Vector<double> gradient_difference = gradient - old_gradient;
+      for(int j = 0; j < parameters_number; j++)
+      {
+         sum += row[j]*gradient_difference[j];
+      }
 
-   // Control sentence (if debug)
+      inverse_Hessian_dot_gradient_difference[i] = sum;
+   }
+}
 
-   #ifdef _DEBUG 
 
-   if(gradient_difference > -1.0e-50 && gradient_difference < 1.0e-50)
-   {
-      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Gradient difference vector is zero." << std::endl;
+// Vector<double> calculate_vector_dot_Hessian_forward_differences(const Vector<double>&) method
 
-      exit(1);
-   }
+/// This method returns the dot product between a given vector and the Hessian matrix of the objective function 
+/// by means of the forward differences method for numerical differentiation. 
+/// The gradient is differentiated along the direction of the vector, so that only two gradient evaluations are 
+/// needed. 
+/// @param vector Vector in the dot product. 
 
-   #endif
+Vector<double> ObjectiveFunctional::calculate_vector_dot_Hessian_forward_differences(const Vector<double>& vector)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
    // Control sentence (if debug)
 
    #ifdef _DEBUG 
 
-   if(old_inverse_Hessian > -1.0e-50 && old_inverse_Hessian < 1.0e-50)
+   int size = vector.get_size();
+
+   if(size != parameters_number)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Matrix<double> calculate_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method." << std::endl
-                << "Old inverse Hessian matrix is zero." << std::endl;
+                << "Vector<double> calculate_vector_dot_Hessian_forward_differences(const Vector<double>&) method." << std::endl
+                << "Size of vector must be equal to number of parameters." << std::endl;
 
       exit(1);
    }
 
    #endif
 
-   // BGFS Vector
-
-   Vector<double> BFGS = parameters_difference/parameters_difference.dot(gradient_difference) 
-   - old_inverse_Hessian.dot(gradient_difference)
-   /gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference);
+   Vector<double> vector_Hessian_product(parameters_number, 0.0);
 
-   // Calculate inverse Hessian approximation
-
-   Matrix<double> BFGS_inverse_Hessian = old_inverse_Hessian
-   + parameters_difference.outer(parameters_difference)
-   /parameters_difference.dot(gradient_difference) 
-   - (old_inverse_Hessian.dot(gradient_difference)).outer(gradient_difference.dot(old_inverse_Hessian))
-   /gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference)
-   + (BFGS.outer(BFGS))*(gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference));   
-   
-   return(BFGS_inverse_Hessian);               
-}
+   double vector_norm = vector.calculate_norm();
 
+   if(vector_norm == 0.0)
+   {
+      return(vector_Hessian_product);
+   }
 
-// Vector<double> calculate_vector_dot_Hessian_forward_differences(const Vector<double>&) method
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
 
-/// This method returns the dot product between a given vector and the Hessian matrix of the objective function 
-/// by means of the forward differences method for numerical differentiation. 
-/// @todo This method is not yet implemented. 
-/// @param vector Vector in the dot product. 
+   // Step along the vector direction
 
-Vector<double> ObjectiveFunctional::calculate_vector_dot_Hessian_forward_differences(const Vector<double>&)
-{
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+   double actual_epsilon = calculate_actual_epsilon(parameters.calculate_norm())/vector_norm;
 
-   Vector<double> vector_Hessian_product(parameters_number);
+   Vector<double> gradient = calculate_potential_gradient(parameters);
 
-   std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-             << "Vector<double> calculate_vector_dot_Hessian(Vector<double>) method." << std::endl
-             << "Numerical differentiation of vector-Hessian matrix with forward differences is not yet implemented." << std::endl
-             << "Please use central differences." << std::endl;
+   Vector<double> gradient_forward = calculate_potential_gradient(parameters + vector*actual_epsilon);
 
-//   exit(1);
+   for(int i = 0; i < parameters_number; i++)
+   {
+      vector_Hessian_product[i] = (gradient_forward[i] - gradient[i])/actual_epsilon;
+   }
 
    return(vector_Hessian_product);
 }
 
 
-// Vector<double> calculate_vector_dot_Hessian_central_differences(Vector<double>) method
+// Vector<double> calculate_vector_dot_Hessian_central_differences(const Vector<double>&) method
 
 /// This method returns the dot product between a given vector and the Hessian matrix of the objective function 
-/// by means of the forward differences method for numerical differentiation. 
+/// by means of the central differences method for numerical differentiation. 
+/// The gradient is differentiated along the direction of the vector, so that only two gradient evaluations are 
+/// needed. 
 /// @param vector Vector in the dot product. 
 
 Vector<double> ObjectiveFunctional::calculate_vector_dot_Hessian_central_differences(const Vector<double>& vector)
@@ -1903,7 +3578,7 @@ Vector<double> ObjectiveFunctional::calculate_vector_dot_Hessian_central_differe
    if(size != parameters_number)
    {
       std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
-                << "Vector<double> calculate_vector_dot_Hessian_central_differences(Vector<double>) method." << std::endl
+                << "Vector<double> calculate_vector_dot_Hessian_central_differences(const Vector<double>&) method." << std::endl
                 << "Size of vector must be equal to number of parameters." << std::endl;
 
       exit(1);
@@ -1911,47 +3586,27 @@ Vector<double> ObjectiveFunctional::calculate_vector_dot_Hessian_central_differe
 
    #endif
 
-   Vector<double> vector_Hessian_product;
+   Vector<double> vector_Hessian_product(parameters_number, 0.0);
 
-   Vector<double> gradient_forward(parameters_number);
-   Vector<double> gradient_backward(parameters_number);
-
-   double actual_epsilon;
-
-   Vector<double> potential_parameters = multilayer_perceptron_pointer->get_parameters();
+   double vector_norm = vector.calculate_norm();
 
-   for(int i = 0; i < parameters_number; i++)
+   if(vector_norm == 0.0)
    {
-      // Calculate actual epsilon
-
-      actual_epsilon = calculate_actual_epsilon(potential_parameters[i]);
-
-      // Add actual_epsilon*vector[i] to parameter i
-
-      potential_parameters[i] += actual_epsilon*vector[i];
-
-      // Calculate objective function gradient
-
-      gradient_forward = calculate_potential_gradient(potential_parameters);
-
-      // Restart parameter i
-
-      potential_parameters[i] -= actual_epsilon*vector[i];
-
-      // Substract numerical_epsilon*vector[i] to parameter i
-
-      potential_parameters[i] -= actual_epsilon*vector[i];
+      return(vector_Hessian_product);
+   }
 
-      // Calculate objective function gradient
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
 
-      gradient_backward = calculate_potential_gradient(potential_parameters);
+   // Step along the vector direction
 
-      // Restart potential parameter i
+   double actual_epsilon = calculate_actual_epsilon(parameters.calculate_norm())/vector_norm;
 
-      potential_parameters[i] += actual_epsilon*vector[i];
+   Vector<double> gradient_forward = calculate_potential_gradient(parameters + vector*actual_epsilon);
 
-      // Calculate the product
+   Vector<double> gradient_backward = calculate_potential_gradient(parameters - vector*actual_epsilon);
 
+   for(int i = 0; i < parameters_number; i++)
+   {
       vector_Hessian_product[i] = (gradient_forward[i] - gradient_backward[i])/(2.0*actual_epsilon);
    }
 
@@ -2007,6 +3662,131 @@ Vector<double> ObjectiveFunctional::calculate_vector_dot_Hessian(const Vector<do
 }
 
 
+// Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method
+
+/// This method returns the products of a set of vectors with the objective function Hessian matrix. 
+/// Each row of the argument is a vector, and the corresponding row of the result is its product with the Hessian. 
+/// By default each product is computed with the calculate_vector_dot_Hessian(const Vector<double>&) method. 
+/// Derived classes can override it in order to share the forward propagation between all the vectors. 
+/// @param vectors Matrix whose rows are the vectors in the dot products. 
+
+Matrix<double> ObjectiveFunctional::calculate_vectors_dot_Hessian(const Matrix<double>& vectors)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   int columns_number = vectors.get_columns_number();
+
+   if(columns_number != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Number of columns must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   int vectors_number = vectors.get_rows_number();
+
+   Matrix<double> vectors_Hessian_product(vectors_number, parameters_number);
+
+   for(int i = 0; i < vectors_number; i++)
+   {
+      vectors_Hessian_product.set_row(i, calculate_vector_dot_Hessian(vectors.get_row(i)));
+   }
+
+   return(vectors_Hessian_product);
+}
+
+
+// Vector<double> calculate_regularization_vector_dot_Hessian(const Vector<double>&) method
+
+/// This method returns the product of a vector with the Hessian matrix of the regularization term. 
+/// It is computed analytically for all the regularization methods. 
+/// @param vector Vector in the dot product. 
+
+Vector<double> ObjectiveFunctional::calculate_regularization_vector_dot_Hessian(const Vector<double>& vector)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   int size = vector.get_size();
+
+   if(size != parameters_number)
+   {
+      std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                << "Vector<double> calculate_regularization_vector_dot_Hessian(const Vector<double>&) method." << std::endl
+                << "Size of vector must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   Vector<double> regularization_vector_Hessian_product(parameters_number, 0.0);
+
+   switch(regularization_method)   
+   {
+      case None:
+      {
+         return(regularization_vector_Hessian_product);
+      }             
+      break;
+
+      case NeuralParametersNorm:
+      {  
+         Vector<double> neural_parameters = multilayer_perceptron_pointer->get_neural_parameters();                     
+
+         int neural_parameters_number = neural_parameters.get_size();
+
+         double neural_parameters_norm = neural_parameters.calculate_norm();
+
+         if(neural_parameters_norm < 1.0e-99)
+         {
+            return(regularization_vector_Hessian_product);
+         }
+
+         // The Hessian of the norm is (I - w*w'/(w'*w))/|w|
+
+         double neural_parameters_dot_vector = 0.0;
+
+         for(int i = 0; i < neural_parameters_number; i++)
+         {
+            neural_parameters_dot_vector += neural_parameters[i]*vector[i];
+         }
+
+         double projection = neural_parameters_dot_vector/(neural_parameters_norm*neural_parameters_norm);
+
+         for(int i = 0; i < neural_parameters_number; i++)
+         {
+            regularization_vector_Hessian_product[i] = (vector[i] - neural_parameters[i]*projection)/neural_parameters_norm;
+         }
+
+         return(regularization_vector_Hessian_product);
+      }             
+      break;
+
+      default:
+      {
+         std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                   << "Vector<double> calculate_regularization_vector_dot_Hessian(const Vector<double>&) method." << std::endl
+                   << "Unknown regularization method." << std::endl;
+ 
+         exit(1);       	  
+      }
+      break;
+   }   
+}
+
+
 // double calculate_validation_error(void) method
 
 double ObjectiveFunctional::calculate_validation_error(void)
@@ -2065,7 +3845,19 @@ std::string ObjectiveFunctional::to_XML(bool show_declaration)
    buffer << "<NumericalEpsilon>" << std::endl
    	      << numerical_epsilon << std::endl
           << "</NumericalEpsilon>" << std::endl;
+
+   buffer << "<ThreadsNumber>" << std::endl
+   	      << threads_number << std::endl
+          << "</ThreadsNumber>" << std::endl;
+
+   buffer << "<EvaluationCacheSize>" << std::endl
+   	      << evaluation_cache_size << std::endl
+          << "</EvaluationCacheSize>" << std::endl;
       
+   buffer << "<HessianApproximationMethod>" << std::endl
+	      << get_Hessian_approximation_method_name() << std::endl
+          << "</HessianApproximationMethod>" << std::endl;
+
    buffer << "<Display>" << std::endl
 	      << display << std::endl
           << "</Display>" << std::endl;
@@ -2326,6 +4118,63 @@ void ObjectiveFunctional::load(const char* filename)
  
             exit(1);
          }  
+	  }
+	  else if(word == "<ThreadsNumber>")
+	  {
+         int new_threads_number;
+
+		 file >> new_threads_number;
+
+		 set_threads_number(new_threads_number);
+
+         file >> word;
+
+		 if(word != "</ThreadsNumber>") 
+         {
+            std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown threads number end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+	  }
+	  else if(word == "<EvaluationCacheSize>")
+	  {
+         int new_evaluation_cache_size;
+
+		 file >> new_evaluation_cache_size;
+
+		 set_evaluation_cache_size(new_evaluation_cache_size);
+
+         file >> word;
+
+		 if(word != "</EvaluationCacheSize>") 
+         {
+            std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown evaluation cache size end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+	  }
+	  else if(word == "<HessianApproximationMethod>")
+	  {
+    	 std::string new_Hessian_approximation_method_name;
+
+         file >> new_Hessian_approximation_method_name;
+
+		 set_Hessian_approximation_method(new_Hessian_approximation_method_name);
+
+         file >> word;
+
+		 if(word != "</HessianApproximationMethod>") 
+         {
+            std::cerr << "Flood Error: ObjectiveFunctional class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown Hessian approximation method end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
 	  }
 	  else if(word == "<Display>")
 	  {
@@ -45,10 +45,18 @@ public:
 
    explicit ObjectiveFunctional(MultilayerPerceptron*);
 
+   // COPY CONSTRUCTOR
+
+   ObjectiveFunctional(const ObjectiveFunctional&);
+
    // DESTRUCTOR
 
    virtual ~ObjectiveFunctional(void);
 
+   // ASSIGNMENT OPERATOR
+
+   ObjectiveFunctional& operator = (const ObjectiveFunctional&);
+
 
    // ENUMERATIONS
 
@@ -64,8 +72,17 @@ public:
 
    enum NumericalEpsilonMethod{Absolute, Relative};
 
+   /// Enumeration of available methods for calculating the Hessian matrix in those objective functionals which 
+   /// implement it analytically.
+
+   enum HessianApproximationMethod{ExactHessian, GaussNewton};
+
    // METHODS
 
+   // Clone methods
+
+   virtual ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    /// This method returns a pointer to the multilayer perceptron object associated to the objective functional.
@@ -96,14 +113,33 @@ public:
 
    double get_numerical_epsilon(void);
 
+   int get_threads_number(void);
+
+   // Hessian approximation methods
+
+   HessianApproximationMethod get_Hessian_approximation_method(void);
+   std::string get_Hessian_approximation_method_name(void);
+
    // Counter methods
 
    int get_calculate_evaluation_count(void);
    int get_calculate_gradient_count(void);
    int get_calculate_Hessian_count(void);
 
+   // Evaluation cache methods
+
+   int get_evaluation_cache_size(void);
+
+   int get_evaluation_cache_hits_count(void);
+   int get_evaluation_cache_misses_count(void);
+
    bool get_display(void);
 
+   // Data set methods
+
+   virtual int get_training_instances_number(void);
+   virtual int get_data_set_version(void);
+
    // Set methods
 
    void set_multilayer_perceptron_pointer(MultilayerPerceptron*);
@@ -131,12 +167,32 @@ public:
 
    void set_numerical_epsilon(double);
 
+   void set_threads_number(int);
+
+   // Hessian approximation methods
+
+   void set_Hessian_approximation_method(const HessianApproximationMethod&);
+   void set_Hessian_approximation_method(const std::string&);
+
    // Counter methods
 
    void set_calculate_evaluation_count(int);
    void set_calculate_gradient_count(int);
    void set_calculate_Hessian_count(int);
 
+   // Evaluation cache methods
+
+   void set_evaluation_cache_size(int);
+
+   void set_evaluation_cache_hits_count(int);
+   void set_evaluation_cache_misses_count(int);
+
+   void clear_evaluation_cache(void);
+
+   // Thread replica methods
+
+   void clear_thread_replicas(void);
+
    void set_display(bool);
 
    // Objective functional evaluation methods
@@ -144,9 +200,20 @@ public:
    double calculate_evaluation(void);
    double calculate_potential_evaluation(const Vector<double>&);
 
+   Vector<double> calculate_potential_evaluation(const Matrix<double>&);
+   Vector<double> calculate_potential_evaluation(const Matrix<double>&, int);
+
+   // Bounded evaluation methods
+
+   double calculate_evaluation(double);
+   double calculate_potential_evaluation(const Vector<double>&, double);
+
+   Vector<double> calculate_potential_evaluation(const Matrix<double>&, int, double);
+
    /// This method returns the objective value of a multilayer perceptron.
 
    virtual double calculate_objective(void) = 0;
+   virtual double calculate_objective(double);
    virtual double calculate_regularization(void); 
 
    // Objective function gradient methods
@@ -156,6 +223,9 @@ public:
 
    double calculate_gradient_norm(void);
 
+   Vector<double> calculate_batch_gradient(const Vector<int>&);
+   void calculate_batch_gradient(const Vector<int>&, Vector<double>&);
+
    /// This method returns the objective function gradient vector for a multilayer perceptron.
 
    virtual Vector<double> calculate_objective_gradient(void); 
@@ -164,8 +234,13 @@ public:
    virtual Vector<double> calculate_neural_parameters_gradient(void);
    virtual Vector<double> calculate_independent_parameters_gradient(void);
 
+   virtual Vector<double> calculate_batch_objective_gradient(const Vector<int>&);
+   virtual void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&);
+
    // Objective function gradient numerical differentiation methods
 
+   Vector<double> calculate_perturbed_evaluation(const Vector<double>&, const Matrix<int>&, const Matrix<double>&);
+
    Vector<double> calculate_objective_gradient_numerical_differentiation(void);
 
    Vector<double> calculate_neural_parameters_gradient_numerical_differentiation(void);  
@@ -183,6 +258,8 @@ public:
    virtual Matrix<double> calculate_Hessian(void);
    Matrix<double> calculate_potential_Hessian(const Vector<double>&);
 
+   virtual Matrix<double> calculate_regularization_Hessian(void);
+
    // Objective function Hessian numerical differentiation methods
 
    Matrix<double> calculate_Hessian_numerical_differentiation(void);
@@ -199,9 +276,26 @@ public:
    Matrix<double> calculate_BFGS_inverse_Hessian
    (const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&);
 
+   void update_DFP_inverse_Hessian
+   (const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&);
+
+   void update_DFP_inverse_Hessian
+   (const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&, 
+    Vector<double>&, Vector<double>&, Vector<double>&);
+
+   void update_BFGS_inverse_Hessian
+   (const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&);
+
+   void update_BFGS_inverse_Hessian
+   (const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&, 
+    Vector<double>&, Vector<double>&, Vector<double>&);
+
    // Objective function vector Hessian product methods
 
    virtual Vector<double> calculate_vector_dot_Hessian(const Vector<double>&);
+   virtual Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&);
+
+   virtual Vector<double> calculate_regularization_vector_dot_Hessian(const Vector<double>&);
 
    // Objective function vector Hessian product numerical differentiation methods
 
@@ -230,6 +324,26 @@ public:
 
 protected:
 
+   // Evaluation cache methods
+
+   double calculate_uncached_evaluation(void);
+   double calculate_uncached_evaluation(double);
+
+   unsigned int calculate_parameters_hash(const Vector<double>&);
+
+   int find_evaluation_cache_entry(const Vector<double>&, unsigned int);
+   int insert_evaluation_cache_entry(const Vector<double>&, unsigned int);
+
+   // Thread replica methods
+
+   void update_thread_replicas(int);
+
+   // Inverse Hessian update methods
+
+   void calculate_inverse_Hessian_update_vectors
+   (const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&, 
+    Vector<double>&, Vector<double>&, Vector<double>&);
+
    /// Pointer to a multilayer perceptron object.
 
    MultilayerPerceptron* multilayer_perceptron_pointer;
@@ -258,6 +372,65 @@ protected:
 
    int calculate_Hessian_count;
 
+   /// Maximum number of parameter vectors whose evaluation and gradient are remembered, so that they are not 
+   /// calculated again if those parameters are seen again. 
+   /// The least recently used vector of parameters is forgotten first. 
+   /// Zero means that the evaluation cache is not used.
+
+   int evaluation_cache_size;
+
+   /// Number of evaluations and gradients which have been found in the evaluation cache.
+
+   int evaluation_cache_hits_count;
+
+   /// Number of evaluations and gradients which have been looked for in the evaluation cache and not found.
+
+   int evaluation_cache_misses_count;
+
+   /// Hash values of the vectors of parameters in the evaluation cache.
+
+   Vector<unsigned int> evaluation_cache_hashes;
+
+   /// Vectors of parameters in the evaluation cache.
+
+   Vector< Vector<double> > evaluation_cache_parameters;
+
+   /// Evaluations of the vectors of parameters in the evaluation cache.
+
+   Vector<double> evaluation_cache_evaluations;
+
+   /// Gradients of the vectors of parameters in the evaluation cache.
+
+   Vector< Vector<double> > evaluation_cache_gradients;
+
+   /// True for the entries of the evaluation cache whose evaluation is known, and false otherwise.
+
+   Vector<bool> evaluation_cache_evaluation_flags;
+
+   /// True for the entries of the evaluation cache whose gradient is known, and false otherwise.
+
+   Vector<bool> evaluation_cache_gradient_flags;
+
+   /// Time of last use of each entry of the evaluation cache. 
+   /// Zero means that the entry is empty. 
+
+   Vector<int> evaluation_cache_stamps;
+
+   /// Number of uses of the evaluation cache since it was last cleared, which serves as its clock.
+
+   int evaluation_cache_clock;
+
+   /// Version of the data set on which the evaluations and gradients in the evaluation cache were calculated. 
+   /// It is -1 if the evaluation cache has not been used since it was last cleared. 
+
+   int evaluation_cache_data_set_version;
+
+   /// Version of the multilayer perceptron on which the evaluations and gradients in the evaluation cache were 
+   /// calculated. 
+   /// It is -1 if the evaluation cache has not been used since it was last cleared. 
+
+   int evaluation_cache_multilayer_perceptron_version;
+
    /// Numerical differentiation methods enumeration.
 
    NumericalDifferentiationMethod numerical_differentiation_method;
@@ -270,6 +443,28 @@ protected:
 
    double numerical_epsilon;   
 
+   /// Number of threads for the perturbed evaluations of numerical differentiation when compiled with OpenMP.
+   /// Zero means the OpenMP default, and one means serial evaluation.
+
+   int threads_number;
+
+   /// Clones of the multilayer perceptron, one for each thread, which are kept between the batched evaluations.
+
+   Vector<MultilayerPerceptron*> thread_multilayer_perceptrons;
+
+   /// Clones of this objective functional, each one associated to the clone of the multilayer perceptron of its 
+   /// thread. 
+
+   Vector<ObjectiveFunctional*> thread_objective_functionals;
+
+   /// Version of the multilayer perceptron when its clones for the threads were created, or -1 if there are none.
+
+   int thread_replicas_multilayer_perceptron_version;
+
+   /// Method for calculating the Hessian matrix in those objective functionals which implement it analytically.
+
+   HessianApproximationMethod Hessian_approximation_method;
+
    /// Display messages to screen. 
 
    bool display;  
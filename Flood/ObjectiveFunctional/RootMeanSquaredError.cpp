@@ -96,6 +96,41 @@ RootMeanSquaredError::~RootMeanSquaredError(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+/// This method returns a new root mean squared error object with the same members as this one, but associated to another
+/// multilayer perceptron.
+/// The input-target data set is referenced by both objects, not copied.
+/// @param new_multilayer_perceptron_pointer Pointer to a multilayer perceptron object.
+
+ObjectiveFunctional* RootMeanSquaredError::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   RootMeanSquaredError* root_mean_squared_error_pointer = new RootMeanSquaredError(*this);
+
+   root_mean_squared_error_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(root_mean_squared_error_pointer);
+}
+
+
+// int get_data_set_version(void) method
+
+/// This method returns the version of the input-target data set, or zero if there is no input-target data set 
+/// associated to the root mean squared error object. 
+
+int RootMeanSquaredError::get_data_set_version(void)
+{
+   if(input_target_data_set_pointer == NULL)
+   {
+      return(0);
+   }
+   else
+   {
+      return(input_target_data_set_pointer->get_version());
+   }
+}
+
+
 // void set(void) method
 
 /// This method sets the multilayer perceptron and the input-target data set pointers to NULL.
@@ -161,6 +196,10 @@ void RootMeanSquaredError
 ::set_input_target_data_set_pointer(InputTargetDataSet* new_input_target_data_set_pointer)
 {
    input_target_data_set_pointer = new_input_target_data_set_pointer;
+
+   clear_evaluation_cache();
+
+   clear_thread_replicas();
 }
 
 
@@ -168,8 +207,24 @@ void RootMeanSquaredError
 
 /// This method returns the evaluation value of a multilayer perceptron according to the root mean squared error 
 /// on the training instances of an input-target data set.
+/// It is calculated by the calculate_objective(double) method with no bound.
 
 double RootMeanSquaredError::calculate_objective(void)
+{
+   return(calculate_objective(std::numeric_limits<double>::max()));
+}
+
+
+// double calculate_objective(double) method
+
+/// This method returns the root mean squared error of a multilayer perceptron on the training instances, as the 
+/// calculate_objective(void) method does. 
+/// The sum over the training instances stops as soon as it exceeds the given bound. 
+/// The root mean squared error of the instances summed so far is then returned. 
+/// It is a lower bound of the objective greater than the bound. 
+/// @param objective_bound Objective value above which the exact objective is not needed. 
+
+double RootMeanSquaredError::calculate_objective(double objective_bound)
 {
    int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
    int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
@@ -181,7 +236,7 @@ double RootMeanSquaredError::calculate_objective(void)
    if(multilayer_perceptron_pointer == NULL)
    {
       std::cerr << "Flood Error: RootMeanSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
 
         exit(1);
@@ -189,7 +244,7 @@ double RootMeanSquaredError::calculate_objective(void)
    else if(input_target_data_set_pointer == NULL)
    {
       std::cerr << "Flood Error: RootMeanSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl
+                << "double calculate_objective(double) method." << std::endl
                 << "Pointer to input-target data set object cannot be NULL." << std::endl;
 
         exit(1);
@@ -201,7 +256,7 @@ double RootMeanSquaredError::calculate_objective(void)
    if(inputs_number != input_variables_number || outputs_number != target_variables_number)
    {
       std::cerr << "Flood Error: RootMeanSquaredError class." << std::endl
-                << "double calculate_objective(void) method." << std::endl 
+                << "double calculate_objective(double) method." << std::endl 
                 << "Number of inputs and outputs in multilayer perceptron must be equal to " 
                 << "number of input and output variables in input-target data set." << std::endl;
 
@@ -219,6 +274,8 @@ double RootMeanSquaredError::calculate_objective(void)
 
    double training_error = 0.0;
 
+   double training_error_bound = objective_bound > 0.0 ? objective_bound*objective_bound*training_instances_number : 0.0;
+
    for(int i = 0; i < training_instances_number; i++)
    {
       // Input vector
@@ -240,6 +297,13 @@ double RootMeanSquaredError::calculate_objective(void)
       // Sum of squares error
 
       training_error += instance_error.dot(instance_error);           
+
+      // Stop as soon as the objective is known to exceed the bound
+
+      if(training_error > training_error_bound)
+      {
+         break;
+      }
    }
 
    return(sqrt(training_error/(double)training_instances_number));
@@ -336,6 +400,197 @@ Vector<double> RootMeanSquaredError::calculate_objective_gradient(void)
 }
 
 
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) method
+
+/// This method returns the product of a vector with the Hessian matrix of the root mean squared error functional. 
+/// It is computed exactly by means of the calculate_vectors_dot_Hessian(const Matrix<double>&) method. 
+/// @param vector Vector in the dot product. 
+
+Vector<double> RootMeanSquaredError::calculate_vector_dot_Hessian(const Vector<double>& vector)
+{
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Matrix<double> vectors(1, parameters_number);
+
+   vectors.set_row(0, vector);
+
+   return(calculate_vectors_dot_Hessian(vectors).get_row(0));
+}
+
+
+// Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method
+
+/// This method returns the products of a set of vectors with the Hessian matrix of the root mean squared error functional, 
+/// including the regularization term. 
+/// The products are exact, and are computed with the R-operator technique of the multilayer perceptron. 
+/// They are obtained from the products with the Hessian of the mean squared error by means of the chain rule. 
+/// The forward propagation for each training instance is shared between all the vectors. 
+/// @param vectors Matrix whose rows are the vectors in the dot products. 
+
+Matrix<double> RootMeanSquaredError::calculate_vectors_dot_Hessian(const Matrix<double>& vectors)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(multilayer_perceptron_pointer == NULL)
+   {
+      std::cerr << "Flood Error: RootMeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(input_target_data_set_pointer == NULL)
+   {
+      std::cerr << "Flood Error: RootMeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Pointer to input-target data set object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+   else if(vectors.get_columns_number() != multilayer_perceptron_pointer->get_parameters_number())
+   {
+      std::cerr << "Flood Error: RootMeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Number of columns must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Multilayer perceptron 
+
+   int hidden_layers_number = multilayer_perceptron_pointer->get_hidden_layers_number();
+
+   int inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+   int outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   int neural_parameters_number = multilayer_perceptron_pointer->get_neural_parameters_number();
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   // Input-target data set
+
+   int training_instances_number = input_target_data_set_pointer->get_training_instances_number();
+
+   // Vectors restricted to the neural parameters
+
+   int vectors_number = vectors.get_rows_number();
+
+   Vector< Vector<double> > neural_parameters_vectors(vectors_number);
+   Vector< Vector<double> > neural_parameters_vectors_Hessian_product(vectors_number);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      neural_parameters_vectors[r].set(neural_parameters_number);
+
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         neural_parameters_vectors[r][j] = vectors[r][j];
+      }
+
+      neural_parameters_vectors_Hessian_product[r].set(neural_parameters_number, 0.0);
+   }
+
+   // Main loop
+
+   Vector<double> training_input_instance(inputs_number);
+   Vector<double> training_target_instance(outputs_number);
+
+   Vector<double> scaled_input(inputs_number);
+   Vector< Vector<double> > forward_propagation_second_derivative(3*hidden_layers_number+3);
+   Vector<double> output(outputs_number);
+
+   Vector<double> output_gradient(outputs_number);
+   Vector<double> output_second_derivative(outputs_number, 2.0/(double)training_instances_number);
+
+   Vector< Vector<double> > forward_propagation_derivative(2*hidden_layers_number+2);
+
+   double sum_squared_error = 0.0;
+
+   Vector<double> mean_squared_error_gradient(neural_parameters_number, 0.0);
+
+   for(int i = 0; i < training_instances_number; i++)
+   {
+      training_input_instance = input_target_data_set_pointer->get_training_input_instance(i);
+      training_target_instance = input_target_data_set_pointer->get_training_target_instance(i);
+
+      scaled_input = multilayer_perceptron_pointer->calculate_scaled_input(training_input_instance);
+
+      forward_propagation_second_derivative 
+      = multilayer_perceptron_pointer->calculate_forward_propagation_second_derivative(scaled_input);
+
+      output = multilayer_perceptron_pointer->calculate_unscaled_output(forward_propagation_second_derivative[3*hidden_layers_number]);
+
+      output_gradient = (output - training_target_instance)*(2.0/(double)training_instances_number);
+
+      sum_squared_error += (output - training_target_instance).dot(output - training_target_instance);
+
+      for(int j = 0; j < 2*hidden_layers_number+2; j++)
+      {
+         forward_propagation_derivative[j] = forward_propagation_second_derivative[j + j/2];
+      }
+
+      mean_squared_error_gradient += multilayer_perceptron_pointer
+      ->calculate_neural_parameters_gradient(scaled_input, forward_propagation_derivative, output_gradient);
+
+      for(int r = 0; r < vectors_number; r++)
+      {
+         neural_parameters_vectors_Hessian_product[r] += multilayer_perceptron_pointer->calculate_neural_parameters_vector_dot_Hessian
+         (scaled_input, forward_propagation_second_derivative, output_gradient, output_second_derivative, neural_parameters_vectors[r]);
+      }
+   }
+
+   // Chain rule for the square root of the mean squared error
+
+   double root_mean_squared_error = sqrt(sum_squared_error/(double)training_instances_number);
+
+   if(root_mean_squared_error < 1.0e-99)
+   {
+      std::cerr << "Flood Error: RootMeanSquaredError class." << std::endl
+                << "Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&) method." << std::endl
+                << "Root mean squared error is zero." << std::endl;
+
+      exit(1);
+   }
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      double mean_squared_error_gradient_dot_vector = mean_squared_error_gradient.dot(neural_parameters_vectors[r]);
+
+      neural_parameters_vectors_Hessian_product[r] 
+      = (neural_parameters_vectors_Hessian_product[r] 
+      - mean_squared_error_gradient*mean_squared_error_gradient_dot_vector/(2.0*root_mean_squared_error*root_mean_squared_error))
+      /(2.0*root_mean_squared_error);
+   }
+
+   // Objective and regularization terms
+
+   Matrix<double> vectors_Hessian_product(vectors_number, parameters_number, 0.0);
+
+   for(int r = 0; r < vectors_number; r++)
+   {
+      for(int j = 0; j < neural_parameters_number; j++)
+      {
+         vectors_Hessian_product[r][j] = objective_weight*neural_parameters_vectors_Hessian_product[r][j];
+      }
+
+      if(regularization_method != None)
+      {
+         Vector<double> regularization_vector_Hessian_product = calculate_regularization_vector_dot_Hessian(vectors.get_row(r));
+
+         for(int j = 0; j < parameters_number; j++)
+         {
+            vectors_Hessian_product[r][j] += regularization_weight*regularization_vector_Hessian_product[j];
+         }
+      }
+   }
+
+   return(vectors_Hessian_product);
+}
+
+
 // Vector<double> calculate_output_errors(const Vector< Vector<double> >&, const Vector<double>&) method
 
 /// This method returns the output errors to be used in the back-propagation algorithm for calculating the objective gradient. 
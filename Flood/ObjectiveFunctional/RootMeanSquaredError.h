@@ -54,6 +54,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    /// This method returns a pointer to the input-target data set object on which the objective functional is 
@@ -64,6 +68,8 @@ public:
       return(input_target_data_set_pointer);
    }
 
+   int get_data_set_version(void);
+
    // Set methods
 
    void set(void);
@@ -76,6 +82,7 @@ public:
    // Objective functional evaluation methods
 
    double calculate_objective(void);
+   double calculate_objective(double);
    double calculate_validation_error(void);   
 
    // Objective function gradient vector methods
@@ -87,6 +94,11 @@ public:
 
    Vector<double> calculate_objective_gradient(void);
 
+   // Hessian methods
+
+   Vector<double> calculate_vector_dot_Hessian(const Vector<double>&);
+   Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&);
+
 private:
 
    // MEMBERS
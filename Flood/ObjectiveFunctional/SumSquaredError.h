@@ -51,6 +51,10 @@ public:
 
    virtual ~SumSquaredError(void);    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    // Get methods
 
    /// This method returns a pointer to the input-target data set object on which the objective functional is 
@@ -61,6 +65,8 @@ public:
 	   return(input_target_data_set_pointer);
    }
 
+   int get_data_set_version(void);
+
    // Set methods
 
    void set(void);
@@ -73,6 +79,7 @@ public:
    // Evaluation methods
 
    double calculate_objective(void);   
+   double calculate_objective(double);
 
    Vector<double> calculate_squared_errors(void);
 
@@ -85,6 +92,19 @@ public:
 
    Vector<double> calculate_objective_gradient(void);
 
+   int get_training_instances_number(void);
+
+   Vector<double> calculate_batch_objective_gradient(const Vector<int>&);
+   void calculate_batch_objective_gradient(const Vector<int>&, Vector<double>&);
+
+   // Hessian methods
+
+   Vector<double> calculate_vector_dot_Hessian(const Vector<double>&);
+   Matrix<double> calculate_vectors_dot_Hessian(const Matrix<double>&);
+
+   Matrix<double> calculate_Hessian(void);
+   Matrix<double> calculate_Gauss_Newton_Hessian(void);
+
    // Jacobian methods
 
    Matrix<double> calculate_Jacobian(void);
@@ -257,7 +257,7 @@ void Perceptron::set(void)
 
    inputs_number = 0;
 
-   initialize_bias_normal(0.0, 0.2);
+   bias = 0.0;
    
    display = true;
 }
@@ -843,7 +843,7 @@ double Perceptron::calculate_activation_second_derivative(double combination)
    {
       case Perceptron::Logistic:
       {
-         return(-exp(combination)*(exp(combination) - 1.0)/pow(exp(combination + 1), 3));
+         return(-exp(combination)*(exp(combination) - 1.0)/pow(exp(combination) + 1.0, 3));
       }
       break;
                                      
@@ -0,0 +1,493 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   A D A M   O P T I M I Z E R   C L A S S                                                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cmath>
+
+// Flood includes
+
+#include "AdamOptimizer.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates an Adam training algorithm object associated to an objective functional
+/// object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+AdamOptimizer::AdamOptimizer(ObjectiveFunctional* new_objective_functional_pointer)
+: StochasticTrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates an Adam training algorithm object not associated to any objective
+/// functional object.
+/// It also initializes the class members to their default values.
+
+AdamOptimizer::AdamOptimizer(void) : StochasticTrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+AdamOptimizer::~AdamOptimizer(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new Adam optimizer object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* AdamOptimizer::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   AdamOptimizer* adam_optimizer_pointer = new AdamOptimizer(*this);
+
+   adam_optimizer_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(adam_optimizer_pointer);
+}
+
+
+// double get_first_moment_decay(void) method
+
+/// This method returns the decay rate of the running average of the gradients.
+
+double AdamOptimizer::get_first_moment_decay(void)
+{
+   return(first_moment_decay);
+}
+
+
+// double get_second_moment_decay(void) method
+
+/// This method returns the decay rate of the running average of the squared gradients.
+
+double AdamOptimizer::get_second_moment_decay(void)
+{
+   return(second_moment_decay);
+}
+
+
+// double get_epsilon(void) method
+
+/// This method returns the small value added to the root of the second moment estimate to avoid divisions by zero.
+
+double AdamOptimizer::get_epsilon(void)
+{
+   return(epsilon);
+}
+
+
+// const Vector<double>& get_first_moment(void) method
+
+/// This method returns the running average of the mini-batch gradients.
+/// It is sized and reset by the initialize_optimizer_state(int) method.
+
+const Vector<double>& AdamOptimizer::get_first_moment(void)
+{
+   return(first_moment);
+}
+
+
+// const Vector<double>& get_second_moment(void) method
+
+/// This method returns the running average of the squared mini-batch gradients.
+/// It is sized and reset by the initialize_optimizer_state(int) method.
+
+const Vector<double>& AdamOptimizer::get_second_moment(void)
+{
+   return(second_moment);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the Adam object to their default values.
+/// The members of the stochastic training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Initial learning rate: 0.001
+/// <li> First moment decay: 0.9
+/// <li> Second moment decay: 0.999
+/// <li> Epsilon: 1.0e-8
+/// </ul>
+
+void AdamOptimizer::set_default(void)
+{
+   StochasticTrainingAlgorithm::set_default();
+
+   // TRAINING PARAMETERS
+
+   initial_learning_rate = 0.001;
+
+   first_moment_decay = 0.9;
+   second_moment_decay = 0.999;
+   epsilon = 1.0e-8;
+}
+
+
+// void set_first_moment_decay(double) method
+
+/// This method sets a new decay rate of the running average of the gradients.
+/// @param new_first_moment_decay First moment decay value. It must be equal or greater than 0 and less than 1.
+
+void AdamOptimizer::set_first_moment_decay(double new_first_moment_decay)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_first_moment_decay < 0.0 || new_first_moment_decay >= 1.0)
+   {
+      std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                << "void set_first_moment_decay(double) method." << std::endl
+                << "First moment decay must be equal or greater than 0 and less than 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   first_moment_decay = new_first_moment_decay;
+}
+
+
+// void set_second_moment_decay(double) method
+
+/// This method sets a new decay rate of the running average of the squared gradients.
+/// @param new_second_moment_decay Second moment decay value. It must be equal or greater than 0 and less than 1.
+
+void AdamOptimizer::set_second_moment_decay(double new_second_moment_decay)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_second_moment_decay < 0.0 || new_second_moment_decay >= 1.0)
+   {
+      std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                << "void set_second_moment_decay(double) method." << std::endl
+                << "Second moment decay must be equal or greater than 0 and less than 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   second_moment_decay = new_second_moment_decay;
+}
+
+
+// void set_epsilon(double) method
+
+/// This method sets a new small value added to the root of the second moment estimate to avoid divisions by zero.
+/// @param new_epsilon Epsilon value. It must be greater than 0.
+
+void AdamOptimizer::set_epsilon(double new_epsilon)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_epsilon <= 0.0)
+   {
+      std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                << "void set_epsilon(double) method." << std::endl
+                << "Epsilon must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   epsilon = new_epsilon;
+}
+
+
+// void initialize_optimizer_state(int) method
+
+/// This method sizes the state vectors of the Adam optimizer to the number of parameters, sets them to zero
+/// and resets the number of steps.
+/// @param new_parameters_number Number of parameters of the multilayer perceptron.
+
+void AdamOptimizer::initialize_optimizer_state(int new_parameters_number)
+{
+   first_moment.set(new_parameters_number, 0.0);
+   second_moment.set(new_parameters_number, 0.0);
+
+   steps_count = 0;
+}
+
+
+// void update_parameters(Vector<double>&, const Vector<double>&, double) method
+
+/// This method performs an Adam step with a mini-batch gradient.
+/// The moment estimates are updated as m = b1*m + (1-b1)*g and v = b2*v + (1-b2)*g*g.
+/// Each parameter is then decremented by a*m/(sqrt(v) + epsilon), where the step size
+/// a = r*sqrt(1-b2^t)/(1-b1^t) corrects the initialization bias of both estimates after t steps.
+/// The state vectors are updated in place, so that no memory is allocated.
+/// @param parameters Vector of parameters to be updated.
+/// @param gradient Mini-batch gradient at the parameters.
+/// @param learning_rate Learning rate of the step.
+
+void AdamOptimizer::update_parameters(Vector<double>& parameters, const Vector<double>& gradient, double learning_rate)
+{
+   int parameters_number = parameters.get_size();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(gradient.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Size of gradient must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+   else if(first_moment.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Optimizer state has not been initialized for this number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   steps_count++;
+
+   double first_moment_correction = 1.0 - pow(first_moment_decay, steps_count);
+   double second_moment_correction = 1.0 - pow(second_moment_decay, steps_count);
+
+   double step_size = learning_rate*sqrt(second_moment_correction)/first_moment_correction;
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      first_moment[i] = first_moment_decay*first_moment[i] + (1.0 - first_moment_decay)*gradient[i];
+      second_moment[i] = second_moment_decay*second_moment[i] + (1.0 - second_moment_decay)*gradient[i]*gradient[i];
+
+      parameters[i] -= step_size*first_moment[i]/(sqrt(second_moment[i]) + epsilon);
+   }
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format.
+/// Only that training history variables which have been reserved are included here.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string AdamOptimizer::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='AdamOptimizer' content='TrainingHistory'>" << std::endl;
+   }
+
+   buffer << TrainingAlgorithm::get_training_history_XML(false);
+
+   return(buffer.str());
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of this Adam object.
+/// It contains the parameters of the update rule, together with the learning rate schedule, batch size, training
+/// parameters, stopping criteria and other user stuff of the base classes.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string AdamOptimizer::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='AdamOptimizer'>" << std::endl;
+   }
+
+   // Training parameters
+
+   buffer << "<FirstMomentDecay>" << std::endl
+          << first_moment_decay << std::endl
+          << "</FirstMomentDecay>" << std::endl;
+
+   buffer << "<SecondMomentDecay>" << std::endl
+          << second_moment_decay << std::endl
+          << "</SecondMomentDecay>" << std::endl;
+
+   buffer << "<Epsilon>" << std::endl
+          << epsilon << std::endl
+          << "</Epsilon>" << std::endl;
+
+   buffer << StochasticTrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads an Adam object from a XML-type file.
+/// The members of the base classes are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void AdamOptimizer::load(const char* filename)
+{
+   StochasticTrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open Adam object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+	  // Training parameters
+
+	  if(word == "<FirstMomentDecay>")
+	  {
+		 double new_first_moment_decay;
+
+         file >> new_first_moment_decay;
+
+         file >> word;
+
+		 if(word != "</FirstMomentDecay>")
+         {
+            std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown first moment decay end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_first_moment_decay(new_first_moment_decay);
+	  }
+
+	  else if(word == "<SecondMomentDecay>")
+	  {
+		 double new_second_moment_decay;
+
+         file >> new_second_moment_decay;
+
+         file >> word;
+
+		 if(word != "</SecondMomentDecay>")
+         {
+            std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown second moment decay end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_second_moment_decay(new_second_moment_decay);
+	  }
+
+	  else if(word == "<Epsilon>")
+	  {
+		 double new_epsilon;
+
+         file >> new_epsilon;
+
+         file >> word;
+
+		 if(word != "</Epsilon>")
+         {
+            std::cerr << "Flood Error: AdamOptimizer class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown epsilon end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_epsilon(new_epsilon);
+	  }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,135 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   A D A M   O P T I M I Z E R   C L A S S   H E A D E R                                                      */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __ADAMOPTIMIZER_H__
+#define __ADAMOPTIMIZER_H__
+
+// Flood includes
+
+#include "StochasticTrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This concrete class represents the Adam (adaptive moment estimation) training algorithm for an objective
+/// functional of a multilayer perceptron.
+/// It keeps running averages of the mini-batch gradients and of their squares, corrects their initialization bias,
+/// and scales the step of each parameter by the ratio of both.
+
+class AdamOptimizer : public StochasticTrainingAlgorithm
+{
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit AdamOptimizer(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit AdamOptimizer(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~AdamOptimizer(void);
+
+
+   // METHODS
+
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
+   // Get methods
+
+   double get_first_moment_decay(void);
+   double get_second_moment_decay(void);
+   double get_epsilon(void);
+
+   const Vector<double>& get_first_moment(void);
+   const Vector<double>& get_second_moment(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_first_moment_decay(double);
+   void set_second_moment_decay(double);
+   void set_epsilon(double);
+
+   // Train methods
+
+   void initialize_optimizer_state(int);
+
+   void update_parameters(Vector<double>&, const Vector<double>&, double);
+
+   // Training history methods
+
+   std::string get_training_history_XML(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Decay rate of the running average of the gradients.
+
+   double first_moment_decay;
+
+   /// Decay rate of the running average of the squared gradients.
+
+   double second_moment_decay;
+
+   /// Small value added to the root of the second moment estimate to avoid divisions by zero.
+
+   double epsilon;
+
+   /// Running average of the mini-batch gradients.
+
+   Vector<double> first_moment;
+
+   /// Running average of the squared mini-batch gradients.
+
+   Vector<double> second_moment;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -75,9 +75,7 @@ namespace Flood
 ConjugateGradient::ConjugateGradient(ObjectiveFunctional* new_objective_functional_pointer)
 : TrainingAlgorithm(new_objective_functional_pointer)
 {
-   // Training operators
-
-   training_direction_method = PolakRibiere;
+   set_default();
 }
 
 
@@ -125,9 +123,7 @@ ConjugateGradient::ConjugateGradient(ObjectiveFunctional* new_objective_function
 
 ConjugateGradient::ConjugateGradient(void) : TrainingAlgorithm()
 {
-   // Training operators
-
-   training_direction_method = PolakRibiere;
+   set_default();
 }
 
 
@@ -142,6 +138,22 @@ ConjugateGradient::~ConjugateGradient(void)
 
 // METHODS
 
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new conjugate gradient object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* ConjugateGradient::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   ConjugateGradient* conjugate_gradient_pointer = new ConjugateGradient(*this);
+
+   conjugate_gradient_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(conjugate_gradient_pointer);
+}
+
+
 // TrainingDirectionMethod get_training_direction_method(void) method
 
 /// This method returns the conjugate gradient training direction method used for training.
@@ -185,6 +197,32 @@ std::string ConjugateGradient::get_training_direction_method_name(void)
 }
 
 
+// void set_default(void) method
+
+/// This method sets the members of the conjugate gradient object to their default values.
+/// The members of the training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Training direction method: Polak-Ribiere
+/// <li> Curvature parameter: 0.1
+/// </ul>
+
+void ConjugateGradient::set_default(void)
+{
+   TrainingAlgorithm::set_default();
+
+   // TRAINING OPERATORS
+
+   training_direction_method = PolakRibiere;
+
+   // TRAINING PARAMETERS
+
+   // The strong Wolfe line search only guarantees conjugate gradient descent directions with a curvature 
+   // parameter below 0.5
+
+   curvature_parameter = 0.1;
+}
+
+
 // void set_training_direction_method(const TrainingDirectionMethod&) method
 
 /// This method sets a new training direction method to be used for training. 
@@ -467,10 +505,11 @@ void ConjugateGradient::train(void)
 
    // Elapsed time
 
-   time_t beginning_time, current_time;
-   time(&beginning_time);
+   double beginning_time = calculate_monotonic_time();
    double elapsed_time;
 
+   initialize_profiling();
+
    // Multilayer perceptron stuff
 
    MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
@@ -512,11 +551,60 @@ void ConjugateGradient::train(void)
 
    bool stop_training = false;
 
-   resize_training_history(maximum_epochs_number+1);
+   initialize_training_history(maximum_epochs_number+1);
+
+   int first_epoch = 0;
+
+   // Resume training from the checkpoint
+
+   if(resume_training)
+   {
+      std::istringstream checkpoint(load_checkpoint(), std::ios::in | std::ios::binary);
+
+      read_checkpoint_header(checkpoint, "ConjugateGradient");
+
+      int checkpoint_epoch = 0;
+      double checkpoint_elapsed_time = 0.0;
+
+      read_binary(checkpoint, checkpoint_epoch);
+      read_binary(checkpoint, checkpoint_elapsed_time);
+
+      read_binary(checkpoint, parameters);
+      read_binary(checkpoint, old_gradient);
+      read_binary(checkpoint, old_training_direction);
+
+      read_binary(checkpoint, training_rate_gradient);
+      read_binary(checkpoint, training_rate_evaluation);
+
+      read_binary(checkpoint, old_evaluation);
+      read_binary(checkpoint, old_training_rate);
+
+      read_binary(checkpoint, validation_error);
+      read_binary(checkpoint, old_validation_error);
+
+      read_training_history_binary(checkpoint);
+
+      if(!checkpoint || parameters.get_size() != parameters_number)
+      {
+         std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                   << "void train(void) method." << std::endl
+                   << "Checkpoint file does not match this training process." << std::endl;
+
+         exit(1);
+      }
+
+      multilayer_perceptron_pointer->set_parameters(parameters);
+
+      resize_training_history(calculate_training_history_size(maximum_epochs_number+1));
+
+      beginning_time -= checkpoint_elapsed_time;
+
+      first_epoch = checkpoint_epoch + 1;
+   }
    
    // Main loop    
    
-   for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   for(int epoch = first_epoch; epoch <= maximum_epochs_number; epoch++)
    {
       // Multilayer perceptron 
 
@@ -541,7 +629,12 @@ void ConjugateGradient::train(void)
     
       if(epoch == 0)
       {      
+         begin_profiling_phase(EvaluationPhase);
+
          evaluation = objective_functional_pointer->calculate_evaluation();
+
+         end_profiling_phase(EvaluationPhase);
+
          evaluation_improvement = 0.0; 
       }
       else
@@ -550,7 +643,33 @@ void ConjugateGradient::train(void)
          evaluation_improvement = old_evaluation - evaluation; 
       }
 
-      validation_error = objective_functional_pointer->calculate_validation_error();
+      if(epoch != 0 && training_rate_method == StrongWolfe)
+      {
+         // The strong Wolfe line search has already computed the gradient at the new parameters
+
+         gradient = training_rate_gradient;
+
+         if(epoch % validation_interval == 0)
+         {
+            begin_profiling_phase(ValidationPhase);
+
+            validation_error = objective_functional_pointer->calculate_validation_error();
+
+            end_profiling_phase(ValidationPhase);
+         }
+      }
+      else if(epoch % validation_interval == 0)
+      {
+         gradient = calculate_gradient_validation_error(validation_error);
+      }
+      else
+      {
+         begin_profiling_phase(GradientPhase);
+
+         gradient = objective_functional_pointer->calculate_gradient();
+
+         end_profiling_phase(GradientPhase);
+      }
 
       if(epoch == 0)
       {
@@ -561,8 +680,6 @@ void ConjugateGradient::train(void)
          validation_error_increment = validation_error - old_validation_error;
       }
 
-      gradient = objective_functional_pointer->calculate_gradient();
-
       gradient_norm = gradient.calculate_norm();
 
       if(display && gradient_norm >= warning_gradient_norm)
@@ -572,6 +689,8 @@ void ConjugateGradient::train(void)
 
       // Training algorithm 
 
+      begin_profiling_phase(TrainingDirectionPhase);
+
       if(epoch == 0 || epoch % parameters_number == 0)
       {
          // Gradient descent training direction
@@ -604,6 +723,8 @@ void ConjugateGradient::train(void)
          training_direction = calculate_gradient_descent_training_direction(gradient);
       }
 
+      end_profiling_phase(TrainingDirectionPhase);
+
       // Get initial training rate
 
       if(epoch == 0)
@@ -616,7 +737,7 @@ void ConjugateGradient::train(void)
       }
 
       training_rate_evaluation 
-      = calculate_training_rate_evaluation(evaluation, training_direction, initial_training_rate);
+      = calculate_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate);
 
       training_rate = training_rate_evaluation[0];
 
@@ -626,7 +747,7 @@ void ConjugateGradient::train(void)
 
          training_direction = calculate_gradient_descent_training_direction(gradient);         
 
-         training_rate_evaluation = calculate_training_rate_evaluation(evaluation, training_direction, first_training_rate);
+         training_rate_evaluation = calculate_training_rate_evaluation(evaluation, gradient, training_direction, first_training_rate);
 
          training_rate = training_rate_evaluation[0];
       }
@@ -636,60 +757,76 @@ void ConjugateGradient::train(void)
       
       // Elapsed time
 
-      time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      begin_profiling_phase(TrainingHistoryPhase);
+
+      int history_index = get_training_history_index(epoch);
 
       // Training history multilayer perceptron 
 
       if(reserve_parameters_history)
       {
-         parameters_history[epoch] = parameters;                                
+         parameters_history[history_index] = parameters;                                
       }
 
       if(reserve_parameters_norm_history)
       {
-         parameters_norm_history[epoch] = parameters_norm; 
+         parameters_norm_history[history_index] = parameters_norm; 
       }
 
       // Training history objective functional
 
       if(reserve_evaluation_history)
       {
-         evaluation_history[epoch] = evaluation;
+         evaluation_history[history_index] = evaluation;
       }
 
       if(reserve_validation_error_history)
       {
-         validation_error_history[epoch] = validation_error;
+         if(epoch % validation_interval == 0)
+         {
+            validation_error_history[history_index] = validation_error;
+         }
+         else
+         {
+            validation_error_history[history_index] = -1.0;
+         }
       }
 
       if(reserve_gradient_history)
       {
-         gradient_history[epoch] = gradient;                                
+         gradient_history[history_index] = gradient;                                
       }
 
       if(reserve_gradient_norm_history)
       {
-         gradient_norm_history[epoch] = gradient_norm;
+         gradient_norm_history[history_index] = gradient_norm;
       }
 
       // Training history training algorithm
 
       if(reserve_training_direction_history)
       {
-         training_direction_history[epoch] = training_direction;                                
+         training_direction_history[history_index] = training_direction;                                
       }
 
       if(reserve_training_rate_history)
       {
-         training_rate_history[epoch] = training_rate;
+         training_rate_history[history_index] = training_rate;
       }
 
       if(reserve_elapsed_time_history)
       {
-         elapsed_time_history[epoch] = elapsed_time;
+         elapsed_time_history[history_index] = elapsed_time;
       }
 
+      append_training_history(epoch);
+
+      end_profiling_phase(TrainingHistoryPhase);
+
       // Stopping Criteria
 
       if(parameters_increment_norm <= minimum_parameters_increment_norm)
@@ -786,7 +923,7 @@ void ConjugateGradient::train(void)
                       << "Elapsed time: " << elapsed_time << std::endl; 
 		 }
 
-         resize_training_history(1+epoch);
+         finish_training_history(1+epoch);
   
          break;
       }
@@ -826,7 +963,54 @@ void ConjugateGradient::train(void)
 
       old_training_direction = training_direction;   
       old_training_rate = training_rate;
+
+      // Checkpoint
+
+      if(checkpoint_period > 0 && (epoch+1) % checkpoint_period == 0)
+      {
+         std::ostringstream checkpoint(std::ios::out | std::ios::binary);
+
+         write_checkpoint_header(checkpoint, "ConjugateGradient");
+
+         write_binary(checkpoint, epoch);
+         write_binary(checkpoint, elapsed_time);
+
+         write_binary(checkpoint, parameters);
+         write_binary(checkpoint, old_gradient);
+         write_binary(checkpoint, old_training_direction);
+
+         write_binary(checkpoint, training_rate_gradient);
+         write_binary(checkpoint, training_rate_evaluation);
+
+         write_binary(checkpoint, old_evaluation);
+         write_binary(checkpoint, old_training_rate);
+
+         write_binary(checkpoint, validation_error);
+         write_binary(checkpoint, old_validation_error);
+
+         write_training_history_binary(checkpoint);
+
+         save_checkpoint(checkpoint.str());
+      }
    } 
+
+   delete_validation_replica();
+}
+
+
+// void resume(void) method
+
+/// This method continues the training process from the state saved in the checkpoint file. 
+/// The parameters of the multilayer perceptron, the conjugate directions and the training history are restored, 
+/// so that training goes on exactly as if it had not been interrupted after the epoch of the checkpoint. 
+
+void ConjugateGradient::resume(void)
+{
+   resume_training = true;
+
+   train();
+
+   resume_training = false;
 }
 
 
@@ -870,6 +1054,14 @@ std::string ConjugateGradient::to_XML(bool show_declaration)
           << training_rate_tolerance << std::endl
           << "</TrainingRateTolerance>" << std::endl;
 
+   buffer << "<SufficientDecreaseParameter>" << std::endl
+          << sufficient_decrease_parameter << std::endl
+          << "</SufficientDecreaseParameter>" << std::endl;
+
+   buffer << "<CurvatureParameter>" << std::endl
+          << curvature_parameter << std::endl
+          << "</CurvatureParameter>" << std::endl;
+
    buffer << "<WarningTrainingRate>" << std::endl
           << warning_training_rate << std::endl
           << "</WarningTrainingRate>" << std::endl;
@@ -904,6 +1096,38 @@ std::string ConjugateGradient::to_XML(bool show_declaration)
           << maximum_time << std::endl 
           << "</MaximumTime>" << std::endl;
 
+   buffer << "<CheckpointPeriod>" << std::endl
+          << checkpoint_period << std::endl
+          << "</CheckpointPeriod>" << std::endl;
+
+   buffer << "<CheckpointFilename>" << std::endl
+          << checkpoint_filename << std::endl
+          << "</CheckpointFilename>" << std::endl;
+
+   // Training history sink
+
+   buffer << "<TrainingHistoryPeriod>" << std::endl
+          << training_history_period << std::endl
+          << "</TrainingHistoryPeriod>" << std::endl;
+
+   buffer << "<TrainingHistoryDepth>" << std::endl
+          << training_history_depth << std::endl
+          << "</TrainingHistoryDepth>" << std::endl;
+
+   buffer << "<TrainingHistoryFilename>" << std::endl
+          << training_history_filename << std::endl
+          << "</TrainingHistoryFilename>" << std::endl;
+
+   // Profiling
+
+   buffer << "<Profiling>" << std::endl
+          << profiling << std::endl
+          << "</Profiling>" << std::endl;
+
+   buffer << "<ReserveProfilingTrace>" << std::endl
+          << reserve_profiling_trace << std::endl
+          << "</ReserveProfilingTrace>" << std::endl;
+
    // Training history
 
    buffer << "<ReserveParametersHistory>" << std::endl
@@ -1099,6 +1323,44 @@ void ConjugateGradient::load(const char* filename)
  
             exit(1);
          }  
+	  }
+	  else if(word == "<SufficientDecreaseParameter>")
+	  {
+		 double new_sufficient_decrease_parameter; 
+
+         file >> new_sufficient_decrease_parameter;          
+
+         file >> word;
+
+		 if(word != "</SufficientDecreaseParameter>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown sufficient decrease parameter end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_sufficient_decrease_parameter(new_sufficient_decrease_parameter);
+	  }
+	  else if(word == "<CurvatureParameter>")
+	  {
+		 double new_curvature_parameter; 
+
+         file >> new_curvature_parameter;          
+
+         file >> word;
+
+		 if(word != "</CurvatureParameter>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown curvature parameter end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_curvature_parameter(new_curvature_parameter);
 	  }
 	  else if(word == "<WarningTrainingRate>")
 	  {
@@ -1274,6 +1536,184 @@ void ConjugateGradient::load(const char* filename)
             exit(1);
          }  
 	  }
+	  else if(word == "<ValidationInterval>")
+	  {
+   	     int new_validation_interval; 
+
+         file >> new_validation_interval;          
+
+         file >> word;
+
+		 if(word != "</ValidationInterval>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown validation interval end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_validation_interval(new_validation_interval);
+	  }
+	  else if(word == "<AsynchronousValidation>")
+	  {
+   	     bool new_asynchronous_validation; 
+
+         file >> new_asynchronous_validation;          
+
+         file >> word;
+
+		 if(word != "</AsynchronousValidation>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown asynchronous validation end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_asynchronous_validation(new_asynchronous_validation);
+	  }
+	  else if(word == "<CheckpointPeriod>")
+	  {
+   	     int new_checkpoint_period; 
+
+         file >> new_checkpoint_period;          
+
+         file >> word;
+
+		 if(word != "</CheckpointPeriod>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_period(new_checkpoint_period);
+	  }
+	  else if(word == "<CheckpointFilename>")
+	  {
+   	     std::string new_checkpoint_filename; 
+
+         file >> new_checkpoint_filename;          
+
+         file >> word;
+
+		 if(word != "</CheckpointFilename>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_filename(new_checkpoint_filename);
+	  }
+	  else if(word == "<TrainingHistoryPeriod>")
+	  {
+   	     int new_training_history_period; 
+
+         file >> new_training_history_period;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryPeriod>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_period(new_training_history_period);
+	  }
+	  else if(word == "<TrainingHistoryDepth>")
+	  {
+   	     int new_training_history_depth; 
+
+         file >> new_training_history_depth;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryDepth>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history depth end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_depth(new_training_history_depth);
+	  }
+	  else if(word == "<TrainingHistoryFilename>")
+	  {
+         // The training history filename is empty by default
+
+   	     std::string new_training_history_filename; 
+
+         file >> word;
+
+         if(word != "</TrainingHistoryFilename>")
+         {
+            new_training_history_filename = word;
+
+            file >> word;
+         }
+
+		 if(word != "</TrainingHistoryFilename>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_filename(new_training_history_filename);
+	  }
+	  else if(word == "<Profiling>")
+	  {
+   	     bool new_profiling; 
+
+         file >> new_profiling;          
+
+         file >> word;
+
+		 if(word != "</Profiling>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown profiling end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_profiling(new_profiling);
+	  }
+	  else if(word == "<ReserveProfilingTrace>")
+	  {
+   	     bool new_reserve_profiling_trace; 
+
+         file >> new_reserve_profiling_trace;          
+
+         file >> word;
+
+		 if(word != "</ReserveProfilingTrace>") 
+         {
+            std::cerr << "Flood Error: ConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown reserve profiling trace end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_reserve_profiling_trace(new_reserve_profiling_trace);
+	  }
 
       // Training history 
 
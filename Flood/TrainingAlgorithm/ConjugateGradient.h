@@ -55,6 +55,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
    // Get methods
 
    TrainingDirectionMethod get_training_direction_method(void);
@@ -62,6 +66,8 @@ public:
 
    // Set methods
 
+   void set_default(void);
+
    void set_training_direction_method(const TrainingDirectionMethod&);
    void set_training_direction_method(const std::string&);
 
@@ -81,6 +87,8 @@ public:
 
    void train(void);
 
+   void resume(void);
+
    // Training history methods
 
    void set_reserve_all_training_history(bool);
@@ -0,0 +1,1022 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   C O V A R I A N C E   M A T R I X   A D A P T A T I O N   C L A S S                                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <utility>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+
+// Flood includes
+
+#include "CovarianceMatrixAdaptation.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a covariance matrix adaptation training algorithm object associated to an
+/// objective functional object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+CovarianceMatrixAdaptation::CovarianceMatrixAdaptation(ObjectiveFunctional* new_objective_functional_pointer)
+: TrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a covariance matrix adaptation training algorithm object not associated to any
+/// objective functional object.
+/// It also initializes the class members to their default values.
+
+CovarianceMatrixAdaptation::CovarianceMatrixAdaptation(void) : TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+CovarianceMatrixAdaptation::~CovarianceMatrixAdaptation(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new covariance matrix adaptation object with the same members as this one, associated to
+/// another objective functional object.
+/// The returned object must be deleted by the caller.
+/// @param new_objective_functional_pointer Pointer to the objective functional of the copy.
+
+TrainingAlgorithm* CovarianceMatrixAdaptation::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   CovarianceMatrixAdaptation* covariance_matrix_adaptation_pointer = new CovarianceMatrixAdaptation(*this);
+
+   covariance_matrix_adaptation_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(covariance_matrix_adaptation_pointer);
+}
+
+
+// double get_initial_step_size(void) method
+
+/// This method returns the standard deviation of the search distribution at the first generation.
+
+double CovarianceMatrixAdaptation::get_initial_step_size(void)
+{
+   return(initial_step_size);
+}
+
+
+// int get_population_size(void) method
+
+/// This method returns the number of parameter vectors sampled at each generation.
+/// Zero means the default size for the number of parameters.
+
+int CovarianceMatrixAdaptation::get_population_size(void)
+{
+   return(population_size);
+}
+
+
+// int get_eigendecomposition_period(void) method
+
+/// This method returns the number of generations between two eigendecompositions of the covariance matrix.
+/// Zero means the default period for the number of parameters.
+
+int CovarianceMatrixAdaptation::get_eigendecomposition_period(void)
+{
+   return(eigendecomposition_period);
+}
+
+
+// double get_step_size(void) method
+
+/// This method returns the standard deviation of the search distribution after the last generation of training.
+
+double CovarianceMatrixAdaptation::get_step_size(void)
+{
+   return(step_size);
+}
+
+
+// Matrix<double>& get_covariance_matrix(void) method
+
+/// This method returns the covariance matrix of the search distribution after the last generation of training.
+
+Matrix<double>& CovarianceMatrixAdaptation::get_covariance_matrix(void)
+{
+   return(covariance_matrix);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the covariance matrix adaptation object to their default values.
+/// The members of the training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Initial step size: 0.5
+/// <li> Population size: 0 (4 + 3*ln(n))
+/// <li> Eigendecomposition period: 0 (automatic)
+/// </ul>
+
+void CovarianceMatrixAdaptation::set_default(void)
+{
+   TrainingAlgorithm::set_default();
+
+   // TRAINING PARAMETERS
+
+   initial_step_size = 0.5;
+
+   population_size = 0;
+   eigendecomposition_period = 0;
+
+   step_size = initial_step_size;
+}
+
+
+// void set_initial_step_size(double) method
+
+/// This method sets a new standard deviation of the search distribution at the first generation.
+/// @param new_initial_step_size Initial step size. It must be greater than zero.
+
+void CovarianceMatrixAdaptation::set_initial_step_size(double new_initial_step_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_initial_step_size <= 0.0)
+   {
+      std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                << "void set_initial_step_size(double) method." << std::endl
+                << "Initial step size must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   initial_step_size = new_initial_step_size;
+}
+
+
+// void set_population_size(int) method
+
+/// This method sets a new number of parameter vectors sampled at each generation.
+/// @param new_population_size Population size. Zero means the default 4 + 3*ln(n), and any other value must be at
+/// least two.
+
+void CovarianceMatrixAdaptation::set_population_size(int new_population_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_population_size < 0 || new_population_size == 1)
+   {
+      std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                << "void set_population_size(int) method." << std::endl
+                << "Population size must be zero or greater than one." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   population_size = new_population_size;
+}
+
+
+// void set_eigendecomposition_period(int) method
+
+/// This method sets a new number of generations between two eigendecompositions of the covariance matrix.
+/// @param new_eigendecomposition_period Eigendecomposition period. Zero means the default period.
+
+void CovarianceMatrixAdaptation::set_eigendecomposition_period(int new_eigendecomposition_period)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_eigendecomposition_period < 0)
+   {
+      std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                << "void set_eigendecomposition_period(int) method." << std::endl
+                << "Eigendecomposition period must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   eigendecomposition_period = new_eigendecomposition_period;
+}
+
+
+// int calculate_population_size(int) method
+
+/// This method returns the number of parameter vectors sampled at each generation for a given number of
+/// parameters.
+/// @param parameters_number Number of parameters.
+
+int CovarianceMatrixAdaptation::calculate_population_size(int parameters_number)
+{
+   if(population_size != 0)
+   {
+      return(population_size);
+   }
+   else
+   {
+      return(4 + (int)(3.0*log((double)parameters_number)));
+   }
+}
+
+
+// Vector<double> calculate_recombination_weights(int) method
+
+/// This method returns the weights of the best half of the population in the recombination of the mean, from the
+/// best to the worst.
+/// They decrease logarithmically with the rank, and add up to one.
+/// @param new_population_size Population size.
+
+Vector<double> CovarianceMatrixAdaptation::calculate_recombination_weights(int new_population_size)
+{
+   int parents_number = new_population_size/2;
+
+   Vector<double> recombination_weights(parents_number);
+
+   for(int i = 0; i < parents_number; i++)
+   {
+      recombination_weights[i] = log(new_population_size/2.0 + 0.5) - log(i + 1.0);
+   }
+
+   double sum = 0.0;
+
+   for(int i = 0; i < parents_number; i++)
+   {
+      sum += recombination_weights[i];
+   }
+
+   return(recombination_weights/sum);
+}
+
+
+// void calculate_eigensystem(const Matrix<double>&, Matrix<double>&, Vector<double>&) method
+
+/// This method computes the eigenvalues and eigenvectors of a symmetric matrix with the cyclic Jacobi method.
+/// @param matrix Symmetric matrix.
+/// @param eigenvectors Matrix whose columns are set to the eigenvectors, which are orthonormal.
+/// @param eigenvalues Vector set to the eigenvalues, in the order of the eigenvectors.
+
+void CovarianceMatrixAdaptation::calculate_eigensystem
+(const Matrix<double>& matrix, Matrix<double>& eigenvectors, Vector<double>& eigenvalues)
+{
+   int size = matrix.get_rows_number();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(matrix.get_columns_number() != size)
+   {
+      std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                << "void calculate_eigensystem(const Matrix<double>&, Matrix<double>&, Vector<double>&) method."
+                << std::endl
+                << "Matrix must be square." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   Matrix<double> a(matrix);
+
+   eigenvectors.set(size, size);
+   eigenvectors.set_to_identity();
+
+   double a_pp, a_qq, a_pq;
+   double theta, t, c, s;
+   double a_kp, a_kq;
+
+   for(int sweep = 0; sweep < 50; sweep++)
+   {
+      // Stop when the off-diagonal elements are negligible
+
+      double off_diagonal_norm = 0.0;
+      double diagonal_norm = 0.0;
+
+      for(int p = 0; p < size; p++)
+      {
+         diagonal_norm += a[p][p]*a[p][p];
+
+         for(int q = p+1; q < size; q++)
+         {
+            off_diagonal_norm += a[p][q]*a[p][q];
+         }
+      }
+
+      if(off_diagonal_norm <= 1.0e-30*diagonal_norm)
+      {
+         break;
+      }
+
+      // Rotate every pair of rows and columns so as to annihilate their off-diagonal element
+
+      for(int p = 0; p < size; p++)
+      {
+         for(int q = p+1; q < size; q++)
+         {
+            a_pq = a[p][q];
+
+            if(a_pq == 0.0)
+            {
+               continue;
+            }
+
+            a_pp = a[p][p];
+            a_qq = a[q][q];
+
+            theta = (a_qq - a_pp)/(2.0*a_pq);
+
+            t = 1.0/(fabs(theta) + sqrt(theta*theta + 1.0));
+
+            if(theta < 0.0)
+            {
+               t = -t;
+            }
+
+            c = 1.0/sqrt(t*t + 1.0);
+            s = t*c;
+
+            for(int k = 0; k < size; k++)
+            {
+               a_kp = a[k][p];
+               a_kq = a[k][q];
+
+               a[k][p] = c*a_kp - s*a_kq;
+               a[k][q] = s*a_kp + c*a_kq;
+            }
+
+            for(int k = 0; k < size; k++)
+            {
+               a_kp = a[p][k];
+               a_kq = a[q][k];
+
+               a[p][k] = c*a_kp - s*a_kq;
+               a[q][k] = s*a_kp + c*a_kq;
+            }
+
+            for(int k = 0; k < size; k++)
+            {
+               a_kp = eigenvectors[k][p];
+               a_kq = eigenvectors[k][q];
+
+               eigenvectors[k][p] = c*a_kp - s*a_kq;
+               eigenvectors[k][q] = s*a_kp + c*a_kq;
+            }
+         }
+      }
+   }
+
+   eigenvalues = a.get_diagonal();
+}
+
+
+// void train(void) method
+
+/// This method trains a multilayer perceptron with an associated objective functional according to the covariance
+/// matrix adaptation evolution strategy.
+/// The search distribution is centred at the initial parameters, and the parameters of the multilayer perceptron
+/// are set to the best parameter vector sampled so far.
+/// Each epoch is a generation, which computes as many evaluations as the population size. The mean of the
+/// distribution is not evaluated.
+/// The covariance matrix is only factorized every eigendecomposition period generations, and the samples of a
+/// generation are all obtained with one matrix product.
+/// The minimum evaluation improvement criterion does not apply, since the best evaluation does not need to improve
+/// at every generation, and there are no gradient criteria.
+
+void CovarianceMatrixAdaptation::train(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(objective_functional_pointer == NULL)
+   {
+      std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Start training
+
+   if(display)
+   {
+      std::cout << "Training with covariance matrix adaptation..." << std::endl;
+   }
+
+   // Multilayer perceptron stuff
+
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+   double parameters_norm;
+
+   double parameters_increment_norm = 0.0;
+
+   // Objective functional stuff
+
+   double evaluation = objective_functional_pointer->calculate_evaluation();
+
+   // Strategy parameters
+
+   int lambda = calculate_population_size(parameters_number);
+   int mu = lambda/2;
+
+   Vector<double> recombination_weights = calculate_recombination_weights(lambda);
+
+   double mu_effective = 1.0/recombination_weights.dot(recombination_weights);
+
+   double n = (double)parameters_number;
+
+   double path_cumulation = (4.0 + mu_effective/n)/(n + 4.0 + 2.0*mu_effective/n);
+   double step_size_cumulation = (mu_effective + 2.0)/(n + mu_effective + 5.0);
+
+   double rank_one_learning_rate = 2.0/((n + 1.3)*(n + 1.3) + mu_effective);
+   double rank_mu_learning_rate = 2.0*(mu_effective - 2.0 + 1.0/mu_effective)/((n + 2.0)*(n + 2.0) + mu_effective);
+
+   if(rank_mu_learning_rate > 1.0 - rank_one_learning_rate)
+   {
+      rank_mu_learning_rate = 1.0 - rank_one_learning_rate;
+   }
+
+   double step_size_damping = 1.0 + step_size_cumulation;
+
+   if(sqrt((mu_effective - 1.0)/(n + 1.0)) > 1.0)
+   {
+      step_size_damping += 2.0*(sqrt((mu_effective - 1.0)/(n + 1.0)) - 1.0);
+   }
+
+   double expected_normal_norm = sqrt(n)*(1.0 - 1.0/(4.0*n) + 1.0/(21.0*n*n));
+
+   int period = eigendecomposition_period;
+
+   if(period == 0)
+   {
+      period = (int)(1.0/(10.0*n*(rank_one_learning_rate + rank_mu_learning_rate)));
+
+      if(period < 1)
+      {
+         period = 1;
+      }
+   }
+
+   // Search distribution
+
+   Vector<double> mean = parameters;
+   Vector<double> old_mean(parameters_number);
+
+   step_size = initial_step_size;
+
+   covariance_matrix.set(parameters_number, parameters_number);
+   covariance_matrix.set_to_identity();
+
+   Matrix<double> eigenvectors(parameters_number, parameters_number);
+   eigenvectors.set_to_identity();
+
+   Vector<double> eigenvalues(parameters_number, 1.0);
+
+   // Square root of the covariance matrix, B*D, and D^-1*B^T, so that the inverse square root is B*D^-1*B^T
+
+   Matrix<double> scaled_eigenvectors(eigenvectors);
+   Matrix<double> inverse_square_root(eigenvectors);
+
+   Vector<double> conjugate_evolution_path(parameters_number, 0.0);
+   Vector<double> evolution_path(parameters_number, 0.0);
+
+   // Population
+
+   Matrix<double> normal_samples(lambda, parameters_number);
+   Matrix<double> steps(lambda, parameters_number);
+   Matrix<double> population(lambda, parameters_number);
+   Vector<double> population_evaluation(lambda);
+
+   Vector< std::pair<double, int> > ranking(lambda);
+
+   Vector<double> mean_step(parameters_number);
+   Vector<double> whitened_mean_step(parameters_number);
+
+   // Training algorithm stuff
+
+   Vector<double> training_direction(parameters_number, 0.0);
+
+   bool stop_training = false;
+
+   double beginning_time = calculate_monotonic_time();
+   double elapsed_time;
+
+   initialize_profiling();
+
+   initialize_training_history(maximum_epochs_number+1);
+
+   // Main loop
+
+   for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   {
+      // Multilayer perceptron stuff
+
+      parameters_norm = parameters.calculate_norm();
+
+      if(display && parameters_norm >= warning_parameters_norm)
+      {
+         std::cout << "Flood Warning: Parameters norm is " << parameters_norm << "." << std::endl;
+      }
+
+      // Elapsed time
+
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      int history_index = get_training_history_index(epoch);
+
+      // Training history multilayer perceptron
+
+      if(reserve_parameters_history)
+      {
+         parameters_history[history_index] = parameters;
+      }
+
+      if(reserve_parameters_norm_history)
+      {
+         parameters_norm_history[history_index] = parameters_norm;
+      }
+
+      // Training history objective functional
+
+      if(reserve_evaluation_history)
+      {
+         evaluation_history[history_index] = evaluation;
+      }
+
+      // Training history training algorithm
+
+      if(reserve_training_direction_history)
+      {
+         training_direction_history[history_index] = training_direction;
+      }
+
+      if(reserve_training_rate_history)
+      {
+         training_rate_history[history_index] = step_size;
+      }
+
+      if(reserve_elapsed_time_history)
+      {
+         elapsed_time_history[history_index] = elapsed_time;
+      }
+
+      append_training_history(epoch);
+
+      // Stopping Criteria
+
+      if(epoch != 0 && parameters_increment_norm <= minimum_parameters_increment_norm)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum parameters increment norm reached." << std::endl
+			          << "Parameters increment norm: " << parameters_increment_norm << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(evaluation <= evaluation_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Evaluation goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch == maximum_epochs_number)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum number of epochs reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(elapsed_time >= maximum_time)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum training time reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      if(stop_training)
+      {
+         if(display)
+		 {
+            std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+            std::cout << "Evaluation: " << evaluation << std::endl;
+
+            objective_functional_pointer->print_information();
+
+            std::cout << "Step size: " << step_size << std::endl
+                      << "Elapsed time: " << elapsed_time << std::endl;
+		 }
+
+         finish_training_history(1+epoch);
+
+         break;
+      }
+      else if(display && epoch % display_period == 0)
+      {
+         std::cout << "Epoch " << epoch << ";" << std::endl;
+
+         std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+         std::cout << "Evaluation: " << evaluation << std::endl;
+
+         objective_functional_pointer->print_information();
+
+         std::cout << "Step size: " << step_size << std::endl
+                   << "Elapsed time: " << elapsed_time << std::endl;
+      }
+
+      // Sample a new population, with one row per individual
+
+      normal_samples.initialize_normal(0.0, 1.0);
+
+      steps = normal_samples.dot(scaled_eigenvectors.calculate_transpose());
+
+      for(int i = 0; i < lambda; i++)
+      {
+         for(int j = 0; j < parameters_number; j++)
+         {
+            population[i][j] = mean[j] + step_size*steps[i][j];
+         }
+      }
+
+      population_evaluation = objective_functional_pointer->calculate_potential_evaluation(population);
+
+      for(int i = 0; i < lambda; i++)
+      {
+         ranking[i] = std::pair<double, int>(population_evaluation[i], i);
+      }
+
+      std::sort(ranking.begin(), ranking.end());
+
+      // Keep the best parameters found
+
+      if(ranking[0].first < evaluation)
+      {
+         evaluation = ranking[0].first;
+         parameters = population.get_row(ranking[0].second);
+
+         multilayer_perceptron_pointer->set_parameters(parameters);
+      }
+
+      // Recombination of the mean
+
+      old_mean = mean;
+
+      mean_step.initialize(0.0);
+
+      for(int i = 0; i < mu; i++)
+      {
+         for(int j = 0; j < parameters_number; j++)
+         {
+            mean_step[j] += recombination_weights[i]*steps[ranking[i].second][j];
+         }
+      }
+
+      mean = old_mean + mean_step*step_size;
+
+      training_direction = mean - old_mean;
+
+      parameters_increment_norm = training_direction.calculate_norm();
+
+      // Evolution paths
+
+      whitened_mean_step = eigenvectors.dot(inverse_square_root.dot(mean_step));
+
+      conjugate_evolution_path = conjugate_evolution_path*(1.0 - step_size_cumulation)
+      + whitened_mean_step*sqrt(step_size_cumulation*(2.0 - step_size_cumulation)*mu_effective);
+
+      double conjugate_evolution_path_norm = conjugate_evolution_path.calculate_norm();
+
+      bool stalled = conjugate_evolution_path_norm/sqrt(1.0 - pow(1.0 - step_size_cumulation, 2.0*(epoch + 1)))
+                   >= (1.4 + 2.0/(n + 1.0))*expected_normal_norm;
+
+      evolution_path = evolution_path*(1.0 - path_cumulation);
+
+      if(!stalled)
+      {
+         evolution_path += mean_step*sqrt(path_cumulation*(2.0 - path_cumulation)*mu_effective);
+      }
+
+      // Rank-one and rank-mu updates of the covariance matrix
+
+      double old_covariance_weight = 1.0 - rank_one_learning_rate - rank_mu_learning_rate;
+
+      if(stalled)
+      {
+         old_covariance_weight += rank_one_learning_rate*path_cumulation*(2.0 - path_cumulation);
+      }
+
+      for(int j = 0; j < parameters_number; j++)
+      {
+         for(int k = 0; k <= j; k++)
+         {
+            double rank_mu_update = 0.0;
+
+            for(int i = 0; i < mu; i++)
+            {
+               rank_mu_update += recombination_weights[i]*steps[ranking[i].second][j]*steps[ranking[i].second][k];
+            }
+
+            covariance_matrix[j][k] = old_covariance_weight*covariance_matrix[j][k]
+            + rank_one_learning_rate*evolution_path[j]*evolution_path[k]
+            + rank_mu_learning_rate*rank_mu_update;
+
+            covariance_matrix[k][j] = covariance_matrix[j][k];
+         }
+      }
+
+      // Cumulative step size adaptation
+
+      step_size *= exp((step_size_cumulation/step_size_damping)*(conjugate_evolution_path_norm/expected_normal_norm - 1.0));
+
+      // Lazy eigendecomposition of the covariance matrix
+
+      if((epoch + 1) % period == 0)
+      {
+         calculate_eigensystem(covariance_matrix, eigenvectors, eigenvalues);
+
+         double maximum_eigenvalue = eigenvalues.calculate_maximum();
+
+         for(int j = 0; j < parameters_number; j++)
+         {
+            double standard_deviation = sqrt(std::max(eigenvalues[j], 1.0e-20*maximum_eigenvalue));
+
+            for(int k = 0; k < parameters_number; k++)
+            {
+               scaled_eigenvectors[k][j] = eigenvectors[k][j]*standard_deviation;
+               inverse_square_root[j][k] = eigenvectors[k][j]/standard_deviation;
+            }
+         }
+      }
+   }
+}
+
+
+// void set_reserve_all_training_history(bool) method
+
+/// This method makes the training history of all variables to reseved or not in memory.
+/// The gradient, inverse Hessian and validation error are never computed by this training algorithm, so their
+/// histories are not reserved.
+/// The training rate history contains the step size.
+/// @param new_reserve_all_training_history True if the training history of all variables is to be reserved,
+/// false otherwise.
+
+void CovarianceMatrixAdaptation::set_reserve_all_training_history(bool new_reserve_all_training_history)
+{
+   reserve_parameters_history = new_reserve_all_training_history;
+   reserve_parameters_norm_history = new_reserve_all_training_history;
+
+   reserve_evaluation_history = new_reserve_all_training_history;
+
+   reserve_training_direction_history = new_reserve_all_training_history;
+   reserve_training_rate_history = new_reserve_all_training_history;
+   reserve_elapsed_time_history = new_reserve_all_training_history;
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format.
+/// Only that training history variables which have been reserved are included here.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string CovarianceMatrixAdaptation::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='CovarianceMatrixAdaptation' content='TrainingHistory'>" << std::endl;
+   }
+
+   buffer << TrainingAlgorithm::get_training_history_XML(false);
+
+   return(buffer.str());
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of this covariance matrix adaptation object.
+/// It contains the initial step size, population size and eigendecomposition period, together with the training
+/// parameters, stopping criteria and other user stuff of the training algorithm base class.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string CovarianceMatrixAdaptation::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='CovarianceMatrixAdaptation'>" << std::endl;
+   }
+
+   // Training parameters
+
+   buffer << "<InitialStepSize>" << std::endl
+          << initial_step_size << std::endl
+          << "</InitialStepSize>" << std::endl;
+
+   buffer << "<PopulationSize>" << std::endl
+          << population_size << std::endl
+          << "</PopulationSize>" << std::endl;
+
+   buffer << "<EigendecompositionPeriod>" << std::endl
+          << eigendecomposition_period << std::endl
+          << "</EigendecompositionPeriod>" << std::endl;
+
+   buffer << TrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads a covariance matrix adaptation object from a XML-type file.
+/// The members of the training algorithm base class are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void CovarianceMatrixAdaptation::load(const char* filename)
+{
+   TrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open covariance matrix adaptation object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+      // Training parameters
+
+      if(word == "<InitialStepSize>")
+      {
+         double new_initial_step_size;
+
+         file >> new_initial_step_size;
+
+         file >> word;
+
+         if(word != "</InitialStepSize>")
+         {
+            std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown initial step size end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_initial_step_size(new_initial_step_size);
+      }
+      else if(word == "<PopulationSize>")
+      {
+         int new_population_size;
+
+         file >> new_population_size;
+
+         file >> word;
+
+         if(word != "</PopulationSize>")
+         {
+            std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown population size end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_population_size(new_population_size);
+      }
+      else if(word == "<EigendecompositionPeriod>")
+      {
+         int new_eigendecomposition_period;
+
+         file >> new_eigendecomposition_period;
+
+         file >> word;
+
+         if(word != "</EigendecompositionPeriod>")
+         {
+            std::cerr << "Flood Error: CovarianceMatrixAdaptation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown eigendecomposition period end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_eigendecomposition_period(new_eigendecomposition_period);
+      }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
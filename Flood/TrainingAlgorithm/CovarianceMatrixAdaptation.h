@@ -0,0 +1,148 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   C O V A R I A N C E   M A T R I X   A D A P T A T I O N   C L A S S   H E A D E R                          */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __COVARIANCEMATRIXADAPTATION_H__
+#define __COVARIANCEMATRIXADAPTATION_H__
+
+// Flood includes
+
+#include "TrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This concrete class represents the covariance matrix adaptation evolution strategy (CMA-ES) training algorithm
+/// for an objective functional of a multilayer perceptron.
+/// Each generation samples a population of parameter vectors from a multivariate normal distribution, and moves
+/// its mean towards the best of them.
+/// The covariance matrix of the distribution is adapted with the rank-one and rank-mu updates, and the step size
+/// with the cumulative step size adaptation, so that no gradient is needed.
+
+class CovarianceMatrixAdaptation : public TrainingAlgorithm
+{
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit CovarianceMatrixAdaptation(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit CovarianceMatrixAdaptation(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~CovarianceMatrixAdaptation(void);
+
+
+   // METHODS
+
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
+   // Get methods
+
+   double get_initial_step_size(void);
+
+   int get_population_size(void);
+   int get_eigendecomposition_period(void);
+
+   double get_step_size(void);
+   Matrix<double>& get_covariance_matrix(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_initial_step_size(double);
+
+   void set_population_size(int);
+   void set_eigendecomposition_period(int);
+
+   // Train methods
+
+   int calculate_population_size(int);
+
+   Vector<double> calculate_recombination_weights(int);
+
+   void calculate_eigensystem(const Matrix<double>&, Matrix<double>&, Vector<double>&);
+
+   void train(void);
+
+   // Training history methods
+
+   void set_reserve_all_training_history(bool);
+
+   std::string get_training_history_XML(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Standard deviation of the search distribution at the first generation.
+   /// It should be about a third of the distance from the initial parameters to the optimum.
+
+   double initial_step_size;
+
+   /// Number of parameter vectors sampled at each generation.
+   /// Zero means the default 4 + 3*ln(n), where n is the number of parameters.
+
+   int population_size;
+
+   /// Number of generations between two eigendecompositions of the covariance matrix.
+   /// Zero means the default, so that the cost of the eigendecomposition is of order n^2 per generation.
+
+   int eigendecomposition_period;
+
+   /// Standard deviation of the search distribution after the last generation of training.
+
+   double step_size;
+
+   /// Covariance matrix of the search distribution after the last generation of training.
+
+   Matrix<double> covariance_matrix;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
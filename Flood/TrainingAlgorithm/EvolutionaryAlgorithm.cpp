@@ -21,8 +21,10 @@
 #include <fstream>
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include <cmath>
 #include <time.h>
+#include <cstdlib>
 
 // Flood includes
 
@@ -50,6 +52,7 @@ namespace Flood
 /// <li> Recombination size: 0.25.
 /// <li> Mutation rate: = 1/parameters_number or 0.
 /// <li> Mutation range: = 0.1
+/// <li> Early abandon: false.
 /// </ul>
 /// Stopping criteria:
 /// <ul> 
@@ -103,6 +106,7 @@ EvolutionaryAlgorithm::EvolutionaryAlgorithm(ObjectiveFunctional* new_objective_
 /// <li> Recombination size: 0.25.
 /// <li> Mutation rate: = 1/parameters_number or 0.
 /// <li> Mutation range: = 0.1
+/// <li> Early abandon: false.
 /// </ul>
 /// Stopping criteria:
 /// <ul> 
@@ -146,6 +150,22 @@ EvolutionaryAlgorithm::~EvolutionaryAlgorithm(void)
 
 // METHODS
 
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new evolutionary algorithm object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* EvolutionaryAlgorithm::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   EvolutionaryAlgorithm* evolutionary_algorithm_pointer = new EvolutionaryAlgorithm(*this);
+
+   evolutionary_algorithm_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(evolutionary_algorithm_pointer);
+}
+
+
 // FitnessAssignmentMethod get_fitness_assignment_method(void) method
 
 /// This method returns the fitness assignment method used for training.
@@ -549,6 +569,7 @@ void EvolutionaryAlgorithm::set(ObjectiveFunctional* new_objective_functional_po
 /// <li> Recombination size: 0.25.
 /// <li> Mutation rate: = 1/parameters_number or 0.
 /// <li> Mutation range: = 0.1
+/// <li> Early abandon: false.
 /// </ul>
 /// Stopping criteria:
 /// <ul> 
@@ -632,6 +653,10 @@ void EvolutionaryAlgorithm::set_default(void)
 
    mutation_range = 0.1;
 
+   threads_number = 0;
+
+   early_abandon = false;
+
    // Stopping criteria
 
    evaluation_goal = -1.0e99;
@@ -1371,6 +1396,35 @@ double EvolutionaryAlgorithm::calculate_standard_deviation_evaluation(void)
 }
 
 
+// double calculate_median_evaluation(void) method
+
+/// This method returns the median of the evaluation vector. 
+/// For an even population size it is the mean of the two middle evaluations.
+
+double EvolutionaryAlgorithm::calculate_median_evaluation(void)
+{
+   int population_size = get_population_size();
+
+   if(population_size == 0)
+   {
+      return(0.0);
+   }
+
+   Vector<double> sorted_evaluation(evaluation);
+
+   std::sort(sorted_evaluation.begin(), sorted_evaluation.end());
+
+   if(population_size%2 == 1)
+   {
+      return(sorted_evaluation[population_size/2]);
+   }
+   else
+   {
+      return((sorted_evaluation[population_size/2-1] + sorted_evaluation[population_size/2])/2.0);
+   }
+}
+
+
 // Training parameters
 
 
@@ -1420,6 +1474,28 @@ double EvolutionaryAlgorithm::get_mutation_range(void)
 }
 
 
+// int get_threads_number(void) method
+
+/// This method returns the number of threads for evaluating the population when compiled with OpenMP.
+/// Zero means the OpenMP default, and one means serial evaluation.
+
+int EvolutionaryAlgorithm::get_threads_number(void)
+{
+   return(threads_number);
+}
+
+
+// bool get_early_abandon(void) method
+
+/// This method returns true if the evaluation of the individuals worse than the median evaluation of the previous 
+/// generation may be given up, and false otherwise.
+
+bool EvolutionaryAlgorithm::get_early_abandon(void)
+{
+   return(early_abandon);
+}
+
+
 // double get_maximum_generations_number(void) method
 
 /// This method returns the maximum number of generations to train.
@@ -1565,6 +1641,50 @@ void EvolutionaryAlgorithm::set_mutation_range(double new_mutation_range)
 }
 
 
+// void set_threads_number(int) method
+
+/// This method sets a new number of threads for evaluating the population when compiled with OpenMP.
+/// Each thread evaluates individuals on its own clone of the multilayer perceptron and the objective functional, so
+/// that the objective functional must redefine the clone method.
+/// @param new_threads_number Number of threads. Zero means the OpenMP default, and one means serial evaluation.
+
+void EvolutionaryAlgorithm::set_threads_number(int new_threads_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_threads_number < 0)
+   {
+      std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                << "void set_threads_number(int) method." << std::endl
+                << "Number of threads must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   threads_number = new_threads_number;
+}
+
+
+// void set_early_abandon(bool) method
+
+/// This method sets whether the evaluation of the individuals worse than the median evaluation of the previous 
+/// generation may be given up. 
+/// The objective functional then returns a lower bound of their evaluation, which is greater than that median.
+/// The ranking of the better half of the population is not changed, but the mean and standard deviation of the 
+/// evaluation would be underestimated. 
+/// Their goals are therefore not checked and their histories are not reserved while early abandon is enabled. 
+/// @param new_early_abandon True to give up the evaluation of the individuals worse than the median, false otherwise.
+
+void EvolutionaryAlgorithm::set_early_abandon(bool new_early_abandon)
+{
+   early_abandon = new_early_abandon;
+}
+
+
 // void set_maximum_generations_number(int) method
 
 /// This method sets a new value for the maximum number of generations to train.
@@ -1955,6 +2075,18 @@ void EvolutionaryAlgorithm::perform_mutation(void)
 }
 
 
+// void perform_recombination_mutation(void) method
+
+/// This method performs recombination and mutation in a single pass over the new population, with the current 
+/// recombination and mutation methods. 
+/// Each offspring is mutated as soon as it is generated. 
+
+void EvolutionaryAlgorithm::perform_recombination_mutation(void)
+{
+   recombine_population(recombination_method, true);
+}
+
+
 // void evolve_population(void) method
 
 void EvolutionaryAlgorithm::evolve_population(void)
@@ -1967,13 +2099,9 @@ void EvolutionaryAlgorithm::evolve_population(void)
 
    perform_selection();
 
-   // Recombination
-
-   perform_recombination();
-
-   // Mutation
+   // Recombination and mutation
 
-   perform_mutation();
+   perform_recombination_mutation();
 }
 
 
@@ -1999,44 +2127,63 @@ void EvolutionaryAlgorithm::evaluate_population(void)
 
    #endif
 
-   // Multilayer perceptron
+   // Evaluate objective functional for all individuals
+
+   int population_size = get_population_size();
+
+   evaluation = objective_functional_pointer->calculate_potential_evaluation(population, threads_number);
+
+   for(int i = 0; i < population_size; i++)
+   {
+      if(!(evaluation[i] > -1.0e99 && evaluation[i] < 1.0e99))
+      {
+         std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                   << "void evaluate_population(void) method." << std::endl
+                   << "Evaluation of individual " << i << " is not a real number." << std::endl;
+
+         exit(1);
+      }                
+   }
+}
 
-   MultilayerPerceptron* multilayer_perceptron_pointer 
-   = objective_functional_pointer->get_multilayer_perceptron_pointer();
 
+// void evaluate_population(double) method
+
+/// This method evaluates the objective functional of all individuals in the population, but the evaluation of any 
+/// individual may be given up as soon as it is known to exceed a bound. 
+/// The evaluation of such individuals is then a lower bound greater than the bound. 
+/// Results are stored in the evaluation vector.
+/// @param evaluation_bound Evaluation value above which the exact evaluations are not needed. 
+
+void EvolutionaryAlgorithm::evaluate_population(double evaluation_bound)
+{
    // Control sentence (if debug)
 
    #ifdef _DEBUG 
 
-   if(multilayer_perceptron_pointer == NULL)   
+   if(objective_functional_pointer == NULL)   
    {
       std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
-                << "void evaluate_population(void)." << std::endl
-                << "Multilayer perceptron pointer cannot be NULL." << std::endl;
+                << "void evaluate_population(double)." << std::endl
+                << "Objective functional pointer cannot be NULL." << std::endl;
  
       exit(1);
    }
 
    #endif
 
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
-
-   Vector<double> individual(parameters_number);
-
    // Evaluate objective functional for all individuals
 
    int population_size = get_population_size();
 
+   evaluation = objective_functional_pointer->calculate_potential_evaluation(population, threads_number, evaluation_bound);
+
    for(int i = 0; i < population_size; i++)
    {
-      individual = get_individual(i);
-
-      evaluation[i] = objective_functional_pointer->calculate_potential_evaluation(individual);
-      
       if(!(evaluation[i] > -1.0e99 && evaluation[i] < 1.0e99))
       {
          std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
-                   << "void evaluate_population(void) method." << std::endl
+                   << "void evaluate_population(double) method." << std::endl
                    << "Evaluation of individual " << i << " is not a real number." << std::endl;
 
          exit(1);
@@ -2054,28 +2201,37 @@ void EvolutionaryAlgorithm::evaluate_population(void)
 
 void EvolutionaryAlgorithm::perform_linear_ranking_fitness_assignment(void)
 {
-   // Sorted evaluation vector
-
    int population_size = get_population_size();
 
-   Vector<double> sorted_evaluation(population_size);
+   // Evaluations sorted together with the individuals indices
+
+   Vector< std::pair<double, int> > sorted_evaluation(population_size);
 
-   sorted_evaluation = evaluation;
+   for(int i = 0; i < population_size; i++)
+   {
+      sorted_evaluation[i] = std::pair<double, int>(evaluation[i], i);
+   }
 
-   std::sort(sorted_evaluation.begin(), sorted_evaluation.end(), std::less<double>());
+   std::sort(sorted_evaluation.begin(), sorted_evaluation.end());
 
-   // Rank vector
+   // Rank vector. Individuals with equal evaluations get the lowest rank among them. 
 
    Vector<int> rank(population_size);
 
-   for(int i = 0; i < population_size; i++)
+   int last;
+
+   for(int first = 0; first < population_size; first = last+1)
    {
-      for(int j = 0; j < population_size; j++)
+      last = first;
+
+      while(last+1 < population_size && sorted_evaluation[last+1].first == sorted_evaluation[first].first)
       {
-         if(evaluation[j] == sorted_evaluation[i])
-         {
-            rank[j] = population_size - i;
-         }
+         last++;
+      }
+
+      for(int i = first; i <= last; i++)
+      {
+         rank[sorted_evaluation[i].second] = population_size - last;
       }
    }
 
@@ -2101,7 +2257,9 @@ void EvolutionaryAlgorithm::perform_linear_ranking_fitness_assignment(void)
 // void perform_roulette_wheel_selection(void) method
 
 /// This metod performs selection with roulette wheel selection. It selects half of the individuals from the 
-/// population. 
+/// population, without replacement. 
+/// The fitness values are stored in a binary tree of partial sums, so that each individual is found in logarithmic 
+/// time, and it is then removed from the wheel by setting its fitness in the tree to zero.
 /// Results are stored in the selection vector. 
 
 void EvolutionaryAlgorithm::perform_roulette_wheel_selection(void)
@@ -2114,21 +2272,34 @@ void EvolutionaryAlgorithm::perform_roulette_wheel_selection(void)
 
    int selected_individuals_number = population_size/2;
 
-   // Cumulative fitness vector
+   // Binary tree of partial fitness sums. Leaves are the individuals fitness, and every other node is the sum of its 
+   // two children, so that the root holds the total fitness.
 
-   Vector<double> cumulative_fitness(population_size);
+   int leaves_number = 1;
 
-   cumulative_fitness[0] = fitness[0]; 
+   while(leaves_number < population_size)
+   {
+      leaves_number *= 2;
+   }
 
-   for(int i = 1; i < population_size; i++)
+   Vector<double> fitness_tree(2*leaves_number, 0.0);
+
+   for(int i = 0; i < population_size; i++)
    {
-      cumulative_fitness[i] = cumulative_fitness[i-1] + fitness[i];
+      fitness_tree[leaves_number+i] = fitness[i];
+   }
+
+   for(int node = leaves_number-1; node >= 1; node--)
+   {
+      fitness_tree[node] = fitness_tree[2*node] + fitness_tree[2*node+1];
    }
 
    // Select individuals until the desired number of selections is obtained
 
    int selected_individuals_count = 0;
 
+   int node;
+
    if(elitism)
    {
       int best_individual_index = evaluation.calculate_minimal_index();
@@ -2136,39 +2307,72 @@ void EvolutionaryAlgorithm::perform_roulette_wheel_selection(void)
       selection[best_individual_index] = true; 
 
       selected_individuals_count++;
+
+      // Remove the best individual from the wheel
+
+      node = leaves_number + best_individual_index;
+
+      fitness_tree[node] = 0.0;
+
+      for(node /= 2; node >= 1; node /= 2)
+      {
+         fitness_tree[node] = fitness_tree[2*node] + fitness_tree[2*node+1];
+      }
    }
 
-   do
+   while(selected_individuals_count < selected_individuals_number)
    {
-      // Random number between 0 and total cumulative fitness
+      // If all the remaining individuals have zero fitness, they are given equal chances
+
+      if(!(fitness_tree[1] > 0.0))
+      {
+         for(int i = 0; i < population_size; i++)
+         {
+            fitness_tree[leaves_number+i] = selection[i] ? 0.0 : 1.0;
+         }
+
+         for(node = leaves_number-1; node >= 1; node--)
+         {
+            fitness_tree[node] = fitness_tree[2*node] + fitness_tree[2*node+1];
+         }
+      }
+
+      // Random number between 0 and total remaining fitness
 
       double random = (double)rand()/(RAND_MAX+1.0);
 
-      double pointer = cumulative_fitness[population_size-1]*random;
+      double pointer = fitness_tree[1]*random;
 
-      // Perform selection
+      // Search the individual in the tree. Branches with zero fitness are never taken, which also guards against 
+      // rounding errors.
 
-      if(pointer < cumulative_fitness[0])
+      node = 1;
+
+      while(node < leaves_number)
       {
-         if(selection[0] == false)
+         if(fitness_tree[2*node+1] == 0.0 || (pointer < fitness_tree[2*node] && fitness_tree[2*node] != 0.0))
          {
-            selection[0] = true;
-            selected_individuals_count++;
+            node = 2*node;
          }
-      }
-      
-      for(int i = 1; i < population_size; i++)
-      {
-         if(pointer < cumulative_fitness[i] && pointer >= cumulative_fitness[i-1])
+         else
          {
-            if(selection[i] == false)
-            {
-               selection[i] = true;
-               selected_individuals_count++;
-            }
+            pointer -= fitness_tree[2*node];
+            node = 2*node+1;
          }
       }
-   }while(selected_individuals_count != selected_individuals_number);
+
+      // Perform selection and remove the individual from the wheel
+
+      selection[node-leaves_number] = true;
+      selected_individuals_count++;
+
+      fitness_tree[node] = 0.0;
+
+      for(node /= 2; node >= 1; node /= 2)
+      {
+         fitness_tree[node] = fitness_tree[2*node] + fitness_tree[2*node+1];
+      }
+   }
 
    // Control sentence
 
@@ -2241,21 +2445,22 @@ void EvolutionaryAlgorithm::perform_stochastic_universal_sampling_selection(void
 //      selected_individuals_count++;
 //   }
 
-   if(pointer[0] <= cumulative_fitness[0])
-   {
-      selection[0] = true;
-      selected_individuals_count++;
-   }
+   // Both the pointers and the cumulative fitness are sorted, so that they are matched in a single pass. 
+   // Each pointer selects the first individual whose cumulative fitness is not less than the pointer.
+
+   int individual_index = 0;
 
    for(int i = 0; i < selected_individuals_number; i++)
    {
-      for(int j = 1; j < population_size; j++)
+      while(individual_index < population_size-1 && cumulative_fitness[individual_index] < pointer[i])
       {
-         if(pointer[i] <= cumulative_fitness[j] && pointer[i] > cumulative_fitness[j-1])
-         {
-            selection[j] = true;
-            selected_individuals_count++;
-         }
+         individual_index++;
+      }
+
+      if(pointer[i] <= cumulative_fitness[individual_index])
+      {
+         selection[individual_index] = true;
+         selected_individuals_count++;
       }
    }
 
@@ -2281,362 +2486,180 @@ void EvolutionaryAlgorithm::perform_stochastic_universal_sampling_selection(void
 
 void EvolutionaryAlgorithm::perform_intermediate_recombination(void)
 {
-   int population_size = get_population_size();
+   recombine_population(Intermediate, false);
+}
 
-   MultilayerPerceptron* multilayer_perceptron_pointer 
-   = objective_functional_pointer->get_multilayer_perceptron_pointer();
-     
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
-   Matrix<double> new_population(population_size, parameters_number);
+// void perform_line_recombination(void) method
+
+/// This method performs line recombination between pairs of selected individuals to generate a new population. 
+/// Each selected individual is to be recombined with two other selected individuals chosen at random. 
+/// Results are stored in the population matrix.
+
+void EvolutionaryAlgorithm::perform_line_recombination(void)
+{
+   recombine_population(Line, false);
+}
+
+
+// void perform_normal_mutation(void) method
+
+/// This method performs normal mutation to all individuals in order to generate a new population. 
+/// Results are stored in the population matrix.
+
+void EvolutionaryAlgorithm::perform_normal_mutation(void)
+{
+   int population_size = get_population_size();
+
+   int parameters_number = population.get_columns_number();
 
-   int count = 0;
    for(int i = 0; i < population_size; i++)
    {
-      if(selection[i] == true)
-      count ++;        
+      mutate_individual(population[i], parameters_number, Normal);
    }
+}  
 
-   Vector<double> parent_1(parameters_number);
-   Vector<double> parent_2(parameters_number);
 
-   Vector<double> offspring(parameters_number);
+// void perform_uniform_mutation(void) method
 
-   Matrix<int> recombination(population_size, 2);
+/// This method performs uniform mutation to all individuals in order to generate a new population. 
+/// Results are stored in the population matrix.
 
-   // Start recombination   
+void EvolutionaryAlgorithm::perform_uniform_mutation(void)
+{
+   int population_size = get_population_size();
 
-   int new_population_size_count = 0;
+   int parameters_number = population.get_columns_number();
 
    for(int i = 0; i < population_size; i++)
    {
-      if(selection[i] == true)
-      {
-         // Set parent 1
+      mutate_individual(population[i], parameters_number, Uniform);
+   }
+}
 
-         parent_1 = get_individual(i);
 
-         // Generate 2 offspring with parent 1
+// void train(void) method
 
-         for(int j = 0; j < 2; j++)
-         {
-            // Choose parent 2 at random among selected individuals   
+/// This method trains a multilayer perceptron with an associated
+/// objective function according to the evolutionary algorithm.
+/// Training occurs according to the training operators and their related
+/// parameters.
 
-            bool parent_2_candidate = false;
+void EvolutionaryAlgorithm::train(void)
+{
+   // Control sentence (if debug)
 
-            do{
-               // Integer random number beteen 0 and population size
+   #ifdef _DEBUG 
 
-               double random = (double)rand()/(RAND_MAX+1.0);
+   if(objective_functional_pointer == NULL)
+   {
+      std::cout << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
 
-               int parent_2_candidate_index = (int)(population_size*random);
+      exit(1);
+   }
 
-               // Check if candidate for parent 2 is ok
+   #endif
 
-               if(selection[parent_2_candidate_index] == true && parent_2_candidate_index != i)
-               {
-                  parent_2_candidate = true;
+   if(display)
+   {
+      std::cout << "Training with the evolutionary algorithm..." << std::endl;
+   }
 
-                  recombination[new_population_size_count][0] = i;
+   // Population stuff
 
-                  recombination[new_population_size_count][1] = parent_2_candidate_index;
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
 
-                  parent_2 = get_individual(parent_2_candidate_index);
+   Vector<double> population_norm;
 
-                  // Perform inediate recombination between parent 1 and parent 2
+   double mean_norm;
+   double standard_deviation_norm;
 
-                  for(int j = 0; j < parameters_number; j++)
-                  {
-                     // Choose the scaling factor to be a random number between
-                     // -recombination_size and 1+recombination_size for each
-                     // variable anew.
+   Vector<double> best_individual;
+   double best_norm = 0.0;
 
-                     double random = (double)rand()/(RAND_MAX+1.0);
+   // Objective functional stuff
 
-                     double scaling_factor = -1.0*recombination_size + (1.0 + recombination_size)*random;
+   double best_evaluation = 1.0e99;
 
-                     offspring[j] = scaling_factor*parent_1[j] + (1.0 - scaling_factor)*parent_2[j];
-                  }
+   // Training algorithm stuff 
 
-                  // Add offspring to new_population matrix
+   double beginning_time = calculate_monotonic_time();
+   double elapsed_time;
 
-                  new_population.set_row(new_population_size_count, offspring);   
-                  
-                  new_population_size_count++;
-               }
-            }while(parent_2_candidate != true);
-         }
-      }
-   }
+   initialize_profiling();
 
-   // Count number of new individuals control sentence
+   bool stop_training = false;
 
-   if(new_population_size_count != population_size)
-   {
-      std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
-                << "void perform_intermediate_recombination(void) method." << std::endl
-                << "Count new population size is not equal to population size." << std::endl;
+   initialize_training_history(maximum_generations_number+1);
 
-      exit(1);
-   }
-
-   // Set new population
-
-   population = new_population;
-}
-
-
-// void perform_line_recombination(void) method
-
-/// This method performs line recombination between pairs of selected individuals to generate a new population. 
-/// Each selected individual is to be recombined with two other selected individuals chosen at random. 
-/// Results are stored in the population matrix.
-
-void EvolutionaryAlgorithm::perform_line_recombination(void)
-{
-   int population_size = get_population_size();
-
-   MultilayerPerceptron* multilayer_perceptron_pointer 
-   = objective_functional_pointer->get_multilayer_perceptron_pointer();
-     
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
-
-   Matrix<double> new_population(population_size, parameters_number);
-
-   Vector<double> parent_1(parameters_number);
-   Vector<double> parent_2(parameters_number);
-
-   Vector<double> offspring(parameters_number);
-   Vector<double> parent_1_term(parameters_number);
-   Vector<double> parent_2_term(parameters_number);
-
-   Matrix<int> recombination(population_size, 2);
-
-   // Start recombination   
-
-   int new_population_size_count = 0;
-
-   for(int i = 0; i < population_size; i++)
-   {
-      if(selection[i] == true)
-      {
-         // Set parent 1
-
-         parent_1 = get_individual(i);
-
-         // Generate 2 offspring with parent 1
-
-         for(int j = 0; j < 2; j++)
-         {
-            // Choose parent 2 at random among selected individuals   
-
-            bool parent_2_candidate = false;
-
-            do
-            {
-               // Integer random number beteen 0 and population size
-
-               double random = (double)rand()/(RAND_MAX + 1.0);
-
-               int parent_2_candidate_index = (int)(population_size*random);
-
-               // Check if candidate for parent 2 is ok
-
-               if(selection[parent_2_candidate_index] == true && parent_2_candidate_index != i)
-               {
-                  parent_2_candidate = true;
-
-                  recombination[new_population_size_count][0] = i;
-                  recombination[new_population_size_count][1] = parent_2_candidate_index;
-
-                  parent_2 = get_individual(parent_2_candidate_index);
-
-                  // Perform inediate recombination between parent 1
-                  // and parent 2
-
-                  // Choose the scaling factor to be a random number between
-                  // -recombination_size and 1+recombination_size for all
-                  // variables.
-
-                  double random = (double)rand()/(RAND_MAX+1.0);
-
-                  double scaling_factor = -1.0*recombination_size 
-                  + (1.0 + recombination_size)*random;
-
-                  parent_1_term = parent_1*scaling_factor;
-                  parent_2_term = parent_2*(1.0 - scaling_factor); 
-
-                  offspring = parent_1_term + parent_2_term;
-
-                  // Add offspring to new_population matrix
-
-                  new_population.set_row(new_population_size_count, offspring);   
-
-                  new_population_size_count++;
-               }
-            }while(parent_2_candidate == false);
-         }
-      }
-   }
-
-   // Count new population size control sentence
+   int first_generation = 0;
 
-   if(new_population_size_count != population_size)
-   {
-      std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
-                << "void perform_line_recombination(void) method." << std::endl
-                << "Count new population size is not equal to population size." << std::endl;
-
-      exit(1);
-   }
-
-   // Set new population
-
-   population = new_population;
-}
-
-
-// void perform_normal_mutation(void) method
-
-/// This method performs normal mutation to all individuals in order to generate a new population. 
-/// Results are stored in the population matrix.
-
-void EvolutionaryAlgorithm::perform_normal_mutation(void)
-{
-   int population_size = get_population_size();
-
-   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
-     
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+   // Resume training from the checkpoint
 
-   Vector<double> individual(parameters_number);
-
-   for(int i = 0; i < population_size; i++)
+   if(resume_training)
    {
-      individual = get_individual(i);
-
-      for(int j = 0; j < parameters_number; j++)
-      {
-         // Random number between 0 and 1
-
-         double pointer = calculate_random_uniform(0.0, 1.0);
-
-         if(pointer < mutation_rate)
-         {
-            individual[j] += calculate_random_normal(0.0, mutation_range);
-         }
-      }
-
-      set_individual(i, individual);
-   }
-}  
+      std::istringstream checkpoint(load_checkpoint(), std::ios::in | std::ios::binary);
 
+      read_checkpoint_header(checkpoint, "EvolutionaryAlgorithm");
 
-// void perform_uniform_mutation(void) method
+      int checkpoint_generation = 0;
+      double checkpoint_elapsed_time = 0.0;
+      int seed = 0;
 
-/// This method performs uniform mutation to all individuals in order to generate a new population. 
-/// Results are stored in the population matrix.
+      read_binary(checkpoint, checkpoint_generation);
+      read_binary(checkpoint, checkpoint_elapsed_time);
+      read_binary(checkpoint, seed);
 
-void EvolutionaryAlgorithm::perform_uniform_mutation(void)
-{
-   int population_size = get_population_size();
+      read_binary(checkpoint, population);
+      read_binary(checkpoint, evaluation);
+      read_binary(checkpoint, fitness);
 
-   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
-     
-   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
-   
-   Vector<double> individual(parameters_number, 0.0);
+      read_binary(checkpoint, best_individual);
+      read_binary(checkpoint, best_norm);
+      read_binary(checkpoint, best_evaluation);
 
-   for(int i = 0; i < population_size; i++)
-   {
-      individual = get_individual(i);
+      read_training_history_binary(checkpoint);
 
-      for(int j = 0; j < parameters_number; j++)
+      if(!checkpoint 
+      || population.get_columns_number() != multilayer_perceptron_pointer->get_parameters_number()
+      || evaluation.get_size() != population.get_rows_number()
+      || fitness.get_size() != population.get_rows_number())
       {
-         // random number between 0 and 1
-
-         double pointer = (double)rand()/(RAND_MAX+1.0);
-
-         if(pointer < mutation_rate)
-         {
-            // random number between 0 and 1
-
-            double random = (double)rand()/(RAND_MAX+1.0);
-
-            double uniformlyDistributedRandomNumber
-            = (-1.0 + 2.0*random)*mutation_range;
+         std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                   << "void train(void) method." << std::endl
+                   << "Checkpoint file does not match this training process." << std::endl;
 
-            individual[j] += uniformlyDistributedRandomNumber;
-         }
+         exit(1);
       }
 
-      set_individual(i, individual);
-   }
-}
-
-
-// void train(void) method
+      selection.set(population.get_rows_number(), false);
 
-/// This method trains a multilayer perceptron with an associated
-/// objective function according to the evolutionary algorithm.
-/// Training occurs according to the training operators and their related
-/// parameters.
+      multilayer_perceptron_pointer->set_parameters(best_individual);
 
-void EvolutionaryAlgorithm::train(void)
-{
-   // Control sentence (if debug)
+      resize_training_history(calculate_training_history_size(maximum_generations_number+1));
 
-   #ifdef _DEBUG 
+      srand(seed);
 
-   if(objective_functional_pointer == NULL)
-   {
-      std::cout << "Flood Error: EvolutionaryAlgorithm class." << std::endl
-                << "void train(void) method." << std::endl
-                << "Pointer to objective functional object cannot be NULL." << std::endl;
+      beginning_time -= checkpoint_elapsed_time;
 
-      exit(1);
+      first_generation = checkpoint_generation + 1;
    }
 
-   #endif
+   // Main loop
 
-   if(display)
+   for(int generation = first_generation; generation <= maximum_generations_number; generation++)
    {
-      std::cout << "Training with the evolutionary algorithm..." << std::endl;
-   }
-
-   // Population stuff
-
-   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
-
-   Vector<double> population_norm;
-
-   double mean_norm;
-   double standard_deviation_norm;
-
-   Vector<double> best_individual;
-   double best_norm = 0.0;
+      // Training history
 
-   // Objective functional stuff
-
-   double best_evaluation = 1.0e99;
-
-   // Training algorithm stuff 
-
-   time_t beginning_time, current_time;
-   time(&beginning_time);
-   double elapsed_time;
-
-   bool stop_training = false;
-
-   resize_training_history(maximum_generations_number+1);    // Main loop
+      int history_index = get_training_history_index(generation);
 
-   for(int generation = 0; generation <= maximum_generations_number; generation++)
-   {
       // Population stuff
 
       if(reserve_population_history)
       {
-         population_history[generation] = population; 
+         population_history[history_index] = population; 
       }
 
       population_norm = calculate_population_norm();
@@ -2647,7 +2670,7 @@ void EvolutionaryAlgorithm::train(void)
 
       if(reserve_mean_norm_history)
       {
-         mean_norm_history[generation] = mean_norm;
+         mean_norm_history[history_index] = mean_norm;
       }
 
       // Standard deviation of norm
@@ -2656,10 +2679,23 @@ void EvolutionaryAlgorithm::train(void)
 
       if(reserve_standard_deviation_norm_history)
       {
-         standard_deviation_norm_history[generation] = standard_deviation_norm;                                
+         standard_deviation_norm_history[history_index] = standard_deviation_norm;                                
       }
     
-      evaluate_population();
+      // Individuals worse than the median of the previous generation need not be evaluated exactly
+
+      begin_profiling_phase(EvaluationPhase);
+
+      if(early_abandon && generation != 0)
+      {
+         evaluate_population(calculate_median_evaluation());
+      }
+      else
+      {
+         evaluate_population();
+      }
+
+      end_profiling_phase(EvaluationPhase);
 
       int population_size = get_population_size();
  
@@ -2679,100 +2715,105 @@ void EvolutionaryAlgorithm::train(void)
 
       if(reserve_best_individual_history)
       {
-         best_individual_history[generation] = best_individual;
+         best_individual_history[history_index] = best_individual;
       }
 
       // Best individual norm
 
       if(reserve_best_norm_history)
       {
-         best_norm_history[generation] = best_norm;
+         best_norm_history[history_index] = best_norm;
       }
 
-      // Mean evaluation
+      // Mean evaluation. It is underestimated if the evaluation of some individuals has been abandoned.
 
       double mean_evaluation = evaluation.calculate_mean();
 
-      if(reserve_mean_evaluation_history)
+      if(reserve_mean_evaluation_history && !early_abandon)
       {
-         mean_evaluation_history[generation] = mean_evaluation;
+         mean_evaluation_history[history_index] = mean_evaluation;
       }
 
       // Standard deviation of evaluation
 
       double standard_deviation_evaluation = evaluation.calculate_standard_deviation();
 
-      if(reserve_standard_deviation_evaluation_history)
+      if(reserve_standard_deviation_evaluation_history && !early_abandon)
       {
-         standard_deviation_evaluation_history[generation] = standard_deviation_evaluation;
+         standard_deviation_evaluation_history[history_index] = standard_deviation_evaluation;
       }
 
       // Best individual evaluation
 
       if(reserve_best_evaluation_history)
       {
-         best_evaluation_history[generation] = best_evaluation;
+         best_evaluation_history[history_index] = best_evaluation;
       }
 
       // Elapsed time
 
-      time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = calculate_monotonic_time() - beginning_time;
 
       if(reserve_elapsed_time_history)
       {
-         elapsed_time_history[generation] = elapsed_time;
+         elapsed_time_history[history_index] = elapsed_time;
       }
 
       // Training history multilayer perceptron 
 
+      begin_profiling_phase(TrainingHistoryPhase);
+
       if(reserve_population_history)
       {
-         population_history[generation] = population;                                
+         population_history[history_index] = population;                                
       }
 
       if(reserve_best_individual_history)
       {
-         best_individual_history[generation] = best_individual;                                
+         best_individual_history[history_index] = best_individual;                                
       }
 
       if(reserve_mean_norm_history)
       {
-         mean_norm_history[generation] = mean_norm;                                
+         mean_norm_history[history_index] = mean_norm;                                
       }
 
       if(reserve_standard_deviation_norm_history)
       {
-         standard_deviation_norm_history[generation] = standard_deviation_norm;                                
+         standard_deviation_norm_history[history_index] = standard_deviation_norm;                                
       }
 
       if(reserve_best_norm_history)
       {
-         best_norm_history[generation] = best_norm;                                
+         best_norm_history[history_index] = best_norm;                                
       }
 
       // Training history training algorithm
 
-      if(reserve_mean_evaluation_history)
+      if(reserve_mean_evaluation_history && !early_abandon)
       {
-         mean_evaluation_history[generation] = mean_evaluation;                                
+         mean_evaluation_history[history_index] = mean_evaluation;                                
       }
 
-      if(reserve_standard_deviation_evaluation_history)
+      if(reserve_standard_deviation_evaluation_history && !early_abandon)
       {
-         standard_deviation_evaluation_history[generation] = standard_deviation_evaluation;                                
+         standard_deviation_evaluation_history[history_index] = standard_deviation_evaluation;                                
       }
 
       if(reserve_best_evaluation_history)
       {
-         best_evaluation_history[generation] = best_evaluation;                                
+         best_evaluation_history[history_index] = best_evaluation;                                
       }
 
       if(reserve_elapsed_time_history)
       {
-         elapsed_time_history[generation] = elapsed_time;                                
+         elapsed_time_history[history_index] = elapsed_time;                                
       }
 
+      append_training_history(generation);
+
+      end_profiling_phase(TrainingHistoryPhase);
+
       // Stopping criteria
 
       if(best_evaluation <= evaluation_goal)
@@ -2787,7 +2828,7 @@ void EvolutionaryAlgorithm::train(void)
 		 stop_training = true;
       }
 
-      if(mean_evaluation <= mean_evaluation_goal)
+      if(!early_abandon && mean_evaluation <= mean_evaluation_goal)
       {
          if(display)
          {
@@ -2797,7 +2838,7 @@ void EvolutionaryAlgorithm::train(void)
 		 stop_training = true;
       }
 
-      if(standard_deviation_evaluation <= standard_deviation_evaluation_goal)
+      if(!early_abandon && standard_deviation_evaluation <= standard_deviation_evaluation_goal)
       {
          if(display)
          {
@@ -2824,7 +2865,7 @@ void EvolutionaryAlgorithm::train(void)
             std::cout << "Generation " << generation << ": Maximum number of generations reached." << std::endl;
          }
 
-         break;
+         stop_training = true;
       }
 
       if(stop_training)
@@ -2836,17 +2877,21 @@ void EvolutionaryAlgorithm::train(void)
             std::cout << "Standard deviation of norm: " << standard_deviation_norm << std::endl;
             std::cout << "Best norm: " << best_norm << std::endl;
 
-            std::cout << "Mean evaluation: " << mean_evaluation << std::endl;
-            std::cout << "Standard deviation of evaluation: " << standard_deviation_evaluation << std::endl;
+            if(!early_abandon)
+            {
+               std::cout << "Mean evaluation: " << mean_evaluation << std::endl;
+               std::cout << "Standard deviation of evaluation: " << standard_deviation_evaluation << std::endl;
+            }
+
             std::cout << "Best evaluation: " << best_evaluation << std::endl;                  
 
             std::cout << "Elapsed time: " << elapsed_time << ";" << std::endl;
 
             objective_functional_pointer->print_information();
-
-            resize_training_history(generation+1);  
 		 }
 
+         finish_training_history(generation+1);
+
          break;
 	  }
       else if(display && generation % display_period == 0)
@@ -2857,8 +2902,12 @@ void EvolutionaryAlgorithm::train(void)
          std::cout << "Standard deviation of norm: " << standard_deviation_norm << std::endl;
          std::cout << "Best norm: " << best_norm << std::endl;
 
-         std::cout << "Mean evaluation: " << mean_evaluation << std::endl;
-         std::cout << "Standard deviation of evaluation: " << standard_deviation_evaluation << std::endl;
+         if(!early_abandon)
+         {
+            std::cout << "Mean evaluation: " << mean_evaluation << std::endl;
+            std::cout << "Standard deviation of evaluation: " << standard_deviation_evaluation << std::endl;
+         }
+
          std::cout << "Best evaluation: " << best_evaluation << std::endl;
 
          std::cout << "Elapsed time: " << elapsed_time << ";" << std::endl;
@@ -2876,11 +2925,72 @@ void EvolutionaryAlgorithm::train(void)
 
       selection.initialize(false);
 
+      begin_profiling_phase(EvolutionPhase);
+
 	  evolve_population();
+
+      end_profiling_phase(EvolutionPhase);
+
+      // When checkpoints are enabled or training has been resumed from one, the random number generator is seeded 
+      // again at every generation with a number drawn from it. 
+      // A checkpoint saves that seed, so that a resumed training process draws the same random numbers from here on, 
+      // and the random numbers drawn do not depend on the checkpoint period. 
+      // Otherwise the random number generator is left alone. 
+
+      int seed = 0;
+
+      if(checkpoint_period > 0 || resume_training)
+      {
+         seed = rand();
+
+         srand(seed);
+      }
+
+      // Checkpoint
+
+      if(checkpoint_period > 0 && (generation+1) % checkpoint_period == 0)
+      {
+         std::ostringstream checkpoint(std::ios::out | std::ios::binary);
+
+         write_checkpoint_header(checkpoint, "EvolutionaryAlgorithm");
+
+         write_binary(checkpoint, generation);
+         write_binary(checkpoint, elapsed_time);
+         write_binary(checkpoint, seed);
+
+         write_binary(checkpoint, population);
+         write_binary(checkpoint, evaluation);
+         write_binary(checkpoint, fitness);
+
+         write_binary(checkpoint, best_individual);
+         write_binary(checkpoint, best_norm);
+         write_binary(checkpoint, best_evaluation);
+
+         write_training_history_binary(checkpoint);
+
+         save_checkpoint(checkpoint.str());
+      }
    }
 }
 
 
+// void resume(void) method
+
+/// This method continues the training process from the state saved in the checkpoint file. 
+/// The population with its evaluation and fitness, the best individual, the training history and the seed of the 
+/// random number generator are restored, so that training goes on exactly as if it had not been interrupted after 
+/// the generation of the checkpoint, as long as the interrupted training process saved checkpoints from its start. 
+
+void EvolutionaryAlgorithm::resume(void)
+{
+   resume_training = true;
+
+   train();
+
+   resume_training = false;
+}
+
+
 // std::string to_XML(void) method
 
 /// This method prints to the screen the members of the evolutionary algorithm object.
@@ -3007,6 +3117,14 @@ std::string EvolutionaryAlgorithm::to_XML(bool show_declaration)
           << mutation_range << std::endl
           << "</MutationRange>" << std::endl;
 
+   buffer << "<ThreadsNumber>" << std::endl
+          << threads_number << std::endl
+          << "</ThreadsNumber>" << std::endl;
+
+   buffer << "<EarlyAbandon>" << std::endl
+          << early_abandon << std::endl
+          << "</EarlyAbandon>" << std::endl;
+
    // Stopping criteria
 
    buffer << "<EvaluationGoal>" << std::endl
@@ -3029,6 +3147,40 @@ std::string EvolutionaryAlgorithm::to_XML(bool show_declaration)
           << maximum_time << std::endl
           << "</MaximumTime>" << std::endl;
 
+   // Checkpoints
+
+   buffer << "<CheckpointPeriod>" << std::endl
+          << checkpoint_period << std::endl
+          << "</CheckpointPeriod>" << std::endl;
+
+   buffer << "<CheckpointFilename>" << std::endl
+          << checkpoint_filename << std::endl
+          << "</CheckpointFilename>" << std::endl;
+
+   // Training history sink
+
+   buffer << "<TrainingHistoryPeriod>" << std::endl
+          << training_history_period << std::endl
+          << "</TrainingHistoryPeriod>" << std::endl;
+
+   buffer << "<TrainingHistoryDepth>" << std::endl
+          << training_history_depth << std::endl
+          << "</TrainingHistoryDepth>" << std::endl;
+
+   buffer << "<TrainingHistoryFilename>" << std::endl
+          << training_history_filename << std::endl
+          << "</TrainingHistoryFilename>" << std::endl;
+
+   // Profiling
+
+   buffer << "<Profiling>" << std::endl
+          << profiling << std::endl
+          << "</Profiling>" << std::endl;
+
+   buffer << "<ReserveProfilingTrace>" << std::endl
+          << reserve_profiling_trace << std::endl
+          << "</ReserveProfilingTrace>" << std::endl;
+
    // User stuff
    
    buffer << "<ReservePopulationHistory>" << std::endl
@@ -3392,6 +3544,42 @@ void EvolutionaryAlgorithm::load(const char* filename)
          }  
       }
 
+      else if(word == "<ThreadsNumber>")
+      {
+	     int new_threads_number;
+		 file >> new_threads_number;
+         set_threads_number(new_threads_number);   
+
+         file >> word; 
+
+         if(word != "</ThreadsNumber>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown threads number end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+      }
+
+      else if(word == "<EarlyAbandon>")
+      {
+	     bool new_early_abandon;
+		 file >> new_early_abandon;
+         set_early_abandon(new_early_abandon);   
+
+         file >> word; 
+
+         if(word != "</EarlyAbandon>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown early abandon end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+      }
+
       else if(word == "<EvaluationGoal>")
       {
 	     double new_evaluation_goal;
@@ -3482,6 +3670,147 @@ void EvolutionaryAlgorithm::load(const char* filename)
          }  
       }
 
+	  else if(word == "<CheckpointPeriod>")
+	  {
+   	     int new_checkpoint_period; 
+
+         file >> new_checkpoint_period;          
+
+         file >> word;
+
+		 if(word != "</CheckpointPeriod>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_period(new_checkpoint_period);
+	  }
+	  else if(word == "<CheckpointFilename>")
+	  {
+   	     std::string new_checkpoint_filename; 
+
+         file >> new_checkpoint_filename;          
+
+         file >> word;
+
+		 if(word != "</CheckpointFilename>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_filename(new_checkpoint_filename);
+	  }
+	  else if(word == "<TrainingHistoryPeriod>")
+	  {
+   	     int new_training_history_period; 
+
+         file >> new_training_history_period;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryPeriod>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_period(new_training_history_period);
+	  }
+	  else if(word == "<TrainingHistoryDepth>")
+	  {
+   	     int new_training_history_depth; 
+
+         file >> new_training_history_depth;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryDepth>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history depth end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_depth(new_training_history_depth);
+	  }
+	  else if(word == "<TrainingHistoryFilename>")
+	  {
+         // The training history filename is empty by default
+
+   	     std::string new_training_history_filename; 
+
+         file >> word;
+
+         if(word != "</TrainingHistoryFilename>")
+         {
+            new_training_history_filename = word;
+
+            file >> word;
+         }
+
+		 if(word != "</TrainingHistoryFilename>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_filename(new_training_history_filename);
+	  }
+	  else if(word == "<Profiling>")
+	  {
+   	     bool new_profiling; 
+
+         file >> new_profiling;          
+
+         file >> word;
+
+		 if(word != "</Profiling>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown profiling end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_profiling(new_profiling);
+	  }
+	  else if(word == "<ReserveProfilingTrace>")
+	  {
+   	     bool new_reserve_profiling_trace; 
+
+         file >> new_reserve_profiling_trace;          
+
+         file >> word;
+
+		 if(word != "</ReserveProfilingTrace>") 
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown reserve profiling trace end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_reserve_profiling_trace(new_reserve_profiling_trace);
+	  }
+
       else if(word == "<ReservePopulationHistory>")
       {     
 		 file >> reserve_population_history;
@@ -3744,18 +4073,32 @@ void EvolutionaryAlgorithm::resize_training_history(int new_size)
       best_norm_history.resize(new_size);
    }
 
-   // Mean evaluation history history vector
+   // Mean evaluation history history vector. It is empty if the evaluation of some individuals may be abandoned.
 
    if(reserve_mean_evaluation_history)
    {
-      mean_evaluation_history.resize(new_size);
+      if(early_abandon)
+      {
+         mean_evaluation_history.set();
+      }
+      else
+      {
+         mean_evaluation_history.resize(new_size);
+      }
    }
  
    // Standard deviation of evaluation history vector
 
    if(reserve_standard_deviation_evaluation_history)
    {
-      standard_deviation_evaluation_history.resize(new_size);
+      if(early_abandon)
+      {
+         standard_deviation_evaluation_history.set();
+      }
+      else
+      {
+         standard_deviation_evaluation_history.resize(new_size);
+      }
    }
 
    // Best evaluation history vector
@@ -3774,6 +4117,222 @@ void EvolutionaryAlgorithm::resize_training_history(int new_size)
 }
 
 
+// void rotate_training_history(int) method
+
+/// This method rotates all the training history vectors of the evolutionary algorithm, so that a given record 
+/// becomes the first one. 
+/// @param first Position of the oldest record.
+
+void EvolutionaryAlgorithm::rotate_training_history(int first)
+{
+   if(reserve_population_history && population_history.get_size() > first)
+   {
+      std::rotate(population_history.begin(), population_history.begin()+first, population_history.end());
+   }
+
+   if(reserve_best_individual_history && best_individual_history.get_size() > first)
+   {
+      std::rotate(best_individual_history.begin(), best_individual_history.begin()+first, best_individual_history.end());
+   }
+
+   if(reserve_mean_norm_history && mean_norm_history.get_size() > first)
+   {
+      std::rotate(mean_norm_history.begin(), mean_norm_history.begin()+first, mean_norm_history.end());
+   }
+
+   if(reserve_standard_deviation_norm_history && standard_deviation_norm_history.get_size() > first)
+   {
+      std::rotate(standard_deviation_norm_history.begin(), standard_deviation_norm_history.begin()+first, standard_deviation_norm_history.end());
+   }
+
+   if(reserve_best_norm_history && best_norm_history.get_size() > first)
+   {
+      std::rotate(best_norm_history.begin(), best_norm_history.begin()+first, best_norm_history.end());
+   }
+
+   if(reserve_mean_evaluation_history && mean_evaluation_history.get_size() > first)
+   {
+      std::rotate(mean_evaluation_history.begin(), mean_evaluation_history.begin()+first, mean_evaluation_history.end());
+   }
+
+   if(reserve_standard_deviation_evaluation_history && standard_deviation_evaluation_history.get_size() > first)
+   {
+      std::rotate(standard_deviation_evaluation_history.begin(), standard_deviation_evaluation_history.begin()+first, standard_deviation_evaluation_history.end());
+   }
+
+   if(reserve_best_evaluation_history && best_evaluation_history.get_size() > first)
+   {
+      std::rotate(best_evaluation_history.begin(), best_evaluation_history.begin()+first, best_evaluation_history.end());
+   }
+
+   if(reserve_elapsed_time_history && elapsed_time_history.get_size() > first)
+   {
+      std::rotate(elapsed_time_history.begin(), elapsed_time_history.begin()+first, elapsed_time_history.end());
+   }
+}
+
+
+// void write_training_history_header(std::ostream&) method
+
+/// This method writes the names of the columns of the training history vectors of the evolutionary algorithm 
+/// which are reserved. 
+/// The population takes one column per parameter of each individual. 
+/// @param file Training history file.
+
+void EvolutionaryAlgorithm::write_training_history_header(std::ostream& file)
+{
+   int population_size = population.get_rows_number();
+   int parameters_number = population.get_columns_number();
+
+   if(reserve_population_history && population_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "population", population_size*parameters_number);
+   }
+
+   if(reserve_best_individual_history && best_individual_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "best_individual", parameters_number);
+   }
+
+   if(reserve_mean_norm_history && mean_norm_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "mean_norm", 1);
+   }
+
+   if(reserve_standard_deviation_norm_history && standard_deviation_norm_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "standard_deviation_norm", 1);
+   }
+
+   if(reserve_best_norm_history && best_norm_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "best_norm", 1);
+   }
+
+   if(reserve_mean_evaluation_history && mean_evaluation_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "mean_evaluation", 1);
+   }
+
+   if(reserve_standard_deviation_evaluation_history && standard_deviation_evaluation_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "standard_deviation_evaluation", 1);
+   }
+
+   if(reserve_best_evaluation_history && best_evaluation_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "best_evaluation", 1);
+   }
+
+   if(reserve_elapsed_time_history && elapsed_time_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "elapsed_time", 1);
+   }
+}
+
+
+// void write_training_history_record(std::ostream&, int) method
+
+/// This method writes one record of the training history vectors of the evolutionary algorithm which are 
+/// reserved. 
+/// @param file Training history file.
+/// @param index Position of the record in the training history vectors.
+
+void EvolutionaryAlgorithm::write_training_history_record(std::ostream& file, int index)
+{
+   if(reserve_population_history && population_history.get_size() != 0)
+   {
+      write_training_history_values(file, population_history[index]);
+   }
+
+   if(reserve_best_individual_history && best_individual_history.get_size() != 0)
+   {
+      write_training_history_values(file, best_individual_history[index]);
+   }
+
+   if(reserve_mean_norm_history && mean_norm_history.get_size() != 0)
+   {
+      write_training_history_values(file, mean_norm_history[index]);
+   }
+
+   if(reserve_standard_deviation_norm_history && standard_deviation_norm_history.get_size() != 0)
+   {
+      write_training_history_values(file, standard_deviation_norm_history[index]);
+   }
+
+   if(reserve_best_norm_history && best_norm_history.get_size() != 0)
+   {
+      write_training_history_values(file, best_norm_history[index]);
+   }
+
+   if(reserve_mean_evaluation_history && mean_evaluation_history.get_size() != 0)
+   {
+      write_training_history_values(file, mean_evaluation_history[index]);
+   }
+
+   if(reserve_standard_deviation_evaluation_history && standard_deviation_evaluation_history.get_size() != 0)
+   {
+      write_training_history_values(file, standard_deviation_evaluation_history[index]);
+   }
+
+   if(reserve_best_evaluation_history && best_evaluation_history.get_size() != 0)
+   {
+      write_training_history_values(file, best_evaluation_history[index]);
+   }
+
+   if(reserve_elapsed_time_history && elapsed_time_history.get_size() != 0)
+   {
+      write_training_history_values(file, elapsed_time_history[index]);
+   }
+}
+
+
+// void write_training_history_binary(std::ostream&) method
+
+/// This method writes all the training history vectors of the evolutionary algorithm to a binary checkpoint. 
+/// @param checkpoint Binary output stream.
+
+void EvolutionaryAlgorithm::write_training_history_binary(std::ostream& checkpoint)
+{
+   write_binary(checkpoint, population_history);
+
+   write_binary(checkpoint, best_individual_history);
+
+   write_binary(checkpoint, mean_norm_history);
+   write_binary(checkpoint, standard_deviation_norm_history);
+   write_binary(checkpoint, best_norm_history);
+
+   write_binary(checkpoint, mean_evaluation_history);
+   write_binary(checkpoint, standard_deviation_evaluation_history);
+   write_binary(checkpoint, best_evaluation_history);
+
+   write_binary(checkpoint, elapsed_time_history);
+}
+
+
+// void read_training_history_binary(std::istream&) method
+
+/// This method reads all the training history vectors of the evolutionary algorithm from a binary checkpoint. 
+/// @param checkpoint Binary input stream.
+
+void EvolutionaryAlgorithm::read_training_history_binary(std::istream& checkpoint)
+{
+   read_binary(checkpoint, population_history);
+
+   read_binary(checkpoint, best_individual_history);
+
+   read_binary(checkpoint, mean_norm_history);
+   read_binary(checkpoint, standard_deviation_norm_history);
+   read_binary(checkpoint, best_norm_history);
+
+   read_binary(checkpoint, mean_evaluation_history);
+   read_binary(checkpoint, standard_deviation_evaluation_history);
+   read_binary(checkpoint, best_evaluation_history);
+
+   read_binary(checkpoint, elapsed_time_history);
+}
+
+
 // std::string get_training_history_XML(bool) method
 
 /// This method returns a string representation of the training history in XML-type format. 
@@ -3880,6 +4439,219 @@ std::string EvolutionaryAlgorithm::get_training_history_XML(bool show_declaratio
 }
 
 
+// void recombine_population(const RecombinationMethod&, bool) method
+
+/// This method generates a new population by recombining pairs of selected individuals. 
+/// Each selected individual is recombined with two other selected individuals chosen at random. 
+/// The offspring are written into a second population matrix, which is then swapped with the population, so that
+/// no individual is copied. 
+/// If mutation is requested, each offspring is also mutated as soon as it is generated, so that the new population
+/// is traversed only once.
+///
+/// @param new_recombination_method Recombination method to be used.
+/// @param mutation True if the offspring are to be mutated with the mutation method, false otherwise.
+
+void EvolutionaryAlgorithm::recombine_population(const RecombinationMethod& new_recombination_method, bool mutation)
+{
+   int population_size = get_population_size();
+
+   int parameters_number = population.get_columns_number();
+
+   // Selected individuals
+
+   Vector<int> selected_individuals(population_size);
+
+   int selected_individuals_number = 0;
+
+   for(int i = 0; i < population_size; i++)
+   {
+      if(selection[i] == true)
+      {
+         selected_individuals[selected_individuals_number] = i;
+         selected_individuals_number++;
+      }
+   }
+
+   // Count number of new individuals control sentence
+
+   if(2*selected_individuals_number != population_size)
+   {
+      std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                << "void recombine_population(const RecombinationMethod&, bool) method." << std::endl
+                << "Count new population size is not equal to population size." << std::endl;
+
+      exit(1);
+   }
+
+   if(offspring.get_rows_number() != population_size || offspring.get_columns_number() != parameters_number)
+   {
+      offspring.set(population_size, parameters_number);
+   }
+
+   // Start recombination   
+
+   int new_population_size_count = 0;
+
+   for(int k = 0; k < selected_individuals_number; k++)
+   {
+      const double* parent_1 = population[selected_individuals[k]];
+
+      // Generate 2 offspring with parent 1
+
+      for(int j = 0; j < 2; j++)
+      {
+         // Choose parent 2 at random among the other selected individuals
+
+         int parent_2_index = (int)((selected_individuals_number-1)*((double)rand()/(RAND_MAX+1.0)));
+
+         if(parent_2_index >= k)
+         {
+            parent_2_index++;
+         }
+
+         const double* parent_2 = population[selected_individuals[parent_2_index]];
+
+         double* individual = offspring[new_population_size_count];
+
+         switch(new_recombination_method)
+         {
+            case Intermediate:
+            {
+               // Choose the scaling factor to be a random number between -recombination_size and 
+               // 1+recombination_size for each variable anew.
+
+               for(int l = 0; l < parameters_number; l++)
+               {
+                  double random = (double)rand()/(RAND_MAX+1.0);
+
+                  double scaling_factor = -1.0*recombination_size + (1.0 + recombination_size)*random;
+
+                  individual[l] = scaling_factor*parent_1[l] + (1.0 - scaling_factor)*parent_2[l];
+               }
+            }
+            break;
+
+            case Line:
+            {
+               // Choose the scaling factor to be a random number between -recombination_size and 
+               // 1+recombination_size for all variables.
+
+               double random = (double)rand()/(RAND_MAX+1.0);
+
+               double scaling_factor = -1.0*recombination_size + (1.0 + recombination_size)*random;
+
+               for(int l = 0; l < parameters_number; l++)
+               {
+                  individual[l] = scaling_factor*parent_1[l] + (1.0 - scaling_factor)*parent_2[l];
+               }
+            }
+            break;
+
+            default:
+            {
+               std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                         << "void recombine_population(const RecombinationMethod&, bool) method." << std::endl
+                         << "Unknown recombination method." << std::endl;
+
+               exit(1);
+            }
+            break;
+         }
+
+         if(mutation)
+         {
+            mutate_individual(individual, parameters_number, mutation_method);
+         }
+
+         new_population_size_count++;
+      }
+   }
+
+   // Set new population
+
+   population.swap(offspring);
+}
+
+
+// void mutate_individual(double*, int, const MutationMethod&) method
+
+/// This method mutates the parameters of an individual, each of them with a probability equal to the mutation 
+/// rate. 
+/// Instead of drawing a random number for every parameter, the number of parameters skipped until the next 
+/// mutation is drawn from the geometric distribution, so that only the mutated parameters consume random numbers.
+///
+/// @param individual Pointer to the parameters of the individual.
+/// @param parameters_number Number of parameters of the individual.
+/// @param new_mutation_method Mutation method to be used.
+
+void EvolutionaryAlgorithm::mutate_individual(double* individual, int parameters_number, const MutationMethod& new_mutation_method)
+{
+   if(mutation_rate <= 0.0)
+   {
+      return;
+   }
+
+   const double logarithm = mutation_rate < 1.0 ? log(1.0 - mutation_rate) : 0.0;
+
+   int j = -1;
+
+   while(true)
+   {
+      // Number of parameters which are not mutated before the next mutation
+
+      if(mutation_rate < 1.0)
+      {
+         double random = ((double)rand() + 1.0)/(RAND_MAX+1.0);
+
+         double skip = log(random)/logarithm;
+
+         if(skip >= parameters_number - j - 1)
+         {
+            return;
+         }
+
+         j += 1 + (int)skip;
+      }
+      else
+      {
+         j++;
+
+         if(j >= parameters_number)
+         {
+            return;
+         }
+      }
+
+      switch(new_mutation_method)
+      {
+         case Normal:
+         {
+            individual[j] += calculate_random_normal(0.0, mutation_range);
+         }
+         break;
+
+         case Uniform:
+         {
+            double random = (double)rand()/(RAND_MAX+1.0);
+
+            individual[j] += (-1.0 + 2.0*random)*mutation_range;
+         }
+         break;
+
+         default:
+         {
+            std::cerr << "Flood Error: EvolutionaryAlgorithm class." << std::endl
+                      << "void mutate_individual(double*, int, const MutationMethod&) method." << std::endl
+                      << "Unknown mutation method." << std::endl;
+
+            exit(1);
+         }
+         break;
+      }
+   }
+}
+
+
 // double calculate_random_uniform(double, double) method
 
 double EvolutionaryAlgorithm::calculate_random_uniform(double minimum, double maximum)
@@ -66,6 +66,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
    // Get methods
 
    // Population methods
@@ -99,7 +103,13 @@ public:
 
    double get_recombination_size(void);
    double get_mutation_rate(void);
-   double get_mutation_range(void);    double get_maximum_generations_number(void);
+   double get_mutation_range(void);
+
+   int get_threads_number(void);
+
+   bool get_early_abandon(void);
+
+   double get_maximum_generations_number(void);
    double get_mean_evaluation_goal(void);
    double get_standard_deviation_evaluation_goal(void);
 
@@ -159,6 +169,10 @@ public:
    void set_mutation_rate(double);
    void set_mutation_range(double);
 
+   void set_threads_number(int);
+
+   void set_early_abandon(bool);
+
    void set_maximum_generations_number(int);
    void set_mean_evaluation_goal(double);
    void set_standard_deviation_evaluation_goal(double);
@@ -198,6 +212,7 @@ public:
 
    double calculate_mean_evaluation(void);
    double calculate_standard_deviation_evaluation(void);
+   double calculate_median_evaluation(void);
 
    // Initialization methods
 
@@ -224,9 +239,12 @@ public:
    void perform_recombination(void);
    void perform_mutation(void);
 
+   void perform_recombination_mutation(void);
+
    void evolve_population(void);
 
    void evaluate_population(void);
+   void evaluate_population(double);
 
    // Fitness assignment methods
 
@@ -250,11 +268,18 @@ public:
    // Train methods
 
    void train(void);
+
+   void resume(void);
    
    // Training history methods
 
    void resize_training_history(int);
 
+   void rotate_training_history(int);
+
+   void write_training_history_header(std::ostream&);
+   void write_training_history_record(std::ostream&, int);
+
    std::string get_training_history_XML(bool);
 
    // Utility methods
@@ -263,6 +288,14 @@ public:
    void load(const char*);
 
 
+protected:
+
+   // Checkpoint methods
+
+   void write_training_history_binary(std::ostream&);
+   void read_training_history_binary(std::istream&);
+
+
 private:
 
    // MEMBERS
@@ -289,6 +322,11 @@ private:
 
    Matrix<double> population;
 
+   /// Matrix where recombination writes the new population. 
+   /// It is swapped with the population matrix at each generation, so that individuals are never copied.
+
+   Matrix<double> offspring;
+
    /// Evaluation of population.
 
    Vector<double> evaluation;
@@ -325,6 +363,18 @@ private:
 
    double mutation_range;
 
+   /// Number of threads for evaluating the population when compiled with OpenMP.
+   /// Zero means the OpenMP default, and one means serial evaluation.
+
+   int threads_number;
+
+   /// True if the evaluation of an individual may be given up as soon as it is known to be worse than the median
+   /// evaluation of the previous generation, and false otherwise.
+   /// Such individuals are ranked by a lower bound of their evaluation, so that only the order among them is 
+   /// approximate.
+
+   bool early_abandon;
+
    double mean_evaluation_goal;
 
    double standard_deviation_evaluation_goal;
@@ -407,6 +457,11 @@ private:
 
    // METHODS
 
+   // Evolution methods
+
+   void recombine_population(const RecombinationMethod&, bool);
+   void mutate_individual(double*, int, const MutationMethod&);
+
    // Utility methods
 
    double calculate_random_uniform(double, double);
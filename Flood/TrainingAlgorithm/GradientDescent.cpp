@@ -120,6 +120,22 @@ GradientDescent::~GradientDescent(void)
 
 // METHODS
 
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new gradient descent object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* GradientDescent::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   GradientDescent* gradient_descent_pointer = new GradientDescent(*this);
+
+   gradient_descent_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(gradient_descent_pointer);
+}
+
+
 // void set_reserve_all_training_history(bool) method
 
 /// This method makes the training history of all variables to reseved or not in memory:
@@ -238,11 +254,12 @@ void GradientDescent::train(void)
 
    bool stop_training = false;
 
-   time_t beginning_time, current_time;
-   time(&beginning_time);
+   double beginning_time = calculate_monotonic_time();
    double elapsed_time;
 
-   resize_training_history(maximum_epochs_number+1);    // Main loop
+   initialize_profiling();
+
+   initialize_training_history(maximum_epochs_number+1);    // Main loop
 
    for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
    {
@@ -270,7 +287,25 @@ void GradientDescent::train(void)
          evaluation_improvement = old_evaluation - evaluation; 
       }
 
-      validation_error = objective_functional_pointer->calculate_validation_error();
+      if(epoch != 0 && training_rate_method == StrongWolfe)
+      {
+         // The strong Wolfe line search has already computed the gradient at the new parameters
+
+         gradient = training_rate_gradient;
+
+         if(epoch % validation_interval == 0)
+         {
+            validation_error = objective_functional_pointer->calculate_validation_error();
+         }
+      }
+      else if(epoch % validation_interval == 0)
+      {
+         gradient = calculate_gradient_validation_error(validation_error);
+      }
+      else
+      {
+         gradient = objective_functional_pointer->calculate_gradient();
+      }
 
       if(epoch == 0)
       {
@@ -281,8 +316,6 @@ void GradientDescent::train(void)
          validation_error_increment = validation_error - old_validation_error;
       }
 
-      gradient = objective_functional_pointer->calculate_gradient();
-
       gradient_norm = gradient.calculate_norm();
 
       if(display && gradient_norm >= warning_gradient_norm)
@@ -304,7 +337,7 @@ void GradientDescent::train(void)
       }    
       
 	  training_rate_evaluation 
-      = calculate_training_rate_evaluation(evaluation, training_direction, initial_training_rate);
+      = calculate_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate);
 
       training_rate = training_rate_evaluation[0];
 
@@ -313,60 +346,72 @@ void GradientDescent::train(void)
       
       // Elapsed time
 
-      time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      int history_index = get_training_history_index(epoch);
 
       // Training history multilayer perceptron 
 
       if(reserve_parameters_history)
       {
-         parameters_history[epoch] = parameters;
+         parameters_history[history_index] = parameters;
       }
 
       if(reserve_parameters_norm_history)
       {
-         parameters_norm_history[epoch] = parameters_norm; 
+         parameters_norm_history[history_index] = parameters_norm; 
       }
 
       // Training history objective functional
 
       if(reserve_evaluation_history)
       {
-         evaluation_history[epoch] = evaluation;
+         evaluation_history[history_index] = evaluation;
       }
 
       if(reserve_validation_error_history)
       {
-         validation_error_history[epoch] = validation_error;
+         if(epoch % validation_interval == 0)
+         {
+            validation_error_history[history_index] = validation_error;
+         }
+         else
+         {
+            validation_error_history[history_index] = -1.0;
+         }
       }
 
       if(reserve_gradient_history)
       {
-         gradient_history[epoch] = gradient;                                
+         gradient_history[history_index] = gradient;                                
       }
 
       if(reserve_gradient_norm_history)
       {
-         gradient_norm_history[epoch] = gradient_norm;
+         gradient_norm_history[history_index] = gradient_norm;
       }
 
       // Training history training algorithm
 
       if(reserve_training_direction_history)
       {
-         training_direction_history[epoch] = training_direction;                                
+         training_direction_history[history_index] = training_direction;                                
       }
 
       if(reserve_training_rate_history)
       {
-         training_rate_history[epoch] = training_rate;
+         training_rate_history[history_index] = training_rate;
       }
 
       if(reserve_elapsed_time_history)
       {
-         elapsed_time_history[epoch] = elapsed_time;
+         elapsed_time_history[history_index] = elapsed_time;
       }
 
+      append_training_history(epoch);
+
       // Stopping Criteria
 
       if(parameters_increment_norm <= minimum_parameters_increment_norm)
@@ -463,7 +508,7 @@ void GradientDescent::train(void)
                       << "Elapsed time: " << elapsed_time << std::endl; 
 		 }
     
-         resize_training_history(1+epoch);
+         finish_training_history(1+epoch);
 
          break;
       }
@@ -502,6 +547,7 @@ void GradientDescent::train(void)
       old_training_rate = training_rate;
    } 
 
+   delete_validation_replica();
 }
 
 
@@ -536,6 +582,14 @@ std::string GradientDescent::to_XML(bool show_declaration)
           << training_rate_tolerance << std::endl
           << "</TrainingRateTolerance>" << std::endl;
 
+   buffer << "<SufficientDecreaseParameter>" << std::endl
+          << sufficient_decrease_parameter << std::endl
+          << "</SufficientDecreaseParameter>" << std::endl;
+
+   buffer << "<CurvatureParameter>" << std::endl
+          << curvature_parameter << std::endl
+          << "</CurvatureParameter>" << std::endl;
+
    buffer << "<WarningParametersNorm>" << std::endl
           << warning_parameters_norm << std::endl
           << "</WarningParametersNorm>" << std::endl;
@@ -578,6 +632,38 @@ std::string GradientDescent::to_XML(bool show_declaration)
           << early_stopping << std::endl
           << "</EarlyStopping>" << std::endl;
 
+   buffer << "<ValidationInterval>" << std::endl
+          << validation_interval << std::endl
+          << "</ValidationInterval>" << std::endl;
+
+   buffer << "<AsynchronousValidation>" << std::endl
+          << asynchronous_validation << std::endl
+          << "</AsynchronousValidation>" << std::endl;
+
+   // Training history sink
+
+   buffer << "<TrainingHistoryPeriod>" << std::endl
+          << training_history_period << std::endl
+          << "</TrainingHistoryPeriod>" << std::endl;
+
+   buffer << "<TrainingHistoryDepth>" << std::endl
+          << training_history_depth << std::endl
+          << "</TrainingHistoryDepth>" << std::endl;
+
+   buffer << "<TrainingHistoryFilename>" << std::endl
+          << training_history_filename << std::endl
+          << "</TrainingHistoryFilename>" << std::endl;
+
+   // Profiling
+
+   buffer << "<Profiling>" << std::endl
+          << profiling << std::endl
+          << "</Profiling>" << std::endl;
+
+   buffer << "<ReserveProfilingTrace>" << std::endl
+          << reserve_profiling_trace << std::endl
+          << "</ReserveProfilingTrace>" << std::endl;
+
    buffer << "<GradientNormGoal>" << std::endl
           << gradient_norm_goal << std::endl
           << "</GradientNormGoal>" << std::endl;
@@ -844,6 +930,44 @@ void GradientDescent::load(const char* filename)
  
             exit(1);
          }  
+	  }
+	  else if(word == "<SufficientDecreaseParameter>")
+	  {
+		 double new_sufficient_decrease_parameter; 
+
+         file >> new_sufficient_decrease_parameter;          
+
+         file >> word;
+
+		 if(word != "</SufficientDecreaseParameter>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown sufficient decrease parameter end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_sufficient_decrease_parameter(new_sufficient_decrease_parameter);
+	  }
+	  else if(word == "<CurvatureParameter>")
+	  {
+		 double new_curvature_parameter; 
+
+         file >> new_curvature_parameter;          
+
+         file >> word;
+
+		 if(word != "</CurvatureParameter>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown curvature parameter end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_curvature_parameter(new_curvature_parameter);
 	  }
 	  else if(word == "<WarningTrainingRate>")
 	  {
@@ -1019,6 +1143,146 @@ void GradientDescent::load(const char* filename)
             exit(1);
          }  
 	  }
+	  else if(word == "<ValidationInterval>")
+	  {
+   	     int new_validation_interval; 
+
+         file >> new_validation_interval;          
+
+         file >> word;
+
+		 if(word != "</ValidationInterval>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown validation interval end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_validation_interval(new_validation_interval);
+	  }
+	  else if(word == "<AsynchronousValidation>")
+	  {
+   	     bool new_asynchronous_validation; 
+
+         file >> new_asynchronous_validation;          
+
+         file >> word;
+
+		 if(word != "</AsynchronousValidation>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown asynchronous validation end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_asynchronous_validation(new_asynchronous_validation);
+	  }
+	  else if(word == "<TrainingHistoryPeriod>")
+	  {
+   	     int new_training_history_period; 
+
+         file >> new_training_history_period;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryPeriod>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_period(new_training_history_period);
+	  }
+	  else if(word == "<TrainingHistoryDepth>")
+	  {
+   	     int new_training_history_depth; 
+
+         file >> new_training_history_depth;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryDepth>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history depth end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_depth(new_training_history_depth);
+	  }
+	  else if(word == "<TrainingHistoryFilename>")
+	  {
+         // The training history filename is empty by default
+
+   	     std::string new_training_history_filename; 
+
+         file >> word;
+
+         if(word != "</TrainingHistoryFilename>")
+         {
+            new_training_history_filename = word;
+
+            file >> word;
+         }
+
+		 if(word != "</TrainingHistoryFilename>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_filename(new_training_history_filename);
+	  }
+	  else if(word == "<Profiling>")
+	  {
+   	     bool new_profiling; 
+
+         file >> new_profiling;          
+
+         file >> word;
+
+		 if(word != "</Profiling>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown profiling end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_profiling(new_profiling);
+	  }
+	  else if(word == "<ReserveProfilingTrace>")
+	  {
+   	     bool new_reserve_profiling_trace; 
+
+         file >> new_reserve_profiling_trace;          
+
+         file >> word;
+
+		 if(word != "</ReserveProfilingTrace>") 
+         {
+            std::cerr << "Flood Error: GradientDescent class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown reserve profiling trace end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_reserve_profiling_trace(new_reserve_profiling_trace);
+	  }
 
       // Training history 
 
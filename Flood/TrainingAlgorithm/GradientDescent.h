@@ -48,6 +48,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
    // Set methods
 
    void set_reserve_all_training_history(bool);
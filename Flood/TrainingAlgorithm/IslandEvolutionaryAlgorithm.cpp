@@ -0,0 +1,1126 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   I S L A N D   E V O L U T I O N A R Y   A L G O R I T H M   C L A S S                                      */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <utility>
+#include <cstdlib>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Flood includes
+
+#include "IslandEvolutionaryAlgorithm.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates an island evolutionary algorithm object associated to an evolutionary algorithm
+/// object.
+/// It also initializes the class members to their default values.
+/// @param new_evolutionary_algorithm_pointer Pointer to an evolutionary algorithm object.
+
+IslandEvolutionaryAlgorithm::IslandEvolutionaryAlgorithm(EvolutionaryAlgorithm* new_evolutionary_algorithm_pointer)
+{
+   evolutionary_algorithm_pointer = new_evolutionary_algorithm_pointer;
+
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates an island evolutionary algorithm object not associated to any evolutionary
+/// algorithm object.
+/// It also initializes the class members to their default values.
+
+IslandEvolutionaryAlgorithm::IslandEvolutionaryAlgorithm(void)
+{
+   evolutionary_algorithm_pointer = NULL;
+
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+IslandEvolutionaryAlgorithm::~IslandEvolutionaryAlgorithm(void)
+{
+}
+
+
+// METHODS
+
+// EvolutionaryAlgorithm* get_evolutionary_algorithm_pointer(void) method
+
+/// This method returns a pointer to the evolutionary algorithm object associated to the island evolutionary
+/// algorithm object.
+
+EvolutionaryAlgorithm* IslandEvolutionaryAlgorithm::get_evolutionary_algorithm_pointer(void)
+{
+   return(evolutionary_algorithm_pointer);
+}
+
+
+// int get_islands_number(void) method
+
+/// This method returns the number of populations which evolve separately.
+
+int IslandEvolutionaryAlgorithm::get_islands_number(void)
+{
+   return(islands_number);
+}
+
+
+// MigrationTopology& get_migration_topology(void) method
+
+/// This method returns the topology of the migration between islands.
+
+IslandEvolutionaryAlgorithm::MigrationTopology& IslandEvolutionaryAlgorithm::get_migration_topology(void)
+{
+   return(migration_topology);
+}
+
+
+// std::string get_migration_topology_name(void) method
+
+/// This method returns a string with the name of the migration topology.
+
+std::string IslandEvolutionaryAlgorithm::get_migration_topology_name(void)
+{
+   switch(migration_topology)
+   {
+      case Ring:
+      {
+         return("Ring");
+      }
+      break;
+
+      case FullyConnected:
+      {
+         return("FullyConnected");
+      }
+      break;
+
+      default:
+      {
+         std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                   << "std::string get_migration_topology_name(void) method." << std::endl
+                   << "Unknown migration topology." << std::endl;
+
+         exit(1);
+      }
+      break;
+   }
+}
+
+
+// int get_migration_interval(void) method
+
+/// This method returns the number of generations between two migrations.
+
+int IslandEvolutionaryAlgorithm::get_migration_interval(void)
+{
+   return(migration_interval);
+}
+
+
+// int get_migrants_number(void) method
+
+/// This method returns the number of best individuals which an island sends to each of its neighbours at every
+/// migration.
+
+int IslandEvolutionaryAlgorithm::get_migrants_number(void)
+{
+   return(migrants_number);
+}
+
+
+// int get_threads_number(void) method
+
+/// This method returns the number of threads used for training when compiled with OpenMP.
+/// Zero means the OpenMP default.
+
+int IslandEvolutionaryAlgorithm::get_threads_number(void)
+{
+   return(threads_number);
+}
+
+
+// bool get_display(void) method
+
+/// This method returns true if the training progress is to be displayed on the screen, and false otherwise.
+
+bool IslandEvolutionaryAlgorithm::get_display(void)
+{
+   return(display);
+}
+
+
+// Vector<double>& get_final_evaluations(void) method
+
+/// This method returns the evaluation of the best individual found by each island in the last training process.
+
+Vector<double>& IslandEvolutionaryAlgorithm::get_final_evaluations(void)
+{
+   return(final_evaluations);
+}
+
+
+// Matrix<double>& get_final_parameters(void) method
+
+/// This method returns the best individual found by each island in the last training process, one row per island.
+
+Matrix<double>& IslandEvolutionaryAlgorithm::get_final_parameters(void)
+{
+   return(final_parameters);
+}
+
+
+// Vector<double>& get_best_evaluation_history(void) method
+
+/// This method returns the evaluation of the best individual of all the islands at each generation of the last
+/// training process.
+
+Vector<double>& IslandEvolutionaryAlgorithm::get_best_evaluation_history(void)
+{
+   return(best_evaluation_history);
+}
+
+
+// int get_best_island(void) method
+
+/// This method returns the index of the island which found the best individual in the last training process, or
+/// -1 if the object has not been trained.
+
+int IslandEvolutionaryAlgorithm::get_best_island(void)
+{
+   return(best_island);
+}
+
+
+// double get_best_evaluation(void) method
+
+/// This method returns the evaluation of the best individual found in the last training process.
+
+double IslandEvolutionaryAlgorithm::get_best_evaluation(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(best_island < 0)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "double get_best_evaluation(void) method." << std::endl
+                << "Island evolutionary algorithm object has not been trained." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   return(final_evaluations[best_island]);
+}
+
+
+// Vector<double> get_best_parameters(void) method
+
+/// This method returns the best individual found in the last training process.
+
+Vector<double> IslandEvolutionaryAlgorithm::get_best_parameters(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(best_island < 0)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "Vector<double> get_best_parameters(void) method." << std::endl
+                << "Island evolutionary algorithm object has not been trained." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   return(final_parameters.get_row(best_island));
+}
+
+
+// void set_evolutionary_algorithm_pointer(EvolutionaryAlgorithm*) method
+
+/// This method sets a pointer to an evolutionary algorithm object to be associated to the island evolutionary
+/// algorithm object.
+/// @param new_evolutionary_algorithm_pointer Pointer to an evolutionary algorithm object.
+
+void IslandEvolutionaryAlgorithm::set_evolutionary_algorithm_pointer
+(EvolutionaryAlgorithm* new_evolutionary_algorithm_pointer)
+{
+   evolutionary_algorithm_pointer = new_evolutionary_algorithm_pointer;
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the island evolutionary algorithm object to their default values:
+/// <ul>
+/// <li> Islands number: 4
+/// <li> Migration topology: Ring
+/// <li> Migration interval: 10
+/// <li> Migrants number: 1
+/// <li> Threads number: 0
+/// <li> Display: true
+/// </ul>
+
+void IslandEvolutionaryAlgorithm::set_default(void)
+{
+   islands_number = 4;
+
+   migration_topology = Ring;
+   migration_interval = 10;
+   migrants_number = 1;
+
+   threads_number = 0;
+
+   display = true;
+
+   best_island = -1;
+}
+
+
+// void set_islands_number(int) method
+
+/// This method sets a new number of populations which evolve separately.
+/// @param new_islands_number Number of islands. It must be greater than zero.
+
+void IslandEvolutionaryAlgorithm::set_islands_number(int new_islands_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_islands_number <= 0)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void set_islands_number(int) method." << std::endl
+                << "Number of islands must be greater than zero." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   islands_number = new_islands_number;
+}
+
+
+// void set_migration_topology(const MigrationTopology&) method
+
+/// This method sets a new topology for the migration between islands.
+/// @param new_migration_topology Migration topology.
+
+void IslandEvolutionaryAlgorithm::set_migration_topology(const MigrationTopology& new_migration_topology)
+{
+   migration_topology = new_migration_topology;
+}
+
+
+// void set_migration_topology(const std::string&) method
+
+/// This method sets a new topology for the migration between islands from a string.
+/// @param new_migration_topology_name Name of the migration topology ("Ring" or "FullyConnected").
+
+void IslandEvolutionaryAlgorithm::set_migration_topology(const std::string& new_migration_topology_name)
+{
+   if(new_migration_topology_name == "Ring")
+   {
+      migration_topology = Ring;
+   }
+   else if(new_migration_topology_name == "FullyConnected")
+   {
+      migration_topology = FullyConnected;
+   }
+   else
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void set_migration_topology(const std::string&) method." << std::endl
+                << "Unknown migration topology: " << new_migration_topology_name << "." << std::endl;
+
+      exit(1);
+   }
+}
+
+
+// void set_migration_interval(int) method
+
+/// This method sets a new number of generations between two migrations.
+/// @param new_migration_interval Migration interval. It must be greater than zero.
+
+void IslandEvolutionaryAlgorithm::set_migration_interval(int new_migration_interval)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_migration_interval <= 0)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void set_migration_interval(int) method." << std::endl
+                << "Migration interval must be greater than zero." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   migration_interval = new_migration_interval;
+}
+
+
+// void set_migrants_number(int) method
+
+/// This method sets a new number of best individuals which an island sends to each of its neighbours at every
+/// migration.
+/// @param new_migrants_number Number of migrants. Zero means that the islands evolve in isolation.
+
+void IslandEvolutionaryAlgorithm::set_migrants_number(int new_migrants_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_migrants_number < 0)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void set_migrants_number(int) method." << std::endl
+                << "Number of migrants must be equal or greater than zero." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   migrants_number = new_migrants_number;
+}
+
+
+// void set_threads_number(int) method
+
+/// This method sets a new number of threads for training when compiled with OpenMP.
+/// @param new_threads_number Number of threads. Zero means the OpenMP default.
+
+void IslandEvolutionaryAlgorithm::set_threads_number(int new_threads_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_threads_number < 0)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void set_threads_number(int) method." << std::endl
+                << "Number of threads must be equal or greater than zero." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   threads_number = new_threads_number;
+}
+
+
+// void set_display(bool) method
+
+/// This method sets a new display value.
+/// If it is set to true messages from this class are to be displayed on the screen;
+/// if it is set to false messages from this class are not to be displayed on the screen.
+/// @param new_display Display value.
+
+void IslandEvolutionaryAlgorithm::set_display(bool new_display)
+{
+   display = new_display;
+}
+
+
+// void perform_migration(Vector<EvolutionaryAlgorithm*>&) method
+
+/// This method sends copies of the best individuals of each island to its neighbours in the migration topology,
+/// where they replace the worst individuals together with their evaluations.
+/// All the migrants are chosen before any island is changed, so that the result does not depend on the order of
+/// the islands.
+/// @param islands Evolutionary algorithm objects of the islands. Their populations must have been evaluated.
+
+void IslandEvolutionaryAlgorithm::perform_migration(Vector<EvolutionaryAlgorithm*>& islands)
+{
+   int size = islands.get_size();
+
+   if(size < 2 || migrants_number == 0)
+   {
+      return;
+   }
+
+   int population_size = islands[0]->get_population_size();
+
+   int neighbours_number = migration_topology == Ring ? 1 : size-1;
+
+   // Control sentence
+
+   if(neighbours_number*migrants_number >= population_size)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void perform_migration(Vector<EvolutionaryAlgorithm*>&) method." << std::endl
+                << "Number of immigrants (" << neighbours_number*migrants_number
+                << ") must be less than population size (" << population_size << ")." << std::endl;
+
+      exit(1);
+   }
+
+   // Individuals of each island sorted by evaluation, from the best to the worst
+
+   Vector< Vector< std::pair<double, int> > > ranking(size);
+
+   for(int i = 0; i < size; i++)
+   {
+      Vector<double>& evaluation = islands[i]->get_evaluation();
+
+      ranking[i].set_size(population_size);
+
+      for(int j = 0; j < population_size; j++)
+      {
+         ranking[i][j] = std::pair<double, int>(evaluation[j], j);
+      }
+
+      std::sort(ranking[i].begin(), ranking[i].end());
+   }
+
+   // Migrants of each island
+
+   Vector< Matrix<double> > migrants(size);
+   Vector< Vector<double> > migrants_evaluation(size);
+
+   for(int i = 0; i < size; i++)
+   {
+      migrants[i].set(migrants_number, islands[i]->get_individual(0).get_size());
+      migrants_evaluation[i].set_size(migrants_number);
+
+      for(int k = 0; k < migrants_number; k++)
+      {
+         migrants[i].set_row(k, islands[i]->get_individual(ranking[i][k].second));
+         migrants_evaluation[i][k] = ranking[i][k].first;
+      }
+   }
+
+   // Replace the worst individuals of each island with the immigrants
+
+   for(int i = 0; i < size; i++)
+   {
+      Vector<double>& evaluation = islands[i]->get_evaluation();
+
+      int replaced_individuals_count = 0;
+
+      for(int j = 0; j < size; j++)
+      {
+         bool neighbour = migration_topology == Ring ? j == (i+size-1)%size : j != i;
+
+         if(!neighbour)
+         {
+            continue;
+         }
+
+         for(int k = 0; k < migrants_number; k++)
+         {
+            int worst_individual_index = ranking[i][population_size-1-replaced_individuals_count].second;
+
+            islands[i]->set_individual(worst_individual_index, migrants[j].get_row(k));
+            evaluation[worst_individual_index] = migrants_evaluation[j][k];
+
+            replaced_individuals_count++;
+         }
+      }
+   }
+}
+
+
+// void train(void) method
+
+/// This method trains the multilayer perceptron with all the islands, and sets its parameters to the best
+/// individual found.
+/// Each island evolves with the operators of the evolutionary algorithm, and every migration interval the
+/// islands exchange their best individuals.
+/// The first island begins with the population of the evolutionary algorithm, and the others with random
+/// populations uniformly distributed within the range of that population.
+/// Training stops when the maximum number of generations of the evolutionary algorithm is reached, or when an
+/// island has reached its evaluation goal, which is checked at the migrations.
+/// With more than one thread the islands draw random numbers in the order the threads run, so that training is
+/// only repeatable for a given seed with one thread.
+
+void IslandEvolutionaryAlgorithm::train(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(evolutionary_algorithm_pointer == NULL)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to evolutionary algorithm object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   if(evolutionary_algorithm_pointer->get_objective_functional_pointer() == NULL)
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   ObjectiveFunctional* objective_functional_pointer = evolutionary_algorithm_pointer->get_objective_functional_pointer();
+
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   int maximum_generations_number = (int)evolutionary_algorithm_pointer->get_maximum_generations_number();
+
+   double evaluation_goal = evolutionary_algorithm_pointer->get_evaluation_goal();
+
+   if(display)
+   {
+      std::cout << "Training with the island evolutionary algorithm..." << std::endl;
+   }
+
+   // Results
+
+   final_evaluations.set(islands_number, 1.0e99);
+   final_parameters.set(islands_number, parameters_number, 0.0);
+   best_evaluation_history.set(maximum_generations_number+1, 0.0);
+
+   best_island = -1;
+
+   Matrix<double> islands_best_evaluation_history(islands_number, maximum_generations_number+1, 0.0);
+
+   // Copies. The first island keeps the population of the evolutionary algorithm, and the others are initialized 
+   // at random within its range. 
+
+   Vector< Vector<double> > population_minimum_maximum 
+   = evolutionary_algorithm_pointer->get_population().calculate_minimum_maximum();
+
+   Vector<MultilayerPerceptron*> multilayer_perceptrons(islands_number);
+   Vector<ObjectiveFunctional*> objective_functionals(islands_number);
+   Vector<EvolutionaryAlgorithm*> islands(islands_number);
+
+   for(int i = 0; i < islands_number; i++)
+   {
+      multilayer_perceptrons[i] = multilayer_perceptron_pointer->clone();
+
+      objective_functionals[i] = objective_functional_pointer->clone(multilayer_perceptrons[i]);
+      objective_functionals[i]->set_calculate_evaluation_count(0);
+
+      islands[i] = (EvolutionaryAlgorithm*)evolutionary_algorithm_pointer->clone(objective_functionals[i]);
+
+      islands[i]->set_threads_number(1);
+      islands[i]->set_display(false);
+      islands[i]->set_checkpoint_period(0);
+      islands[i]->set_training_history_filename("");
+
+      if(i != 0)
+      {
+         islands[i]->initialize_population_uniform(population_minimum_maximum[0], population_minimum_maximum[1]);
+      }
+   }
+
+   #ifdef _OPENMP
+
+   int threads = threads_number > 0 ? threads_number : omp_get_max_threads();
+
+   #endif
+
+   // Main loop. The islands evolve concurrently from the first to the last generation of each phase, and migration
+   // takes place between phases.
+
+   int first_generation = 0;
+   int last_generation = 0;
+
+   int generation;
+
+   for(;;)
+   {
+      #ifdef _OPENMP
+
+      #pragma omp parallel for schedule(dynamic) num_threads(threads)
+
+      #endif
+
+      for(int i = 0; i < islands_number; i++)
+      {
+         for(int j = first_generation; j <= last_generation; j++)
+         {
+            if(j != 0)
+            {
+               islands[i]->evolve_population();
+            }
+
+            if(islands[i]->get_early_abandon() && j != 0)
+            {
+               islands[i]->evaluate_population(islands[i]->calculate_median_evaluation());
+            }
+            else
+            {
+               islands[i]->evaluate_population();
+            }
+
+            Vector<double>& evaluation = islands[i]->get_evaluation();
+
+            int best_individual_index = evaluation.calculate_minimal_index();
+
+            if(evaluation[best_individual_index] < final_evaluations[i])
+            {
+               final_evaluations[i] = evaluation[best_individual_index];
+               final_parameters.set_row(i, islands[i]->get_individual(best_individual_index));
+            }
+
+            islands_best_evaluation_history[i][j] = final_evaluations[i];
+         }
+      }
+
+      generation = last_generation;
+
+      // Stopping criteria
+
+      if(final_evaluations.calculate_minimum() <= evaluation_goal)
+      {
+         if(display)
+         {
+            std::cout << "Generation " << generation << ": Evaluation goal reached." << std::endl;
+         }
+
+         break;
+      }
+      else if(generation >= maximum_generations_number)
+      {
+         if(display)
+         {
+            std::cout << "Generation " << generation << ": Maximum number of generations reached." << std::endl;
+         }
+
+         break;
+      }
+      else if(display && generation != 0)
+      {
+         std::cout << "Generation " << generation << "; " << std::endl
+                   << "Best evaluation: " << final_evaluations.calculate_minimum() << std::endl;
+      }
+
+      perform_migration(islands);
+
+      first_generation = generation+1;
+
+      last_generation = generation+migration_interval < maximum_generations_number
+                      ? generation+migration_interval : maximum_generations_number;
+   }
+
+   // Best evaluation history
+
+   best_evaluation_history.set_size(generation+1);
+
+   for(int j = 0; j <= generation; j++)
+   {
+      best_evaluation_history[j] = islands_best_evaluation_history.get_column(j).calculate_minimum();
+   }
+
+   // Best island, the first one in case of ties
+
+   best_island = final_evaluations.calculate_minimal_index();
+
+   multilayer_perceptron_pointer->set_parameters(final_parameters.get_row(best_island));
+
+   if(display)
+   {
+      std::cout << "Best island: " << best_island+1 << std::endl
+                << "Evaluation: " << final_evaluations[best_island] << std::endl;
+   }
+
+   // Delete copies, and count their evaluations in the original objective functional
+
+   int calculate_evaluation_count = objective_functional_pointer->get_calculate_evaluation_count();
+
+   for(int i = 0; i < islands_number; i++)
+   {
+      calculate_evaluation_count += objective_functionals[i]->get_calculate_evaluation_count();
+
+      delete islands[i];
+      delete objective_functionals[i];
+      delete multilayer_perceptrons[i];
+   }
+
+   objective_functional_pointer->set_calculate_evaluation_count(calculate_evaluation_count);
+}
+
+
+// std::string get_results_XML(bool) method
+
+/// This method returns a XML-type string with the results of the last training process.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning of the string.
+
+std::string IslandEvolutionaryAlgorithm::get_results_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='IslandEvolutionaryAlgorithm' content='Results'>" << std::endl;
+   }
+
+   buffer << "<BestIsland>" << std::endl
+          << best_island << std::endl
+          << "</BestIsland>" << std::endl;
+
+   buffer << "<FinalEvaluations>" << std::endl
+          << final_evaluations << std::endl
+          << "</FinalEvaluations>" << std::endl;
+
+   buffer << "<FinalParameters>" << std::endl
+          << final_parameters
+          << "</FinalParameters>" << std::endl;
+
+   buffer << "<BestEvaluationHistory>" << std::endl
+          << best_evaluation_history << std::endl
+          << "</BestEvaluationHistory>" << std::endl;
+
+   return(buffer.str());
+}
+
+
+// void save_results(const char*) method
+
+/// This method saves to a XML-type file the results of the last training process.
+/// @param filename Name of results XML-type file.
+
+void IslandEvolutionaryAlgorithm::save_results(const char* filename)
+{
+   std::fstream file;
+
+   // Open file
+
+   file.open(filename, std::ios::out);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void save_results(const char*) method." << std::endl
+                << "Cannot open results XML-type file." << std::endl;
+
+      exit(1);
+   }
+
+   // Write file
+
+   file << get_results_XML(true);
+
+   // Close file
+
+   file.close();
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string with the members of the island evolutionary algorithm object.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning of the string.
+
+std::string IslandEvolutionaryAlgorithm::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='IslandEvolutionaryAlgorithm'>" << std::endl;
+   }
+
+   buffer << "<IslandsNumber>" << std::endl
+          << islands_number << std::endl
+          << "</IslandsNumber>" << std::endl;
+
+   buffer << "<MigrationTopology>" << std::endl
+          << get_migration_topology_name() << std::endl
+          << "</MigrationTopology>" << std::endl;
+
+   buffer << "<MigrationInterval>" << std::endl
+          << migration_interval << std::endl
+          << "</MigrationInterval>" << std::endl;
+
+   buffer << "<MigrantsNumber>" << std::endl
+          << migrants_number << std::endl
+          << "</MigrantsNumber>" << std::endl;
+
+   buffer << "<ThreadsNumber>" << std::endl
+          << threads_number << std::endl
+          << "</ThreadsNumber>" << std::endl;
+
+   buffer << "<Display>" << std::endl
+          << display << std::endl
+          << "</Display>" << std::endl;
+
+   return(buffer.str());
+}
+
+
+// void print(void) method
+
+/// This method prints to the screen the members of the island evolutionary algorithm object.
+
+void IslandEvolutionaryAlgorithm::print(void)
+{
+   std::cout << to_XML(true);
+}
+
+
+// void save(const char*) method
+
+/// This method saves to a XML-type file the members of the island evolutionary algorithm object.
+/// @param filename Name of island evolutionary algorithm XML-type file.
+
+void IslandEvolutionaryAlgorithm::save(const char* filename)
+{
+   std::fstream file;
+
+   file.open(filename, std::ios::out);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void save(const char*) method." << std::endl
+                << "Cannot open island evolutionary algorithm XML-type file." << std::endl;
+
+      exit(1);
+   }
+
+   // Write file
+
+   file << to_XML(true);
+
+   // Close file
+
+   file.close();
+}
+
+
+// void load(const char*) method
+
+/// This method loads an island evolutionary algorithm object from a XML-type file.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of island evolutionary algorithm XML-type file.
+
+void IslandEvolutionaryAlgorithm::load(const char* filename)
+{
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open island evolutionary algorithm object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   if(line != "<Flood version='3.0' class='IslandEvolutionaryAlgorithm'>")
+   {
+      std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Unknown file declaration: " << line << std::endl;
+
+      exit(1);
+   }
+
+   while(!file.eof())
+   {
+      file >> word;
+
+      if(word == "<IslandsNumber>")
+      {
+         int new_islands_number;
+
+         file >> new_islands_number;
+
+         file >> word;
+
+         if(word != "</IslandsNumber>")
+         {
+            std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown islands number end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_islands_number(new_islands_number);
+      }
+      else if(word == "<MigrationTopology>")
+      {
+         std::string new_migration_topology_name;
+
+         file >> new_migration_topology_name;
+
+         file >> word;
+
+         if(word != "</MigrationTopology>")
+         {
+            std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown migration topology end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_migration_topology(new_migration_topology_name);
+      }
+      else if(word == "<MigrationInterval>")
+      {
+         int new_migration_interval;
+
+         file >> new_migration_interval;
+
+         file >> word;
+
+         if(word != "</MigrationInterval>")
+         {
+            std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown migration interval end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_migration_interval(new_migration_interval);
+      }
+      else if(word == "<MigrantsNumber>")
+      {
+         int new_migrants_number;
+
+         file >> new_migrants_number;
+
+         file >> word;
+
+         if(word != "</MigrantsNumber>")
+         {
+            std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown migrants number end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_migrants_number(new_migrants_number);
+      }
+      else if(word == "<ThreadsNumber>")
+      {
+         int new_threads_number;
+
+         file >> new_threads_number;
+
+         file >> word;
+
+         if(word != "</ThreadsNumber>")
+         {
+            std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown threads number end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_threads_number(new_threads_number);
+      }
+      else if(word == "<Display>")
+      {
+         bool new_display;
+
+         file >> new_display;
+
+         file >> word;
+
+         if(word != "</Display>")
+         {
+            std::cerr << "Flood Error: IslandEvolutionaryAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown display end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_display(new_display);
+      }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,209 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   I S L A N D   E V O L U T I O N A R Y   A L G O R I T H M   C L A S S   H E A D E R                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __ISLANDEVOLUTIONARYALGORITHM_H__
+#define __ISLANDEVOLUTIONARYALGORITHM_H__
+
+// System includes
+
+#include <string>
+
+// Flood includes
+
+#include "../Utilities/Vector.h"
+#include "../Utilities/Matrix.h"
+#include "EvolutionaryAlgorithm.h"
+
+namespace Flood
+{
+
+/// This concrete class trains a multilayer perceptron with several populations of an evolutionary algorithm, or
+/// islands, which evolve separately and exchange their best individuals every few generations.
+/// Each island is a copy of the evolutionary algorithm, with its own copy of the objective functional and
+/// multilayer perceptron, so that the islands can evolve concurrently when the library is compiled with OpenMP
+/// (-fopenmp).
+/// Migration takes place between the concurrent phases, so that the islands never access each other while they
+/// evolve.
+
+class IslandEvolutionaryAlgorithm
+{
+
+public:
+
+   // ENUMERATIONS
+
+   /// Enumeration of the available migration topologies.
+
+   enum MigrationTopology{Ring, FullyConnected};
+
+   // GENERAL CONSTRUCTOR
+
+   explicit IslandEvolutionaryAlgorithm(EvolutionaryAlgorithm*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit IslandEvolutionaryAlgorithm(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~IslandEvolutionaryAlgorithm(void);
+
+
+   // METHODS
+
+   // Get methods
+
+   EvolutionaryAlgorithm* get_evolutionary_algorithm_pointer(void);
+
+   int get_islands_number(void);
+
+   MigrationTopology& get_migration_topology(void);
+   std::string get_migration_topology_name(void);
+
+   int get_migration_interval(void);
+   int get_migrants_number(void);
+
+   int get_threads_number(void);
+
+   bool get_display(void);
+
+   // Results get methods
+
+   Vector<double>& get_final_evaluations(void);
+   Matrix<double>& get_final_parameters(void);
+   Vector<double>& get_best_evaluation_history(void);
+
+   int get_best_island(void);
+   double get_best_evaluation(void);
+   Vector<double> get_best_parameters(void);
+
+   // Set methods
+
+   void set_evolutionary_algorithm_pointer(EvolutionaryAlgorithm*);
+
+   void set_default(void);
+
+   void set_islands_number(int);
+
+   void set_migration_topology(const MigrationTopology&);
+   void set_migration_topology(const std::string&);
+
+   void set_migration_interval(int);
+   void set_migrants_number(int);
+
+   void set_threads_number(int);
+
+   void set_display(bool);
+
+   // Migration methods
+
+   void perform_migration(Vector<EvolutionaryAlgorithm*>&);
+
+   // Train methods
+
+   void train(void);
+
+   // Results methods
+
+   std::string get_results_XML(bool);
+
+   void save_results(const char*);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+
+   void print(void);
+   void save(const char*);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Pointer to the evolutionary algorithm object which defines the training operators, the population size and
+   /// the stopping criteria.
+   /// It is copied for every island, and its multilayer perceptron is set to the best individual after training.
+
+   EvolutionaryAlgorithm* evolutionary_algorithm_pointer;
+
+   /// Number of populations which evolve separately.
+
+   int islands_number;
+
+   /// Topology of the migration between islands.
+   /// In a ring each island sends its migrants to the next one, and in a fully connected topology to all the
+   /// others.
+
+   MigrationTopology migration_topology;
+
+   /// Number of generations between two migrations.
+
+   int migration_interval;
+
+   /// Number of best individuals which an island sends to each of its neighbours at every migration.
+   /// They replace the worst individuals of the receiving island.
+
+   int migrants_number;
+
+   /// Number of threads used for training when compiled with OpenMP.
+   /// Zero means the OpenMP default.
+
+   int threads_number;
+
+   /// True if the training progress is to be displayed on the screen, false otherwise.
+
+   bool display;
+
+   /// Evaluation of the best individual found by each island in the last training process.
+
+   Vector<double> final_evaluations;
+
+   /// Best individual found by each island in the last training process, one row per island.
+
+   Matrix<double> final_parameters;
+
+   /// Evaluation of the best individual of all the islands at each generation of the last training process.
+
+   Vector<double> best_evaluation_history;
+
+   /// Index of the island which found the best individual in the last training process.
+
+   int best_island;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,414 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   M O M E N T U M   S G D   C L A S S                                                                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cmath>
+
+// Flood includes
+
+#include "MomentumSGD.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a stochastic gradient descent with momentum training algorithm object associated
+/// to an objective functional
+/// object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+MomentumSGD::MomentumSGD(ObjectiveFunctional* new_objective_functional_pointer)
+: StochasticTrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a stochastic gradient descent with momentum training algorithm object not
+/// associated to any objective
+/// functional object.
+/// It also initializes the class members to their default values.
+
+MomentumSGD::MomentumSGD(void) : StochasticTrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+MomentumSGD::~MomentumSGD(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new momentum stochastic gradient descent object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* MomentumSGD::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   MomentumSGD* momentum_SGD_pointer = new MomentumSGD(*this);
+
+   momentum_SGD_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(momentum_SGD_pointer);
+}
+
+
+// double get_momentum(void) method
+
+/// This method returns the momentum coefficient, which is the decay factor of the velocity.
+
+double MomentumSGD::get_momentum(void)
+{
+   return(momentum);
+}
+
+
+// bool get_Nesterov_momentum(void) method
+
+/// This method returns the Nesterov accelerated gradient flag.
+
+bool MomentumSGD::get_Nesterov_momentum(void)
+{
+   return(Nesterov_momentum);
+}
+
+
+// const Vector<double>& get_velocity(void) method
+
+/// This method returns the velocity vector, which is an exponentially decaying sum of the past mini-batch gradients
+/// scaled by the learning rate.
+/// It is sized and reset by the initialize_optimizer_state(int) method.
+
+const Vector<double>& MomentumSGD::get_velocity(void)
+{
+   return(velocity);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the stochastic gradient descent with momentum object to their default values.
+/// The members of the stochastic training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Initial learning rate: 0.01
+/// <li> Momentum: 0.9
+/// <li> Nesterov momentum: false
+/// </ul>
+
+void MomentumSGD::set_default(void)
+{
+   StochasticTrainingAlgorithm::set_default();
+
+   // TRAINING PARAMETERS
+
+   initial_learning_rate = 0.01;
+
+   momentum = 0.9;
+   Nesterov_momentum = false;
+}
+
+
+// void set_momentum(double) method
+
+/// This method sets a new momentum coefficient, which is the decay factor of the velocity.
+/// @param new_momentum Momentum value. It must be equal or greater than 0 and less than 1.
+
+void MomentumSGD::set_momentum(double new_momentum)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_momentum < 0.0 || new_momentum >= 1.0)
+   {
+      std::cerr << "Flood Error: MomentumSGD class." << std::endl
+                << "void set_momentum(double) method." << std::endl
+                << "Momentum must be equal or greater than 0 and less than 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   momentum = new_momentum;
+}
+
+
+// void set_Nesterov_momentum(bool) method
+
+/// This method sets a new Nesterov accelerated gradient flag.
+/// @param new_Nesterov_momentum Nesterov momentum value. True if the Nesterov accelerated gradient is to be used,
+/// false otherwise.
+
+void MomentumSGD::set_Nesterov_momentum(bool new_Nesterov_momentum)
+{
+   Nesterov_momentum = new_Nesterov_momentum;
+}
+
+
+// void initialize_optimizer_state(int) method
+
+/// This method sizes the state vectors of the stochastic gradient descent with momentum optimizer to the number of
+/// parameters, sets them to zero
+/// and resets the number of steps.
+/// @param new_parameters_number Number of parameters of the multilayer perceptron.
+
+void MomentumSGD::initialize_optimizer_state(int new_parameters_number)
+{
+   velocity.set(new_parameters_number, 0.0);
+
+   steps_count = 0;
+}
+
+
+// void update_parameters(Vector<double>&, const Vector<double>&, double) method
+
+/// This method performs a momentum step with a mini-batch gradient.
+/// The velocity is updated as v = m*v - r*g, where m is the momentum and r the learning rate.
+/// The parameters are then incremented by v, or by m*v - r*g if the Nesterov momentum is used.
+/// The state vectors are updated in place, so that no memory is allocated.
+/// @param parameters Vector of parameters to be updated.
+/// @param gradient Mini-batch gradient at the parameters.
+/// @param learning_rate Learning rate of the step.
+
+void MomentumSGD::update_parameters(Vector<double>& parameters, const Vector<double>& gradient, double learning_rate)
+{
+   int parameters_number = parameters.get_size();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(gradient.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: MomentumSGD class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Size of gradient must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+   else if(velocity.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: MomentumSGD class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Optimizer state has not been initialized for this number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   steps_count++;
+
+   if(Nesterov_momentum)
+   {
+      for(int i = 0; i < parameters_number; i++)
+      {
+         velocity[i] = momentum*velocity[i] - learning_rate*gradient[i];
+
+         parameters[i] += momentum*velocity[i] - learning_rate*gradient[i];
+      }
+   }
+   else
+   {
+      for(int i = 0; i < parameters_number; i++)
+      {
+         velocity[i] = momentum*velocity[i] - learning_rate*gradient[i];
+
+         parameters[i] += velocity[i];
+      }
+   }
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format.
+/// Only that training history variables which have been reserved are included here.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string MomentumSGD::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='MomentumSGD' content='TrainingHistory'>" << std::endl;
+   }
+
+   buffer << TrainingAlgorithm::get_training_history_XML(false);
+
+   return(buffer.str());
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of this stochastic gradient descent with momentum object.
+/// It contains the parameters of the update rule, together with the learning rate schedule, batch size, training
+/// parameters, stopping criteria and other user stuff of the base classes.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string MomentumSGD::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='MomentumSGD'>" << std::endl;
+   }
+
+   // Training parameters
+
+   buffer << "<Momentum>" << std::endl
+          << momentum << std::endl
+          << "</Momentum>" << std::endl;
+
+   buffer << "<NesterovMomentum>" << std::endl
+          << Nesterov_momentum << std::endl
+          << "</NesterovMomentum>" << std::endl;
+
+   buffer << StochasticTrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads a stochastic gradient descent with momentum object from a XML-type file.
+/// The members of the base classes are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void MomentumSGD::load(const char* filename)
+{
+   StochasticTrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: MomentumSGD class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open stochastic gradient descent with momentum object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+	  // Training parameters
+
+	  if(word == "<Momentum>")
+	  {
+		 double new_momentum;
+
+         file >> new_momentum;
+
+         file >> word;
+
+		 if(word != "</Momentum>")
+         {
+            std::cerr << "Flood Error: MomentumSGD class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown momentum end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_momentum(new_momentum);
+	  }
+
+	  else if(word == "<NesterovMomentum>")
+	  {
+		 bool new_Nesterov_momentum;
+
+         file >> new_Nesterov_momentum;
+
+         file >> word;
+
+		 if(word != "</NesterovMomentum>")
+         {
+            std::cerr << "Flood Error: MomentumSGD class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown Nesterov momentum end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_Nesterov_momentum(new_Nesterov_momentum);
+	  }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
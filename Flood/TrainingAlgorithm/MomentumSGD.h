@@ -0,0 +1,126 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   M O M E N T U M   S G D   C L A S S   H E A D E R                                                          */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __MOMENTUMSGD_H__
+#define __MOMENTUMSGD_H__
+
+// Flood includes
+
+#include "StochasticTrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This concrete class represents the stochastic gradient descent training algorithm with momentum for an
+/// objective functional of a multilayer perceptron.
+/// A velocity vector accumulates an exponentially decaying sum of the past mini-batch gradients, and the parameters
+/// are moved along it.
+/// The Nesterov variant evaluates the update at the look-ahead point.
+
+class MomentumSGD : public StochasticTrainingAlgorithm
+{
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit MomentumSGD(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit MomentumSGD(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~MomentumSGD(void);
+
+
+   // METHODS
+
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
+   // Get methods
+
+   double get_momentum(void);
+   bool get_Nesterov_momentum(void);
+
+   const Vector<double>& get_velocity(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_momentum(double);
+   void set_Nesterov_momentum(bool);
+
+   // Train methods
+
+   void initialize_optimizer_state(int);
+
+   void update_parameters(Vector<double>&, const Vector<double>&, double);
+
+   // Training history methods
+
+   std::string get_training_history_XML(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Momentum coefficient, which is the decay factor of the velocity.
+
+   double momentum;
+
+   /// Nesterov accelerated gradient flag.
+
+   bool Nesterov_momentum;
+
+   /// Velocity vector, which is an exponentially decaying sum of the past mini-batch gradients scaled by the
+   /// learning rate.
+
+   Vector<double> velocity;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
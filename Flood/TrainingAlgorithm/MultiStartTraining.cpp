@@ -0,0 +1,874 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   M U L T I - S T A R T   T R A I N I N G   C L A S S                                                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Flood includes
+
+#include "MultiStartTraining.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a multi-start training object associated to a training algorithm object.
+/// It also initializes the class members to their default values.
+/// @param new_training_algorithm_pointer Pointer to a training algorithm object.
+
+MultiStartTraining::MultiStartTraining(TrainingAlgorithm* new_training_algorithm_pointer)
+{
+   training_algorithm_pointer = new_training_algorithm_pointer;
+
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a multi-start training object not associated to any training algorithm
+/// object.
+/// It also initializes the class members to their default values.
+
+MultiStartTraining::MultiStartTraining(void)
+{
+   training_algorithm_pointer = NULL;
+
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+MultiStartTraining::~MultiStartTraining(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* get_training_algorithm_pointer(void) method
+
+/// This method returns a pointer to the training algorithm object associated to the multi-start training object.
+
+TrainingAlgorithm* MultiStartTraining::get_training_algorithm_pointer(void)
+{
+   return(training_algorithm_pointer);
+}
+
+
+// int get_starts_number(void) method
+
+/// This method returns the number of training runs, each one from a different starting point.
+
+int MultiStartTraining::get_starts_number(void)
+{
+   return(starts_number);
+}
+
+
+// int get_threads_number(void) method
+
+/// This method returns the number of threads used for training when compiled with OpenMP.
+/// Zero means the OpenMP default.
+
+int MultiStartTraining::get_threads_number(void)
+{
+   return(threads_number);
+}
+
+
+// bool get_cancel_at_evaluation_goal(void) method
+
+/// This method returns true if no more starts are begun once any run has reached the evaluation goal, and false
+/// otherwise.
+
+bool MultiStartTraining::get_cancel_at_evaluation_goal(void)
+{
+   return(cancel_at_evaluation_goal);
+}
+
+
+// bool get_display(void) method
+
+/// This method returns true if the final evaluation of each start is to be displayed on the screen, and false
+/// otherwise.
+
+bool MultiStartTraining::get_display(void)
+{
+   return(display);
+}
+
+
+// Vector<bool>& get_completed_starts(void) method
+
+/// This method returns a vector with the starts which were trained in the last training process.
+/// Starts skipped after the evaluation goal was reached are false.
+
+Vector<bool>& MultiStartTraining::get_completed_starts(void)
+{
+   return(completed_starts);
+}
+
+
+// int get_completed_starts_number(void) method
+
+/// This method returns the number of starts which were trained in the last training process.
+
+int MultiStartTraining::get_completed_starts_number(void)
+{
+   int size = completed_starts.get_size();
+
+   int completed_starts_number = 0;
+
+   for(int i = 0; i < size; i++)
+   {
+      if(completed_starts[i])
+      {
+         completed_starts_number++;
+      }
+   }
+
+   return(completed_starts_number);
+}
+
+
+// Vector<double>& get_final_evaluations(void) method
+
+/// This method returns the final evaluation of each start in the last training process.
+/// The elements of the starts which were not trained are zero.
+
+Vector<double>& MultiStartTraining::get_final_evaluations(void)
+{
+   return(final_evaluations);
+}
+
+
+// Matrix<double>& get_final_parameters(void) method
+
+/// This method returns the final parameters of each start in the last training process, one row per start.
+
+Matrix<double>& MultiStartTraining::get_final_parameters(void)
+{
+   return(final_parameters);
+}
+
+
+// Vector< Vector<double> >& get_evaluation_histories(void) method
+
+/// This method returns the evaluation history of each start in the last training process.
+
+Vector< Vector<double> >& MultiStartTraining::get_evaluation_histories(void)
+{
+   return(evaluation_histories);
+}
+
+
+// int get_best_start(void) method
+
+/// This method returns the index of the start with the smallest final evaluation in the last training process,
+/// or -1 if the object has not been trained.
+
+int MultiStartTraining::get_best_start(void)
+{
+   return(best_start);
+}
+
+
+// double get_best_evaluation(void) method
+
+/// This method returns the smallest final evaluation in the last training process.
+
+double MultiStartTraining::get_best_evaluation(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(best_start < 0)
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "double get_best_evaluation(void) method." << std::endl
+                << "Multi-start training object has not been trained." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   return(final_evaluations[best_start]);
+}
+
+
+// Vector<double> get_best_parameters(void) method
+
+/// This method returns the final parameters of the start with the smallest final evaluation in the last training
+/// process.
+
+Vector<double> MultiStartTraining::get_best_parameters(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(best_start < 0)
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "Vector<double> get_best_parameters(void) method." << std::endl
+                << "Multi-start training object has not been trained." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   return(final_parameters.get_row(best_start));
+}
+
+
+// void set_training_algorithm_pointer(TrainingAlgorithm*) method
+
+/// This method sets a pointer to a training algorithm object to be associated to the multi-start training object.
+/// @param new_training_algorithm_pointer Pointer to a training algorithm object.
+
+void MultiStartTraining::set_training_algorithm_pointer(TrainingAlgorithm* new_training_algorithm_pointer)
+{
+   training_algorithm_pointer = new_training_algorithm_pointer;
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the multi-start training object to their default values:
+/// <ul>
+/// <li> Starts number: 10
+/// <li> Threads number: 0
+/// <li> Cancel at evaluation goal: true
+/// <li> Display: true
+/// </ul>
+
+void MultiStartTraining::set_default(void)
+{
+   starts_number = 10;
+   threads_number = 0;
+
+   cancel_at_evaluation_goal = true;
+   display = true;
+
+   best_start = -1;
+}
+
+
+// void set_starts_number(int) method
+
+/// This method sets a new number of training runs.
+/// @param new_starts_number Number of starts. It must be greater than zero.
+
+void MultiStartTraining::set_starts_number(int new_starts_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_starts_number <= 0)
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void set_starts_number(int) method." << std::endl
+                << "Number of starts must be greater than zero." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   starts_number = new_starts_number;
+}
+
+
+// void set_threads_number(int) method
+
+/// This method sets a new number of threads for training when compiled with OpenMP.
+/// @param new_threads_number Number of threads. Zero means the OpenMP default.
+
+void MultiStartTraining::set_threads_number(int new_threads_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_threads_number < 0)
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void set_threads_number(int) method." << std::endl
+                << "Number of threads must be equal or greater than zero." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   threads_number = new_threads_number;
+}
+
+
+// void set_cancel_at_evaluation_goal(bool) method
+
+/// This method sets whether no more starts are begun once any run has reached the evaluation goal.
+/// Starts which are already running are completed.
+/// @param new_cancel_at_evaluation_goal True to skip the remaining starts, false to train all of them.
+
+void MultiStartTraining::set_cancel_at_evaluation_goal(bool new_cancel_at_evaluation_goal)
+{
+   cancel_at_evaluation_goal = new_cancel_at_evaluation_goal;
+}
+
+
+// void set_display(bool) method
+
+/// This method sets a new display value.
+/// If it is set to true messages from this class are to be displayed on the screen;
+/// if it is set to false messages from this class are not to be displayed on the screen.
+/// @param new_display Display value.
+
+void MultiStartTraining::set_display(bool new_display)
+{
+   display = new_display;
+}
+
+
+// ObjectiveFunctional* create_objective_functional(MultilayerPerceptron*) method
+
+/// This method returns a new objective functional object for one start, associated to a copy of the multilayer
+/// perceptron.
+/// By default it is a clone of the objective functional of the training algorithm.
+/// The returned object is deleted by the multi-start training object.
+/// @param new_multilayer_perceptron_pointer Pointer to the multilayer perceptron object of the start.
+
+ObjectiveFunctional* MultiStartTraining::create_objective_functional
+(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   return(training_algorithm_pointer->get_objective_functional_pointer()->clone(new_multilayer_perceptron_pointer));
+}
+
+
+// TrainingAlgorithm* create_training_algorithm(ObjectiveFunctional*) method
+
+/// This method returns a new training algorithm object for one start, associated to a copy of the objective
+/// functional.
+/// By default it is a clone of the training algorithm, so that it has the same training parameters and stopping
+/// criteria.
+/// Its checkpoints and training history file, which all the starts would share, are then disabled. 
+/// The returned object is deleted by the multi-start training object.
+/// @param new_objective_functional_pointer Pointer to the objective functional object of the start.
+
+TrainingAlgorithm* MultiStartTraining::create_training_algorithm(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   return(training_algorithm_pointer->clone(new_objective_functional_pointer));
+}
+
+
+// void train(void) method
+
+/// This method trains a copy of the multilayer perceptron from each starting point, and sets the parameters of
+/// the original multilayer perceptron to those of the start with the smallest final evaluation.
+/// The first start begins at the current parameters, and the others at normally distributed random parameters.
+/// All the copies, starting points and seeds of the starts are created before training, so that they do not depend 
+/// on the threads schedule. 
+/// With a single thread, the random number generator is seeded with the seed of each start before training it, and 
+/// with a new seed after the last start, so that skipped starts do not change the random numbers of the others. 
+/// With more than one thread, the starts share the random number generator, so that stochastic training algorithms 
+/// are not supported.
+
+void MultiStartTraining::train(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(training_algorithm_pointer == NULL)
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to training algorithm object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   if(training_algorithm_pointer->get_objective_functional_pointer() == NULL)
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   if(training_algorithm_pointer->get_objective_functional_pointer()->get_multilayer_perceptron_pointer() == NULL)
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to multilayer perceptron object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   ObjectiveFunctional* objective_functional_pointer = training_algorithm_pointer->get_objective_functional_pointer();
+
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   double evaluation_goal = training_algorithm_pointer->get_evaluation_goal();
+
+   // Results
+
+   completed_starts.set(starts_number, false);
+   final_evaluations.set(starts_number, 0.0);
+   final_parameters.set(starts_number, parameters_number, 0.0);
+   evaluation_histories.set(starts_number);
+
+   best_start = -1;
+
+   // Copies
+
+   Vector<MultilayerPerceptron*> multilayer_perceptrons(starts_number);
+   Vector<ObjectiveFunctional*> objective_functionals(starts_number);
+   Vector<TrainingAlgorithm*> training_algorithms(starts_number);
+
+   Vector<int> seeds(starts_number);
+
+   for(int i = 0; i < starts_number; i++)
+   {
+      multilayer_perceptrons[i] = multilayer_perceptron_pointer->clone();
+
+      if(i != 0)
+      {
+         multilayer_perceptrons[i]->initialize_parameters_normal();
+      }
+
+      objective_functionals[i] = create_objective_functional(multilayer_perceptrons[i]);
+
+      training_algorithms[i] = create_training_algorithm(objective_functionals[i]);
+
+      training_algorithms[i]->set_reserve_evaluation_history(true);
+      training_algorithms[i]->set_display(false);
+
+      // The starts train concurrently, so that they would all write the same checkpoint and training history files
+
+      training_algorithms[i]->set_checkpoint_period(0);
+      training_algorithms[i]->set_training_history_filename("");
+
+      seeds[i] = rand();
+   }
+
+   int final_seed = rand();
+
+   // Training
+
+   bool evaluation_goal_reached = false;
+
+   int threads = 1;
+
+   #ifdef _OPENMP
+
+   threads = threads_number > 0 ? threads_number : omp_get_max_threads();
+
+   #pragma omp parallel for schedule(dynamic) num_threads(threads)
+
+   #endif
+
+   for(int i = 0; i < starts_number; i++)
+   {
+      bool cancelled;
+
+      #ifdef _OPENMP
+      #pragma omp critical(MultiStartTraining)
+      #endif
+      cancelled = cancel_at_evaluation_goal && evaluation_goal_reached;
+
+      if(cancelled)
+      {
+         continue;
+      }
+
+      if(threads == 1)
+      {
+         srand(seeds[i]);
+      }
+
+      training_algorithms[i]->train();
+
+      double evaluation = objective_functionals[i]->calculate_evaluation();
+
+      #ifdef _OPENMP
+      #pragma omp critical(MultiStartTraining)
+      #endif
+      {
+         completed_starts[i] = true;
+         final_evaluations[i] = evaluation;
+         final_parameters.set_row(i, multilayer_perceptrons[i]->get_parameters());
+         evaluation_histories[i] = training_algorithms[i]->get_evaluation_history();
+
+         if(evaluation <= evaluation_goal)
+         {
+            evaluation_goal_reached = true;
+         }
+
+         if(display)
+         {
+            std::cout << "Start " << i+1 << ": Final evaluation: " << evaluation << std::endl;
+         }
+      }
+   }
+
+   srand(final_seed);
+
+   // Best start, the first one in case of ties
+
+   for(int i = 0; i < starts_number; i++)
+   {
+      if(completed_starts[i] && (best_start < 0 || final_evaluations[i] < final_evaluations[best_start]))
+      {
+         best_start = i;
+      }
+   }
+
+   multilayer_perceptron_pointer->set_parameters(final_parameters.get_row(best_start));
+
+   if(display)
+   {
+      std::cout << "Best start: " << best_start+1 << std::endl
+                << "Evaluation: " << final_evaluations[best_start] << std::endl;
+   }
+
+   // Delete copies
+
+   for(int i = 0; i < starts_number; i++)
+   {
+      delete training_algorithms[i];
+      delete objective_functionals[i];
+      delete multilayer_perceptrons[i];
+   }
+}
+
+
+// std::string get_results_XML(bool) method
+
+/// This method returns a XML-type string with the results of the last training process.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning of the string.
+
+std::string MultiStartTraining::get_results_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='MultiStartTraining' content='Results'>" << std::endl;
+   }
+
+   buffer << "<BestStart>" << std::endl
+          << best_start << std::endl
+          << "</BestStart>" << std::endl;
+
+   buffer << "<FinalEvaluations>" << std::endl
+          << final_evaluations << std::endl
+          << "</FinalEvaluations>" << std::endl;
+
+   buffer << "<FinalParameters>" << std::endl
+          << final_parameters
+          << "</FinalParameters>" << std::endl;
+
+   int size = evaluation_histories.get_size();
+
+   for(int i = 0; i < size; i++)
+   {
+      buffer << "<EvaluationHistory>" << std::endl
+             << evaluation_histories[i] << std::endl
+             << "</EvaluationHistory>" << std::endl;
+   }
+
+   return(buffer.str());
+}
+
+
+// void save_results(const char*) method
+
+/// This method saves to a XML-type file the results of the last training process.
+/// @param filename Name of results XML-type file.
+
+void MultiStartTraining::save_results(const char* filename)
+{
+   std::fstream file;
+
+   // Open file
+
+   file.open(filename, std::ios::out);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void save_results(const char*) method." << std::endl
+                << "Cannot open results XML-type file." << std::endl;
+
+      exit(1);
+   }
+
+   // Write file
+
+   file << get_results_XML(true);
+
+   // Close file
+
+   file.close();
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string with the members of the multi-start training object.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning of the string.
+
+std::string MultiStartTraining::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='MultiStartTraining'>" << std::endl;
+   }
+
+   buffer << "<StartsNumber>" << std::endl
+          << starts_number << std::endl
+          << "</StartsNumber>" << std::endl;
+
+   buffer << "<ThreadsNumber>" << std::endl
+          << threads_number << std::endl
+          << "</ThreadsNumber>" << std::endl;
+
+   buffer << "<CancelAtEvaluationGoal>" << std::endl
+          << cancel_at_evaluation_goal << std::endl
+          << "</CancelAtEvaluationGoal>" << std::endl;
+
+   buffer << "<Display>" << std::endl
+          << display << std::endl
+          << "</Display>" << std::endl;
+
+   return(buffer.str());
+}
+
+
+// void print(void) method
+
+/// This method prints to the screen the members of the multi-start training object.
+
+void MultiStartTraining::print(void)
+{
+   std::cout << to_XML(true);
+}
+
+
+// void save(const char*) method
+
+/// This method saves to a XML-type file the members of the multi-start training object.
+/// @param filename Name of multi-start training XML-type file.
+
+void MultiStartTraining::save(const char* filename)
+{
+   std::fstream file;
+
+   file.open(filename, std::ios::out);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void save(const char*) method." << std::endl
+                << "Cannot open multi-start training XML-type file." << std::endl;
+
+      exit(1);
+   }
+
+   // Write file
+
+   file << to_XML(true);
+
+   // Close file
+
+   file.close();
+}
+
+
+// void load(const char*) method
+
+/// This method loads a multi-start training object from a XML-type file.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of multi-start training XML-type file.
+
+void MultiStartTraining::load(const char* filename)
+{
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open multi-start training object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   if(line != "<Flood version='3.0' class='MultiStartTraining'>")
+   {
+      std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Unknown file declaration: " << line << std::endl;
+
+      exit(1);
+   }
+
+   while(!file.eof())
+   {
+      file >> word;
+
+      if(word == "<StartsNumber>")
+      {
+         int new_starts_number;
+
+         file >> new_starts_number;
+
+         file >> word;
+
+         if(word != "</StartsNumber>")
+         {
+            std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown starts number end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_starts_number(new_starts_number);
+      }
+      else if(word == "<ThreadsNumber>")
+      {
+         int new_threads_number;
+
+         file >> new_threads_number;
+
+         file >> word;
+
+         if(word != "</ThreadsNumber>")
+         {
+            std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown threads number end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_threads_number(new_threads_number);
+      }
+      else if(word == "<CancelAtEvaluationGoal>")
+      {
+         bool new_cancel_at_evaluation_goal;
+
+         file >> new_cancel_at_evaluation_goal;
+
+         file >> word;
+
+         if(word != "</CancelAtEvaluationGoal>")
+         {
+            std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown cancel at evaluation goal end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_cancel_at_evaluation_goal(new_cancel_at_evaluation_goal);
+      }
+      else if(word == "<Display>")
+      {
+         bool new_display;
+
+         file >> new_display;
+
+         file >> word;
+
+         if(word != "</Display>")
+         {
+            std::cerr << "Flood Error: MultiStartTraining class." << std::endl
+                      << "void load(const char*) method." << std::endl
+                      << "Unknown display end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_display(new_display);
+      }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
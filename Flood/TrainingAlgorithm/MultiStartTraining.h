@@ -0,0 +1,198 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   M U L T I - S T A R T   T R A I N I N G   C L A S S   H E A D E R                                          */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __MULTISTARTTRAINING_H__
+#define __MULTISTARTTRAINING_H__
+
+// System includes
+
+#include <string>
+
+// Flood includes
+
+#include "../Utilities/Vector.h"
+#include "../Utilities/Matrix.h"
+#include "../MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+#include "TrainingAlgorithm.h"
+
+namespace Flood
+{
+
+/// This class trains a multilayer perceptron several times from different starting points, and keeps the
+/// parameters of the best run.
+/// Each start uses its own copy of the multilayer perceptron, objective functional and training algorithm, so
+/// that the starts can run concurrently when the library is compiled with OpenMP (-fopenmp).
+/// Data sets are shared by all the starts, and they are only read during training.
+/// Each start has its own seed for the random number generator, which is set before the start is trained with a 
+/// single thread, so that its random numbers do not depend on the other starts. 
+/// Stochastic training algorithms, such as the evolutionary algorithm, random search or the stochastic ones, are not 
+/// supported with more than one thread, since the C library random number generator is shared by the concurrent 
+/// starts and their results are not repeatable. 
+/// Cancellation at the evaluation goal only skips the starts which have not begun, and running starts are completed.
+/// The copies are made with the clone methods of the three objects, and derived classes can redefine the
+/// create_objective_functional(MultilayerPerceptron*) and create_training_algorithm(ObjectiveFunctional*) methods
+/// in order to set them up differently.
+
+class MultiStartTraining
+{
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit MultiStartTraining(TrainingAlgorithm*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit MultiStartTraining(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~MultiStartTraining(void);
+
+
+   // METHODS
+
+   // Get methods
+
+   TrainingAlgorithm* get_training_algorithm_pointer(void);
+
+   int get_starts_number(void);
+   int get_threads_number(void);
+
+   bool get_cancel_at_evaluation_goal(void);
+   bool get_display(void);
+
+   // Results get methods
+
+   Vector<bool>& get_completed_starts(void);
+   int get_completed_starts_number(void);
+
+   Vector<double>& get_final_evaluations(void);
+   Matrix<double>& get_final_parameters(void);
+   Vector< Vector<double> >& get_evaluation_histories(void);
+
+   int get_best_start(void);
+   double get_best_evaluation(void);
+   Vector<double> get_best_parameters(void);
+
+   // Set methods
+
+   void set_training_algorithm_pointer(TrainingAlgorithm*);
+
+   void set_default(void);
+
+   void set_starts_number(int);
+   void set_threads_number(int);
+
+   void set_cancel_at_evaluation_goal(bool);
+   void set_display(bool);
+
+   // Replica methods
+
+   virtual ObjectiveFunctional* create_objective_functional(MultilayerPerceptron*);
+   virtual TrainingAlgorithm* create_training_algorithm(ObjectiveFunctional*);
+
+   // Train methods
+
+   void train(void);
+
+   // Results methods
+
+   std::string get_results_XML(bool);
+
+   void save_results(const char*);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+
+   void print(void);
+   void save(const char*);
+   void load(const char*);
+
+protected:
+
+   // FIELDS
+
+   /// Pointer to the training algorithm object which defines the training problem.
+   /// Its objective functional and multilayer perceptron are copied for every start, and the multilayer
+   /// perceptron is set to the best parameters after training.
+
+   TrainingAlgorithm* training_algorithm_pointer;
+
+   /// Number of training runs, each one from a different starting point.
+
+   int starts_number;
+
+   /// Number of threads used for training when compiled with OpenMP.
+   /// Zero means the OpenMP default.
+
+   int threads_number;
+
+   /// True if no more starts are begun once any run has reached the evaluation goal of the training algorithm,
+   /// false otherwise.
+
+   bool cancel_at_evaluation_goal;
+
+   /// True if the final evaluation of each start is to be displayed on the screen, false otherwise.
+
+   bool display;
+
+   /// Elements are true for the starts which were trained in the last training process.
+
+   Vector<bool> completed_starts;
+
+   /// Final evaluation of each start in the last training process.
+
+   Vector<double> final_evaluations;
+
+   /// Final parameters of each start in the last training process, one row per start.
+
+   Matrix<double> final_parameters;
+
+   /// Evaluation history of each start in the last training process.
+
+   Vector< Vector<double> > evaluation_histories;
+
+   /// Index of the start with the smallest final evaluation in the last training process.
+
+   int best_start;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -50,6 +50,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
    // Train methods
 
    Vector<double> calculate_training_direction(const Vector<double>&, const Matrix<double>&);
@@ -74,6 +74,22 @@ QuasiNewtonMethod::~QuasiNewtonMethod(void)
 // METHODS
 
 
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new quasi-Newton method object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* QuasiNewtonMethod::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   QuasiNewtonMethod* quasi_Newton_method_pointer = new QuasiNewtonMethod(*this);
+
+   quasi_Newton_method_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(quasi_Newton_method_pointer);
+}
+
+
 // InverseHessianApproximationMethod get_inverse_Hessian_approximation_method(void) method
 
 /// This method returns the method for approximating the inverse Hessian matrix to be used when training. 
@@ -409,6 +425,56 @@ const Matrix<double>& old_inverse_Hessian)
 }
 
 
+// void update_inverse_Hessian_approximation(
+// const Vector<double>&, const Vector<double>&, 
+// const Vector<double>&, const Vector<double>&, 
+// Matrix<double>&) method
+
+/// This method updates in place an approximation of the inverse Hessian, accoring to the method used. 
+/// Unlike calculate_inverse_Hessian_approximation, it does not allocate any new matrix. 
+/// The work vectors of the update are members of this object, so that they are not allocated at every epoch. 
+/// Therefore this method is not reentrant, and a quasi-Newton method object must not train from several threads at
+/// the same time. 
+/// @param old_parameters Another point of the objective function.
+/// @param parameters Current point of the objective function
+/// @param old_gradient Gradient at the other point. 
+/// @param gradient Gradient at the current point. 
+/// @param inverse_Hessian Inverse Hessian at the other point on input, and at the current point on output.
+
+void QuasiNewtonMethod::update_inverse_Hessian_approximation(
+const Vector<double>& old_parameters, const Vector<double>& parameters, 
+const Vector<double>& old_gradient, const Vector<double>& gradient,
+Matrix<double>& inverse_Hessian)
+{
+   switch(inverse_Hessian_approximation_method)
+   {
+      case DFP:
+      {
+         objective_functional_pointer->update_DFP_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+         parameters_difference, gradient_difference, inverse_Hessian_dot_gradient_difference);
+      }
+      break;
+
+      case BFGS:
+      {
+         objective_functional_pointer->update_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+         parameters_difference, gradient_difference, inverse_Hessian_dot_gradient_difference);
+      }
+      break;
+
+	  default:
+	  {
+         std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                   << "void update_inverse_Hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&) method." << std::endl
+                   << "Unknown inverse Hessian approximation method." << std::endl;
+
+         exit(1);	  
+	  }
+	  break;
+   }
+}
+
+
 // Vector<double> calculate_training_direction(const Vector<double>&, const Matrix<double>&) method
 
 Vector<double> QuasiNewtonMethod::calculate_training_direction(const Vector<double>& gradient, const Matrix<double>& inverse_Hessian)
@@ -489,7 +555,6 @@ void QuasiNewtonMethod::train(void)
    double gradient_norm;
 
    Matrix<double> inverse_Hessian(parameters_number, parameters_number);
-   Matrix<double> old_inverse_Hessian(parameters_number, parameters_number);
 
    // Training algorithm stuff 
 
@@ -505,15 +570,66 @@ void QuasiNewtonMethod::train(void)
 
    bool stop_training = false;
 
-   time_t beginning_time, current_time;
-   time(&beginning_time);
+   double beginning_time = calculate_monotonic_time();
    double elapsed_time;
 
-   resize_training_history(maximum_epochs_number+1);
+   initialize_profiling();
+
+   initialize_training_history(maximum_epochs_number+1);
+
+   int first_epoch = 0;
+
+   // Resume training from the checkpoint
+
+   if(resume_training)
+   {
+      std::istringstream checkpoint(load_checkpoint(), std::ios::in | std::ios::binary);
+
+      read_checkpoint_header(checkpoint, "QuasiNewtonMethod");
+
+      int checkpoint_epoch = 0;
+      double checkpoint_elapsed_time = 0.0;
+
+      read_binary(checkpoint, checkpoint_epoch);
+      read_binary(checkpoint, checkpoint_elapsed_time);
+
+      read_binary(checkpoint, parameters);
+      read_binary(checkpoint, old_parameters);
+      read_binary(checkpoint, old_gradient);
+      read_binary(checkpoint, inverse_Hessian);
+
+      read_binary(checkpoint, training_rate_gradient);
+      read_binary(checkpoint, training_rate_evaluation);
+
+      read_binary(checkpoint, old_evaluation);
+      read_binary(checkpoint, old_training_rate);
+
+      read_binary(checkpoint, validation_error);
+      read_binary(checkpoint, old_validation_error);
+
+      read_training_history_binary(checkpoint);
+
+      if(!checkpoint || parameters.get_size() != parameters_number)
+      {
+         std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                   << "void train(void) method." << std::endl
+                   << "Checkpoint file does not match this training process." << std::endl;
+
+         exit(1);
+      }
+
+      multilayer_perceptron_pointer->set_parameters(parameters);
+
+      resize_training_history(calculate_training_history_size(maximum_epochs_number+1));
+
+      beginning_time -= checkpoint_elapsed_time;
+
+      first_epoch = checkpoint_epoch + 1;
+   }
 
    // Main loop 
 
-   for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   for(int epoch = first_epoch; epoch <= maximum_epochs_number; epoch++)
    {
       // Multilayer perceptron 
 
@@ -530,7 +646,12 @@ void QuasiNewtonMethod::train(void)
 
 	  if(epoch == 0)
       {      
+         begin_profiling_phase(EvaluationPhase);
+
          evaluation = objective_functional_pointer->calculate_evaluation();
+
+         end_profiling_phase(EvaluationPhase);
+
          evaluation_improvement = 0.0; 
       }
       else
@@ -539,7 +660,33 @@ void QuasiNewtonMethod::train(void)
          evaluation_improvement = old_evaluation - evaluation; 
       }
 
-      validation_error = objective_functional_pointer->calculate_validation_error();
+      if(epoch != 0 && training_rate_method == StrongWolfe)
+      {
+         // The strong Wolfe line search has already computed the gradient at the new parameters
+
+         gradient = training_rate_gradient;
+
+         if(epoch % validation_interval == 0)
+         {
+            begin_profiling_phase(ValidationPhase);
+
+            validation_error = objective_functional_pointer->calculate_validation_error();
+
+            end_profiling_phase(ValidationPhase);
+         }
+      }
+      else if(epoch % validation_interval == 0)
+      {
+         gradient = calculate_gradient_validation_error(validation_error);
+      }
+      else
+      {
+         begin_profiling_phase(GradientPhase);
+
+         gradient = objective_functional_pointer->calculate_gradient();
+
+         end_profiling_phase(GradientPhase);
+      }
 
       if(epoch == 0)
       {
@@ -550,8 +697,6 @@ void QuasiNewtonMethod::train(void)
          validation_error_increment = validation_error - old_validation_error;
       }
 
-      gradient = objective_functional_pointer->calculate_gradient();
-
       gradient_norm = gradient.calculate_norm();
 
       if(display && gradient_norm >= warning_gradient_norm)
@@ -559,17 +704,23 @@ void QuasiNewtonMethod::train(void)
          std::cout << "Flood Warning: Gradient norm is " << gradient_norm << "." << std::endl;          
       }
 
+      begin_profiling_phase(HessianPhase);
+
       if(epoch == 0)
       {
          inverse_Hessian.set_to_identity();
       }
       else
       {
-		 inverse_Hessian = calculate_inverse_Hessian_approximation(old_parameters, parameters, old_gradient, gradient, old_inverse_Hessian);	
+		 update_inverse_Hessian_approximation(old_parameters, parameters, old_gradient, gradient, inverse_Hessian);	
 	  }
 
+      end_profiling_phase(HessianPhase);
+
       // Training algorithm 
 
+      begin_profiling_phase(TrainingDirectionPhase);
+
       training_direction = calculate_training_direction(gradient, inverse_Hessian);          
 
       // Calculate evaluation training_slope
@@ -585,6 +736,8 @@ void QuasiNewtonMethod::train(void)
          training_direction = calculate_gradient_descent_training_direction(gradient);
       }
 
+      end_profiling_phase(TrainingDirectionPhase);
+
       // Get initial training rate
 
       if(epoch == 0)
@@ -596,7 +749,7 @@ void QuasiNewtonMethod::train(void)
          initial_training_rate = old_training_rate;
       }
 
-      training_rate_evaluation = calculate_training_rate_evaluation(evaluation, training_direction, initial_training_rate);
+      training_rate_evaluation = calculate_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate);
 
       training_rate = training_rate_evaluation[0];      
 
@@ -606,7 +759,7 @@ void QuasiNewtonMethod::train(void)
 
          training_direction = calculate_gradient_descent_training_direction(gradient);         
 
-         training_rate_evaluation = calculate_training_rate_evaluation(evaluation, training_direction, first_training_rate);
+         training_rate_evaluation = calculate_training_rate_evaluation(evaluation, gradient, training_direction, first_training_rate);
 
          training_rate = training_rate_evaluation[0];
       }
@@ -616,65 +769,81 @@ void QuasiNewtonMethod::train(void)
       
       // Elapsed time
 
-      time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      begin_profiling_phase(TrainingHistoryPhase);
+
+      int history_index = get_training_history_index(epoch);
 
       // Training history multilayer perceptron 
 
       if(reserve_parameters_history)
       {
-         parameters_history[epoch] = parameters;                                
+         parameters_history[history_index] = parameters;                                
       }
 
       if(reserve_parameters_norm_history)
       {
-         parameters_norm_history[epoch] = parameters_norm; 
+         parameters_norm_history[history_index] = parameters_norm; 
       }
 
       // Training history objective functional
 
       if(reserve_evaluation_history)
       {
-         evaluation_history[epoch] = evaluation;
+         evaluation_history[history_index] = evaluation;
       }
 
       if(reserve_validation_error_history)
       {
-         validation_error_history[epoch] = validation_error;
+         if(epoch % validation_interval == 0)
+         {
+            validation_error_history[history_index] = validation_error;
+         }
+         else
+         {
+            validation_error_history[history_index] = -1.0;
+         }
       }
 
       if(reserve_gradient_history)
       {
-         gradient_history[epoch] = gradient;                                
+         gradient_history[history_index] = gradient;                                
       }
 
       if(reserve_gradient_norm_history)
       {
-         gradient_norm_history[epoch] = gradient_norm;
+         gradient_norm_history[history_index] = gradient_norm;
       }
 
       if(reserve_inverse_Hessian_history)
       {
-         inverse_Hessian_history[epoch] = inverse_Hessian;
+         inverse_Hessian_history[history_index] = inverse_Hessian;
       }
 
       // Training history training algorithm
 
       if(reserve_training_direction_history)
       {
-         training_direction_history[epoch] = training_direction;                                
+         training_direction_history[history_index] = training_direction;                                
       }
 
       if(reserve_training_rate_history)
       {
-         training_rate_history[epoch] = training_rate;
+         training_rate_history[history_index] = training_rate;
       }
 
       if(reserve_elapsed_time_history)
       {
-         elapsed_time_history[epoch] = elapsed_time;
+         elapsed_time_history[history_index] = elapsed_time;
       }
 
+      append_training_history(epoch);
+
+      end_profiling_phase(TrainingHistoryPhase);
+
       // Stopping Criteria
 
       if(parameters_increment_norm <= minimum_parameters_increment_norm)
@@ -771,7 +940,7 @@ void QuasiNewtonMethod::train(void)
                       << "Elapsed time: " << elapsed_time << std::endl; 
 		 }   
  
-         resize_training_history(1+epoch);
+         finish_training_history(1+epoch);
 
          break;
       }
@@ -803,8 +972,6 @@ void QuasiNewtonMethod::train(void)
       old_evaluation = evaluation;
 
 	  old_gradient = gradient;
-
-	  old_inverse_Hessian = inverse_Hessian;
  
       old_training_rate = training_rate;
 
@@ -819,7 +986,55 @@ void QuasiNewtonMethod::train(void)
 
       multilayer_perceptron_pointer->set_parameters(parameters);
 
+      // Checkpoint
+
+      if(checkpoint_period > 0 && (epoch+1) % checkpoint_period == 0)
+      {
+         std::ostringstream checkpoint(std::ios::out | std::ios::binary);
+
+         write_checkpoint_header(checkpoint, "QuasiNewtonMethod");
+
+         write_binary(checkpoint, epoch);
+         write_binary(checkpoint, elapsed_time);
+
+         write_binary(checkpoint, parameters);
+         write_binary(checkpoint, old_parameters);
+         write_binary(checkpoint, old_gradient);
+         write_binary(checkpoint, inverse_Hessian);
+
+         write_binary(checkpoint, training_rate_gradient);
+         write_binary(checkpoint, training_rate_evaluation);
+
+         write_binary(checkpoint, old_evaluation);
+         write_binary(checkpoint, old_training_rate);
+
+         write_binary(checkpoint, validation_error);
+         write_binary(checkpoint, old_validation_error);
+
+         write_training_history_binary(checkpoint);
+
+         save_checkpoint(checkpoint.str());
+      }
+
    }
+
+   delete_validation_replica();
+}
+
+
+// void resume(void) method
+
+/// This method continues the training process from the state saved in the checkpoint file. 
+/// The parameters of the multilayer perceptron, the inverse Hessian approximation and the training history are restored, 
+/// so that training goes on exactly as if it had not been interrupted after the epoch of the checkpoint. 
+
+void QuasiNewtonMethod::resume(void)
+{
+   resume_training = true;
+
+   train();
+
+   resume_training = false;
 }
 
 
@@ -859,6 +1074,14 @@ std::string QuasiNewtonMethod::to_XML(bool show_declaration)
           << training_rate_tolerance << std::endl
           << "</TrainingRateTolerance>" << std::endl;
 
+   buffer << "<SufficientDecreaseParameter>" << std::endl
+          << sufficient_decrease_parameter << std::endl
+          << "</SufficientDecreaseParameter>" << std::endl;
+
+   buffer << "<CurvatureParameter>" << std::endl
+          << curvature_parameter << std::endl
+          << "</CurvatureParameter>" << std::endl;
+
    buffer << "<WarningParametersNorm>" << std::endl
           << warning_parameters_norm << std::endl
           << "</WarningParametersNorm>" << std::endl;
@@ -893,6 +1116,46 @@ std::string QuasiNewtonMethod::to_XML(bool show_declaration)
           << early_stopping << std::endl
           << "</EarlyStopping>" << std::endl;
 
+   buffer << "<ValidationInterval>" << std::endl
+          << validation_interval << std::endl
+          << "</ValidationInterval>" << std::endl;
+
+   buffer << "<AsynchronousValidation>" << std::endl
+          << asynchronous_validation << std::endl
+          << "</AsynchronousValidation>" << std::endl;
+
+   buffer << "<CheckpointPeriod>" << std::endl
+          << checkpoint_period << std::endl
+          << "</CheckpointPeriod>" << std::endl;
+
+   buffer << "<CheckpointFilename>" << std::endl
+          << checkpoint_filename << std::endl
+          << "</CheckpointFilename>" << std::endl;
+
+   // Training history sink
+
+   buffer << "<TrainingHistoryPeriod>" << std::endl
+          << training_history_period << std::endl
+          << "</TrainingHistoryPeriod>" << std::endl;
+
+   buffer << "<TrainingHistoryDepth>" << std::endl
+          << training_history_depth << std::endl
+          << "</TrainingHistoryDepth>" << std::endl;
+
+   buffer << "<TrainingHistoryFilename>" << std::endl
+          << training_history_filename << std::endl
+          << "</TrainingHistoryFilename>" << std::endl;
+
+   // Profiling
+
+   buffer << "<Profiling>" << std::endl
+          << profiling << std::endl
+          << "</Profiling>" << std::endl;
+
+   buffer << "<ReserveProfilingTrace>" << std::endl
+          << reserve_profiling_trace << std::endl
+          << "</ReserveProfilingTrace>" << std::endl;
+
    buffer << "<GradientNormGoal>" << std::endl
           << gradient_norm_goal << std::endl
           << "</GradientNormGoal>" << std::endl;
@@ -1104,6 +1367,44 @@ void QuasiNewtonMethod::load(const char* filename)
          set_training_rate_tolerance(new_training_rate_tolerance);
 	  }
 
+	  else if(word == "<SufficientDecreaseParameter>")
+	  {
+		 double new_sufficient_decrease_parameter; 
+
+         file >> new_sufficient_decrease_parameter;          
+
+         file >> word;
+
+		 if(word != "</SufficientDecreaseParameter>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown sufficient decrease parameter end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_sufficient_decrease_parameter(new_sufficient_decrease_parameter);
+	  }
+	  else if(word == "<CurvatureParameter>")
+	  {
+		 double new_curvature_parameter; 
+
+         file >> new_curvature_parameter;          
+
+         file >> word;
+
+		 if(word != "</CurvatureParameter>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown curvature parameter end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_curvature_parameter(new_curvature_parameter);
+	  }
 	  else if(word == "<WarningParametersNorm>")
 	  {
 		 double new_warning_parameters_norm; 
@@ -1305,6 +1606,184 @@ void QuasiNewtonMethod::load(const char* filename)
 
          set_early_stopping(new_early_stopping);
 	  }
+	  else if(word == "<ValidationInterval>")
+	  {
+   	     int new_validation_interval; 
+
+         file >> new_validation_interval;          
+
+         file >> word;
+
+		 if(word != "</ValidationInterval>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown validation interval end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_validation_interval(new_validation_interval);
+	  }
+	  else if(word == "<AsynchronousValidation>")
+	  {
+   	     bool new_asynchronous_validation; 
+
+         file >> new_asynchronous_validation;          
+
+         file >> word;
+
+		 if(word != "</AsynchronousValidation>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown asynchronous validation end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_asynchronous_validation(new_asynchronous_validation);
+	  }
+	  else if(word == "<CheckpointPeriod>")
+	  {
+   	     int new_checkpoint_period; 
+
+         file >> new_checkpoint_period;          
+
+         file >> word;
+
+		 if(word != "</CheckpointPeriod>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_period(new_checkpoint_period);
+	  }
+	  else if(word == "<CheckpointFilename>")
+	  {
+   	     std::string new_checkpoint_filename; 
+
+         file >> new_checkpoint_filename;          
+
+         file >> word;
+
+		 if(word != "</CheckpointFilename>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_filename(new_checkpoint_filename);
+	  }
+	  else if(word == "<TrainingHistoryPeriod>")
+	  {
+   	     int new_training_history_period; 
+
+         file >> new_training_history_period;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryPeriod>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_period(new_training_history_period);
+	  }
+	  else if(word == "<TrainingHistoryDepth>")
+	  {
+   	     int new_training_history_depth; 
+
+         file >> new_training_history_depth;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryDepth>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history depth end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_depth(new_training_history_depth);
+	  }
+	  else if(word == "<TrainingHistoryFilename>")
+	  {
+         // The training history filename is empty by default
+
+   	     std::string new_training_history_filename; 
+
+         file >> word;
+
+         if(word != "</TrainingHistoryFilename>")
+         {
+            new_training_history_filename = word;
+
+            file >> word;
+         }
+
+		 if(word != "</TrainingHistoryFilename>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_filename(new_training_history_filename);
+	  }
+	  else if(word == "<Profiling>")
+	  {
+   	     bool new_profiling; 
+
+         file >> new_profiling;          
+
+         file >> word;
+
+		 if(word != "</Profiling>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown profiling end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_profiling(new_profiling);
+	  }
+	  else if(word == "<ReserveProfilingTrace>")
+	  {
+   	     bool new_reserve_profiling_trace; 
+
+         file >> new_reserve_profiling_trace;          
+
+         file >> word;
+
+		 if(word != "</ReserveProfilingTrace>") 
+         {
+            std::cerr << "Flood Error: QuasiNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown reserve profiling trace end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_reserve_profiling_trace(new_reserve_profiling_trace);
+	  }
 
 	  else if(word == "<GradientNormGoal>")
 	  {
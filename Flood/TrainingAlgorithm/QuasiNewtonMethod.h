@@ -54,6 +54,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
    // Get methods
 
    InverseHessianApproximationMethod get_inverse_Hessian_approximation_method(void);
@@ -69,11 +73,14 @@ public:
    Vector<double> calculate_training_direction(const Vector<double>&, const Matrix<double>&);
 
    Matrix<double> calculate_inverse_Hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&);
+   void update_inverse_Hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, Matrix<double>&);
 
    Vector<double> calculate_gradient_descent_training_direction(const Vector<double>&);
    
    void train(void);
 
+   void resume(void);
+
    // Training history methods
 
    void resize_training_history(int);
@@ -97,6 +104,18 @@ private:
 
    InverseHessianApproximationMethod inverse_Hessian_approximation_method;
 
+   /// Work vector with the parameters difference in the inverse Hessian updates.
+
+   Vector<double> parameters_difference;
+
+   /// Work vector with the gradient difference in the inverse Hessian updates.
+
+   Vector<double> gradient_difference;
+
+   /// Work vector with the dot product of the inverse Hessian and the gradient difference in the inverse Hessian updates.
+
+   Vector<double> inverse_Hessian_dot_gradient_difference;
+
 };
 
 }
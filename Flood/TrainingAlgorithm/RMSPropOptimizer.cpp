@@ -0,0 +1,412 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   R M S P R O P   O P T I M I Z E R   C L A S S                                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cmath>
+
+// Flood includes
+
+#include "RMSPropOptimizer.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a RMSProp training algorithm object associated to an objective functional
+/// object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+RMSPropOptimizer::RMSPropOptimizer(ObjectiveFunctional* new_objective_functional_pointer)
+: StochasticTrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a RMSProp training algorithm object not associated to any objective
+/// functional object.
+/// It also initializes the class members to their default values.
+
+RMSPropOptimizer::RMSPropOptimizer(void) : StochasticTrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+RMSPropOptimizer::~RMSPropOptimizer(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new RMSProp optimizer object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* RMSPropOptimizer::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   RMSPropOptimizer* RMSProp_optimizer_pointer = new RMSPropOptimizer(*this);
+
+   RMSProp_optimizer_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(RMSProp_optimizer_pointer);
+}
+
+
+// double get_decay_rate(void) method
+
+/// This method returns the decay rate of the running average of the squared gradients.
+
+double RMSPropOptimizer::get_decay_rate(void)
+{
+   return(decay_rate);
+}
+
+
+// double get_epsilon(void) method
+
+/// This method returns the small value added to the root mean square of the gradients to avoid divisions by zero.
+
+double RMSPropOptimizer::get_epsilon(void)
+{
+   return(epsilon);
+}
+
+
+// const Vector<double>& get_squared_gradient_average(void) method
+
+/// This method returns the running average of the squared mini-batch gradients.
+/// It is sized and reset by the initialize_optimizer_state(int) method.
+
+const Vector<double>& RMSPropOptimizer::get_squared_gradient_average(void)
+{
+   return(squared_gradient_average);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the RMSProp object to their default values.
+/// The members of the stochastic training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Initial learning rate: 0.001
+/// <li> Decay rate: 0.9
+/// <li> Epsilon: 1.0e-8
+/// </ul>
+
+void RMSPropOptimizer::set_default(void)
+{
+   StochasticTrainingAlgorithm::set_default();
+
+   // TRAINING PARAMETERS
+
+   initial_learning_rate = 0.001;
+
+   decay_rate = 0.9;
+   epsilon = 1.0e-8;
+}
+
+
+// void set_decay_rate(double) method
+
+/// This method sets a new decay rate of the running average of the squared gradients.
+/// @param new_decay_rate Decay rate value. It must be equal or greater than 0 and less than 1.
+
+void RMSPropOptimizer::set_decay_rate(double new_decay_rate)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_decay_rate < 0.0 || new_decay_rate >= 1.0)
+   {
+      std::cerr << "Flood Error: RMSPropOptimizer class." << std::endl
+                << "void set_decay_rate(double) method." << std::endl
+                << "Decay rate must be equal or greater than 0 and less than 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   decay_rate = new_decay_rate;
+}
+
+
+// void set_epsilon(double) method
+
+/// This method sets a new small value added to the root mean square of the gradients to avoid divisions by zero.
+/// @param new_epsilon Epsilon value. It must be greater than 0.
+
+void RMSPropOptimizer::set_epsilon(double new_epsilon)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_epsilon <= 0.0)
+   {
+      std::cerr << "Flood Error: RMSPropOptimizer class." << std::endl
+                << "void set_epsilon(double) method." << std::endl
+                << "Epsilon must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   epsilon = new_epsilon;
+}
+
+
+// void initialize_optimizer_state(int) method
+
+/// This method sizes the state vectors of the RMSProp optimizer to the number of parameters, sets them to zero
+/// and resets the number of steps.
+/// @param new_parameters_number Number of parameters of the multilayer perceptron.
+
+void RMSPropOptimizer::initialize_optimizer_state(int new_parameters_number)
+{
+   squared_gradient_average.set(new_parameters_number, 0.0);
+
+   steps_count = 0;
+}
+
+
+// void update_parameters(Vector<double>&, const Vector<double>&, double) method
+
+/// This method performs a RMSProp step with a mini-batch gradient.
+/// The running average of the squared gradients is updated as s = d*s + (1-d)*g*g, where d is the decay rate.
+/// Each parameter is then decremented by r*g/(sqrt(s) + epsilon), where r is the learning rate.
+/// The state vectors are updated in place, so that no memory is allocated.
+/// @param parameters Vector of parameters to be updated.
+/// @param gradient Mini-batch gradient at the parameters.
+/// @param learning_rate Learning rate of the step.
+
+void RMSPropOptimizer::update_parameters(Vector<double>& parameters, const Vector<double>& gradient, double learning_rate)
+{
+   int parameters_number = parameters.get_size();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(gradient.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: RMSPropOptimizer class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Size of gradient must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+   else if(squared_gradient_average.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: RMSPropOptimizer class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Optimizer state has not been initialized for this number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   steps_count++;
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      squared_gradient_average[i] = decay_rate*squared_gradient_average[i] + (1.0 - decay_rate)*gradient[i]*gradient[i];
+
+      parameters[i] -= learning_rate*gradient[i]/(sqrt(squared_gradient_average[i]) + epsilon);
+   }
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format.
+/// Only that training history variables which have been reserved are included here.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string RMSPropOptimizer::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='RMSPropOptimizer' content='TrainingHistory'>" << std::endl;
+   }
+
+   buffer << TrainingAlgorithm::get_training_history_XML(false);
+
+   return(buffer.str());
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of this RMSProp object.
+/// It contains the parameters of the update rule, together with the learning rate schedule, batch size, training
+/// parameters, stopping criteria and other user stuff of the base classes.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string RMSPropOptimizer::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='RMSPropOptimizer'>" << std::endl;
+   }
+
+   // Training parameters
+
+   buffer << "<DecayRate>" << std::endl
+          << decay_rate << std::endl
+          << "</DecayRate>" << std::endl;
+
+   buffer << "<Epsilon>" << std::endl
+          << epsilon << std::endl
+          << "</Epsilon>" << std::endl;
+
+   buffer << StochasticTrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads a RMSProp object from a XML-type file.
+/// The members of the base classes are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void RMSPropOptimizer::load(const char* filename)
+{
+   StochasticTrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: RMSPropOptimizer class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open RMSProp object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+	  // Training parameters
+
+	  if(word == "<DecayRate>")
+	  {
+		 double new_decay_rate;
+
+         file >> new_decay_rate;
+
+         file >> word;
+
+		 if(word != "</DecayRate>")
+         {
+            std::cerr << "Flood Error: RMSPropOptimizer class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown decay rate end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_decay_rate(new_decay_rate);
+	  }
+
+	  else if(word == "<Epsilon>")
+	  {
+		 double new_epsilon;
+
+         file >> new_epsilon;
+
+         file >> word;
+
+		 if(word != "</Epsilon>")
+         {
+            std::cerr << "Flood Error: RMSPropOptimizer class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown epsilon end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_epsilon(new_epsilon);
+	  }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
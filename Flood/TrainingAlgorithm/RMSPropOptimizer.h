@@ -0,0 +1,124 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   R M S P R O P   O P T I M I Z E R   C L A S S   H E A D E R                                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __RMSPROPOPTIMIZER_H__
+#define __RMSPROPOPTIMIZER_H__
+
+// Flood includes
+
+#include "StochasticTrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This concrete class represents the RMSProp training algorithm for an objective functional of a multilayer
+/// perceptron.
+/// Each parameter has its own learning rate, which is divided by a running root mean square of its mini-batch
+/// gradients.
+
+class RMSPropOptimizer : public StochasticTrainingAlgorithm
+{
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit RMSPropOptimizer(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit RMSPropOptimizer(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~RMSPropOptimizer(void);
+
+
+   // METHODS
+
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
+   // Get methods
+
+   double get_decay_rate(void);
+   double get_epsilon(void);
+
+   const Vector<double>& get_squared_gradient_average(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_decay_rate(double);
+   void set_epsilon(double);
+
+   // Train methods
+
+   void initialize_optimizer_state(int);
+
+   void update_parameters(Vector<double>&, const Vector<double>&, double);
+
+   // Training history methods
+
+   std::string get_training_history_XML(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Decay rate of the running average of the squared gradients.
+
+   double decay_rate;
+
+   /// Small value added to the root mean square of the gradients to avoid divisions by zero.
+
+   double epsilon;
+
+   /// Running average of the squared mini-batch gradients.
+
+   Vector<double> squared_gradient_average;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
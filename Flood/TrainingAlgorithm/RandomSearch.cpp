@@ -67,6 +67,22 @@ RandomSearch::~RandomSearch(void)
 }
 
 
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new random search object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* RandomSearch::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   RandomSearch* random_search_pointer = new RandomSearch(*this);
+
+   random_search_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(random_search_pointer);
+}
+
+
 // double get_training_rate_reduction_factor(void) method
 
 /// This method returns the reducing factor for the training rate. 
@@ -87,6 +103,39 @@ int RandomSearch::get_training_rate_reduction_period(void)
 }
 
 
+// int get_candidates_number(void) method
+
+/// This method returns the number of potential parameters which are generated and evaluated at each epoch. 
+
+int RandomSearch::get_candidates_number(void)
+{
+   return(candidates_number);
+}
+
+
+// int get_threads_number(void) method
+
+/// This method returns the number of threads for evaluating the potential parameters of an epoch when compiled with
+/// OpenMP.
+/// Zero means the OpenMP default, and one means serial evaluation.
+
+int RandomSearch::get_threads_number(void)
+{
+   return(threads_number);
+}
+
+
+// bool get_early_abandon(void) method
+
+/// This method returns true if the evaluation of the candidates worse than the current evaluation may be given up, 
+/// and false otherwise.
+
+bool RandomSearch::get_early_abandon(void)
+{
+   return(early_abandon);
+}
+
+
 // bool get_reserve_potential_parameters_history(void) method
 
 /// This method returns true if the potential parameters history is to be reserved, and false otherwise.
@@ -153,6 +202,9 @@ Vector<double> RandomSearch::get_potential_evaluation_history(void)
 /// <ul>
 /// <li> Training rate reduction factor: 0.9
 /// <li> Training rate reduction period: 10
+/// <li> Candidates number: 1
+/// <li> Threads number: 0
+/// <li> Early abandon: False
 /// <li> Warning parameters norm: 1.0e6
 /// <li> Error parameters norm: 1.0e9
 /// <li> Evaluation goal: -1.0e99
@@ -174,6 +226,11 @@ void RandomSearch::set_default(void)
    training_rate_reduction_factor = 0.9;
    training_rate_reduction_period = 10;
 
+   candidates_number = 1;
+   threads_number = 0;
+
+   early_abandon = false;
+
    // STOPPING CRITERIA
 
    minimum_evaluation_improvement = 0.0;
@@ -219,6 +276,71 @@ void RandomSearch::set_training_rate_reduction_period(int new_training_rate_redu
 }
 
 
+// void set_candidates_number(int) method
+
+/// This method sets a new number of potential parameters which are generated and evaluated at each epoch. 
+/// The potential parameters of an epoch are the best of them, and the training rate is reduced once per epoch.
+/// @param new_candidates_number Number of candidates. It must be greater than zero.
+
+void RandomSearch::set_candidates_number(int new_candidates_number)
+{
+   if(new_candidates_number <= 0)
+   {
+      std::cerr << "Flood Error: RandomSearch class." << std::endl
+                << "void set_candidates_number(int) method." << std::endl
+                << "Number of candidates must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   candidates_number = new_candidates_number;
+}
+
+
+// void set_threads_number(int) method
+
+/// This method sets a new number of threads for evaluating the potential parameters of an epoch when compiled with
+/// OpenMP.
+/// Each thread evaluates candidates on its own clone of the multilayer perceptron and the objective functional, so
+/// that the objective functional must redefine the clone method.
+/// @param new_threads_number Number of threads. Zero means the OpenMP default, and one means serial evaluation.
+
+void RandomSearch::set_threads_number(int new_threads_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_threads_number < 0)
+   {
+      std::cerr << "Flood Error: RandomSearch class." << std::endl
+                << "void set_threads_number(int) method." << std::endl
+                << "Number of threads must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   threads_number = new_threads_number;
+}
+
+
+// void set_early_abandon(bool) method
+
+/// This method sets whether the evaluation of the candidates worse than the current evaluation may be given up. 
+/// The objective functional then returns a lower bound of their evaluation, which is greater than the current 
+/// evaluation, so that such candidates are still rejected. 
+/// The potential evaluation history is not reserved while early abandon is enabled. 
+/// @param new_early_abandon True to give up the evaluation of the candidates worse than the current evaluation, 
+/// false otherwise.
+
+void RandomSearch::set_early_abandon(bool new_early_abandon)
+{
+   early_abandon = new_early_abandon;
+}
+
+
 // void set_reserve_potential_parameters_history(bool) method
 
 void RandomSearch::set_reserve_potential_parameters_history(bool new_reserve_potential_parameters_history)
@@ -321,6 +443,10 @@ Vector<double> RandomSearch::calculate_training_direction(void)
 /// This method trains a multilayer perceptron with an associated 
 /// objective function according to the random search training algorithm.
 /// Training occurs according to the training parameters. 
+/// At each epoch a number of candidates are generated from the current parameters, and the best of them are the
+/// potential parameters.
+/// The candidates are evaluated concurrently on clones of the multilayer perceptron and the objective functional
+/// when compiled with OpenMP.
 
 void RandomSearch::train(void)
 {
@@ -348,10 +474,11 @@ void RandomSearch::train(void)
      
    // Elapsed time
 
-   time_t beginning_time, current_time;
-   time(&beginning_time);
+   double beginning_time = calculate_monotonic_time();
    double elapsed_time;
 
+   initialize_profiling();
+
    // Multilayer perceptron stuff
 
    MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
@@ -374,11 +501,18 @@ void RandomSearch::train(void)
    Vector<double> training_direction(parameters_number);
    double training_rate = 0.0;
 
-   Vector<double> parameters_increment(parameters_number);
-
    bool stop_training = false;
 
-   resize_training_history(maximum_epochs_number+1);
+   // Candidates stuff
+
+   Matrix<double> training_directions(candidates_number, parameters_number);
+   Matrix<double> candidates(candidates_number, parameters_number);
+
+   Vector<double> candidate_evaluations(candidates_number);
+
+   int best_candidate = 0;
+
+   initialize_training_history(maximum_epochs_number+1);
 
    // Main loop 
 
@@ -397,12 +531,68 @@ void RandomSearch::train(void)
 
       if(epoch == 0)
 	  {
+         begin_profiling_phase(EvaluationPhase);
+
          evaluation = objective_functional_pointer->calculate_evaluation();
+
+         end_profiling_phase(EvaluationPhase);
+
          potential_evaluation = evaluation;
 	  }
 	  else
 	  {
-         potential_evaluation = objective_functional_pointer->calculate_potential_evaluation(potential_parameters);
+         begin_profiling_phase(EvaluationPhase);
+
+         if(early_abandon)
+         {
+            // Candidates worse than the current evaluation are rejected, so their evaluations need not be exact
+
+            if(candidates_number == 1)
+            {
+               candidate_evaluations[0] 
+               = objective_functional_pointer->calculate_potential_evaluation(candidates.get_row(0), evaluation);
+            }
+            else
+            {
+               candidate_evaluations 
+               = objective_functional_pointer->calculate_potential_evaluation(candidates, threads_number, evaluation);
+            }
+         }
+         else
+         {
+            if(candidates_number == 1)
+            {
+               candidate_evaluations[0] = objective_functional_pointer->calculate_potential_evaluation(candidates.get_row(0));
+            }
+            else
+            {
+               candidate_evaluations = objective_functional_pointer->calculate_potential_evaluation(candidates, threads_number);
+            }
+         }
+
+         end_profiling_phase(EvaluationPhase);
+
+         best_candidate = 0;
+
+         for(int i = 1; i < candidates_number; i++)
+         {
+            if(candidate_evaluations[i] < candidate_evaluations[best_candidate])
+            {
+               best_candidate = i;
+            }
+         }
+
+         potential_parameters = candidates.get_row(best_candidate);
+         potential_parameters_norm = potential_parameters.calculate_norm();
+
+         potential_evaluation = candidate_evaluations[best_candidate];
+
+         // The training direction of the previous epoch is that of the best candidate
+
+         if(reserve_training_direction_history)
+         {
+            training_direction_history[get_training_history_index(epoch-1)] = training_directions.get_row(best_candidate);
+         }
 	  }
 
       if(potential_evaluation < evaluation)
@@ -416,7 +606,16 @@ void RandomSearch::train(void)
 
       // Training algorithm stuff
 
-      training_direction = calculate_training_direction();
+      begin_profiling_phase(TrainingDirectionPhase);
+
+      for(int i = 0; i < candidates_number; i++)
+      {
+         training_directions.set_row(i, calculate_training_direction());
+      }
+
+      end_profiling_phase(TrainingDirectionPhase);
+
+      training_direction = training_directions.get_row(0);
   
       if(epoch == 0)
       {
@@ -427,62 +626,71 @@ void RandomSearch::train(void)
          training_rate *= training_rate_reduction_factor; 
       }       
 
-      parameters_increment = training_direction*training_rate;
-
       // Elapsed time
 
-      time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      begin_profiling_phase(TrainingHistoryPhase);
+
+      int history_index = get_training_history_index(epoch);
 
       // Training history multilayer perceptron 
 
       if(reserve_potential_parameters_history)
       {
-         potential_parameters_history[epoch] = potential_parameters;                                
+         potential_parameters_history[history_index] = potential_parameters;                                
       }
 
       if(reserve_parameters_history)
       {
-         parameters_history[epoch] = parameters;                                
+         parameters_history[history_index] = parameters;                                
       }
 
       if(reserve_potential_parameters_norm_history)
       {
-         potential_parameters_norm_history[epoch] = potential_parameters_norm; 
+         potential_parameters_norm_history[history_index] = potential_parameters_norm; 
       }       if(reserve_parameters_norm_history)
       {
-         parameters_norm_history[epoch] = parameters_norm; 
+         parameters_norm_history[history_index] = parameters_norm; 
       }
 
       // Training history objective functional
 
-      if(reserve_potential_evaluation_history)
+      // Potential evaluation. It is a lower bound if the evaluation of the best candidate has been abandoned.
+
+      if(reserve_potential_evaluation_history && !early_abandon)
       {
-         potential_evaluation_history[epoch] = potential_evaluation;
+         potential_evaluation_history[history_index] = potential_evaluation;
       }
 
       if(reserve_evaluation_history)
       {
-         evaluation_history[epoch] = evaluation;
+         evaluation_history[history_index] = evaluation;
       }
 
       // Training history training algorithm
 
       if(reserve_training_direction_history)
       {
-         training_direction_history[epoch] = training_direction;                                
+         training_direction_history[history_index] = training_direction;                                
       }
 
       if(reserve_training_rate_history)
       {
-         training_rate_history[epoch] = training_rate;
+         training_rate_history[history_index] = training_rate;
       }
 
       if(reserve_elapsed_time_history)
       {
-         elapsed_time_history[epoch] = elapsed_time;
+         elapsed_time_history[history_index] = elapsed_time;
       }
 
+      append_training_history(epoch);
+
+      end_profiling_phase(TrainingHistoryPhase);
+
       // Stopping Criteria
 
       if(potential_evaluation <= evaluation_goal)
@@ -529,6 +737,8 @@ void RandomSearch::train(void)
             objective_functional_pointer->print_information();
 		 }   
  
+         finish_training_history(1+epoch);
+
          break;
       }
 
@@ -546,10 +756,12 @@ void RandomSearch::train(void)
          objective_functional_pointer->print_information();
       }
 
-      // Set new parameters
+      // Set new candidates
 
-      potential_parameters = parameters + parameters_increment;
-      potential_parameters_norm = potential_parameters.calculate_norm();
+      for(int i = 0; i < candidates_number; i++)
+      {
+         candidates.set_row(i, parameters + training_directions.get_row(i)*training_rate);
+      }
    }
 }
 
@@ -598,11 +810,18 @@ void RandomSearch::resize_training_history(int new_size)
       parameters_norm_history.resize(new_size);
    }
 
-   // Potential evaluation history vector
+   // Potential evaluation history vector. It is empty if the evaluation of some candidates may be abandoned.
 
    if(reserve_potential_evaluation_history)
    {
-      potential_evaluation_history.resize(new_size);
+      if(early_abandon)
+      {
+         potential_evaluation_history.set();
+      }
+      else
+      {
+         potential_evaluation_history.resize(new_size);
+      }
    }
 
    // Evaluation history vector
@@ -621,6 +840,90 @@ void RandomSearch::resize_training_history(int new_size)
 }
 
 
+// void rotate_training_history(int) method
+
+/// This method rotates the potential parameters, potential parameters norm and potential evaluation history 
+/// vectors, together with the default training history vectors, so that a given record becomes the first one. 
+/// @param first Position of the oldest record.
+
+void RandomSearch::rotate_training_history(int first)
+{
+   if(reserve_potential_parameters_history && potential_parameters_history.get_size() > first)
+   {
+      std::rotate(potential_parameters_history.begin(), potential_parameters_history.begin()+first, potential_parameters_history.end());
+   }
+
+   if(reserve_potential_parameters_norm_history && potential_parameters_norm_history.get_size() > first)
+   {
+      std::rotate(potential_parameters_norm_history.begin(), potential_parameters_norm_history.begin()+first, potential_parameters_norm_history.end());
+   }
+
+   if(reserve_potential_evaluation_history && potential_evaluation_history.get_size() > first)
+   {
+      std::rotate(potential_evaluation_history.begin(), potential_evaluation_history.begin()+first, potential_evaluation_history.end());
+   }
+
+   TrainingAlgorithm::rotate_training_history(first);
+}
+
+
+// void write_training_history_header(std::ostream&) method
+
+/// This method writes the names of the columns of the potential parameters, potential parameters norm and 
+/// potential evaluation history vectors which are reserved, followed by those of the default training history. 
+/// @param file Training history file.
+
+void RandomSearch::write_training_history_header(std::ostream& file)
+{
+   int parameters_number = objective_functional_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
+
+   if(reserve_potential_parameters_history && potential_parameters_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "potential_parameters", parameters_number);
+   }
+
+   if(reserve_potential_parameters_norm_history && potential_parameters_norm_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "potential_parameters_norm", 1);
+   }
+
+   if(reserve_potential_evaluation_history && potential_evaluation_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "potential_evaluation", 1);
+   }
+
+   TrainingAlgorithm::write_training_history_header(file);
+}
+
+
+// void write_training_history_record(std::ostream&, int) method
+
+/// This method writes one record of the potential parameters, potential parameters norm and potential 
+/// evaluation history vectors which are reserved, followed by that of the default training history. 
+/// @param file Training history file.
+/// @param index Position of the record in the training history vectors.
+
+void RandomSearch::write_training_history_record(std::ostream& file, int index)
+{
+   if(reserve_potential_parameters_history && potential_parameters_history.get_size() != 0)
+   {
+      write_training_history_values(file, potential_parameters_history[index]);
+   }
+
+   if(reserve_potential_parameters_norm_history && potential_parameters_norm_history.get_size() != 0)
+   {
+      write_training_history_values(file, potential_parameters_norm_history[index]);
+   }
+
+   if(reserve_potential_evaluation_history && potential_evaluation_history.get_size() != 0)
+   {
+      write_training_history_values(file, potential_evaluation_history[index]);
+   }
+
+   TrainingAlgorithm::write_training_history_record(file, index);
+}
+
+
 // std::string get_training_history_XML(bool) method
 
 std::string RandomSearch::get_training_history_XML(bool show_declaration)
@@ -728,6 +1031,18 @@ std::string RandomSearch::to_XML(bool show_declaration)
           << training_rate_reduction_factor << std::endl
           << "</TrainingRateReductionFactor>" << std::endl;
 
+   buffer << "<CandidatesNumber>" << std::endl
+          << candidates_number << std::endl
+          << "</CandidatesNumber>" << std::endl;
+
+   buffer << "<ThreadsNumber>" << std::endl
+          << threads_number << std::endl
+          << "</ThreadsNumber>" << std::endl;
+
+   buffer << "<EarlyAbandon>" << std::endl
+          << early_abandon << std::endl
+          << "</EarlyAbandon>" << std::endl;
+
    buffer << "<WarningParametersNorm>" << std::endl
           << warning_parameters_norm << std::endl
           << "</WarningParametersNorm>" << std::endl;
@@ -749,6 +1064,30 @@ std::string RandomSearch::to_XML(bool show_declaration)
    buffer << "<MaximumTime>" << std::endl
           << maximum_time << std::endl 
           << "</MaximumTime>" << std::endl;
+
+   // Training history sink
+
+   buffer << "<TrainingHistoryPeriod>" << std::endl
+          << training_history_period << std::endl
+          << "</TrainingHistoryPeriod>" << std::endl;
+
+   buffer << "<TrainingHistoryDepth>" << std::endl
+          << training_history_depth << std::endl
+          << "</TrainingHistoryDepth>" << std::endl;
+
+   buffer << "<TrainingHistoryFilename>" << std::endl
+          << training_history_filename << std::endl
+          << "</TrainingHistoryFilename>" << std::endl;
+
+   // Profiling
+
+   buffer << "<Profiling>" << std::endl
+          << profiling << std::endl
+          << "</Profiling>" << std::endl;
+
+   buffer << "<ReserveProfilingTrace>" << std::endl
+          << reserve_profiling_trace << std::endl
+          << "</ReserveProfilingTrace>" << std::endl;
   
    // Reserve training history
 
@@ -899,6 +1238,66 @@ void RandomSearch::load(const char* filename)
          set_training_rate_reduction_factor(new_training_rate_reduction_factor);
 	  }
 
+	  if(word == "<CandidatesNumber>")
+	  {
+		 int new_candidates_number; 
+
+         file >> new_candidates_number;          
+
+         file >> word;
+
+		 if(word != "</CandidatesNumber>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown candidates number end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_candidates_number(new_candidates_number);
+	  }
+
+	  if(word == "<ThreadsNumber>")
+	  {
+		 int new_threads_number; 
+
+         file >> new_threads_number;          
+
+         file >> word;
+
+		 if(word != "</ThreadsNumber>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown threads number end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_threads_number(new_threads_number);
+	  }
+
+	  if(word == "<EarlyAbandon>")
+	  {
+		 bool new_early_abandon; 
+
+         file >> new_early_abandon;          
+
+         file >> word;
+
+		 if(word != "</EarlyAbandon>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown early abandon end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_early_abandon(new_early_abandon);
+	  }
+
 	  if(word == "<WarningParametersNorm>")
 	  {
 		 double new_warning_parameters_norm; 
@@ -1000,6 +1399,108 @@ void RandomSearch::load(const char* filename)
 
          set_maximum_time(new_maximum_time);
 	  }
+	  else if(word == "<TrainingHistoryPeriod>")
+	  {
+   	     int new_training_history_period; 
+
+         file >> new_training_history_period;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryPeriod>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_period(new_training_history_period);
+	  }
+	  else if(word == "<TrainingHistoryDepth>")
+	  {
+   	     int new_training_history_depth; 
+
+         file >> new_training_history_depth;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryDepth>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history depth end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_depth(new_training_history_depth);
+	  }
+	  else if(word == "<TrainingHistoryFilename>")
+	  {
+         // The training history filename is empty by default
+
+   	     std::string new_training_history_filename; 
+
+         file >> word;
+
+         if(word != "</TrainingHistoryFilename>")
+         {
+            new_training_history_filename = word;
+
+            file >> word;
+         }
+
+		 if(word != "</TrainingHistoryFilename>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_filename(new_training_history_filename);
+	  }
+	  else if(word == "<Profiling>")
+	  {
+   	     bool new_profiling; 
+
+         file >> new_profiling;          
+
+         file >> word;
+
+		 if(word != "</Profiling>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown profiling end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_profiling(new_profiling);
+	  }
+	  else if(word == "<ReserveProfilingTrace>")
+	  {
+   	     bool new_reserve_profiling_trace; 
+
+         file >> new_reserve_profiling_trace;          
+
+         file >> word;
+
+		 if(word != "</ReserveProfilingTrace>") 
+         {
+            std::cerr << "Flood Error: RandomSearch class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown reserve profiling trace end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_reserve_profiling_trace(new_reserve_profiling_trace);
+	  }
 
       // Training history 
 
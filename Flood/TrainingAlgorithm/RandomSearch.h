@@ -46,11 +46,20 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
    // Get methods
 
    double get_training_rate_reduction_factor(void);
    int get_training_rate_reduction_period(void);
 
+   int get_candidates_number(void);
+   int get_threads_number(void);
+
+   bool get_early_abandon(void);
+
    bool get_reserve_potential_parameters_history(void);
    bool get_reserve_potential_parameters_norm_history(void);
 
@@ -68,6 +77,11 @@ public:
    void set_training_rate_reduction_factor(double);
    void set_training_rate_reduction_period(int);
 
+   void set_candidates_number(int);
+   void set_threads_number(int);
+
+   void set_early_abandon(bool);
+
    void set_reserve_potential_parameters_history(bool);
    void set_reserve_potential_parameters_norm_history(bool);
 
@@ -89,6 +103,11 @@ public:
    void resize_training_history(int);
    void set_reserve_all_training_history(bool);
 
+   void rotate_training_history(int);
+
+   void write_training_history_header(std::ostream&);
+   void write_training_history_record(std::ostream&, int);
+
    std::string get_training_history_XML(bool);
 
    // Utiltity methods
@@ -103,6 +122,21 @@ private:
    double training_rate_reduction_factor;
    int training_rate_reduction_period;
 
+   /// Number of potential parameters which are generated and evaluated at each epoch. 
+   /// The best of them is the potential parameters of that epoch.
+
+   int candidates_number;
+
+   /// Number of threads for evaluating the potential parameters of an epoch when compiled with OpenMP.
+   /// Zero means the OpenMP default, and one means serial evaluation.
+
+   int threads_number;
+
+   /// True if the evaluation of a candidate may be given up as soon as it is known to be worse than the current 
+   /// evaluation, and false otherwise.
+
+   bool early_abandon;
+
    bool reserve_potential_parameters_history;
    bool reserve_potential_parameters_norm_history;
 
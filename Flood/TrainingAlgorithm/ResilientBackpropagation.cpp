@@ -0,0 +1,1015 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   R E S I L I E N T   B A C K P R O P A G A T I O N   C L A S S                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+
+// Flood includes
+
+#include "ResilientBackpropagation.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a resilient backpropagation training algorithm object associated to an
+/// objective functional object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+ResilientBackpropagation::ResilientBackpropagation(ObjectiveFunctional* new_objective_functional_pointer)
+: TrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a resilient backpropagation training algorithm object not associated to any
+/// objective functional object.
+/// It also initializes the class members to their default values.
+
+ResilientBackpropagation::ResilientBackpropagation(void) : TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+ResilientBackpropagation::~ResilientBackpropagation(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new resilient backpropagation object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* ResilientBackpropagation::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   ResilientBackpropagation* resilient_backpropagation_pointer = new ResilientBackpropagation(*this);
+
+   resilient_backpropagation_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(resilient_backpropagation_pointer);
+}
+
+
+// double get_increase_factor(void) method
+
+/// This method returns the factor by which a step size is multiplied when the sign of its gradient component is kept.
+
+double ResilientBackpropagation::get_increase_factor(void)
+{
+   return(increase_factor);
+}
+
+// double get_decrease_factor(void) method
+
+/// This method returns the factor by which a step size is multiplied when the sign of its gradient component changes.
+
+double ResilientBackpropagation::get_decrease_factor(void)
+{
+   return(decrease_factor);
+}
+
+// double get_initial_step_size(void) method
+
+/// This method returns the step size of all the parameters at the first epoch.
+
+double ResilientBackpropagation::get_initial_step_size(void)
+{
+   return(initial_step_size);
+}
+
+// double get_minimum_step_size(void) method
+
+/// This method returns the lower bound of the step sizes.
+
+double ResilientBackpropagation::get_minimum_step_size(void)
+{
+   return(minimum_step_size);
+}
+
+// double get_maximum_step_size(void) method
+
+/// This method returns the upper bound of the step sizes.
+
+double ResilientBackpropagation::get_maximum_step_size(void)
+{
+   return(maximum_step_size);
+}
+
+// const Vector<double>& get_step_sizes(void) method
+
+/// This method returns the step size of each parameter.
+/// It is sized by the initialize_step_sizes(int) method and adapted at each epoch.
+
+const Vector<double>& ResilientBackpropagation::get_step_sizes(void)
+{
+   return(step_sizes);
+}
+
+
+// const Vector<double>& get_old_gradient(void) method
+
+/// This method returns the gradient at the previous epoch, with the components whose sign changed set to zero.
+
+const Vector<double>& ResilientBackpropagation::get_old_gradient(void)
+{
+   return(old_gradient);
+}
+
+
+// const Vector<double>& get_parameters_increment(void) method
+
+/// This method returns the parameters increment applied in the previous epoch.
+
+const Vector<double>& ResilientBackpropagation::get_parameters_increment(void)
+{
+   return(parameters_increment);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the resilient backpropagation object to their default values.
+/// The members of the training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Increase factor: 1.2
+/// <li> Decrease factor: 0.5
+/// <li> Initial step size: 0.1
+/// <li> Minimum step size: 1.0e-6
+/// <li> Maximum step size: 50.0
+/// <li> Minimum evaluation improvement: -1.0e99
+/// </ul>
+/// The minimum evaluation improvement stopping criterion is disabled, since an epoch which increases the
+/// evaluation is reverted by the next one.
+
+void ResilientBackpropagation::set_default(void)
+{
+   TrainingAlgorithm::set_default();
+
+   // STOPPING CRITERIA
+
+   minimum_evaluation_improvement = -1.0e99;
+
+   // TRAINING PARAMETERS
+
+   increase_factor = 1.2;
+   decrease_factor = 0.5;
+
+   initial_step_size = 0.1;
+   minimum_step_size = 1.0e-6;
+   maximum_step_size = 50.0;
+}
+
+// void set_increase_factor(double) method
+
+/// This method sets a new factor by which a step size is multiplied when the sign of its gradient component is kept.
+/// @param new_increase_factor Increase factor value.
+
+void ResilientBackpropagation::set_increase_factor(double new_increase_factor)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_increase_factor <= 1.0)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void set_increase_factor(double) method." << std::endl
+                << "Increase factor must be greater than 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   increase_factor = new_increase_factor;
+}
+
+// void set_decrease_factor(double) method
+
+/// This method sets a new factor by which a step size is multiplied when the sign of its gradient component changes.
+/// @param new_decrease_factor Decrease factor value.
+
+void ResilientBackpropagation::set_decrease_factor(double new_decrease_factor)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_decrease_factor <= 0.0 || new_decrease_factor >= 1.0)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void set_decrease_factor(double) method." << std::endl
+                << "Decrease factor must be greater than 0 and less than 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   decrease_factor = new_decrease_factor;
+}
+
+// void set_initial_step_size(double) method
+
+/// This method sets a new step size of all the parameters at the first epoch.
+/// @param new_initial_step_size Initial step size value.
+
+void ResilientBackpropagation::set_initial_step_size(double new_initial_step_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_initial_step_size <= 0.0)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void set_initial_step_size(double) method." << std::endl
+                << "Initial step size must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   initial_step_size = new_initial_step_size;
+}
+
+// void set_minimum_step_size(double) method
+
+/// This method sets a new lower bound of the step sizes.
+/// @param new_minimum_step_size Minimum step size value.
+
+void ResilientBackpropagation::set_minimum_step_size(double new_minimum_step_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_minimum_step_size < 0.0)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void set_minimum_step_size(double) method." << std::endl
+                << "Minimum step size must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   minimum_step_size = new_minimum_step_size;
+}
+
+// void set_maximum_step_size(double) method
+
+/// This method sets a new upper bound of the step sizes.
+/// @param new_maximum_step_size Maximum step size value.
+
+void ResilientBackpropagation::set_maximum_step_size(double new_maximum_step_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_maximum_step_size <= 0.0)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void set_maximum_step_size(double) method." << std::endl
+                << "Maximum step size must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   maximum_step_size = new_maximum_step_size;
+}
+
+// void initialize_step_sizes(int) method
+
+/// This method sizes the state vectors of the resilient backpropagation to the number of parameters.
+/// All the step sizes are set to the initial step size, and the old gradient and parameters increment are set to
+/// zero.
+/// @param new_parameters_number Number of parameters of the multilayer perceptron.
+
+void ResilientBackpropagation::initialize_step_sizes(int new_parameters_number)
+{
+   step_sizes.set(new_parameters_number, initial_step_size);
+
+   old_gradient.set(new_parameters_number, 0.0);
+   parameters_increment.set(new_parameters_number, 0.0);
+}
+
+
+// void update_parameters(Vector<double>&, const Vector<double>&, bool) method
+
+/// This method performs an iRprop+ step.
+/// If the sign of a gradient component is kept, its step size is increased and the parameter is moved against the
+/// gradient sign.
+/// If the sign changes, the step size is decreased, the previous increment of that parameter is reverted only if
+/// the evaluation increased, and the gradient component is forgotten so that the next step does not adapt the step
+/// size again.
+/// The state vectors are updated in place, so that no memory is allocated.
+/// @param parameters Vector of parameters to be updated.
+/// @param gradient Objective function gradient at the parameters.
+/// @param evaluation_increase True if the evaluation increased in the last epoch, false otherwise.
+
+void ResilientBackpropagation::update_parameters
+(Vector<double>& parameters, const Vector<double>& gradient, bool evaluation_increase)
+{
+   int parameters_number = parameters.get_size();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(gradient.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, bool) method." << std::endl
+                << "Size of gradient must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+   else if(step_sizes.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void update_parameters(Vector<double>&, const Vector<double>&, bool) method." << std::endl
+                << "Step sizes have not been initialized for this number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   double gradient_product;
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      gradient_product = old_gradient[i]*gradient[i];
+
+      if(gradient_product > 0.0)
+      {
+         step_sizes[i] = step_sizes[i]*increase_factor;
+
+         if(step_sizes[i] > maximum_step_size)
+         {
+            step_sizes[i] = maximum_step_size;
+         }
+
+         if(gradient[i] > 0.0)
+         {
+            parameters_increment[i] = -step_sizes[i];
+         }
+         else
+         {
+            parameters_increment[i] = step_sizes[i];
+         }
+
+         old_gradient[i] = gradient[i];
+      }
+      else if(gradient_product < 0.0)
+      {
+         step_sizes[i] = step_sizes[i]*decrease_factor;
+
+         if(step_sizes[i] < minimum_step_size)
+         {
+            step_sizes[i] = minimum_step_size;
+         }
+
+         if(evaluation_increase)
+         {
+            parameters_increment[i] = -parameters_increment[i];
+         }
+         else
+         {
+            parameters_increment[i] = 0.0;
+         }
+
+         old_gradient[i] = 0.0;
+      }
+      else
+      {
+         if(gradient[i] > 0.0)
+         {
+            parameters_increment[i] = -step_sizes[i];
+         }
+         else if(gradient[i] < 0.0)
+         {
+            parameters_increment[i] = step_sizes[i];
+         }
+         else
+         {
+            parameters_increment[i] = 0.0;
+         }
+
+         old_gradient[i] = gradient[i];
+      }
+
+      parameters[i] += parameters_increment[i];
+   }
+}
+
+
+// void train(void) method
+
+/// This method trains a multilayer perceptron with an associated objective functional according to the resilient
+/// backpropagation algorithm.
+/// Each epoch computes the evaluation and the gradient once, and there is no line search.
+/// Training occurs according to the training parameters and stopping criteria.
+
+void ResilientBackpropagation::train(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(objective_functional_pointer == NULL)
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Start training
+
+   if(display)
+   {
+      std::cout << "Training with resilient backpropagation..." << std::endl;
+   }
+
+   // Multilayer perceptron stuff
+
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+   double parameters_norm;
+
+   double parameters_increment_norm = 0.0;
+
+   // Objective functional stuff
+
+   double validation_error = 0.0;
+   double old_validation_error = 0.0;
+   double validation_error_increment = 0.0;
+
+   double evaluation = 0.0;
+   double old_evaluation = 0.0;
+   double evaluation_improvement = 0.0;
+
+   Vector<double> gradient(parameters_number);
+   double gradient_norm;
+
+   // Training algorithm stuff
+
+   bool stop_training = false;
+
+   double beginning_time = calculate_monotonic_time();
+   double elapsed_time;
+
+   initialize_profiling();
+
+   initialize_step_sizes(parameters_number);
+
+   initialize_training_history(maximum_epochs_number+1);
+
+   // Main loop
+
+   for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   {
+      // Multilayer perceptron stuff
+
+      parameters_norm = parameters.calculate_norm();
+
+      if(display && parameters_norm >= warning_parameters_norm)
+      {
+         std::cout << "Flood Warning: Parameters norm is " << parameters_norm << "." << std::endl;
+      }
+
+      // Objective functional stuff
+
+      evaluation = objective_functional_pointer->calculate_evaluation();
+
+      if(epoch == 0)
+      {
+         evaluation_improvement = 0.0;
+      }
+      else
+      {
+         evaluation_improvement = old_evaluation - evaluation;
+      }
+
+      if(epoch % validation_interval == 0)
+      {
+         gradient = calculate_gradient_validation_error(validation_error);
+      }
+      else
+      {
+         gradient = objective_functional_pointer->calculate_gradient();
+      }
+
+      if(epoch == 0)
+      {
+         validation_error_increment = 0.0;
+      }
+      else
+      {
+         validation_error_increment = validation_error - old_validation_error;
+      }
+
+      gradient_norm = gradient.calculate_norm();
+
+      if(display && gradient_norm >= warning_gradient_norm)
+      {
+         std::cout << "Flood Warning: Gradient norm is " << gradient_norm << "." << std::endl;
+      }
+
+      // Elapsed time
+
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      int history_index = get_training_history_index(epoch);
+
+      // Training history multilayer perceptron
+
+      if(reserve_parameters_history)
+      {
+         parameters_history[history_index] = parameters;
+      }
+
+      if(reserve_parameters_norm_history)
+      {
+         parameters_norm_history[history_index] = parameters_norm;
+      }
+
+      // Training history objective functional
+
+      if(reserve_evaluation_history)
+      {
+         evaluation_history[history_index] = evaluation;
+      }
+
+      if(reserve_validation_error_history)
+      {
+         if(epoch % validation_interval == 0)
+         {
+            validation_error_history[history_index] = validation_error;
+         }
+         else
+         {
+            validation_error_history[history_index] = -1.0;
+         }
+      }
+
+      if(reserve_gradient_history)
+      {
+         gradient_history[history_index] = gradient;
+      }
+
+      if(reserve_gradient_norm_history)
+      {
+         gradient_norm_history[history_index] = gradient_norm;
+      }
+
+      // Training history training algorithm
+
+      if(reserve_elapsed_time_history)
+      {
+         elapsed_time_history[history_index] = elapsed_time;
+      }
+
+      append_training_history(epoch);
+
+      // Stopping Criteria
+
+      // The increment is also zero after an epoch in which all the gradient components changed sign,
+      // and then the old gradient is zero
+
+      if(epoch != 0 && parameters_increment_norm <= minimum_parameters_increment_norm && old_gradient != 0.0)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum parameters increment norm reached." << std::endl
+			          << "Parameters increment norm: " << parameters_increment_norm << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch != 0 && evaluation_improvement <= minimum_evaluation_improvement)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum evaluation improvement reached." << std::endl
+                      << "Evaluation improvement: " << evaluation_improvement << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(evaluation <= evaluation_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Evaluation goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(early_stopping && epoch != 0 && validation_error_increment > 0.0)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Validation error stopped improving." << std::endl;
+            std::cout << "Validation error increment: "<< validation_error_increment << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(gradient_norm <= gradient_norm_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Gradient norm goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch == maximum_epochs_number)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum number of epochs reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(elapsed_time >= maximum_time)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum training time reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      if(stop_training)
+      {
+         if(display)
+		 {
+            std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+            std::cout << "Evaluation: " << evaluation << std::endl;
+
+            if(validation_error != 0)
+            {
+               std::cout << "Validation error: " << validation_error << std::endl;
+            }
+
+            std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+            objective_functional_pointer->print_information();
+
+            std::cout << "Elapsed time: " << elapsed_time << std::endl;
+		 }
+
+         finish_training_history(1+epoch);
+
+         break;
+      }
+      else if(display && epoch % display_period == 0)
+      {
+         std::cout << "Epoch " << epoch << ";" << std::endl;
+
+         std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+         std::cout << "Evaluation: " << evaluation << std::endl;
+
+         if(validation_error != 0)
+         {
+            std::cout << "Validation error: " << validation_error << std::endl;
+         }
+
+         std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+         objective_functional_pointer->print_information();
+
+         std::cout << "Elapsed time: " << elapsed_time << std::endl;
+      }
+
+      // Update stuff
+
+      update_parameters(parameters, gradient, epoch != 0 && evaluation > old_evaluation);
+
+      multilayer_perceptron_pointer->set_parameters(parameters);
+
+      parameters_increment_norm = parameters_increment.calculate_norm();
+
+      old_evaluation = evaluation;
+      old_validation_error = validation_error;
+   }
+
+   delete_validation_replica();
+}
+
+
+// void set_reserve_all_training_history(bool) method
+
+/// This method makes the training history of all variables to reseved or not in memory.
+/// There is neither training rate, training direction nor inverse Hessian in the resilient backpropagation, so
+/// their histories are not reserved.
+/// @param new_reserve_all_training_history True if the training history of all variables is to be reserved,
+/// false otherwise.
+
+void ResilientBackpropagation::set_reserve_all_training_history(bool new_reserve_all_training_history)
+{
+   reserve_parameters_history = new_reserve_all_training_history;
+   reserve_parameters_norm_history = new_reserve_all_training_history;
+
+   reserve_evaluation_history = new_reserve_all_training_history;
+   reserve_validation_error_history = new_reserve_all_training_history;
+   reserve_gradient_history = new_reserve_all_training_history;
+   reserve_gradient_norm_history = new_reserve_all_training_history;
+
+   reserve_elapsed_time_history = new_reserve_all_training_history;
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format.
+/// Only that training history variables which have been reserved are included here.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string ResilientBackpropagation::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='ResilientBackpropagation' content='TrainingHistory'>" << std::endl;
+   }
+
+   buffer << TrainingAlgorithm::get_training_history_XML(false);
+
+   return(buffer.str());
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of this resilient backpropagation object.
+/// It contains the step size adaptation parameters, together with the training parameters, stopping criteria and
+/// other user stuff of the training algorithm base class.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string ResilientBackpropagation::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='ResilientBackpropagation'>" << std::endl;
+   }
+
+   // Training parameters
+
+   buffer << "<IncreaseFactor>" << std::endl
+          << increase_factor << std::endl
+          << "</IncreaseFactor>" << std::endl;
+
+   buffer << "<DecreaseFactor>" << std::endl
+          << decrease_factor << std::endl
+          << "</DecreaseFactor>" << std::endl;
+
+   buffer << "<InitialStepSize>" << std::endl
+          << initial_step_size << std::endl
+          << "</InitialStepSize>" << std::endl;
+
+   buffer << "<MinimumStepSize>" << std::endl
+          << minimum_step_size << std::endl
+          << "</MinimumStepSize>" << std::endl;
+
+   buffer << "<MaximumStepSize>" << std::endl
+          << maximum_step_size << std::endl
+          << "</MaximumStepSize>" << std::endl;
+
+   buffer << TrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads a resilient backpropagation object from a XML-type file.
+/// The members of the training algorithm base class are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void ResilientBackpropagation::load(const char* filename)
+{
+   TrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open resilient backpropagation object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+	  // Training parameters
+
+	  if(word == "<IncreaseFactor>")
+	  {
+		 double new_increase_factor;
+
+         file >> new_increase_factor;
+
+         file >> word;
+
+		 if(word != "</IncreaseFactor>")
+         {
+            std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown increase factor end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_increase_factor(new_increase_factor);
+	  }
+
+	  else if(word == "<DecreaseFactor>")
+	  {
+		 double new_decrease_factor;
+
+         file >> new_decrease_factor;
+
+         file >> word;
+
+		 if(word != "</DecreaseFactor>")
+         {
+            std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown decrease factor end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_decrease_factor(new_decrease_factor);
+	  }
+
+	  else if(word == "<InitialStepSize>")
+	  {
+		 double new_initial_step_size;
+
+         file >> new_initial_step_size;
+
+         file >> word;
+
+		 if(word != "</InitialStepSize>")
+         {
+            std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown initial step size end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_initial_step_size(new_initial_step_size);
+	  }
+
+	  else if(word == "<MinimumStepSize>")
+	  {
+		 double new_minimum_step_size;
+
+         file >> new_minimum_step_size;
+
+         file >> word;
+
+		 if(word != "</MinimumStepSize>")
+         {
+            std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown minimum step size end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_minimum_step_size(new_minimum_step_size);
+	  }
+
+	  else if(word == "<MaximumStepSize>")
+	  {
+		 double new_maximum_step_size;
+
+         file >> new_maximum_step_size;
+
+         file >> word;
+
+		 if(word != "</MaximumStepSize>")
+         {
+            std::cerr << "Flood Error: ResilientBackpropagation class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown maximum step size end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_maximum_step_size(new_maximum_step_size);
+	  }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,161 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   R E S I L I E N T   B A C K P R O P A G A T I O N   C L A S S   H E A D E R                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __RESILIENTBACKPROPAGATION_H__
+#define __RESILIENTBACKPROPAGATION_H__
+
+// Flood includes
+
+#include "TrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This concrete class represents the resilient backpropagation training algorithm (iRprop+) for an objective
+/// functional of a multilayer perceptron.
+/// Each parameter has its own step size, which grows while the sign of its gradient component is kept and shrinks
+/// when it changes.
+/// Only the signs of the gradient are used, so that no line search is needed and each epoch costs one evaluation
+/// and one gradient.
+
+class ResilientBackpropagation : public TrainingAlgorithm
+{
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit ResilientBackpropagation(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit ResilientBackpropagation(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~ResilientBackpropagation(void);
+
+
+   // METHODS
+
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
+   // Get methods
+
+   double get_increase_factor(void);
+   double get_decrease_factor(void);
+
+   double get_initial_step_size(void);
+   double get_minimum_step_size(void);
+   double get_maximum_step_size(void);
+
+   const Vector<double>& get_step_sizes(void);
+   const Vector<double>& get_old_gradient(void);
+   const Vector<double>& get_parameters_increment(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_increase_factor(double);
+   void set_decrease_factor(double);
+
+   void set_initial_step_size(double);
+   void set_minimum_step_size(double);
+   void set_maximum_step_size(double);
+
+   // Train methods
+
+   void initialize_step_sizes(int);
+
+   void update_parameters(Vector<double>&, const Vector<double>&, bool);
+
+   void train(void);
+
+   // Training history methods
+
+   void set_reserve_all_training_history(bool);
+
+   std::string get_training_history_XML(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Factor by which a step size is multiplied when the sign of its gradient component is kept.
+
+   double increase_factor;
+
+   /// Factor by which a step size is multiplied when the sign of its gradient component changes.
+
+   double decrease_factor;
+
+   /// Step size of all the parameters at the first epoch.
+
+   double initial_step_size;
+
+   /// Lower bound of the step sizes.
+
+   double minimum_step_size;
+
+   /// Upper bound of the step sizes.
+
+   double maximum_step_size;
+
+   /// Step size of each parameter.
+
+   Vector<double> step_sizes;
+
+   /// Gradient at the previous epoch.
+   /// The components whose sign changed are set to zero, so that the next step does not adapt their step size.
+
+   Vector<double> old_gradient;
+
+   /// Parameters increment applied in the previous epoch.
+
+   Vector<double> parameters_increment;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
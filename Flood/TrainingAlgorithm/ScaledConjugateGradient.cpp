@@ -0,0 +1,804 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   S C A L E D   C O N J U G A T E   G R A D I E N T   C L A S S                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+
+// Flood includes
+
+#include "ScaledConjugateGradient.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a scaled conjugate gradient training algorithm object associated to an
+/// objective functional object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+ScaledConjugateGradient::ScaledConjugateGradient(ObjectiveFunctional* new_objective_functional_pointer)
+: TrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a scaled conjugate gradient training algorithm object not associated to any
+/// objective functional object.
+/// It also initializes the class members to their default values.
+
+ScaledConjugateGradient::ScaledConjugateGradient(void) : TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+ScaledConjugateGradient::~ScaledConjugateGradient(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new scaled conjugate gradient object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* ScaledConjugateGradient::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   ScaledConjugateGradient* scaled_conjugate_gradient_pointer = new ScaledConjugateGradient(*this);
+
+   scaled_conjugate_gradient_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(scaled_conjugate_gradient_pointer);
+}
+
+
+// double get_initial_scaling_parameter(void) method
+
+/// This method returns the value of the scaling parameter at the first epoch.
+
+double ScaledConjugateGradient::get_initial_scaling_parameter(void)
+{
+   return(initial_scaling_parameter);
+}
+
+
+// double get_scaling_parameter(void) method
+
+/// This method returns the scaling parameter after the last epoch of training.
+
+double ScaledConjugateGradient::get_scaling_parameter(void)
+{
+   return(scaling_parameter);
+}
+
+
+// int get_unsuccessful_steps_count(void) method
+
+/// This method returns the number of epochs of the last training process in which the step was rejected because
+/// it did not reduce the evaluation.
+
+int ScaledConjugateGradient::get_unsuccessful_steps_count(void)
+{
+   return(unsuccessful_steps_count);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the scaled conjugate gradient object to their default values.
+/// The members of the training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Initial scaling parameter: 1.0e-6
+/// </ul>
+
+void ScaledConjugateGradient::set_default(void)
+{
+   TrainingAlgorithm::set_default();
+
+   // TRAINING PARAMETERS
+
+   initial_scaling_parameter = 1.0e-6;
+
+   scaling_parameter = initial_scaling_parameter;
+   unsuccessful_steps_count = 0;
+}
+
+
+// void set_initial_scaling_parameter(double) method
+
+/// This method sets a new value for the scaling parameter at the first epoch.
+/// @param new_initial_scaling_parameter Initial scaling parameter value. It must be greater than zero.
+
+void ScaledConjugateGradient::set_initial_scaling_parameter(double new_initial_scaling_parameter)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_initial_scaling_parameter <= 0.0)
+   {
+      std::cerr << "Flood Error: ScaledConjugateGradient class." << std::endl
+                << "void set_initial_scaling_parameter(double) method." << std::endl
+                << "Initial scaling parameter must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   initial_scaling_parameter = new_initial_scaling_parameter;
+}
+
+
+// Vector<double> calculate_training_direction(const Vector<double>&, const Vector<double>&, const Vector<double>&) method
+
+/// This method returns the next conjugate direction of the scaled conjugate gradient algorithm.
+/// The conjugate parameter is (g*g - g*g_old)/(-d_old*g_old), which is the Hestenes-Stiefel formula when the
+/// previous step minimized the evaluation along the previous direction.
+/// The direction is not normalized, since its length is part of the training rate estimate.
+/// @param old_gradient Gradient at the previous epoch.
+/// @param gradient Current gradient.
+/// @param old_training_direction Training direction at the previous epoch.
+
+Vector<double> ScaledConjugateGradient::calculate_training_direction
+(const Vector<double>& old_gradient, const Vector<double>& gradient, const Vector<double>& old_training_direction)
+{
+   int parameters_number = gradient.get_size();
+
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(old_gradient.get_size() != parameters_number || old_training_direction.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: ScaledConjugateGradient class." << std::endl
+                << "Vector<double> calculate_training_direction(const Vector<double>&, const Vector<double>&, "
+                << "const Vector<double>&) method." << std::endl
+                << "Size of vectors must be equal to number of parameters." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   double old_directional_derivative = -old_training_direction.dot(old_gradient);
+
+   double conjugate_parameter = 0.0;
+
+   if(old_directional_derivative > 0.0)
+   {
+      conjugate_parameter = (gradient.dot(gradient) - gradient.dot(old_gradient))/old_directional_derivative;
+   }
+
+   Vector<double> training_direction(parameters_number);
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      training_direction[i] = -gradient[i] + conjugate_parameter*old_training_direction[i];
+   }
+
+   return(training_direction);
+}
+
+
+// void train(void) method
+
+/// This method trains a multilayer perceptron with an associated objective functional according to the scaled
+/// conjugate gradient algorithm.
+/// Each epoch computes one Hessian-vector product, with the calculate_vector_dot_Hessian(const Vector<double>&)
+/// method of the objective functional, and one evaluation, and also one gradient if the step is accepted.
+/// There is no line search.
+/// Training occurs according to the training parameters and stopping criteria.
+
+void ScaledConjugateGradient::train(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(objective_functional_pointer == NULL)
+   {
+      std::cerr << "Flood Error: ScaledConjugateGradient class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Start training
+
+   if(display)
+   {
+      std::cout << "Training with scaled conjugate gradient..." << std::endl;
+   }
+
+   // Multilayer perceptron stuff
+
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+   double parameters_norm;
+
+   Vector<double> potential_parameters(parameters_number);
+
+   double parameters_increment_norm = 0.0;
+
+   // Objective functional stuff
+
+   double validation_error = 0.0;
+   double old_validation_error = 0.0;
+   double validation_error_increment = 0.0;
+
+   double evaluation = objective_functional_pointer->calculate_evaluation();
+   double potential_evaluation = 0.0;
+   double evaluation_improvement = 0.0;
+
+   Vector<double> gradient = objective_functional_pointer->calculate_gradient();
+   Vector<double> old_gradient(parameters_number);
+   double gradient_norm;
+
+   Vector<double> Hessian_dot_training_direction(parameters_number);
+
+   // Training algorithm stuff
+
+   Vector<double> training_direction = gradient*(-1.0);
+   double squared_training_direction_norm;
+
+   double curvature = 0.0;
+   double directional_derivative;
+   double training_rate = 0.0;
+
+   double comparison_parameter;
+   double lower_scaling_parameter = 0.0;
+
+   bool success = true;
+   int successful_steps_count = 0;
+
+   bool stop_training = false;
+
+   double beginning_time = calculate_monotonic_time();
+   double elapsed_time;
+
+   initialize_profiling();
+
+   scaling_parameter = initial_scaling_parameter;
+   unsuccessful_steps_count = 0;
+
+   initialize_training_history(maximum_epochs_number+1);
+
+   // Main loop
+
+   for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   {
+      // Multilayer perceptron stuff
+
+      parameters_norm = parameters.calculate_norm();
+
+      if(display && parameters_norm >= warning_parameters_norm)
+      {
+         std::cout << "Flood Warning: Parameters norm is " << parameters_norm << "." << std::endl;
+      }
+
+      // Objective functional stuff
+
+      if(epoch % validation_interval == 0)
+      {
+         validation_error = objective_functional_pointer->calculate_validation_error();
+      }
+
+      if(epoch == 0)
+      {
+         validation_error_increment = 0.0;
+      }
+      else
+      {
+         validation_error_increment = validation_error - old_validation_error;
+      }
+
+      gradient_norm = gradient.calculate_norm();
+
+      if(display && gradient_norm >= warning_gradient_norm)
+      {
+         std::cout << "Flood Warning: Gradient norm is " << gradient_norm << "." << std::endl;
+      }
+
+      // Training algorithm stuff
+
+      squared_training_direction_norm = training_direction.dot(training_direction);
+
+      if(success)
+      {
+         Hessian_dot_training_direction = objective_functional_pointer->calculate_vector_dot_Hessian(training_direction);
+
+         curvature = training_direction.dot(Hessian_dot_training_direction);
+      }
+
+      // Scale the curvature
+
+      curvature += (scaling_parameter - lower_scaling_parameter)*squared_training_direction_norm;
+
+      // Make the scaled Hessian positive definite
+
+      if(curvature <= 0.0)
+      {
+         lower_scaling_parameter = 2.0*(scaling_parameter - curvature/squared_training_direction_norm);
+
+         curvature = -curvature + scaling_parameter*squared_training_direction_norm;
+
+         scaling_parameter = lower_scaling_parameter;
+      }
+
+      directional_derivative = -training_direction.dot(gradient);
+
+      training_rate = directional_derivative/curvature;
+
+      // Elapsed time
+
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      int history_index = get_training_history_index(epoch);
+
+      // Training history multilayer perceptron
+
+      if(reserve_parameters_history)
+      {
+         parameters_history[history_index] = parameters;
+      }
+
+      if(reserve_parameters_norm_history)
+      {
+         parameters_norm_history[history_index] = parameters_norm;
+      }
+
+      // Training history objective functional
+
+      if(reserve_evaluation_history)
+      {
+         evaluation_history[history_index] = evaluation;
+      }
+
+      if(reserve_validation_error_history)
+      {
+         if(epoch % validation_interval == 0)
+         {
+            validation_error_history[history_index] = validation_error;
+         }
+         else
+         {
+            validation_error_history[history_index] = -1.0;
+         }
+      }
+
+      if(reserve_gradient_history)
+      {
+         gradient_history[history_index] = gradient;
+      }
+
+      if(reserve_gradient_norm_history)
+      {
+         gradient_norm_history[history_index] = gradient_norm;
+      }
+
+      // Training history training algorithm
+
+      if(reserve_training_direction_history)
+      {
+         training_direction_history[history_index] = training_direction;
+      }
+
+      if(reserve_training_rate_history)
+      {
+         training_rate_history[history_index] = training_rate;
+      }
+
+      if(reserve_elapsed_time_history)
+      {
+         elapsed_time_history[history_index] = elapsed_time;
+      }
+
+      append_training_history(epoch);
+
+      // Stopping Criteria
+
+      // The parameters increment and the evaluation improvement criteria only apply after accepted steps
+
+      if(epoch != 0 && success && parameters_increment_norm <= minimum_parameters_increment_norm)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum parameters increment norm reached." << std::endl
+			          << "Parameters increment norm: " << parameters_increment_norm << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch != 0 && success && evaluation_improvement <= minimum_evaluation_improvement)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum evaluation improvement reached." << std::endl
+                      << "Evaluation improvement: " << evaluation_improvement << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(evaluation <= evaluation_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Evaluation goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(early_stopping && epoch != 0 && validation_error_increment > 0.0)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Validation error stopped improving." << std::endl;
+            std::cout << "Validation error increment: "<< validation_error_increment << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(gradient_norm <= gradient_norm_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Gradient norm goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch == maximum_epochs_number)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum number of epochs reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(elapsed_time >= maximum_time)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum training time reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      if(stop_training)
+      {
+         if(display)
+		 {
+            std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+            std::cout << "Evaluation: " << evaluation << std::endl;
+
+            if(validation_error != 0)
+            {
+               std::cout << "Validation error: " << validation_error << std::endl;
+            }
+
+            std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+            objective_functional_pointer->print_information();
+
+            std::cout << "Training rate: " << training_rate << std::endl
+                      << "Scaling parameter: " << scaling_parameter << std::endl
+                      << "Unsuccessful steps: " << unsuccessful_steps_count << std::endl
+                      << "Elapsed time: " << elapsed_time << std::endl;
+		 }
+
+         finish_training_history(1+epoch);
+
+         break;
+      }
+      else if(display && epoch % display_period == 0)
+      {
+         std::cout << "Epoch " << epoch << ";" << std::endl;
+
+         std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+         std::cout << "Evaluation: " << evaluation << std::endl;
+
+         if(validation_error != 0)
+         {
+            std::cout << "Validation error: " << validation_error << std::endl;
+         }
+
+         std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+         objective_functional_pointer->print_information();
+
+         std::cout << "Training rate: " << training_rate << std::endl
+                   << "Scaling parameter: " << scaling_parameter << std::endl
+                   << "Elapsed time: " << elapsed_time << std::endl;
+      }
+
+      // Update stuff
+
+      old_validation_error = validation_error;
+
+      for(int i = 0; i < parameters_number; i++)
+      {
+         potential_parameters[i] = parameters[i] + training_rate*training_direction[i];
+      }
+
+      multilayer_perceptron_pointer->set_parameters(potential_parameters);
+
+      potential_evaluation = objective_functional_pointer->calculate_evaluation();
+
+      // Compare the actual and the predicted evaluation reductions
+
+      comparison_parameter
+      = 2.0*curvature*(evaluation - potential_evaluation)/(directional_derivative*directional_derivative);
+
+      if(comparison_parameter >= 0.0)
+      {
+         // Accept step
+
+         parameters_increment_norm = fabs(training_rate)*sqrt(squared_training_direction_norm);
+
+         parameters = potential_parameters;
+
+         evaluation_improvement = evaluation - potential_evaluation;
+         evaluation = potential_evaluation;
+
+         old_gradient = gradient;
+         gradient = objective_functional_pointer->calculate_gradient();
+
+         lower_scaling_parameter = 0.0;
+         success = true;
+
+         successful_steps_count++;
+
+         if(comparison_parameter >= 0.75)
+         {
+            scaling_parameter *= 0.25;
+         }
+      }
+      else
+      {
+         // Reject step
+
+         multilayer_perceptron_pointer->set_parameters(parameters);
+
+         lower_scaling_parameter = scaling_parameter;
+         success = false;
+
+         unsuccessful_steps_count++;
+      }
+
+      if(comparison_parameter < 0.25)
+      {
+         scaling_parameter += curvature*(1.0 - comparison_parameter)/squared_training_direction_norm;
+      }
+
+      // Next conjugate direction, restarted each number of parameters accepted steps
+
+      if(success)
+      {
+         if(successful_steps_count % parameters_number == 0)
+         {
+            training_direction = gradient*(-1.0);
+         }
+         else
+         {
+            training_direction = calculate_training_direction(old_gradient, gradient, training_direction);
+
+            if(training_direction.dot(gradient) >= 0.0)
+            {
+               training_direction = gradient*(-1.0);
+            }
+         }
+      }
+   }
+}
+
+
+// void set_reserve_all_training_history(bool) method
+
+/// This method makes the training history of all variables to reseved or not in memory.
+/// The inverse Hessian is never computed by this training algorithm, so its history is not reserved.
+/// @param new_reserve_all_training_history True if the training history of all variables is to be reserved,
+/// false otherwise.
+
+void ScaledConjugateGradient::set_reserve_all_training_history(bool new_reserve_all_training_history)
+{
+   reserve_parameters_history = new_reserve_all_training_history;
+   reserve_parameters_norm_history = new_reserve_all_training_history;
+
+   reserve_evaluation_history = new_reserve_all_training_history;
+   reserve_validation_error_history = new_reserve_all_training_history;
+   reserve_gradient_history = new_reserve_all_training_history;
+   reserve_gradient_norm_history = new_reserve_all_training_history;
+
+   reserve_training_direction_history = new_reserve_all_training_history;
+   reserve_training_rate_history = new_reserve_all_training_history;
+   reserve_elapsed_time_history = new_reserve_all_training_history;
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format.
+/// Only that training history variables which have been reserved are included here.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string ScaledConjugateGradient::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='ScaledConjugateGradient' content='TrainingHistory'>" << std::endl;
+   }
+
+   buffer << TrainingAlgorithm::get_training_history_XML(false);
+
+   return(buffer.str());
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of this scaled conjugate gradient object.
+/// It contains the initial scaling parameter, together with the training parameters, stopping criteria and other
+/// user stuff of the training algorithm base class.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string ScaledConjugateGradient::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='ScaledConjugateGradient'>" << std::endl;
+   }
+
+   // Training parameters
+
+   buffer << "<InitialScalingParameter>" << std::endl
+          << initial_scaling_parameter << std::endl
+          << "</InitialScalingParameter>" << std::endl;
+
+   buffer << TrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads a scaled conjugate gradient object from a XML-type file.
+/// The members of the training algorithm base class are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void ScaledConjugateGradient::load(const char* filename)
+{
+   TrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: ScaledConjugateGradient class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open scaled conjugate gradient object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+	  // Training parameters
+
+	  if(word == "<InitialScalingParameter>")
+	  {
+		 double new_initial_scaling_parameter;
+
+         file >> new_initial_scaling_parameter;
+
+         file >> word;
+
+		 if(word != "</InitialScalingParameter>")
+         {
+            std::cerr << "Flood Error: ScaledConjugateGradient class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown initial scaling parameter end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_initial_scaling_parameter(new_initial_scaling_parameter);
+	  }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,129 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   S C A L E D   C O N J U G A T E   G R A D I E N T   C L A S S   H E A D E R                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __SCALEDCONJUGATEGRADIENT_H__
+#define __SCALEDCONJUGATEGRADIENT_H__
+
+// Flood includes
+
+#include "TrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This concrete class represents the scaled conjugate gradient training algorithm of Moller for an objective
+/// functional of a multilayer perceptron.
+/// The training rate is estimated from the product of the Hessian with the training direction, instead of being
+/// found with a line search.
+/// A Levenberg-Marquardt type scaling parameter keeps that estimate safe when the Hessian is not positive definite
+/// or the quadratic model is poor.
+
+class ScaledConjugateGradient : public TrainingAlgorithm
+{
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit ScaledConjugateGradient(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit ScaledConjugateGradient(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~ScaledConjugateGradient(void);
+
+
+   // METHODS
+
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
+   // Get methods
+
+   double get_initial_scaling_parameter(void);
+
+   double get_scaling_parameter(void);
+   int get_unsuccessful_steps_count(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_initial_scaling_parameter(double);
+
+   // Train methods
+
+   Vector<double> calculate_training_direction(const Vector<double>&, const Vector<double>&, const Vector<double>&);
+
+   void train(void);
+
+   // Training history methods
+
+   void set_reserve_all_training_history(bool);
+
+   std::string get_training_history_XML(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Value of the scaling parameter at the first epoch.
+
+   double initial_scaling_parameter;
+
+   /// Scaling parameter after the last epoch of training.
+   /// It is added to the curvature along the training direction, as in the Levenberg-Marquardt algorithm.
+
+   double scaling_parameter;
+
+   /// Number of epochs of the last training process in which the step was rejected because it did not reduce the
+   /// evaluation.
+
+   int unsuccessful_steps_count;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,1121 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   S T O C H A S T I C   T R A I N I N G   A L G O R I T H M   C L A S S                                      */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+
+// Flood includes
+
+#include "StochasticTrainingAlgorithm.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a stochastic training algorithm object associated to an objective functional
+/// object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+StochasticTrainingAlgorithm::StochasticTrainingAlgorithm(ObjectiveFunctional* new_objective_functional_pointer)
+: TrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a stochastic training algorithm object not associated to any objective
+/// functional object.
+/// It also initializes the class members to their default values.
+
+StochasticTrainingAlgorithm::StochasticTrainingAlgorithm(void) : TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+StochasticTrainingAlgorithm::~StochasticTrainingAlgorithm(void)
+{
+}
+
+
+// METHODS
+
+// LearningRateSchedule get_learning_rate_schedule(void) method
+
+/// This method returns the schedule of the learning rate over the training epochs.
+
+StochasticTrainingAlgorithm::LearningRateSchedule StochasticTrainingAlgorithm::get_learning_rate_schedule(void)
+{
+   return(learning_rate_schedule);
+}
+
+
+// std::string get_learning_rate_schedule_name(void) method
+
+/// This method returns the name of the schedule of the learning rate over the training epochs.
+
+std::string StochasticTrainingAlgorithm::get_learning_rate_schedule_name(void)
+{
+   switch(learning_rate_schedule)
+   {
+      case Constant:
+      {
+         return("Constant");
+	  }
+      break;
+
+      case StepDecay:
+      {
+         return("StepDecay");
+	  }
+      break;
+
+      case ExponentialDecay:
+      {
+         return("ExponentialDecay");
+	  }
+      break;
+
+      case InverseTimeDecay:
+      {
+         return("InverseTimeDecay");
+	  }
+      break;
+
+      case CosineAnnealing:
+      {
+         return("CosineAnnealing");
+	  }
+      break;
+
+	  default:
+      {
+         std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                   << "std::string get_learning_rate_schedule_name(void) method." << std::endl
+                   << "Unknown learning rate schedule." << std::endl;
+
+         exit(1);
+	  }
+      break;
+   }
+}
+
+
+// double get_initial_learning_rate(void) method
+
+/// This method returns the learning rate at the first epoch.
+
+double StochasticTrainingAlgorithm::get_initial_learning_rate(void)
+{
+   return(initial_learning_rate);
+}
+
+
+// double get_learning_rate_decay(void) method
+
+/// This method returns the decay factor of the learning rate schedule.
+
+double StochasticTrainingAlgorithm::get_learning_rate_decay(void)
+{
+   return(learning_rate_decay);
+}
+
+
+// int get_learning_rate_decay_epochs_number(void) method
+
+/// This method returns the number of epochs over which the learning rate schedule applies one decay factor.
+
+int StochasticTrainingAlgorithm::get_learning_rate_decay_epochs_number(void)
+{
+   return(learning_rate_decay_epochs_number);
+}
+
+
+// int get_batch_size(void) method
+
+/// This method returns the number of training instances in each mini-batch.
+
+int StochasticTrainingAlgorithm::get_batch_size(void)
+{
+   return(batch_size);
+}
+
+
+// int get_steps_count(void) method
+
+/// This method returns the number of parameter updates performed since the optimizer state was initialized.
+
+int StochasticTrainingAlgorithm::get_steps_count(void)
+{
+   return(steps_count);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the stochastic training algorithm object to their default values.
+/// The members of the training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Learning rate schedule: Constant
+/// <li> Initial learning rate: 0.01
+/// <li> Learning rate decay: 0.5
+/// <li> Learning rate decay epochs number: 100
+/// <li> Batch size: 32
+/// <li> Minimum evaluation improvement: -1.0e99
+/// </ul>
+/// The minimum evaluation improvement stopping criterion is disabled, since the evaluation does not need to
+/// decrease monotonically with stochastic updates.
+
+void StochasticTrainingAlgorithm::set_default(void)
+{
+   TrainingAlgorithm::set_default();
+
+   // STOPPING CRITERIA
+
+   minimum_evaluation_improvement = -1.0e99;
+
+   // TRAINING OPERATORS
+
+   learning_rate_schedule = Constant;
+
+   // TRAINING PARAMETERS
+
+   initial_learning_rate = 0.01;
+   learning_rate_decay = 0.5;
+   learning_rate_decay_epochs_number = 100;
+
+   batch_size = 32;
+
+   steps_count = 0;
+}
+
+
+// void set_learning_rate_schedule(const LearningRateSchedule&) method
+
+/// This method sets a new schedule of the learning rate over the training epochs.
+/// @param new_learning_rate_schedule Learning rate schedule value.
+
+void StochasticTrainingAlgorithm::set_learning_rate_schedule(const StochasticTrainingAlgorithm::LearningRateSchedule&
+new_learning_rate_schedule)
+{
+   learning_rate_schedule = new_learning_rate_schedule;
+}
+
+
+// void set_learning_rate_schedule(const std::string&) method
+
+/// This method sets a new schedule of the learning rate from a string containing the name.
+/// Possible values are:
+/// <ul>
+/// <li> "Constant"
+/// <li> "StepDecay"
+/// <li> "ExponentialDecay"
+/// <li> "InverseTimeDecay"
+/// <li> "CosineAnnealing"
+/// <ul>
+/// @param new_learning_rate_schedule_name Name of learning rate schedule.
+
+void StochasticTrainingAlgorithm::set_learning_rate_schedule(const std::string& new_learning_rate_schedule_name)
+{
+   if(new_learning_rate_schedule_name == "Constant")
+   {
+      learning_rate_schedule = Constant;
+   }
+   else if(new_learning_rate_schedule_name == "StepDecay")
+   {
+      learning_rate_schedule = StepDecay;
+   }
+   else if(new_learning_rate_schedule_name == "ExponentialDecay")
+   {
+      learning_rate_schedule = ExponentialDecay;
+   }
+   else if(new_learning_rate_schedule_name == "InverseTimeDecay")
+   {
+      learning_rate_schedule = InverseTimeDecay;
+   }
+   else if(new_learning_rate_schedule_name == "CosineAnnealing")
+   {
+      learning_rate_schedule = CosineAnnealing;
+   }
+   else
+   {
+      std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                << "void set_learning_rate_schedule(const std::string&) method." << std::endl
+				<< "Unknown learning rate schedule: " << new_learning_rate_schedule_name << "." <<std::endl;
+
+      exit(1);
+   }
+}
+
+
+// void set_initial_learning_rate(double) method
+
+/// This method sets a new learning rate for the first epoch.
+/// @param new_initial_learning_rate Initial learning rate value. It must be greater than 0.
+
+void StochasticTrainingAlgorithm::set_initial_learning_rate(double new_initial_learning_rate)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_initial_learning_rate <= 0.0)
+   {
+      std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                << "void set_initial_learning_rate(double) method." << std::endl
+                << "Initial learning rate must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   initial_learning_rate = new_initial_learning_rate;
+}
+
+
+// void set_learning_rate_decay(double) method
+
+/// This method sets a new decay factor for the learning rate schedule.
+/// For the step and exponential decay schedules it is the factor by which the learning rate is multiplied every
+/// decay epochs number.
+/// For the inverse time decay schedule it is the rate at which the denominator grows.
+/// @param new_learning_rate_decay Learning rate decay value. It must be equal or greater than 0.
+
+void StochasticTrainingAlgorithm::set_learning_rate_decay(double new_learning_rate_decay)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_learning_rate_decay < 0.0)
+   {
+      std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                << "void set_learning_rate_decay(double) method." << std::endl
+                << "Learning rate decay must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   learning_rate_decay = new_learning_rate_decay;
+}
+
+
+// void set_learning_rate_decay_epochs_number(int) method
+
+/// This method sets a new number of epochs over which the learning rate schedule applies one decay factor.
+/// @param new_learning_rate_decay_epochs_number Learning rate decay epochs number. It must be greater than 0.
+
+void StochasticTrainingAlgorithm::set_learning_rate_decay_epochs_number(int new_learning_rate_decay_epochs_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_learning_rate_decay_epochs_number <= 0)
+   {
+      std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                << "void set_learning_rate_decay_epochs_number(int) method." << std::endl
+                << "Learning rate decay epochs number must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   learning_rate_decay_epochs_number = new_learning_rate_decay_epochs_number;
+}
+
+
+// void set_batch_size(int) method
+
+/// This method sets a new number of training instances in each mini-batch.
+/// A value of zero means that the whole training data set is used in each step.
+/// @param new_batch_size Batch size. It must be equal or greater than 0.
+
+void StochasticTrainingAlgorithm::set_batch_size(int new_batch_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_batch_size < 0)
+   {
+      std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                << "void set_batch_size(int) method." << std::endl
+                << "Batch size must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   batch_size = new_batch_size;
+}
+
+
+// double calculate_learning_rate(int) method
+
+/// This method returns the learning rate at a given epoch according to the learning rate schedule.
+/// With an initial learning rate r, a decay factor d and a decay epochs number k, the schedules are:
+/// <ul>
+/// <li> Constant: r
+/// <li> Step decay: r*d^floor(epoch/k)
+/// <li> Exponential decay: r*d^(epoch/k)
+/// <li> Inverse time decay: r/(1 + d*epoch/k)
+/// <li> Cosine annealing: r*(1 + cos(pi*epoch/maximum_epochs_number))/2
+/// </ul>
+/// @param epoch Training epoch.
+
+double StochasticTrainingAlgorithm::calculate_learning_rate(int epoch)
+{
+   const double pi = 3.1415926535897932384626433832795;
+
+   switch(learning_rate_schedule)
+   {
+      case Constant:
+      {
+         return(initial_learning_rate);
+	  }
+      break;
+
+      case StepDecay:
+      {
+         return(initial_learning_rate*pow(learning_rate_decay, epoch/learning_rate_decay_epochs_number));
+	  }
+      break;
+
+      case ExponentialDecay:
+      {
+         return(initial_learning_rate*pow(learning_rate_decay, (double)epoch/(double)learning_rate_decay_epochs_number));
+	  }
+      break;
+
+      case InverseTimeDecay:
+      {
+         return(initial_learning_rate/(1.0 + learning_rate_decay*(double)epoch/(double)learning_rate_decay_epochs_number));
+	  }
+      break;
+
+      case CosineAnnealing:
+      {
+         if(maximum_epochs_number == 0)
+         {
+            return(initial_learning_rate);
+         }
+         else
+         {
+            return(0.5*initial_learning_rate*(1.0 + cos(pi*(double)epoch/(double)maximum_epochs_number)));
+         }
+	  }
+      break;
+
+	  default:
+      {
+         std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                   << "double calculate_learning_rate(int) method." << std::endl
+                   << "Unknown learning rate schedule." << std::endl;
+
+         exit(1);
+	  }
+      break;
+   }
+}
+
+
+// void train(void) method
+
+/// This method trains a multilayer perceptron with an associated objective functional by stochastic updates of
+/// the parameters.
+/// In each epoch the training instances are shuffled and split into mini-batches, and the parameters are updated
+/// once per mini-batch.
+/// If the objective functional cannot be split into mini-batches, the whole gradient is used in each update.
+/// The evaluation recorded at each epoch is that of the whole training data set, and the gradient recorded is the
+/// mean of the mini-batch gradients in the previous pass.
+/// Training occurs according to the training parameters and stopping criteria.
+
+void StochasticTrainingAlgorithm::train(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(objective_functional_pointer == NULL)
+   {
+      std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Start training
+
+   if(display)
+   {
+      std::cout << "Training with stochastic gradient..." << std::endl;
+   }
+
+   // Multilayer perceptron stuff
+
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
+   Vector<double> old_parameters(parameters_number);
+   double parameters_norm;
+
+   double parameters_increment_norm = 0.0;
+
+   // Objective functional stuff
+
+   double validation_error = 0.0;
+   double old_validation_error = 0.0;
+   double validation_error_increment = 0.0;
+
+   double evaluation = 0.0;
+   double old_evaluation = 0.0;
+   double evaluation_improvement = 0.0;
+
+   Vector<double> gradient(parameters_number);
+   double gradient_norm;
+
+   Vector<double> batch_gradient(parameters_number);
+   Vector<double> mean_gradient(parameters_number, 0.0);
+
+   // Mini-batch stuff
+
+   int training_instances_number = objective_functional_pointer->get_training_instances_number();
+
+   bool mini_batches = (training_instances_number > 0 && batch_size > 0 && batch_size < training_instances_number);
+
+   int actual_batch_size = mini_batches ? batch_size : training_instances_number;
+
+   int batches_number = mini_batches ? (training_instances_number + batch_size - 1)/batch_size : 1;
+
+   int last_batch_size = mini_batches ? training_instances_number - (batches_number-1)*batch_size : 0;
+
+   Vector<int> training_instances_indices(training_instances_number);
+   training_instances_indices.initialize_sequential();
+
+   Vector<int> batch_indices(actual_batch_size);
+   Vector<int> last_batch_indices(last_batch_size);
+
+   int first_index;
+   int swap_index;
+   int swap;
+
+   double batch_weight;
+
+   // Training algorithm stuff
+
+   double learning_rate = 0.0;
+
+   bool stop_training = false;
+
+   double beginning_time = calculate_monotonic_time();
+   double elapsed_time;
+
+   initialize_profiling();
+
+   initialize_optimizer_state(parameters_number);
+
+   initialize_training_history(maximum_epochs_number+1);
+
+   // Main loop
+
+   for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   {
+      // Multilayer perceptron stuff
+
+      parameters_norm = parameters.calculate_norm();
+
+      if(display && parameters_norm >= warning_parameters_norm)
+      {
+         std::cout << "Flood Warning: Parameters norm is " << parameters_norm << "." << std::endl;
+      }
+
+      // Objective functional stuff
+
+      evaluation = objective_functional_pointer->calculate_evaluation();
+
+      if(epoch == 0)
+      {
+         evaluation_improvement = 0.0;
+      }
+      else
+      {
+         evaluation_improvement = old_evaluation - evaluation;
+      }
+
+      if(epoch % validation_interval == 0)
+      {
+         validation_error = objective_functional_pointer->calculate_validation_error();
+      }
+
+      if(epoch == 0)
+      {
+         validation_error_increment = 0.0;
+      }
+      else
+      {
+         validation_error_increment = validation_error - old_validation_error;
+      }
+
+      if(epoch == 0)
+      {
+         gradient = objective_functional_pointer->calculate_gradient();
+      }
+      else
+      {
+         gradient = mean_gradient;
+      }
+
+      gradient_norm = gradient.calculate_norm();
+
+      if(display && gradient_norm >= warning_gradient_norm)
+      {
+         std::cout << "Flood Warning: Gradient norm is " << gradient_norm << "." << std::endl;
+      }
+
+      // Training algorithm stuff
+
+      learning_rate = calculate_learning_rate(epoch);
+
+      // Elapsed time
+
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      int history_index = get_training_history_index(epoch);
+
+      // Training history multilayer perceptron
+
+      if(reserve_parameters_history)
+      {
+         parameters_history[history_index] = parameters;
+      }
+
+      if(reserve_parameters_norm_history)
+      {
+         parameters_norm_history[history_index] = parameters_norm;
+      }
+
+      // Training history objective functional
+
+      if(reserve_evaluation_history)
+      {
+         evaluation_history[history_index] = evaluation;
+      }
+
+      if(reserve_validation_error_history)
+      {
+         if(epoch % validation_interval == 0)
+         {
+            validation_error_history[history_index] = validation_error;
+         }
+         else
+         {
+            validation_error_history[history_index] = -1.0;
+         }
+      }
+
+      if(reserve_gradient_history)
+      {
+         gradient_history[history_index] = gradient;
+      }
+
+      if(reserve_gradient_norm_history)
+      {
+         gradient_norm_history[history_index] = gradient_norm;
+      }
+
+      // Training history training algorithm
+
+      if(reserve_training_rate_history)
+      {
+         training_rate_history[history_index] = learning_rate;
+      }
+
+      if(reserve_elapsed_time_history)
+      {
+         elapsed_time_history[history_index] = elapsed_time;
+      }
+
+      append_training_history(epoch);
+
+      // Stopping Criteria
+
+      if(epoch != 0 && parameters_increment_norm <= minimum_parameters_increment_norm)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum parameters increment norm reached." << std::endl
+			          << "Parameters increment norm: " << parameters_increment_norm << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch != 0 && evaluation_improvement <= minimum_evaluation_improvement)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum evaluation improvement reached." << std::endl
+                      << "Evaluation improvement: " << evaluation_improvement << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(evaluation <= evaluation_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Evaluation goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(early_stopping && epoch != 0 && validation_error_increment > 0.0)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Validation error stopped improving." << std::endl;
+            std::cout << "Validation error increment: "<< validation_error_increment << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(gradient_norm <= gradient_norm_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Gradient norm goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch == maximum_epochs_number)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum number of epochs reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(elapsed_time >= maximum_time)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum training time reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      if(stop_training)
+      {
+         if(display)
+		 {
+            std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+            std::cout << "Evaluation: " << evaluation << std::endl;
+
+            if(validation_error != 0)
+            {
+               std::cout << "Validation error: " << validation_error << std::endl;
+            }
+
+            std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+            objective_functional_pointer->print_information();
+
+            std::cout << "Learning rate: " << learning_rate << std::endl
+                      << "Steps: " << steps_count << std::endl
+                      << "Elapsed time: " << elapsed_time << std::endl;
+		 }
+
+         finish_training_history(1+epoch);
+
+         break;
+      }
+      else if(display && epoch % display_period == 0)
+      {
+         std::cout << "Epoch " << epoch << ";" << std::endl;
+
+         std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+         std::cout << "Evaluation: " << evaluation << std::endl;
+
+         if(validation_error != 0)
+         {
+            std::cout << "Validation error: " << validation_error << std::endl;
+         }
+
+         std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+         objective_functional_pointer->print_information();
+
+         std::cout << "Learning rate: " << learning_rate << std::endl
+                   << "Elapsed time: " << elapsed_time << std::endl;
+      }
+
+      // Update stuff
+
+      old_evaluation = evaluation;
+      old_validation_error = validation_error;
+
+      old_parameters = parameters;
+
+      mean_gradient.initialize(0.0);
+
+      // Shuffle training instances
+
+      if(mini_batches)
+      {
+         for(int i = training_instances_number-1; i > 0; i--)
+         {
+            swap_index = rand()%(i+1);
+
+            swap = training_instances_indices[i];
+            training_instances_indices[i] = training_instances_indices[swap_index];
+            training_instances_indices[swap_index] = swap;
+         }
+      }
+
+      // Pass over the mini-batches
+
+      for(int b = 0; b < batches_number; b++)
+      {
+         if(!mini_batches)
+         {
+            batch_gradient = objective_functional_pointer->calculate_gradient();
+
+            batch_weight = 1.0;
+         }
+         else if(b < batches_number-1)
+         {
+            first_index = b*batch_size;
+
+            for(int i = 0; i < batch_size; i++)
+            {
+               batch_indices[i] = training_instances_indices[first_index+i];
+            }
+
+            objective_functional_pointer->calculate_batch_gradient(batch_indices, batch_gradient);
+
+            batch_weight = (double)batch_size/(double)training_instances_number;
+         }
+         else
+         {
+            first_index = b*batch_size;
+
+            for(int i = 0; i < last_batch_size; i++)
+            {
+               last_batch_indices[i] = training_instances_indices[first_index+i];
+            }
+
+            objective_functional_pointer->calculate_batch_gradient(last_batch_indices, batch_gradient);
+
+            batch_weight = (double)last_batch_size/(double)training_instances_number;
+         }
+
+         for(int i = 0; i < parameters_number; i++)
+         {
+            mean_gradient[i] += batch_weight*batch_gradient[i];
+         }
+
+         update_parameters(parameters, batch_gradient, learning_rate);
+
+         multilayer_perceptron_pointer->set_parameters(parameters);
+      }
+
+      parameters_increment_norm = 0.0;
+
+      for(int i = 0; i < parameters_number; i++)
+      {
+         parameters_increment_norm += (parameters[i] - old_parameters[i])*(parameters[i] - old_parameters[i]);
+      }
+
+      parameters_increment_norm = sqrt(parameters_increment_norm);
+   }
+}
+
+
+// void set_reserve_all_training_history(bool) method
+
+/// This method makes the training history of all variables to reseved or not in memory.
+/// The training rate history contains the learning rate of each epoch.
+/// There is neither training direction nor inverse Hessian in the stochastic training algorithms, so their
+/// histories are not reserved.
+/// @param new_reserve_all_training_history True if the training history of all variables is to be reserved,
+/// false otherwise.
+
+void StochasticTrainingAlgorithm::set_reserve_all_training_history(bool new_reserve_all_training_history)
+{
+   reserve_parameters_history = new_reserve_all_training_history;
+   reserve_parameters_norm_history = new_reserve_all_training_history;
+
+   reserve_evaluation_history = new_reserve_all_training_history;
+   reserve_validation_error_history = new_reserve_all_training_history;
+   reserve_gradient_history = new_reserve_all_training_history;
+   reserve_gradient_norm_history = new_reserve_all_training_history;
+
+   reserve_training_rate_history = new_reserve_all_training_history;
+   reserve_elapsed_time_history = new_reserve_all_training_history;
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of the stochastic training algorithm members.
+/// It contains the learning rate schedule and the batch size, together with the training parameters, stopping
+/// criteria and other user stuff of the training algorithm base class.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string StochasticTrainingAlgorithm::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='StochasticTrainingAlgorithm'>" << std::endl;
+   }
+
+   // Training operators
+
+   buffer << "<LearningRateSchedule>" << std::endl
+   	      << get_learning_rate_schedule_name() << std::endl
+          << "</LearningRateSchedule>" << std::endl;
+
+   // Training parameters
+
+   buffer << "<InitialLearningRate>" << std::endl
+          << initial_learning_rate << std::endl
+          << "</InitialLearningRate>" << std::endl;
+
+   buffer << "<LearningRateDecay>" << std::endl
+          << learning_rate_decay << std::endl
+          << "</LearningRateDecay>" << std::endl;
+
+   buffer << "<LearningRateDecayEpochsNumber>" << std::endl
+          << learning_rate_decay_epochs_number << std::endl
+          << "</LearningRateDecayEpochsNumber>" << std::endl;
+
+   buffer << "<BatchSize>" << std::endl
+          << batch_size << std::endl
+          << "</BatchSize>" << std::endl;
+
+   buffer << TrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads the stochastic training algorithm members from a XML-type file.
+/// The members of the training algorithm base class are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void StochasticTrainingAlgorithm::load(const char* filename)
+{
+   TrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open stochastic training algorithm object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+	  // Training operators
+
+	  if(word == "<LearningRateSchedule>")
+	  {
+		 std::string new_learning_rate_schedule_name;
+
+         file >> new_learning_rate_schedule_name;
+
+         file >> word;
+
+		 if(word != "</LearningRateSchedule>")
+         {
+            std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown learning rate schedule end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_learning_rate_schedule(new_learning_rate_schedule_name);
+	  }
+
+	  // Training parameters
+
+	  else if(word == "<InitialLearningRate>")
+	  {
+		 double new_initial_learning_rate;
+
+         file >> new_initial_learning_rate;
+
+         file >> word;
+
+		 if(word != "</InitialLearningRate>")
+         {
+            std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown initial learning rate end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_initial_learning_rate(new_initial_learning_rate);
+	  }
+
+	  else if(word == "<LearningRateDecay>")
+	  {
+		 double new_learning_rate_decay;
+
+         file >> new_learning_rate_decay;
+
+         file >> word;
+
+		 if(word != "</LearningRateDecay>")
+         {
+            std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown learning rate decay end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_learning_rate_decay(new_learning_rate_decay);
+	  }
+
+	  else if(word == "<LearningRateDecayEpochsNumber>")
+	  {
+		 int new_learning_rate_decay_epochs_number;
+
+         file >> new_learning_rate_decay_epochs_number;
+
+         file >> word;
+
+		 if(word != "</LearningRateDecayEpochsNumber>")
+         {
+            std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown learning rate decay epochs number end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_learning_rate_decay_epochs_number(new_learning_rate_decay_epochs_number);
+	  }
+
+	  else if(word == "<BatchSize>")
+	  {
+		 int new_batch_size;
+
+         file >> new_batch_size;
+
+         file >> word;
+
+		 if(word != "</BatchSize>")
+         {
+            std::cerr << "Flood Error: StochasticTrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown batch size end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_batch_size(new_batch_size);
+	  }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,163 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   S T O C H A S T I C   T R A I N I N G   A L G O R I T H M   C L A S S   H E A D E R                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __STOCHASTICTRAININGALGORITHM_H__
+#define __STOCHASTICTRAININGALGORITHM_H__
+
+// Flood includes
+
+#include "TrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This abstract class represents the concept of stochastic gradient training algorithm for an objective
+/// functional of a multilayer perceptron.
+/// Each epoch is a pass over the training instances, which are shuffled and split into mini-batches.
+/// The parameters are updated after each mini-batch with a learning rate given by a schedule.
+/// Any derived class must implement the initialize_optimizer_state(int) and
+/// update_parameters(Vector<double>&, const Vector<double>&, double) methods.
+
+class StochasticTrainingAlgorithm : public TrainingAlgorithm
+{
+
+public:
+
+   // ENUMERATIONS
+
+   /// Enumeration of the available schedules for the learning rate over the training epochs.
+
+   enum LearningRateSchedule{Constant, StepDecay, ExponentialDecay, InverseTimeDecay, CosineAnnealing};
+
+
+   // GENERAL CONSTRUCTOR
+
+   explicit StochasticTrainingAlgorithm(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit StochasticTrainingAlgorithm(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~StochasticTrainingAlgorithm(void);
+
+
+   // METHODS
+
+   // Get methods
+
+   LearningRateSchedule get_learning_rate_schedule(void);
+   std::string get_learning_rate_schedule_name(void);
+
+   double get_initial_learning_rate(void);
+   double get_learning_rate_decay(void);
+   int get_learning_rate_decay_epochs_number(void);
+
+   int get_batch_size(void);
+
+   int get_steps_count(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_learning_rate_schedule(const LearningRateSchedule&);
+   void set_learning_rate_schedule(const std::string&);
+
+   void set_initial_learning_rate(double);
+   void set_learning_rate_decay(double);
+   void set_learning_rate_decay_epochs_number(int);
+
+   void set_batch_size(int);
+
+   // Train methods
+
+   double calculate_learning_rate(int);
+
+   /// This method sizes and resets the per-parameter state of the optimizer before training.
+
+   virtual void initialize_optimizer_state(int) = 0;
+
+   /// This method updates in place a vector of parameters from a mini-batch gradient and a learning rate.
+
+   virtual void update_parameters(Vector<double>&, const Vector<double>&, double) = 0;
+
+   void train(void);
+
+   // Training history methods
+
+   void set_reserve_all_training_history(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+protected:
+
+   // FIELDS
+
+   /// Schedule of the learning rate over the training epochs.
+
+   LearningRateSchedule learning_rate_schedule;
+
+   /// Learning rate at the first epoch.
+
+   double initial_learning_rate;
+
+   /// Decay factor of the learning rate schedule.
+
+   double learning_rate_decay;
+
+   /// Number of epochs over which the learning rate schedule applies one decay factor.
+
+   int learning_rate_decay_epochs_number;
+
+   /// Number of training instances in each mini-batch.
+   /// The whole training data set is used in each step if it is zero or greater than the number of training
+   /// instances.
+
+   int batch_size;
+
+   /// Number of parameter updates performed since the optimizer state was initialized.
+
+   int steps_count;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
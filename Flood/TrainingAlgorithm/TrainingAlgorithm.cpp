@@ -15,12 +15,23 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <cstdio>
 #include <algorithm>
 #include <functional>
 #include <limits>
 #include <cmath>
 #include <ctime>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#endif
+
 #include "TrainingAlgorithm.h"
 
 namespace Flood
@@ -35,6 +46,9 @@ TrainingAlgorithm::TrainingAlgorithm(ObjectiveFunctional* new_objective_function
 {
    objective_functional_pointer = new_objective_functional_pointer;
 
+   validation_multilayer_perceptron_pointer = NULL;
+   validation_objective_functional_pointer = NULL;
+
    set_default();
 }
 
@@ -47,6 +61,9 @@ TrainingAlgorithm::TrainingAlgorithm(void)
 { 
    objective_functional_pointer = NULL;
 
+   validation_multilayer_perceptron_pointer = NULL;
+   validation_objective_functional_pointer = NULL;
+
    set_default();
 }
 
@@ -57,11 +74,32 @@ TrainingAlgorithm::TrainingAlgorithm(void)
 
 TrainingAlgorithm::~TrainingAlgorithm(void)
 { 
+   delete_validation_replica();
 }
 
 
 // METHODS
 
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new training algorithm object of the same type as this one, with the same members but
+/// associated to another objective functional.
+/// Derived classes which are to be used by multi-start training or other parallel training schemes must redefine
+/// this method.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* TrainingAlgorithm::clone(ObjectiveFunctional*)
+{
+   std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+             << "TrainingAlgorithm* clone(ObjectiveFunctional*) method." << std::endl
+             << "This method is not redefined in the derived class." << std::endl;
+
+   exit(1);
+
+   return(NULL);
+}
+
+
 // ObjectiveFunctional* get_objective_functional_pointer(void) method
 
 /// This method returns a pointer to the objective functional object to which the training algorithm is 
@@ -109,6 +147,12 @@ std::string TrainingAlgorithm::get_training_rate_method_name(void)
 	  }
       break;
 
+      case StrongWolfe:
+      {
+         return("StrongWolfe");
+	  }
+      break;
+
 	  default:
       {
          std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
@@ -152,6 +196,26 @@ double TrainingAlgorithm::get_training_rate_tolerance(void)
 }
 
 
+// double get_sufficient_decrease_parameter(void) method
+
+/// This method returns the constant of the sufficient decrease condition in the strong Wolfe line search.
+
+double TrainingAlgorithm::get_sufficient_decrease_parameter(void)
+{
+   return(sufficient_decrease_parameter);
+}
+
+
+// double get_curvature_parameter(void) method
+
+/// This method returns the constant of the curvature condition in the strong Wolfe line search.
+
+double TrainingAlgorithm::get_curvature_parameter(void)
+{
+   return(curvature_parameter);
+}
+
+
 // double get_warning_parameters_norm(void) method
 
 /// This method returns the minimum value for the norm of the parameters vector at wich a warning message is 
@@ -290,6 +354,134 @@ bool TrainingAlgorithm::get_early_stopping(void)
 }
 
 
+// int get_validation_interval(void) method
+
+/// This method returns the number of epochs between two calculations of the validation error. 
+
+int TrainingAlgorithm::get_validation_interval(void)
+{
+   return(validation_interval);
+}
+
+
+// bool get_asynchronous_validation(void) method
+
+/// This method returns true if the validation error is calculated concurrently with the gradient, and false 
+/// otherwise. 
+
+bool TrainingAlgorithm::get_asynchronous_validation(void)
+{
+   return(asynchronous_validation);
+}
+
+
+// int get_checkpoint_period(void) method
+
+/// This method returns the number of epochs between two checkpoints of the training state. 
+/// Zero means that no checkpoints are saved. 
+
+int TrainingAlgorithm::get_checkpoint_period(void)
+{
+   return(checkpoint_period);
+}
+
+
+// std::string get_checkpoint_filename(void) method
+
+/// This method returns the name of the binary file where the checkpoints of the training state are saved. 
+
+std::string TrainingAlgorithm::get_checkpoint_filename(void)
+{
+   return(checkpoint_filename);
+}
+
+
+// int get_training_history_period(void) method
+
+/// This method returns the number of epochs between two records of the training history. 
+
+int TrainingAlgorithm::get_training_history_period(void)
+{
+   return(training_history_period);
+}
+
+
+// int get_training_history_depth(void) method
+
+/// This method returns the maximum number of records kept in memory for each training history vector. 
+/// Zero means that all the records are kept. 
+
+int TrainingAlgorithm::get_training_history_depth(void)
+{
+   return(training_history_depth);
+}
+
+
+// std::string get_training_history_filename(void) method
+
+/// This method returns the name of the file to which the training history records are appended during training. 
+/// An empty name means that the training history is not written to any file. 
+
+std::string TrainingAlgorithm::get_training_history_filename(void)
+{
+   return(training_history_filename);
+}
+
+
+// bool get_profiling(void) method
+
+/// This method returns true if the time spent in each phase of training is measured, and false otherwise. 
+
+bool TrainingAlgorithm::get_profiling(void)
+{
+   return(profiling);
+}
+
+
+// bool get_reserve_profiling_trace(void) method
+
+/// This method returns true if every timed phase is reserved for a trace, and false otherwise. 
+
+bool TrainingAlgorithm::get_reserve_profiling_trace(void)
+{
+   return(reserve_profiling_trace);
+}
+
+
+// Vector<double>& get_profiling_total_time(void) method
+
+/// This method returns the total time in seconds spent in each phase of the last training process. 
+/// The vector is indexed by the ProfilingPhase enumeration.
+
+Vector<double>& TrainingAlgorithm::get_profiling_total_time(void)
+{
+   return(profiling_total_time);
+}
+
+
+// Vector<int>& get_profiling_calls_number(void) method
+
+/// This method returns the number of timed calls of each phase in the last training process. 
+/// The vector is indexed by the ProfilingPhase enumeration.
+
+Vector<int>& TrainingAlgorithm::get_profiling_calls_number(void)
+{
+   return(profiling_calls_number);
+}
+
+
+// Matrix<int>& get_profiling_histogram(void) method
+
+/// This method returns the histogram of the durations of the calls of each phase in the last training process. 
+/// Each row corresponds to a phase, and each column to a decade of duration, from less than 1 microsecond to 
+/// 10 seconds or more.
+
+Matrix<int>& TrainingAlgorithm::get_profiling_histogram(void)
+{
+   return(profiling_histogram);
+}
+
+
 // bool get_reserve_parameters_history(void) method
 
 /// This method returns true if the parameters history matrix is to be reserved, and false otherwise.
@@ -536,6 +728,8 @@ void TrainingAlgorithm::set(ObjectiveFunctional* new_objective_functional_pointe
 /// <li> Bracketing factor: 1.5
 /// <li> First training rate: 1.0e-2
 /// <li> Training rate tolerance: 1.0e-3
+/// <li> Sufficient decrease parameter: 1.0e-4
+/// <li> Curvature parameter: 0.9
 /// <li> Warning parameters norm: 1.0e6
 /// <li> Warning gradient norm: 1.0e6 
 /// <li> Warning training rate: 1.0e6
@@ -547,6 +741,8 @@ void TrainingAlgorithm::set(ObjectiveFunctional* new_objective_functional_pointe
 /// <li> Evaluation goal: -Inf
 /// <li> Gradient norm goal: 0.0
 /// <li> Early stopping: False
+/// <li> Validation interval: 1
+/// <li> Asynchronous validation: False
 /// <li> Maximum epochs number: 1000
 /// <li> Maximum time: 1000 
 /// <li> Reserve parameters history: False
@@ -576,6 +772,9 @@ void TrainingAlgorithm::set_default(void)
    first_training_rate = 1.0e-2;
    training_rate_tolerance = 1.0e-6;
 
+   sufficient_decrease_parameter = 1.0e-4;
+   curvature_parameter = 0.9;
+
    warning_parameters_norm = 1.0e6;
    warning_gradient_norm = 1.0e6;   
    warning_training_rate = 1.0e6;
@@ -593,6 +792,23 @@ void TrainingAlgorithm::set_default(void)
    gradient_norm_goal = 0.0;
    early_stopping = false;
 
+   validation_interval = 1;
+   asynchronous_validation = false;
+
+   checkpoint_period = 0;
+   checkpoint_filename = "Checkpoint.bin";
+   resume_training = false;
+
+   training_history_period = 1;
+   training_history_depth = 0;
+   training_history_filename = "";
+
+   profiling = false;
+   reserve_profiling_trace = false;
+
+   profiling_beginning_time = 0.0;
+   profiling_trace_size = 0;
+
    maximum_epochs_number = 1000;
    maximum_time = 1000.0;
 
@@ -659,6 +875,10 @@ void TrainingAlgorithm::set_training_rate_method(const std::string& new_training
    {
       training_rate_method = BrentMethod;
    }
+   else if(new_training_rate_method_name == "StrongWolfe")
+   {
+      training_rate_method = StrongWolfe;
+   }
    else
    {
       std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
@@ -752,6 +972,61 @@ void TrainingAlgorithm::set_training_rate_tolerance(double new_training_rate_tol
 }
 
 
+// void set_sufficient_decrease_parameter(double) method
+
+/// This method sets a new constant for the sufficient decrease condition in the strong Wolfe line search. 
+/// @param new_sufficient_decrease_parameter Sufficient decrease constant, between 0 and 1.
+
+void TrainingAlgorithm::set_sufficient_decrease_parameter(double new_sufficient_decrease_parameter)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+                                      
+   if(new_sufficient_decrease_parameter <= 0.0 || new_sufficient_decrease_parameter >= 1.0)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void set_sufficient_decrease_parameter(double) method." << std::endl
+                << "Sufficient decrease parameter must be between 0 and 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   sufficient_decrease_parameter = new_sufficient_decrease_parameter;
+}
+
+
+// void set_curvature_parameter(double) method
+
+/// This method sets a new constant for the curvature condition in the strong Wolfe line search. 
+/// It must be greater than the sufficient decrease parameter. 
+/// Values close to 1 give inexact line searches, which suit quasi-Newton methods; 
+/// values close to 0.1 give more accurate line searches, which suit conjugate gradient methods. 
+/// @param new_curvature_parameter Curvature constant, between 0 and 1.
+
+void TrainingAlgorithm::set_curvature_parameter(double new_curvature_parameter)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+                                      
+   if(new_curvature_parameter <= 0.0 || new_curvature_parameter >= 1.0)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void set_curvature_parameter(double) method." << std::endl
+                << "Curvature parameter must be between 0 and 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   curvature_parameter = new_curvature_parameter;
+}
+
+
 // void set_warning_parameters_norm(double) method
 
 /// This method sets a new value for the parameters vector norm at which a warning message is written to the 
@@ -1088,6 +1363,169 @@ void TrainingAlgorithm::set_early_stopping(bool new_early_stopping)
 }
 
 
+// void set_validation_interval(int) method
+
+/// This method sets the number of epochs between two calculations of the validation error. 
+/// The validation error history holds -1 for the epochs on which the validation error is not calculated. 
+/// @param new_validation_interval Validation interval. It must be greater than zero. 
+
+void TrainingAlgorithm::set_validation_interval(int new_validation_interval)
+{
+   // Control sentence
+
+   if(new_validation_interval <= 0)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void set_validation_interval(int) method." << std::endl
+                << "Validation interval must be greater than zero." << std::endl;
+
+      exit(1);
+   }
+
+   validation_interval = new_validation_interval;
+}
+
+
+// void set_asynchronous_validation(bool) method
+
+/// This method sets whether the validation error is to be calculated concurrently with the gradient or not.
+/// @param new_asynchronous_validation True if the validation error is to be calculated on a copy of the multilayer 
+/// perceptron while the gradient is calculated, false otherwise.
+
+void TrainingAlgorithm::set_asynchronous_validation(bool new_asynchronous_validation)
+{
+   asynchronous_validation = new_asynchronous_validation;
+}
+
+
+// void set_checkpoint_period(int) method
+
+/// This method sets the number of epochs between two checkpoints of the training state. 
+/// @param new_checkpoint_period Checkpoint period. Zero means that no checkpoints are saved. 
+
+void TrainingAlgorithm::set_checkpoint_period(int new_checkpoint_period)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(new_checkpoint_period < 0)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void set_checkpoint_period(int) method." << std::endl
+                << "Checkpoint period must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   checkpoint_period = new_checkpoint_period;
+}
+
+
+// void set_checkpoint_filename(const std::string&) method
+
+/// This method sets the name of the binary file where the checkpoints of the training state are saved, and from 
+/// which training is resumed. 
+/// @param new_checkpoint_filename Checkpoint filename. 
+
+void TrainingAlgorithm::set_checkpoint_filename(const std::string& new_checkpoint_filename)
+{
+   checkpoint_filename = new_checkpoint_filename;
+}
+
+
+// void set_training_history_period(int) method
+
+/// This method sets the number of epochs between two records of the training history. 
+/// @param new_training_history_period Training history period. It must be equal or greater than 1. 
+
+void TrainingAlgorithm::set_training_history_period(int new_training_history_period)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(new_training_history_period < 1)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void set_training_history_period(int) method." << std::endl
+                << "Training history period must be equal or greater than 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   training_history_period = new_training_history_period;
+}
+
+
+// void set_training_history_depth(int) method
+
+/// This method sets the maximum number of records kept in memory for each training history vector. 
+/// @param new_training_history_depth Training history depth. Zero means that all the records are kept. 
+
+void TrainingAlgorithm::set_training_history_depth(int new_training_history_depth)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG 
+
+   if(new_training_history_depth < 0)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void set_training_history_depth(int) method." << std::endl
+                << "Training history depth must be equal or greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   training_history_depth = new_training_history_depth;
+}
+
+
+// void set_training_history_filename(const std::string&) method
+
+/// This method sets the name of the comma-separated values file to which the training history records are 
+/// appended during training. 
+/// @param new_training_history_filename Training history filename. An empty name means no file. 
+
+void TrainingAlgorithm::set_training_history_filename(const std::string& new_training_history_filename)
+{
+   training_history_filename = new_training_history_filename;
+}
+
+
+// void set_profiling(bool) method
+
+/// This method sets whether the time spent in each phase of training is to be measured or not. 
+/// The profiling counters are only allocated when profiling is enabled. 
+/// @param new_profiling True if the training phases are to be timed, false otherwise.
+
+void TrainingAlgorithm::set_profiling(bool new_profiling)
+{
+   profiling = new_profiling;
+
+   initialize_profiling();
+}
+
+
+// void set_reserve_profiling_trace(bool) method
+
+/// This method sets whether the beginning and the duration of every timed phase are to be reserved in memory, 
+/// so that they can be saved as a trace after training. 
+/// @param new_reserve_profiling_trace True if the profiling trace is to be reserved, false otherwise.
+
+void TrainingAlgorithm::set_reserve_profiling_trace(bool new_reserve_profiling_trace)
+{
+   reserve_profiling_trace = new_reserve_profiling_trace;
+}
+
+
 // void set_reserve_parameters_history(bool) method
 
 /// This method makes the parameters history vector of vectors to be reseved or not in memory.
@@ -1356,38 +1794,169 @@ void TrainingAlgorithm::set_display(bool new_display)
 }
 
 
-// Vector<double> calculate_training_rate_evaluation(double, const Vector<double>&, double) method
+// void resume(void) method
 
-/// This method returns a vector with two elements, the training rate calculated by means of the training rate
-/// object member, and the evaluation for that training rate. 
-/// @param evaluation Initial objective function evaluation.
-/// @param training_direction Initial training direction.
-/// @param initial_training_rate Initial training rate to start the algorithm. 
+/// This method continues the training process from the state saved in the checkpoint file, as if it had not been 
+/// interrupted after the epoch of the checkpoint. 
+/// The multilayer perceptron, the objective functional and the settings of the training algorithm must be the same 
+/// as those of the training process which saved the checkpoint. 
+/// Training algorithms which save checkpoints must redefine this method. 
 
-Vector<double> TrainingAlgorithm::calculate_training_rate_evaluation
-(double evaluation, const Vector<double>& training_direction, double initial_training_rate)
+void TrainingAlgorithm::resume(void)
 {
-   Vector<double> training_rate_evaluation(2);
+   std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+             << "void resume(void) method." << std::endl
+             << "This training algorithm cannot resume training from a checkpoint." << std::endl;
 
-   // Get training rate
+   exit(1);
+}
 
-   switch(training_rate_method)
-   {
+
+// Vector<double> calculate_gradient_validation_error(double&) method
+
+/// This method returns the objective function gradient and calculates the validation error, both for the current 
+/// parameters of the multilayer perceptron. 
+/// If asynchronous validation is set and the library is compiled with OpenMP, the validation error is calculated on 
+/// a copy of the multilayer perceptron and the objective functional, in a second thread, while the gradient is 
+/// calculated, so that the validation pass is taken off the critical path of the epoch.
+/// That copy is created by the first call of a training process, and only its parameters are updated afterwards. 
+/// Training algorithms which call this method must call the delete_validation_replica method at the end of training.
+/// @param validation_error Validation error for the current parameters.
+
+Vector<double> TrainingAlgorithm::calculate_gradient_validation_error(double& validation_error)
+{
+   Vector<double> gradient;
+
+   #ifdef _OPENMP
+
+   if(asynchronous_validation)
+   {
+      // The validation error is calculated on a snapshot of the multilayer perceptron
+
+      MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+      if(validation_objective_functional_pointer == NULL)
+      {
+         validation_multilayer_perceptron_pointer = multilayer_perceptron_pointer->clone();
+
+         validation_objective_functional_pointer = objective_functional_pointer->clone(validation_multilayer_perceptron_pointer);
+      }
+      else
+      {
+         validation_multilayer_perceptron_pointer->set_parameters(multilayer_perceptron_pointer->get_parameters());
+      }
+
+      // Only the gradient is timed, as the validation error is calculated meanwhile
+
+      begin_profiling_phase(GradientPhase);
+
+      // Nested parallelism lets a numerical differentiation gradient use several threads within its section
+
+      int max_active_levels = omp_get_max_active_levels();
+
+      if(max_active_levels < 2)
+      {
+         omp_set_max_active_levels(2);
+      }
+
+      #pragma omp parallel sections num_threads(2)
+      {
+         #pragma omp section
+         {
+            validation_error = validation_objective_functional_pointer->calculate_validation_error();
+         }
+
+         #pragma omp section
+         {
+            gradient = objective_functional_pointer->calculate_gradient();
+         }
+      }
+
+      omp_set_max_active_levels(max_active_levels);
+
+      end_profiling_phase(GradientPhase);
+
+      return(gradient);
+   }
+
+   #endif
+
+   begin_profiling_phase(ValidationPhase);
+
+   validation_error = objective_functional_pointer->calculate_validation_error();
+
+   end_profiling_phase(ValidationPhase);
+
+   begin_profiling_phase(GradientPhase);
+
+   gradient = objective_functional_pointer->calculate_gradient();
+
+   end_profiling_phase(GradientPhase);
+
+   return(gradient);
+}
+
+
+// void delete_validation_replica(void) method
+
+/// This method deletes the copies of the multilayer perceptron and the objective functional on which the validation 
+/// error is calculated asynchronously, if any. 
+/// It is called at the end of each training process, so that the next one makes new copies. 
+
+void TrainingAlgorithm::delete_validation_replica(void)
+{
+   delete validation_objective_functional_pointer;
+   delete validation_multilayer_perceptron_pointer;
+
+   validation_objective_functional_pointer = NULL;
+   validation_multilayer_perceptron_pointer = NULL;
+}
+
+
+// Vector<double> calculate_training_rate_evaluation(double, const Vector<double>&, double) method
+
+/// This method returns a vector with two elements, the training rate calculated by means of the training rate
+/// object member, and the evaluation for that training rate. 
+/// @param evaluation Initial objective function evaluation.
+/// @param training_direction Initial training direction.
+/// @param initial_training_rate Initial training rate to start the algorithm. 
+
+Vector<double> TrainingAlgorithm::calculate_training_rate_evaluation
+(double evaluation, const Vector<double>& training_direction, double initial_training_rate)
+{
+   Vector<double> training_rate_evaluation(2);
+
+   begin_profiling_phase(LineSearchPhase);
+
+   // Get training rate
+
+   switch(training_rate_method)
+   {
       case TrainingAlgorithm::Fixed:
       {
-         return(calculate_fixed_training_rate_evaluation(evaluation, training_direction, initial_training_rate));
+         training_rate_evaluation 
+         = calculate_fixed_training_rate_evaluation(evaluation, training_direction, initial_training_rate);
       }
       break;
 
       case TrainingAlgorithm::GoldenSection:
       {
-         return(calculate_golden_section_training_rate_evaluation(evaluation, training_direction, initial_training_rate));
+         training_rate_evaluation 
+         = calculate_golden_section_training_rate_evaluation(evaluation, training_direction, initial_training_rate);
       }
       break;
 
       case TrainingAlgorithm::BrentMethod:
       {
-         return(calculate_Brent_method_training_rate_evaluation(evaluation, training_direction, initial_training_rate));
+         training_rate_evaluation 
+         = calculate_Brent_method_training_rate_evaluation(evaluation, training_direction, initial_training_rate);
+      }
+      break;
+
+      case TrainingAlgorithm::StrongWolfe:
+      {
+         training_rate_evaluation 
+         = calculate_strong_Wolfe_training_rate_evaluation(evaluation, training_direction, initial_training_rate);
       }
       break;
 
@@ -1400,6 +1969,42 @@ Vector<double> TrainingAlgorithm::calculate_training_rate_evaluation
          exit(1); 	  
 	  }
    }
+
+   end_profiling_phase(LineSearchPhase);
+
+   return(training_rate_evaluation);
+}
+
+
+// Vector<double> calculate_training_rate_evaluation(double, const Vector<double>&, const Vector<double>&, double) method
+
+/// This method returns a vector with two elements, the training rate calculated by means of the training rate
+/// object member, and the evaluation for that training rate. 
+/// The gradient at the current parameters is only used by the strong Wolfe line search, which then does not need to 
+/// compute it again. 
+/// @param evaluation Initial objective function evaluation.
+/// @param gradient Initial objective function gradient.
+/// @param training_direction Initial training direction.
+/// @param initial_training_rate Initial training rate to start the algorithm. 
+
+Vector<double> TrainingAlgorithm::calculate_training_rate_evaluation
+(double evaluation, const Vector<double>& gradient, const Vector<double>& training_direction, double initial_training_rate)
+{
+   if(training_rate_method == StrongWolfe)
+   {
+      begin_profiling_phase(LineSearchPhase);
+
+      Vector<double> training_rate_evaluation 
+      = calculate_strong_Wolfe_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate);
+
+      end_profiling_phase(LineSearchPhase);
+
+      return(training_rate_evaluation);
+   }
+   else
+   {
+      return(calculate_training_rate_evaluation(evaluation, training_direction, initial_training_rate));
+   }
 }
 
 
@@ -1408,6 +2013,11 @@ Vector<double> TrainingAlgorithm::calculate_training_rate_evaluation
 /// This method returns a vector with two elements, a bracketing training rate for the optimum, 
 /// and the evaluation for that training rate. 
 /// This algorithm is used by line minimization algorithms. 
+/// Only whether a trial evaluation is smaller than the initial one matters while bracketing, so the trial 
+/// evaluations are bounded by the initial evaluation, and the objective functional may give up any of them as soon 
+/// as it is known to be larger. 
+/// The evaluation returned is then only a lower bound greater than the initial evaluation, which the line 
+/// minimization algorithms do not use but to compare with smaller evaluations. 
 /// @param evaluation Initial objective function evaluation.
 /// @param training_direction Initial training direction.
 /// @param initial_training_rate Initial training rate to start the algorithm. 
@@ -1436,7 +2046,7 @@ Vector<double> TrainingAlgorithm::calculate_bracketing_training_rate_evaluation
 
    potential_parameters = parameters + parameters_increment;
 
-   double bracketing_evaluation = objective_functional_pointer->calculate_potential_evaluation(potential_parameters);
+   double bracketing_evaluation = objective_functional_pointer->calculate_potential_evaluation(potential_parameters, evaluation);
 
    // Find initial interval where minimum evaluation occurs
 
@@ -1469,7 +2079,7 @@ Vector<double> TrainingAlgorithm::calculate_bracketing_training_rate_evaluation
 
       potential_parameters = parameters + parameters_increment;
 
-      bracketing_evaluation = objective_functional_pointer->calculate_potential_evaluation(potential_parameters);
+      bracketing_evaluation = objective_functional_pointer->calculate_potential_evaluation(potential_parameters, evaluation);
    }
 
    // Return vector
@@ -1947,169 +2557,538 @@ Vector<double> TrainingAlgorithm::calculate_Brent_method_training_rate_evaluatio
 }
 
 
-// std::string to_XML(bool) method
+// Vector<double> calculate_strong_Wolfe_training_rate_evaluation(double, const Vector<double>&, double) method
 
-/// This method returns a default string representation in XML-type format of the training algorithm object.
-/// This containts the training operators, the training parameters, stopping criteria and other stuff.
-/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+/// This method returns a vector with two elements, a training rate which satisfies the strong Wolfe conditions, 
+/// and the evaluation for that training rate. 
+/// It first computes the objective function gradient at the current parameters. 
+/// @param evaluation Initial objective function evaluation.
+/// @param training_direction Training direction vector.
+/// @param initial_training_rate Initial training rate in line minimization.
 
-std::string TrainingAlgorithm::to_XML(bool show_declaration)
+Vector<double> TrainingAlgorithm::calculate_strong_Wolfe_training_rate_evaluation
+(double evaluation, const Vector<double>& training_direction, double initial_training_rate)
 {
-   std::stringstream buffer;
+   Vector<double> gradient = objective_functional_pointer->calculate_gradient();
 
-   // Declaration
+   return(calculate_strong_Wolfe_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate));
+}
 
-   if(show_declaration)
-   {
-      buffer << "<Flood version='3.0' class='TrainingAlgorithm'>" << std::endl;
-   }
 
-   // Training operators
+// Vector<double> calculate_strong_Wolfe_training_rate_evaluation(double, const Vector<double>&, const Vector<double>&, double) method
 
-   buffer << "<TrainingRateMethod>" << std::endl
-   	      << get_training_rate_method_name() << std::endl
-          << "</TrainingRateMethod>" << std::endl;
+/// This method returns a vector with two elements, a training rate which satisfies the strong Wolfe conditions, 
+/// and the evaluation for that training rate. 
+/// It follows the More-Thuente approach: a bracketing phase, which extrapolates the training rate until an interval 
+/// containing acceptable points is found, and a zoom phase, which shrinks that interval. 
+/// New trial points are the minimizers of the cubics interpolating the evaluations and the directional derivatives 
+/// at the interval ends, safeguarded with bisection. 
+/// Each trial point costs one evaluation and one gradient, which are calculated by separate calls to the objective 
+/// functional. For errors measured on a data set that means two passes over the training instances per trial point. 
+/// The first trial point is usually accepted when the initial training rate is a natural step length. 
+/// The gradient at the training rate found is stored in the training rate gradient member. 
+/// If no point satisfies the sufficient decrease condition, the training rate returned is zero.
+/// @param evaluation Initial objective function evaluation.
+/// @param gradient Initial objective function gradient.
+/// @param training_direction Training direction vector.
+/// @param initial_training_rate Initial training rate in line minimization.
 
-   // Training parameters
+Vector<double> TrainingAlgorithm::calculate_strong_Wolfe_training_rate_evaluation
+(double evaluation, const Vector<double>& gradient, const Vector<double>& training_direction, double initial_training_rate)
+{
+   // Multilayer perceptron
 
-   buffer << "<BracketingFactor> " << std::endl
-          << bracketing_factor << std::endl
-		  << "</BracketingFactor> " << std::endl;
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
 
-   buffer << "<FirstTrainingRate> " << std::endl
-          << first_training_rate << std::endl
-		  << "</FirstTrainingRate> " << std::endl;
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
-   buffer << "<TrainingRateTolerance>" << std::endl
-          << training_rate_tolerance << std::endl
-          << "</TrainingRateTolerance>" << std::endl;
+   // Control sentence (if debug)
 
-   buffer << "<WarningParametersNorm>" << std::endl
-          << warning_parameters_norm << std::endl
-          << "</WarningParametersNorm>" << std::endl;
+   #ifdef _DEBUG 
 
-   buffer << "<WarningGradientNorm>" << std::endl
-          << warning_gradient_norm << std::endl
-          << "</WarningGradientNorm>" << std::endl;
+   if(gradient.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "Vector<double> calculate_strong_Wolfe_training_rate_evaluation(double, const Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Size of gradient must be equal to number of parameters." << std::endl;
 
-   buffer << "<WarningTrainingRate>" << std::endl
-          << warning_training_rate << std::endl
-          << "</WarningTrainingRate>" << std::endl;
+      exit(1);
+   }
+   else if(training_direction.get_size() != parameters_number)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "Vector<double> calculate_strong_Wolfe_training_rate_evaluation(double, const Vector<double>&, const Vector<double>&, double) method." << std::endl
+                << "Size of training direction must be equal to number of parameters." << std::endl;
 
-   buffer << "<ErrorParametersNorm>" << std::endl
-          << error_parameters_norm << std::endl
-          << "</ErrorParametersNorm>" << std::endl;
+      exit(1);
+   }
 
-   buffer << "<ErrorGradientNorm>" << std::endl
-          << error_gradient_norm << std::endl
-          << "</ErrorGradientNorm>" << std::endl;
+   #endif
 
-   buffer << "<ErrorTrainingRate>" << std::endl
-          << error_training_rate << std::endl
-          << "</ErrorTrainingRate>" << std::endl;
+   Vector<double> parameters = multilayer_perceptron_pointer->get_parameters();
 
-   // Stopping criteria
+   Vector<double> potential_parameters(parameters_number);
 
-   buffer << "<MinimumParametersIncrementNorm>" << std::endl
-          << minimum_parameters_increment_norm << std::endl
-          << "</MinimumParametersIncrementNorm>" << std::endl;
+   Vector<double> training_rate_evaluation(2);
 
-   buffer << "<MinimumEvaluationImprovement>" << std::endl
-          << minimum_evaluation_improvement << std::endl
-          << "</MinimumEvaluationImprovement>" << std::endl;
+   const int maximum_iterations_number = 50;
 
-   buffer << "<EvaluationGoal>" << std::endl
-          << evaluation_goal << std::endl
-          << "</EvaluationGoal>" << std::endl;
+   // Initial slope
 
-   buffer << "<GradientNormGoal>" << std::endl
-          << gradient_norm_goal << std::endl
-          << "</GradientNormGoal>" << std::endl;
+   double initial_slope = gradient.dot(training_direction);
 
-   buffer << "<MaximumEpochsNumber>" << std::endl
-          << maximum_epochs_number << std::endl 
-		  << "</MaximumEpochsNumber>" << std::endl;
+   training_rate_gradient = gradient;
 
-   buffer << "<MaximumTime>" << std::endl
-          << maximum_time << std::endl 
-          << "</MaximumTime>" << std::endl;
- 
-   // Early stopping
+   if(initial_slope >= 0.0)
+   {
+      training_rate_evaluation[0] = 0.0;
+      training_rate_evaluation[1] = evaluation;
 
-   buffer << "<EarlyStopping>" << std::endl
-          << early_stopping << std::endl 
-          << "</EarlyStopping>" << std::endl;
-  
-   // Reserve training history
+      return(training_rate_evaluation);
+   }
 
-   buffer << "<ReserveParametersHistory>" << std::endl
-          << reserve_parameters_history << std::endl 
-          << "</ReserveParametersHistory>" << std::endl;
+   // Low and high ends of the interval to be zoomed
 
-   buffer << "<ReserveParametersNormHistory>" << std::endl
-          << reserve_parameters_norm_history << std::endl 
-		  << "</ReserveParametersNormHistory>" << std::endl;
+   double low_training_rate = 0.0;
+   double low_evaluation = evaluation;
+   double low_slope = initial_slope;
+   Vector<double> low_gradient = gradient;
 
-   buffer << "<ReserveEvaluationHistory>" << std::endl
-          << reserve_evaluation_history << std::endl 
-          << "</ReserveEvaluationHistory>" << std::endl;
+   double high_training_rate = 0.0;
+   double high_evaluation = evaluation;
+   double high_slope = initial_slope;
 
-   buffer << "<ReserveGradientHistory>" << std::endl
-          << reserve_gradient_history << std::endl
-          << "</ReserveGradientHistory>" << std::endl;
+   // Trial point
 
-   buffer << "<ReserveGradientNormHistory>" << std::endl
-          << reserve_gradient_norm_history << std::endl 
-          << "</ReserveGradientNormHistory>" << std::endl;
+   double training_rate = initial_training_rate > 0.0 ? initial_training_rate : first_training_rate;
+   double trial_evaluation;
+   double trial_slope;
+   Vector<double> trial_gradient(parameters_number);
 
-   buffer << "<ReserveInverseHessianHistory>" << std::endl
-          << reserve_inverse_Hessian_history << std::endl 
-          << "</ReserveInverseHessianHistory>" << std::endl;
+   bool bracketed = false;
 
-   buffer << "<ReserveTrainingDirectionHistory>" << std::endl
-          << reserve_training_direction_history << std::endl 
-          << "</ReserveTrainingDirectionHistory>" << std::endl;
+   // Bracketing phase 
 
-   buffer << "<ReserveTrainingRateHistory>"  << std::endl
-          << reserve_training_rate_history << std::endl
-          << "</ReserveTrainingRateHistory>"  << std::endl;
+   for(int i = 0; i < maximum_iterations_number; i++)
+   {
+      potential_parameters = parameters + training_direction*training_rate;
 
-   buffer << "<ReserveElapsedTimeHistory>" << std::endl
-          << reserve_elapsed_time_history << std::endl 
-          << "</ReserveElapsedTimeHistory>" << std::endl;
+      trial_evaluation = objective_functional_pointer->calculate_potential_evaluation(potential_parameters);
+      trial_gradient = objective_functional_pointer->calculate_potential_gradient(potential_parameters);
+      trial_slope = trial_gradient.dot(training_direction);
 
-   buffer << "<ReserveValidationErrorHistory>" << std::endl
-          << reserve_validation_error_history << std::endl 
-          << "</ReserveValidationErrorHistory>" << std::endl;
+      if(trial_evaluation > evaluation + sufficient_decrease_parameter*training_rate*initial_slope 
+      || (i > 0 && trial_evaluation >= low_evaluation))
+      {
+         high_training_rate = training_rate;
+         high_evaluation = trial_evaluation;
+         high_slope = trial_slope;
 
-   // User stuff
+         bracketed = true;
 
-   buffer << "<Display>" << std::endl
-          << display << std::endl
-		  << "</Display>" << std::endl;
+         break;
+      }
+      else if(fabs(trial_slope) <= -curvature_parameter*initial_slope)
+      {
+         training_rate_gradient = trial_gradient;
 
-   buffer << "<DisplayPeriod>" << std::endl
-          << display_period << std::endl
-		  << "</DisplayPeriod>" << std::endl;
+         training_rate_evaluation[0] = training_rate;
+         training_rate_evaluation[1] = trial_evaluation;
 
-   return(buffer.str());
-}
+         return(training_rate_evaluation);
+      }
+      else if(trial_slope >= 0.0)
+      {
+         high_training_rate = low_training_rate;
+         high_evaluation = low_evaluation;
+         high_slope = low_slope;
 
+         low_training_rate = training_rate;
+         low_evaluation = trial_evaluation;
+         low_slope = trial_slope;
+         low_gradient = trial_gradient;
 
-// void print(void) method
+         bracketed = true;
 
-/// This method prints to the screen the XML-type representation of the training algorithm object. 
+         break;
+      }
 
-void TrainingAlgorithm::print(void)
-{
-   std::cout << to_XML(true);
-}
+      // Extrapolate the training rate
 
+      double next_training_rate = calculate_cubic_interpolation_training_rate
+      (low_training_rate, low_evaluation, low_slope, training_rate, trial_evaluation, trial_slope);
 
-// void save(const char*) method
+      double minimum_next_training_rate = training_rate + 1.1*(training_rate - low_training_rate);
+      double maximum_next_training_rate = training_rate + 4.0*(training_rate - low_training_rate);
 
-/// This method saves to a XML-type file the members of the training algorithm object. 
-/// @param filename Name of training algorithm XML-type file. 
+      if(!(next_training_rate >= minimum_next_training_rate))
+      {
+         next_training_rate = minimum_next_training_rate;
+      }
+      else if(next_training_rate > maximum_next_training_rate)
+      {
+         next_training_rate = maximum_next_training_rate;
+      }
+
+      low_training_rate = training_rate;
+      low_evaluation = trial_evaluation;
+      low_slope = trial_slope;
+      low_gradient = trial_gradient;
+
+      training_rate = next_training_rate;
+
+      if(training_rate >= error_training_rate)
+      {
+         std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                   << "Vector<double> calculate_strong_Wolfe_training_rate_evaluation(double, const Vector<double>&, const Vector<double>&, double) method." << std::endl
+                   << "Unable to bracket a minimum." << std::endl;
+                 
+         exit(1);
+      }
+      else if(display && training_rate >= warning_training_rate)
+      {
+         std::cout << "Flood Warning: Training rate is " << training_rate << std::endl;
+      }
+   }
+
+   // Zoom phase
+
+   if(bracketed)
+   {
+      for(int i = 0; i < maximum_iterations_number; i++)
+      {
+         double minimum_training_rate = low_training_rate < high_training_rate ? low_training_rate : high_training_rate;
+         double maximum_training_rate = low_training_rate < high_training_rate ? high_training_rate : low_training_rate;
+
+         double interval_width = maximum_training_rate - minimum_training_rate;
+
+         if(interval_width <= training_rate_tolerance)
+         {
+            break;
+         }
+
+         training_rate = calculate_cubic_interpolation_training_rate
+         (low_training_rate, low_evaluation, low_slope, high_training_rate, high_evaluation, high_slope);
+
+         if(!(training_rate >= minimum_training_rate + 0.1*interval_width 
+         && training_rate <= maximum_training_rate - 0.1*interval_width))
+         {
+            training_rate = 0.5*(low_training_rate + high_training_rate);
+         }
+
+         potential_parameters = parameters + training_direction*training_rate;
+
+         trial_evaluation = objective_functional_pointer->calculate_potential_evaluation(potential_parameters);
+         trial_gradient = objective_functional_pointer->calculate_potential_gradient(potential_parameters);
+         trial_slope = trial_gradient.dot(training_direction);
+
+         if(trial_evaluation > evaluation + sufficient_decrease_parameter*training_rate*initial_slope 
+         || trial_evaluation >= low_evaluation)
+         {
+            high_training_rate = training_rate;
+            high_evaluation = trial_evaluation;
+            high_slope = trial_slope;
+         }
+         else
+         {
+            if(fabs(trial_slope) <= -curvature_parameter*initial_slope)
+            {
+               training_rate_gradient = trial_gradient;
+
+               training_rate_evaluation[0] = training_rate;
+               training_rate_evaluation[1] = trial_evaluation;
+
+               return(training_rate_evaluation);
+            }
+
+            if(trial_slope*(high_training_rate - low_training_rate) >= 0.0)
+            {
+               high_training_rate = low_training_rate;
+               high_evaluation = low_evaluation;
+               high_slope = low_slope;
+            }
+
+            low_training_rate = training_rate;
+            low_evaluation = trial_evaluation;
+            low_slope = trial_slope;
+            low_gradient = trial_gradient;
+         }
+      }
+   }
+
+   // Best training rate found which satisfies the sufficient decrease condition
+
+   training_rate_gradient = low_gradient;
+
+   training_rate_evaluation[0] = low_training_rate;
+   training_rate_evaluation[1] = low_evaluation;
+
+   return(training_rate_evaluation);
+}
+
+
+// double calculate_cubic_interpolation_training_rate(double, double, double, double, double, double) method
+
+/// This method returns the minimizer of the cubic polynomial which interpolates the evaluations and the directional 
+/// derivatives at two training rates. 
+/// If the cubic has no minimizer, it returns the midpoint of both training rates. 
+/// @param training_rate_a First training rate. 
+/// @param evaluation_a Evaluation at the first training rate. 
+/// @param slope_a Directional derivative at the first training rate. 
+/// @param training_rate_b Second training rate. 
+/// @param evaluation_b Evaluation at the second training rate. 
+/// @param slope_b Directional derivative at the second training rate. 
+
+double TrainingAlgorithm::calculate_cubic_interpolation_training_rate
+(double training_rate_a, double evaluation_a, double slope_a, double training_rate_b, double evaluation_b, double slope_b)
+{
+   double midpoint = 0.5*(training_rate_a + training_rate_b);
+
+   if(training_rate_a == training_rate_b)
+   {
+      return(midpoint);
+   }
+
+   double d1 = slope_a + slope_b - 3.0*(evaluation_a - evaluation_b)/(training_rate_a - training_rate_b);
+
+   double radicand = d1*d1 - slope_a*slope_b;
+
+   if(radicand < 0.0)
+   {
+      return(midpoint);
+   }
+
+   double d2 = sqrt(radicand);
+
+   if(training_rate_b < training_rate_a)
+   {
+      d2 = -d2;
+   }
+
+   double denominator = slope_b - slope_a + 2.0*d2;
+
+   if(fabs(denominator) < 1.0e-99)
+   {
+      return(midpoint);
+   }
+
+   return(training_rate_b - (training_rate_b - training_rate_a)*(slope_b + d2 - d1)/denominator);
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a default string representation in XML-type format of the training algorithm object.
+/// This containts the training operators, the training parameters, stopping criteria and other stuff.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string TrainingAlgorithm::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='TrainingAlgorithm'>" << std::endl;
+   }
+
+   // Training operators
+
+   buffer << "<TrainingRateMethod>" << std::endl
+   	      << get_training_rate_method_name() << std::endl
+          << "</TrainingRateMethod>" << std::endl;
+
+   // Training parameters
+
+   buffer << "<BracketingFactor> " << std::endl
+          << bracketing_factor << std::endl
+		  << "</BracketingFactor> " << std::endl;
+
+   buffer << "<FirstTrainingRate> " << std::endl
+          << first_training_rate << std::endl
+		  << "</FirstTrainingRate> " << std::endl;
+
+   buffer << "<TrainingRateTolerance>" << std::endl
+          << training_rate_tolerance << std::endl
+          << "</TrainingRateTolerance>" << std::endl;
+
+   buffer << "<SufficientDecreaseParameter>" << std::endl
+          << sufficient_decrease_parameter << std::endl
+          << "</SufficientDecreaseParameter>" << std::endl;
+
+   buffer << "<CurvatureParameter>" << std::endl
+          << curvature_parameter << std::endl
+          << "</CurvatureParameter>" << std::endl;
+
+   buffer << "<WarningParametersNorm>" << std::endl
+          << warning_parameters_norm << std::endl
+          << "</WarningParametersNorm>" << std::endl;
+
+   buffer << "<WarningGradientNorm>" << std::endl
+          << warning_gradient_norm << std::endl
+          << "</WarningGradientNorm>" << std::endl;
+
+   buffer << "<WarningTrainingRate>" << std::endl
+          << warning_training_rate << std::endl
+          << "</WarningTrainingRate>" << std::endl;
+
+   buffer << "<ErrorParametersNorm>" << std::endl
+          << error_parameters_norm << std::endl
+          << "</ErrorParametersNorm>" << std::endl;
+
+   buffer << "<ErrorGradientNorm>" << std::endl
+          << error_gradient_norm << std::endl
+          << "</ErrorGradientNorm>" << std::endl;
+
+   buffer << "<ErrorTrainingRate>" << std::endl
+          << error_training_rate << std::endl
+          << "</ErrorTrainingRate>" << std::endl;
+
+   // Stopping criteria
+
+   buffer << "<MinimumParametersIncrementNorm>" << std::endl
+          << minimum_parameters_increment_norm << std::endl
+          << "</MinimumParametersIncrementNorm>" << std::endl;
+
+   buffer << "<MinimumEvaluationImprovement>" << std::endl
+          << minimum_evaluation_improvement << std::endl
+          << "</MinimumEvaluationImprovement>" << std::endl;
+
+   buffer << "<EvaluationGoal>" << std::endl
+          << evaluation_goal << std::endl
+          << "</EvaluationGoal>" << std::endl;
+
+   buffer << "<GradientNormGoal>" << std::endl
+          << gradient_norm_goal << std::endl
+          << "</GradientNormGoal>" << std::endl;
+
+   buffer << "<MaximumEpochsNumber>" << std::endl
+          << maximum_epochs_number << std::endl 
+		  << "</MaximumEpochsNumber>" << std::endl;
+
+   buffer << "<MaximumTime>" << std::endl
+          << maximum_time << std::endl 
+          << "</MaximumTime>" << std::endl;
+ 
+   // Early stopping
+
+   buffer << "<EarlyStopping>" << std::endl
+          << early_stopping << std::endl 
+          << "</EarlyStopping>" << std::endl;
+
+   buffer << "<ValidationInterval>" << std::endl
+          << validation_interval << std::endl 
+          << "</ValidationInterval>" << std::endl;
+
+   buffer << "<AsynchronousValidation>" << std::endl
+          << asynchronous_validation << std::endl 
+          << "</AsynchronousValidation>" << std::endl;
+
+   // Checkpoints
+
+   buffer << "<CheckpointPeriod>" << std::endl
+          << checkpoint_period << std::endl 
+          << "</CheckpointPeriod>" << std::endl;
+
+   buffer << "<CheckpointFilename>" << std::endl
+          << checkpoint_filename << std::endl 
+          << "</CheckpointFilename>" << std::endl;
+
+   // Training history sink
+
+   buffer << "<TrainingHistoryPeriod>" << std::endl
+          << training_history_period << std::endl 
+          << "</TrainingHistoryPeriod>" << std::endl;
+
+   buffer << "<TrainingHistoryDepth>" << std::endl
+          << training_history_depth << std::endl 
+          << "</TrainingHistoryDepth>" << std::endl;
+
+   buffer << "<TrainingHistoryFilename>" << std::endl
+          << training_history_filename << std::endl 
+          << "</TrainingHistoryFilename>" << std::endl;
+
+   // Profiling
+
+   buffer << "<Profiling>" << std::endl
+          << profiling << std::endl 
+          << "</Profiling>" << std::endl;
+
+   buffer << "<ReserveProfilingTrace>" << std::endl
+          << reserve_profiling_trace << std::endl 
+          << "</ReserveProfilingTrace>" << std::endl;
+  
+   // Reserve training history
+
+   buffer << "<ReserveParametersHistory>" << std::endl
+          << reserve_parameters_history << std::endl 
+          << "</ReserveParametersHistory>" << std::endl;
+
+   buffer << "<ReserveParametersNormHistory>" << std::endl
+          << reserve_parameters_norm_history << std::endl 
+		  << "</ReserveParametersNormHistory>" << std::endl;
+
+   buffer << "<ReserveEvaluationHistory>" << std::endl
+          << reserve_evaluation_history << std::endl 
+          << "</ReserveEvaluationHistory>" << std::endl;
+
+   buffer << "<ReserveGradientHistory>" << std::endl
+          << reserve_gradient_history << std::endl
+          << "</ReserveGradientHistory>" << std::endl;
+
+   buffer << "<ReserveGradientNormHistory>" << std::endl
+          << reserve_gradient_norm_history << std::endl 
+          << "</ReserveGradientNormHistory>" << std::endl;
+
+   buffer << "<ReserveInverseHessianHistory>" << std::endl
+          << reserve_inverse_Hessian_history << std::endl 
+          << "</ReserveInverseHessianHistory>" << std::endl;
+
+   buffer << "<ReserveTrainingDirectionHistory>" << std::endl
+          << reserve_training_direction_history << std::endl 
+          << "</ReserveTrainingDirectionHistory>" << std::endl;
+
+   buffer << "<ReserveTrainingRateHistory>"  << std::endl
+          << reserve_training_rate_history << std::endl
+          << "</ReserveTrainingRateHistory>"  << std::endl;
+
+   buffer << "<ReserveElapsedTimeHistory>" << std::endl
+          << reserve_elapsed_time_history << std::endl 
+          << "</ReserveElapsedTimeHistory>" << std::endl;
+
+   buffer << "<ReserveValidationErrorHistory>" << std::endl
+          << reserve_validation_error_history << std::endl 
+          << "</ReserveValidationErrorHistory>" << std::endl;
+
+   // User stuff
+
+   buffer << "<Display>" << std::endl
+          << display << std::endl
+		  << "</Display>" << std::endl;
+
+   buffer << "<DisplayPeriod>" << std::endl
+          << display_period << std::endl
+		  << "</DisplayPeriod>" << std::endl;
+
+   return(buffer.str());
+}
+
+
+// void print(void) method
+
+/// This method prints to the screen the XML-type representation of the training algorithm object. 
+
+void TrainingAlgorithm::print(void)
+{
+   std::cout << to_XML(true);
+}
+
+
+// void save(const char*) method
+
+/// This method saves to a XML-type file the members of the training algorithm object. 
+/// @param filename Name of training algorithm XML-type file. 
 
 void TrainingAlgorithm::save(const char* filename)
 {
@@ -2261,24 +3240,62 @@ void TrainingAlgorithm::load(const char* filename)
          set_training_rate_tolerance(new_training_rate_tolerance);
 	  }
 
-	  else if(word == "<WarningParametersNorm>")
+	  else if(word == "<SufficientDecreaseParameter>")
 	  {
-		 double new_warning_parameters_norm; 
+		 double new_sufficient_decrease_parameter; 
 
-         file >> new_warning_parameters_norm;          
+         file >> new_sufficient_decrease_parameter;          
 
          file >> word;
 
-		 if(word != "</WarningParametersNorm>") 
+		 if(word != "</SufficientDecreaseParameter>") 
          {
             std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
                       << "void load(const char*) method." << std::endl
-          			  << "Unknown warning parameters norm end tag: " << word << std::endl;
+          			  << "Unknown sufficient decrease parameter end tag: " << word << std::endl;
  
             exit(1);
          }  
 
-         set_warning_parameters_norm(new_warning_parameters_norm);
+         set_sufficient_decrease_parameter(new_sufficient_decrease_parameter);
+	  }
+	  else if(word == "<CurvatureParameter>")
+	  {
+		 double new_curvature_parameter; 
+
+         file >> new_curvature_parameter;          
+
+         file >> word;
+
+		 if(word != "</CurvatureParameter>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown curvature parameter end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_curvature_parameter(new_curvature_parameter);
+	  }
+	  else if(word == "<WarningParametersNorm>")
+	  {
+		 double new_warning_parameters_norm; 
+
+         file >> new_warning_parameters_norm;          
+
+         file >> word;
+
+		 if(word != "</WarningParametersNorm>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown warning parameters norm end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_warning_parameters_norm(new_warning_parameters_norm);
 	  }
 
 	  else if(word == "<WarningGradientNorm>")
@@ -2517,6 +3534,184 @@ void TrainingAlgorithm::load(const char* filename)
 
          set_early_stopping(new_early_stopping);
 	  }
+	  else if(word == "<ValidationInterval>")
+	  {
+   	     int new_validation_interval; 
+
+         file >> new_validation_interval;          
+
+         file >> word;
+
+		 if(word != "</ValidationInterval>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown validation interval end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_validation_interval(new_validation_interval);
+	  }
+	  else if(word == "<AsynchronousValidation>")
+	  {
+   	     bool new_asynchronous_validation; 
+
+         file >> new_asynchronous_validation;          
+
+         file >> word;
+
+		 if(word != "</AsynchronousValidation>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown asynchronous validation end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_asynchronous_validation(new_asynchronous_validation);
+	  }
+	  else if(word == "<CheckpointPeriod>")
+	  {
+   	     int new_checkpoint_period; 
+
+         file >> new_checkpoint_period;          
+
+         file >> word;
+
+		 if(word != "</CheckpointPeriod>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_period(new_checkpoint_period);
+	  }
+	  else if(word == "<CheckpointFilename>")
+	  {
+   	     std::string new_checkpoint_filename; 
+
+         file >> new_checkpoint_filename;          
+
+         file >> word;
+
+		 if(word != "</CheckpointFilename>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown checkpoint filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_checkpoint_filename(new_checkpoint_filename);
+	  }
+	  else if(word == "<TrainingHistoryPeriod>")
+	  {
+   	     int new_training_history_period; 
+
+         file >> new_training_history_period;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryPeriod>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history period end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_period(new_training_history_period);
+	  }
+	  else if(word == "<TrainingHistoryDepth>")
+	  {
+   	     int new_training_history_depth; 
+
+         file >> new_training_history_depth;          
+
+         file >> word;
+
+		 if(word != "</TrainingHistoryDepth>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history depth end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_depth(new_training_history_depth);
+	  }
+	  else if(word == "<TrainingHistoryFilename>")
+	  {
+         // The training history filename is empty by default
+
+   	     std::string new_training_history_filename; 
+
+         file >> word;
+
+         if(word != "</TrainingHistoryFilename>")
+         {
+            new_training_history_filename = word;
+
+            file >> word;
+         }
+
+		 if(word != "</TrainingHistoryFilename>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown training history filename end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_training_history_filename(new_training_history_filename);
+	  }
+	  else if(word == "<Profiling>")
+	  {
+   	     bool new_profiling; 
+
+         file >> new_profiling;          
+
+         file >> word;
+
+		 if(word != "</Profiling>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown profiling end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_profiling(new_profiling);
+	  }
+	  else if(word == "<ReserveProfilingTrace>")
+	  {
+   	     bool new_reserve_profiling_trace; 
+
+         file >> new_reserve_profiling_trace;          
+
+         file >> word;
+
+		 if(word != "</ReserveProfilingTrace>") 
+         {
+            std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown reserve profiling trace end tag: " << word << std::endl;
+ 
+            exit(1);
+         }  
+
+         set_reserve_profiling_trace(new_reserve_profiling_trace);
+	  }
 
       // Training history 
 
@@ -2867,123 +4062,455 @@ void TrainingAlgorithm::resize_training_history(int new_size)
 }
 
 
-// std::string get_training_history_XML(bool) method
+// int calculate_training_history_size(int) method
 
-/// This method returns a string with the history of the training process in XML-type format. 
-/// Only that training history variables which have been reserved are included here. 
-/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+/// This method returns the number of records which the training history vectors need for a number of epochs. 
+/// It counts every training history period epochs and the last epoch, up to the training history depth. 
+/// @param epochs_number Number of training epochs. 
 
-std::string TrainingAlgorithm::get_training_history_XML(bool show_declaration)
+int TrainingAlgorithm::calculate_training_history_size(int epochs_number)
 {
-   std::stringstream buffer;
-
-   // Declaration
-
-   if(show_declaration)
+   if(epochs_number <= 0)
    {
-      buffer << "<Flood version='3.0' class='TrainingAlgorithm' content='TrainingHistory'>" << std::endl;
+      return(0);
    }
 
-   // Multilayer perceptron
+   int records_number = (epochs_number-1 + training_history_period-1)/training_history_period + 1;
 
-   if(reserve_parameters_history)
+   if(training_history_depth > 0 && records_number > training_history_depth)
    {
-      buffer << "<ParametersHistory>" << std::endl
-             << parameters_history << std::endl     
-             << "</ParametersHistory>" << std::endl;
+      return(training_history_depth);
    }
-
-   if(reserve_parameters_norm_history)
+   else
    {
-      buffer << "<ParametersNormHistory>" << std::endl
-             << parameters_norm_history << std::endl     
-             << "</ParametersNormHistory>" << std::endl;
+      return(records_number);
    }
+}
 
-   // Objective functional
 
-   if(reserve_evaluation_history)
-   {
-      buffer << "<EvaluationHistory>" << std::endl
-             << evaluation_history << std::endl     
-             << "</EvaluationHistory>" << std::endl;
-   }
+// int get_training_history_index(int) method
 
-   if(reserve_gradient_history)
+/// This method returns the position in the training history vectors where an epoch is recorded. 
+/// An epoch which is not a multiple of the training history period takes the position of the next record, 
+/// so that it is overwritten unless it is the last epoch of training. 
+/// @param epoch Training epoch. 
+
+int TrainingAlgorithm::get_training_history_index(int epoch)
+{
+   int record = (epoch + training_history_period-1)/training_history_period;
+
+   if(training_history_depth > 0)
    {
-      buffer << "<GradientHistory>" << std::endl
-             << gradient_history << std::endl  
-             << "</GradientHistory>" << std::endl;
+      return(record%training_history_depth);
    }
-
-   if(reserve_gradient_norm_history)
+   else
    {
-      buffer << "<GradientNormHistory>" << std::endl
-             << gradient_norm_history << std::endl     
-             << "</GradientNormHistory>" << std::endl;
+      return(record);
    }
+}
 
-   if(reserve_inverse_Hessian_history)
+
+// void initialize_training_history(int) method
+
+/// This method sizes the training history vectors for a maximum number of epochs before training. 
+/// If a training history file is set, and training is not being resumed, it also creates that file with a line 
+/// of column names. 
+/// @param epochs_number Maximum number of training epochs. 
+
+void TrainingAlgorithm::initialize_training_history(int epochs_number)
+{
+   resize_training_history(calculate_training_history_size(epochs_number));
+
+   if(!training_history_filename.empty() && !resume_training)
    {
-      buffer << "<InverseHessianHistory>" << std::endl;
+      std::ofstream file(training_history_filename.c_str());
 
-      int size = inverse_Hessian_history.get_size();
+      if(!file.is_open())
+      {
+         std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                   << "void initialize_training_history(int) method." << std::endl
+                   << "Cannot open training history file " << training_history_filename << "." << std::endl;
 
-	  for(int i = 0; i < size; i++)
-	  {
-		  buffer << "<InverseHessian>" << std::endl
-                 << inverse_Hessian_history[i] << std::endl  
-				 << "</InverseHessian>" << std::endl;	  
-	  }
+         exit(1);
+      }
 
-      buffer << "</InverseHessianHistory>" << std::endl;
+      file << "epoch";
+
+      write_training_history_header(file);
+
+      file << std::endl;
    }
+}
 
-   // Training algorithm
 
-   if(reserve_training_direction_history)
+// void append_training_history(int) method
+
+/// This method appends the record of an epoch to the training history file, if that file is set and the epoch 
+/// is a multiple of the training history period. 
+/// It must be called after the training history vectors have been set for that epoch. 
+/// @param epoch Training epoch. 
+
+void TrainingAlgorithm::append_training_history(int epoch)
+{
+   if(!training_history_filename.empty() && epoch%training_history_period == 0)
    {
-      buffer << "<TrainingDirectionHistory>" << std::endl
-             << training_direction_history << std::endl     
-             << "</TrainingDirectionHistory>" << std::endl;
+      save_training_history_record(epoch);
    }
+}
 
-   if(reserve_training_rate_history)
+
+// void finish_training_history(int) method
+
+/// This method leaves the training history vectors with the records of a finished training process, from the 
+/// oldest to the newest. 
+/// The last epoch is appended to the training history file if it was not recorded yet. 
+/// @param epochs_number Number of epochs performed. 
+
+void TrainingAlgorithm::finish_training_history(int epochs_number)
+{
+   if(epochs_number <= 0)
    {
-      buffer << "<TrainingRateHistory>" << std::endl
-             << training_rate_history << std::endl     
-             << "</TrainingRateHistory>" << std::endl;
+      resize_training_history(0);
+
+      return;
    }
 
-   if(reserve_elapsed_time_history)
+   if(!training_history_filename.empty() && (epochs_number-1)%training_history_period != 0)
    {
-      buffer << "<ElapsedTimeHistory>" << std::endl
-             << elapsed_time_history << std::endl     
-             << "</ElapsedTimeHistory>" << std::endl;
+      save_training_history_record(epochs_number-1);
    }
 
-   if(reserve_validation_error_history)
+   int records_number = (epochs_number-1 + training_history_period-1)/training_history_period + 1;
+
+   if(training_history_depth > 0 && records_number > training_history_depth)
    {
-      buffer << "<ValidationErrorHistory>" << std::endl
-             << validation_error_history << std::endl     
-             << "</ValidationErrorHistory>" << std::endl;
+      rotate_training_history(records_number%training_history_depth);
    }
 
-   return(buffer.str());
+   resize_training_history(calculate_training_history_size(epochs_number));
 }
 
 
-// void print_training_history(void) method
+// void rotate_training_history(int) method
 
-/// This method prints to the screen the history of the training process for the reserved variables. 
+/// This method rotates all the default training history vectors, so that the record at a given position becomes 
+/// the first one. 
+/// It is used to order the training history when the training history depth has been exceeded. 
+/// @param first Position of the oldest record.
 
-void TrainingAlgorithm::print_training_history(void)
+void TrainingAlgorithm::rotate_training_history(int first)
 {
-	std::cout << get_training_history_XML(true);
-}
+   // Multilayer perceptron
 
+   if(reserve_parameters_history && parameters_history.get_size() > first)
+   {
+      std::rotate(parameters_history.begin(), parameters_history.begin()+first, parameters_history.end());
+   }
 
-// void save_training_history(const char*) method
+   if(reserve_parameters_norm_history && parameters_norm_history.get_size() > first)
+   {
+      std::rotate(parameters_norm_history.begin(), parameters_norm_history.begin()+first, parameters_norm_history.end());
+   }
+
+   // Objective functional
+
+   if(reserve_evaluation_history && evaluation_history.get_size() > first)
+   {
+      std::rotate(evaluation_history.begin(), evaluation_history.begin()+first, evaluation_history.end());
+   }
+
+   if(reserve_validation_error_history && validation_error_history.get_size() > first)
+   {
+      std::rotate(validation_error_history.begin(), validation_error_history.begin()+first, validation_error_history.end());
+   }
+
+   if(reserve_gradient_history && gradient_history.get_size() > first)
+   {
+      std::rotate(gradient_history.begin(), gradient_history.begin()+first, gradient_history.end());
+   }
+ 
+   if(reserve_gradient_norm_history && gradient_norm_history.get_size() > first)
+   {
+      std::rotate(gradient_norm_history.begin(), gradient_norm_history.begin()+first, gradient_norm_history.end());
+   }
+
+   if(reserve_inverse_Hessian_history && inverse_Hessian_history.get_size() > first)
+   {
+      std::rotate(inverse_Hessian_history.begin(), inverse_Hessian_history.begin()+first, inverse_Hessian_history.end());
+   }
+
+   // Training algorithm
+
+   if(reserve_training_direction_history && training_direction_history.get_size() > first)
+   {
+      std::rotate(training_direction_history.begin(), training_direction_history.begin()+first, training_direction_history.end());
+   }
+  
+   if(reserve_training_rate_history && training_rate_history.get_size() > first)
+   {
+      std::rotate(training_rate_history.begin(), training_rate_history.begin()+first, training_rate_history.end());
+   }
+
+   if(reserve_elapsed_time_history && elapsed_time_history.get_size() > first)
+   {
+      std::rotate(elapsed_time_history.begin(), elapsed_time_history.begin()+first, elapsed_time_history.end());
+   }
+}
+
+
+// void write_training_history_header(std::ostream&) method
+
+/// This method writes the names of the columns of the default training history vectors which are reserved, 
+/// each one preceded by a comma. 
+/// Vector and matrix variables take one column per element. 
+/// @param file Training history file.
+
+void TrainingAlgorithm::write_training_history_header(std::ostream& file)
+{
+   int parameters_number = objective_functional_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
+
+   // Multilayer perceptron
+
+   if(reserve_parameters_history && parameters_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "parameters", parameters_number);
+   }
+
+   if(reserve_parameters_norm_history && parameters_norm_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "parameters_norm", 1);
+   }
+
+   // Objective functional
+
+   if(reserve_evaluation_history && evaluation_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "evaluation", 1);
+   }
+
+   if(reserve_validation_error_history && validation_error_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "validation_error", 1);
+   }
+
+   if(reserve_gradient_history && gradient_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "gradient", parameters_number);
+   }
+ 
+   if(reserve_gradient_norm_history && gradient_norm_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "gradient_norm", 1);
+   }
+
+   if(reserve_inverse_Hessian_history && inverse_Hessian_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "inverse_Hessian", parameters_number*parameters_number);
+   }
+
+   // Training algorithm
+
+   if(reserve_training_direction_history && training_direction_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "training_direction", parameters_number);
+   }
+  
+   if(reserve_training_rate_history && training_rate_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "training_rate", 1);
+   }
+
+   if(reserve_elapsed_time_history && elapsed_time_history.get_size() != 0)
+   {
+      write_training_history_column_names(file, "elapsed_time", 1);
+   }
+}
+
+
+// void write_training_history_record(std::ostream&, int) method
+
+/// This method writes one record of the default training history vectors which are reserved, each value 
+/// preceded by a comma. 
+/// @param file Training history file.
+/// @param index Position of the record in the training history vectors.
+
+void TrainingAlgorithm::write_training_history_record(std::ostream& file, int index)
+{
+   // Multilayer perceptron
+
+   if(reserve_parameters_history && parameters_history.get_size() != 0)
+   {
+      write_training_history_values(file, parameters_history[index]);
+   }
+
+   if(reserve_parameters_norm_history && parameters_norm_history.get_size() != 0)
+   {
+      write_training_history_values(file, parameters_norm_history[index]);
+   }
+
+   // Objective functional
+
+   if(reserve_evaluation_history && evaluation_history.get_size() != 0)
+   {
+      write_training_history_values(file, evaluation_history[index]);
+   }
+
+   if(reserve_validation_error_history && validation_error_history.get_size() != 0)
+   {
+      write_training_history_values(file, validation_error_history[index]);
+   }
+
+   if(reserve_gradient_history && gradient_history.get_size() != 0)
+   {
+      write_training_history_values(file, gradient_history[index]);
+   }
+ 
+   if(reserve_gradient_norm_history && gradient_norm_history.get_size() != 0)
+   {
+      write_training_history_values(file, gradient_norm_history[index]);
+   }
+
+   if(reserve_inverse_Hessian_history && inverse_Hessian_history.get_size() != 0)
+   {
+      write_training_history_values(file, inverse_Hessian_history[index]);
+   }
+
+   // Training algorithm
+
+   if(reserve_training_direction_history && training_direction_history.get_size() != 0)
+   {
+      write_training_history_values(file, training_direction_history[index]);
+   }
+  
+   if(reserve_training_rate_history && training_rate_history.get_size() != 0)
+   {
+      write_training_history_values(file, training_rate_history[index]);
+   }
+
+   if(reserve_elapsed_time_history && elapsed_time_history.get_size() != 0)
+   {
+      write_training_history_values(file, elapsed_time_history[index]);
+   }
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format. 
+/// Only that training history variables which have been reserved are included here. 
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string TrainingAlgorithm::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='TrainingAlgorithm' content='TrainingHistory'>" << std::endl;
+   }
+
+   // Multilayer perceptron
+
+   if(reserve_parameters_history)
+   {
+      buffer << "<ParametersHistory>" << std::endl
+             << parameters_history << std::endl     
+             << "</ParametersHistory>" << std::endl;
+   }
+
+   if(reserve_parameters_norm_history)
+   {
+      buffer << "<ParametersNormHistory>" << std::endl
+             << parameters_norm_history << std::endl     
+             << "</ParametersNormHistory>" << std::endl;
+   }
+
+   // Objective functional
+
+   if(reserve_evaluation_history)
+   {
+      buffer << "<EvaluationHistory>" << std::endl
+             << evaluation_history << std::endl     
+             << "</EvaluationHistory>" << std::endl;
+   }
+
+   if(reserve_gradient_history)
+   {
+      buffer << "<GradientHistory>" << std::endl
+             << gradient_history << std::endl  
+             << "</GradientHistory>" << std::endl;
+   }
+
+   if(reserve_gradient_norm_history)
+   {
+      buffer << "<GradientNormHistory>" << std::endl
+             << gradient_norm_history << std::endl     
+             << "</GradientNormHistory>" << std::endl;
+   }
+
+   if(reserve_inverse_Hessian_history)
+   {
+      buffer << "<InverseHessianHistory>" << std::endl;
+
+      int size = inverse_Hessian_history.get_size();
+
+	  for(int i = 0; i < size; i++)
+	  {
+		  buffer << "<InverseHessian>" << std::endl
+                 << inverse_Hessian_history[i] << std::endl  
+				 << "</InverseHessian>" << std::endl;	  
+	  }
+
+      buffer << "</InverseHessianHistory>" << std::endl;
+   }
+
+   // Training algorithm
+
+   if(reserve_training_direction_history)
+   {
+      buffer << "<TrainingDirectionHistory>" << std::endl
+             << training_direction_history << std::endl     
+             << "</TrainingDirectionHistory>" << std::endl;
+   }
+
+   if(reserve_training_rate_history)
+   {
+      buffer << "<TrainingRateHistory>" << std::endl
+             << training_rate_history << std::endl     
+             << "</TrainingRateHistory>" << std::endl;
+   }
+
+   if(reserve_elapsed_time_history)
+   {
+      buffer << "<ElapsedTimeHistory>" << std::endl
+             << elapsed_time_history << std::endl     
+             << "</ElapsedTimeHistory>" << std::endl;
+   }
+
+   if(reserve_validation_error_history)
+   {
+      buffer << "<ValidationErrorHistory>" << std::endl
+             << validation_error_history << std::endl     
+             << "</ValidationErrorHistory>" << std::endl;
+   }
+
+   return(buffer.str());
+}
+
+
+// void print_training_history(void) method
+
+/// This method prints to the screen the history of the training process for the reserved variables. 
+
+void TrainingAlgorithm::print_training_history(void)
+{
+	std::cout << get_training_history_XML(true);
+}
+
+
+// void save_training_history(const char*) method
 
 /// This method saves the training history to a XML-type file. 
 /// @param filename Training history XML-type filename. 
@@ -3015,6 +4542,913 @@ void TrainingAlgorithm::save_training_history(const char* filename)
      
 }
 
+
+// double calculate_monotonic_time(void) method
+
+/// This method returns the time in seconds from a monotonic clock, which does not jump when the system clock is 
+/// changed. 
+/// Its resolution is one nanosecond on POSIX systems, and that of the performance counter on Windows. 
+/// Only differences between two of its values are meaningful.
+
+double TrainingAlgorithm::calculate_monotonic_time(void)
+{
+   #ifdef _WIN32
+
+   LARGE_INTEGER counter;
+   LARGE_INTEGER frequency;
+
+   QueryPerformanceCounter(&counter);
+   QueryPerformanceFrequency(&frequency);
+
+   return((double)counter.QuadPart/(double)frequency.QuadPart);
+
+   #else
+
+   timespec monotonic_time;
+
+   clock_gettime(CLOCK_MONOTONIC, &monotonic_time);
+
+   return((double)monotonic_time.tv_sec + 1.0e-9*(double)monotonic_time.tv_nsec);
+
+   #endif
+}
+
+
+// void initialize_profiling(void) method
+
+/// This method sets to zero the time, the calls number and the histogram of every phase, and empties the trace. 
+/// It is called at the beginning of training, and does nothing if profiling is not enabled.
+
+void TrainingAlgorithm::initialize_profiling(void)
+{
+   if(!profiling)
+   {
+      return;
+   }
+
+   int phases_number = EvolutionPhase + 1;
+
+   profiling_beginning_time = calculate_monotonic_time();
+
+   profiling_phase_beginning_time.set(phases_number, 0.0);
+
+   profiling_total_time.set(phases_number, 0.0);
+   profiling_calls_number.set(phases_number, 0);
+   profiling_histogram.set(phases_number, 9, 0);
+
+   profiling_trace_size = 0;
+
+   profiling_trace_phase.set();
+   profiling_trace_beginning_time.set();
+   profiling_trace_duration.set();
+}
+
+
+// void begin_profiling_phase(const ProfilingPhase&) method
+
+/// This method starts timing a call of a training phase, if profiling is enabled. 
+/// Calls of the same phase must not be nested.
+/// @param phase Training phase.
+
+void TrainingAlgorithm::begin_profiling_phase(const ProfilingPhase& phase)
+{
+   if(profiling)
+   {
+      profiling_phase_beginning_time[phase] = calculate_monotonic_time();
+   }
+}
+
+
+// void end_profiling_phase(const ProfilingPhase&) method
+
+/// This method stops timing a call of a training phase, if profiling is enabled. 
+/// It adds the duration of the call to the total time and the histogram of that phase, and to the trace if it is 
+/// reserved.
+/// @param phase Training phase.
+
+void TrainingAlgorithm::end_profiling_phase(const ProfilingPhase& phase)
+{
+   if(!profiling)
+   {
+      return;
+   }
+
+   double duration = calculate_monotonic_time() - profiling_phase_beginning_time[phase];
+
+   profiling_total_time[phase] += duration;
+   profiling_calls_number[phase]++;
+
+   // Histogram
+
+   int bins_number = profiling_histogram.get_columns_number();
+
+   int bin = 0;
+   double bin_upper_bound = 1.0e-6;
+
+   while(bin < bins_number-1 && duration >= bin_upper_bound)
+   {
+      bin++;
+      bin_upper_bound *= 10.0;
+   }
+
+   profiling_histogram[phase][bin]++;
+
+   // Trace
+
+   if(reserve_profiling_trace)
+   {
+      if(profiling_trace_size == profiling_trace_phase.get_size())
+      {
+         int new_size = profiling_trace_size == 0 ? 1024 : 2*profiling_trace_size;
+
+         profiling_trace_phase.resize(new_size);
+         profiling_trace_beginning_time.resize(new_size);
+         profiling_trace_duration.resize(new_size);
+      }
+
+      profiling_trace_phase[profiling_trace_size] = phase;
+      profiling_trace_beginning_time[profiling_trace_size] = profiling_phase_beginning_time[phase] - profiling_beginning_time;
+      profiling_trace_duration[profiling_trace_size] = duration;
+
+      profiling_trace_size++;
+   }
+}
+
+
+// std::string get_profiling_phase_name(const ProfilingPhase&) method
+
+/// This method returns a string with the name of a training phase. 
+/// @param phase Training phase.
+
+std::string TrainingAlgorithm::get_profiling_phase_name(const ProfilingPhase& phase)
+{
+   switch(phase)
+   {
+      case EvaluationPhase:
+      {
+         return("Evaluation");
+	  }
+      break;
+
+      case GradientPhase:
+      {
+         return("Gradient");
+	  }
+      break;
+
+      case HessianPhase:
+      {
+         return("Hessian");
+	  }
+      break;
+
+      case TrainingDirectionPhase:
+      {
+         return("TrainingDirection");
+	  }
+      break;
+
+      case LineSearchPhase:
+      {
+         return("LineSearch");
+	  }
+      break;
+
+      case ValidationPhase:
+      {
+         return("Validation");
+	  }
+      break;
+
+      case TrainingHistoryPhase:
+      {
+         return("TrainingHistory");
+	  }
+      break;
+
+      case EvolutionPhase:
+      {
+         return("Evolution");
+	  }
+      break;
+
+	  default:
+      {
+         std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                   << "std::string get_profiling_phase_name(const ProfilingPhase&) method." << std::endl
+                   << "Unknown profiling phase." << std::endl;
+ 
+         exit(1);
+	  }
+      break;
+   }
+}
+
+
+// std::string get_profiling_report_XML(bool) method
+
+/// This method returns a string in XML format with the profiling report of the last training process. 
+/// For every phase which has been timed, it contains the number of calls, the total and the mean time in seconds, 
+/// and the histogram of the durations of the calls.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning. 
+
+std::string TrainingAlgorithm::get_profiling_report_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='TrainingAlgorithm' content='ProfilingReport'>" << std::endl;
+   }
+
+   int phases_number = profiling_calls_number.get_size();
+
+   for(int i = 0; i < phases_number; i++)
+   {
+      if(profiling_calls_number[i] != 0)
+      {
+         std::string phase_name = get_profiling_phase_name((ProfilingPhase)i);
+
+         Vector<int> histogram = profiling_histogram.get_row(i);
+
+         buffer << "<" << phase_name << ">" << std::endl
+                << "<CallsNumber>" << std::endl
+                << profiling_calls_number[i] << std::endl
+                << "</CallsNumber>" << std::endl
+                << "<TotalTime>" << std::endl
+                << profiling_total_time[i] << std::endl
+                << "</TotalTime>" << std::endl
+                << "<MeanTime>" << std::endl
+                << profiling_total_time[i]/(double)profiling_calls_number[i] << std::endl
+                << "</MeanTime>" << std::endl
+                << "<TimeHistogram>" << std::endl
+                << histogram << std::endl
+                << "</TimeHistogram>" << std::endl
+                << "</" << phase_name << ">" << std::endl;
+      }
+   }
+
+   return(buffer.str());
+}
+
+
+// void print_profiling_report(void) method
+
+/// This method prints to the screen the profiling report of the last training process. 
+
+void TrainingAlgorithm::print_profiling_report(void)
+{
+   std::cout << get_profiling_report_XML(true);
+}
+
+
+// void save_profiling_report(const char*) method
+
+/// This method saves the profiling report of the last training process to an XML-type file. 
+/// @param filename Name of profiling report XML-type file. 
+
+void TrainingAlgorithm::save_profiling_report(const char* filename)
+{
+   std::fstream file; 
+
+   // Open file 
+
+   file.open(filename, std::ios::out);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void save_profiling_report(const char*) method." << std::endl
+                << "Cannot open profiling report XML-type file." << std::endl;
+
+      exit(1);
+   }
+
+   // Write file 
+
+   file << get_profiling_report_XML(true);
+
+   // Close file
+
+   file.close();     
+}
+
+
+// void save_profiling_trace(const char*) method
+
+/// This method saves the profiling trace of the last training process to a JSON file in the Chrome trace event 
+/// format, which can be opened with chrome://tracing or Perfetto. 
+/// Every timed call is a complete event, with its beginning and duration in microseconds. 
+/// @param filename Name of profiling trace file. 
+
+void TrainingAlgorithm::save_profiling_trace(const char* filename)
+{
+   std::fstream file; 
+
+   // Open file 
+
+   file.open(filename, std::ios::out);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void save_profiling_trace(const char*) method." << std::endl
+                << "Cannot open profiling trace file." << std::endl;
+
+      exit(1);
+   }
+
+   // Write file 
+
+   file.setf(std::ios::fixed);
+   file.precision(3);
+
+   file << "{\"traceEvents\":[" << std::endl;
+
+   for(int i = 0; i < profiling_trace_size; i++)
+   {
+      file << "{\"name\":\"" << get_profiling_phase_name((ProfilingPhase)profiling_trace_phase[i]) << "\","
+           << "\"ph\":\"X\","
+           << "\"ts\":" << 1.0e6*profiling_trace_beginning_time[i] << ","
+           << "\"dur\":" << 1.0e6*profiling_trace_duration[i] << ","
+           << "\"pid\":1,\"tid\":1}";
+
+      if(i < profiling_trace_size-1)
+      {
+         file << ",";
+      }
+
+      file << std::endl;
+   }
+
+   file << "],\"displayTimeUnit\":\"ns\"}" << std::endl;
+
+   // Close file
+
+   file.close();     
+}
+
+
+// void write_checkpoint_header(std::ostream&, const std::string&) method
+
+/// This method writes the beginning of a binary checkpoint, which identifies the file and the training algorithm 
+/// class which saved it. 
+/// @param checkpoint Binary output stream.
+/// @param class_name Name of the training algorithm class.
+
+void TrainingAlgorithm::write_checkpoint_header(std::ostream& checkpoint, const std::string& class_name)
+{
+   write_binary(checkpoint, std::string("FloodCheckpoint"));
+   write_binary(checkpoint, 1);
+   write_binary(checkpoint, class_name);
+}
+
+
+// void read_checkpoint_header(std::istream&, const std::string&) method
+
+/// This method reads the beginning of a binary checkpoint, and checks that it was saved by a given training 
+/// algorithm class. 
+/// @param checkpoint Binary input stream.
+/// @param class_name Name of the training algorithm class.
+
+void TrainingAlgorithm::read_checkpoint_header(std::istream& checkpoint, const std::string& class_name)
+{
+   std::string identifier;
+   int version = 0;
+   std::string checkpoint_class_name;
+
+   read_binary(checkpoint, identifier);
+   read_binary(checkpoint, version);
+   read_binary(checkpoint, checkpoint_class_name);
+
+   if(!checkpoint || identifier != "FloodCheckpoint" || version != 1)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void read_checkpoint_header(std::istream&, const std::string&) method." << std::endl
+                << "Unknown checkpoint file format." << std::endl;
+
+      exit(1);
+   }
+   else if(checkpoint_class_name != class_name)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void read_checkpoint_header(std::istream&, const std::string&) method." << std::endl
+                << "Checkpoint saved by " << checkpoint_class_name << " cannot be resumed by " << class_name << "." 
+                << std::endl;
+
+      exit(1);
+   }
+}
+
+
+// void write_binary(std::ostream&, int) method
+
+/// This method writes an integer to a binary checkpoint. 
+/// @param checkpoint Binary output stream.
+/// @param value Integer value.
+
+void TrainingAlgorithm::write_binary(std::ostream& checkpoint, int value)
+{
+   checkpoint.write((const char*)&value, sizeof(int));
+}
+
+
+// void write_binary(std::ostream&, double) method
+
+/// This method writes a double to a binary checkpoint, so that it is read back bit by bit. 
+/// @param checkpoint Binary output stream.
+/// @param value Double value.
+
+void TrainingAlgorithm::write_binary(std::ostream& checkpoint, double value)
+{
+   checkpoint.write((const char*)&value, sizeof(double));
+}
+
+
+// void write_binary(std::ostream&, const std::string&) method
+
+/// This method writes a string to a binary checkpoint, preceded by its length. 
+/// @param checkpoint Binary output stream.
+/// @param value String.
+
+void TrainingAlgorithm::write_binary(std::ostream& checkpoint, const std::string& value)
+{
+   int size = (int)value.size();
+
+   write_binary(checkpoint, size);
+
+   checkpoint.write(value.data(), size);
+}
+
+
+// void write_binary(std::ostream&, const Vector<double>&) method
+
+/// This method writes a vector to a binary checkpoint, preceded by its size. 
+/// @param checkpoint Binary output stream.
+/// @param vector Vector of doubles.
+
+void TrainingAlgorithm::write_binary(std::ostream& checkpoint, const Vector<double>& vector)
+{
+   int size = vector.get_size();
+
+   write_binary(checkpoint, size);
+
+   if(size > 0)
+   {
+      checkpoint.write((const char*)vector.begin(), size*sizeof(double));
+   }
+}
+
+
+// void write_binary(std::ostream&, const Matrix<double>&) method
+
+/// This method writes a matrix to a binary checkpoint by rows, preceded by its numbers of rows and columns. 
+/// @param checkpoint Binary output stream.
+/// @param matrix Matrix of doubles.
+
+void TrainingAlgorithm::write_binary(std::ostream& checkpoint, const Matrix<double>& matrix)
+{
+   int rows_number = matrix.get_rows_number();
+   int columns_number = matrix.get_columns_number();
+
+   write_binary(checkpoint, rows_number);
+   write_binary(checkpoint, columns_number);
+
+   for(int i = 0; i < rows_number; i++)
+   {
+      checkpoint.write((const char*)matrix[i], columns_number*sizeof(double));
+   }
+}
+
+
+// void write_binary(std::ostream&, const Vector< Vector<double> >&) method
+
+/// This method writes a vector of vectors to a binary checkpoint, preceded by its size. 
+/// @param checkpoint Binary output stream.
+/// @param vector Vector of vectors of doubles.
+
+void TrainingAlgorithm::write_binary(std::ostream& checkpoint, const Vector< Vector<double> >& vector)
+{
+   int size = vector.get_size();
+
+   write_binary(checkpoint, size);
+
+   for(int i = 0; i < size; i++)
+   {
+      write_binary(checkpoint, vector[i]);
+   }
+}
+
+
+// void write_binary(std::ostream&, const Vector< Matrix<double> >&) method
+
+/// This method writes a vector of matrices to a binary checkpoint, preceded by its size. 
+/// @param checkpoint Binary output stream.
+/// @param vector Vector of matrices of doubles.
+
+void TrainingAlgorithm::write_binary(std::ostream& checkpoint, const Vector< Matrix<double> >& vector)
+{
+   int size = vector.get_size();
+
+   write_binary(checkpoint, size);
+
+   for(int i = 0; i < size; i++)
+   {
+      write_binary(checkpoint, vector[i]);
+   }
+}
+
+
+// void read_binary(std::istream&, int&) method
+
+/// This method reads an integer from a binary checkpoint. 
+/// @param checkpoint Binary input stream.
+/// @param value Integer value.
+
+void TrainingAlgorithm::read_binary(std::istream& checkpoint, int& value)
+{
+   checkpoint.read((char*)&value, sizeof(int));
+}
+
+
+// void read_binary(std::istream&, double&) method
+
+/// This method reads a double from a binary checkpoint. 
+/// @param checkpoint Binary input stream.
+/// @param value Double value.
+
+void TrainingAlgorithm::read_binary(std::istream& checkpoint, double& value)
+{
+   checkpoint.read((char*)&value, sizeof(double));
+}
+
+
+// void read_binary(std::istream&, std::string&) method
+
+/// This method reads a string from a binary checkpoint. 
+/// @param checkpoint Binary input stream.
+/// @param value String.
+
+void TrainingAlgorithm::read_binary(std::istream& checkpoint, std::string& value)
+{
+   int size = 0;
+
+   read_binary(checkpoint, size);
+
+   if(!checkpoint || size < 0 || size > 1024)
+   {
+      checkpoint.setstate(std::ios::failbit);
+
+      return;
+   }
+
+   value.resize(size);
+
+   for(int i = 0; i < size; i++)
+   {
+      checkpoint.get(value[i]);
+   }
+}
+
+
+// void read_binary(std::istream&, Vector<double>&) method
+
+/// This method reads a vector from a binary checkpoint, and sets its size. 
+/// @param checkpoint Binary input stream.
+/// @param vector Vector of doubles.
+
+void TrainingAlgorithm::read_binary(std::istream& checkpoint, Vector<double>& vector)
+{
+   int size = 0;
+
+   read_binary(checkpoint, size);
+
+   if(!checkpoint || size < 0)
+   {
+      checkpoint.setstate(std::ios::failbit);
+
+      return;
+   }
+
+   vector.set(size);
+
+   if(size > 0)
+   {
+      checkpoint.read((char*)vector.begin(), size*sizeof(double));
+   }
+}
+
+
+// void read_binary(std::istream&, Matrix<double>&) method
+
+/// This method reads a matrix from a binary checkpoint, and sets its numbers of rows and columns. 
+/// @param checkpoint Binary input stream.
+/// @param matrix Matrix of doubles.
+
+void TrainingAlgorithm::read_binary(std::istream& checkpoint, Matrix<double>& matrix)
+{
+   int rows_number = 0;
+   int columns_number = 0;
+
+   read_binary(checkpoint, rows_number);
+   read_binary(checkpoint, columns_number);
+
+   if(!checkpoint || rows_number < 0 || columns_number < 0 || (rows_number == 0) != (columns_number == 0))
+   {
+      checkpoint.setstate(std::ios::failbit);
+
+      return;
+   }
+
+   matrix.set(rows_number, columns_number);
+
+   for(int i = 0; i < rows_number; i++)
+   {
+      checkpoint.read((char*)matrix[i], columns_number*sizeof(double));
+   }
+}
+
+
+// void read_binary(std::istream&, Vector< Vector<double> >&) method
+
+/// This method reads a vector of vectors from a binary checkpoint, and sets its size. 
+/// @param checkpoint Binary input stream.
+/// @param vector Vector of vectors of doubles.
+
+void TrainingAlgorithm::read_binary(std::istream& checkpoint, Vector< Vector<double> >& vector)
+{
+   int size = 0;
+
+   read_binary(checkpoint, size);
+
+   if(!checkpoint || size < 0)
+   {
+      checkpoint.setstate(std::ios::failbit);
+
+      return;
+   }
+
+   vector.set(size);
+
+   for(int i = 0; i < size; i++)
+   {
+      read_binary(checkpoint, vector[i]);
+   }
+}
+
+
+// void read_binary(std::istream&, Vector< Matrix<double> >&) method
+
+/// This method reads a vector of matrices from a binary checkpoint, and sets its size. 
+/// @param checkpoint Binary input stream.
+/// @param vector Vector of matrices of doubles.
+
+void TrainingAlgorithm::read_binary(std::istream& checkpoint, Vector< Matrix<double> >& vector)
+{
+   int size = 0;
+
+   read_binary(checkpoint, size);
+
+   if(!checkpoint || size < 0)
+   {
+      checkpoint.setstate(std::ios::failbit);
+
+      return;
+   }
+
+   vector.set(size);
+
+   for(int i = 0; i < size; i++)
+   {
+      read_binary(checkpoint, vector[i]);
+   }
+}
+
+
+// void save_training_history_record(int) method
+
+/// This method appends one line with the record of an epoch to the training history file. 
+/// @param epoch Training epoch. 
+
+void TrainingAlgorithm::save_training_history_record(int epoch)
+{
+   std::ofstream file(training_history_filename.c_str(), std::ios::app);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void save_training_history_record(int) method." << std::endl
+                << "Cannot open training history file " << training_history_filename << "." << std::endl;
+
+      exit(1);
+   }
+
+   file << epoch;
+
+   write_training_history_record(file, get_training_history_index(epoch));
+
+   file << std::endl;
+}
+
+
+// void write_training_history_column_names(std::ostream&, const std::string&, int) method
+
+/// This method writes the names of the columns of a training history variable, each one preceded by a comma. 
+/// A variable with several elements gets one column per element, numbered from 1. 
+/// @param file Training history file.
+/// @param name Name of the variable.
+/// @param size Number of elements of the variable.
+
+void TrainingAlgorithm::write_training_history_column_names(std::ostream& file, const std::string& name, int size)
+{
+   if(size == 1)
+   {
+      file << "," << name;
+   }
+   else
+   {
+      for(int i = 0; i < size; i++)
+      {
+         file << "," << name << "_" << i+1;
+      }
+   }
+}
+
+
+// void write_training_history_values(std::ostream&, double) method
+
+/// This method writes a single training history value preceded by a comma. 
+/// @param file Training history file.
+/// @param value Value to be written.
+
+void TrainingAlgorithm::write_training_history_values(std::ostream& file, double value)
+{
+   file << "," << value;
+}
+
+
+// void write_training_history_values(std::ostream&, const Vector<double>&) method
+
+/// This method writes all the elements of a training history vector, each one preceded by a comma. 
+/// @param file Training history file.
+/// @param vector Vector to be written.
+
+void TrainingAlgorithm::write_training_history_values(std::ostream& file, const Vector<double>& vector)
+{
+   int size = vector.get_size();
+
+   for(int i = 0; i < size; i++)
+   {
+      file << "," << vector[i];
+   }
+}
+
+
+// void write_training_history_values(std::ostream&, const Matrix<double>&) method
+
+/// This method writes all the elements of a training history matrix by rows, each one preceded by a comma. 
+/// @param file Training history file.
+/// @param matrix Matrix to be written.
+
+void TrainingAlgorithm::write_training_history_values(std::ostream& file, const Matrix<double>& matrix)
+{
+   int rows_number = matrix.get_rows_number();
+   int columns_number = matrix.get_columns_number();
+
+   for(int i = 0; i < rows_number; i++)
+   {
+      for(int j = 0; j < columns_number; j++)
+      {
+         file << "," << matrix[i][j];
+      }
+   }
+}
+
+
+// void write_training_history_binary(std::ostream&) method
+
+/// This method writes all the training history vectors of this class to a binary checkpoint. 
+/// @param checkpoint Binary output stream.
+
+void TrainingAlgorithm::write_training_history_binary(std::ostream& checkpoint)
+{
+   write_binary(checkpoint, parameters_history);
+   write_binary(checkpoint, parameters_norm_history);
+
+   write_binary(checkpoint, evaluation_history);
+   write_binary(checkpoint, gradient_history);
+   write_binary(checkpoint, gradient_norm_history);
+   write_binary(checkpoint, inverse_Hessian_history);
+   write_binary(checkpoint, validation_error_history);
+
+   write_binary(checkpoint, training_direction_history);
+   write_binary(checkpoint, training_rate_history);
+   write_binary(checkpoint, elapsed_time_history);
+}
+
+
+// void read_training_history_binary(std::istream&) method
+
+/// This method reads all the training history vectors of this class from a binary checkpoint. 
+/// @param checkpoint Binary input stream.
+
+void TrainingAlgorithm::read_training_history_binary(std::istream& checkpoint)
+{
+   read_binary(checkpoint, parameters_history);
+   read_binary(checkpoint, parameters_norm_history);
+
+   read_binary(checkpoint, evaluation_history);
+   read_binary(checkpoint, gradient_history);
+   read_binary(checkpoint, gradient_norm_history);
+   read_binary(checkpoint, inverse_Hessian_history);
+   read_binary(checkpoint, validation_error_history);
+
+   read_binary(checkpoint, training_direction_history);
+   read_binary(checkpoint, training_rate_history);
+   read_binary(checkpoint, elapsed_time_history);
+}
+
+
+// void save_checkpoint(const std::string&) method
+
+/// This method saves a binary checkpoint of the training state to the checkpoint file. 
+/// The training state is first serialized in memory by the training algorithm, so that the file is written at once.
+/// The checkpoint is written to a temporary file which then replaces the checkpoint file, so that an interrupted 
+/// write never leaves a partial checkpoint behind. 
+/// @param checkpoint Binary contents of the checkpoint.
+
+void TrainingAlgorithm::save_checkpoint(const std::string& checkpoint)
+{
+   std::string temporary_filename = checkpoint_filename + ".tmp";
+
+   std::ofstream file(temporary_filename.c_str(), std::ios::out | std::ios::binary);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void save_checkpoint(const std::string&) method." << std::endl
+                << "Cannot open checkpoint file " << temporary_filename << "." << std::endl;
+
+      exit(1);
+   }
+
+   file.write(checkpoint.data(), checkpoint.size());
+
+   file.close();
+
+   if(!file)
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "void save_checkpoint(const std::string&) method." << std::endl
+                << "Cannot write checkpoint file " << temporary_filename << "." << std::endl;
+
+      exit(1);
+   }
+
+   // Replace the previous checkpoint. Some systems do not rename onto an existing file.
+
+   if(std::rename(temporary_filename.c_str(), checkpoint_filename.c_str()) != 0)
+   {
+      std::remove(checkpoint_filename.c_str());
+
+      if(std::rename(temporary_filename.c_str(), checkpoint_filename.c_str()) != 0)
+      {
+         std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                   << "void save_checkpoint(const std::string&) method." << std::endl
+                   << "Cannot rename checkpoint file " << temporary_filename << "." << std::endl;
+
+         exit(1);
+      }
+   }
+}
+
+
+// std::string load_checkpoint(void) method
+
+/// This method returns the binary contents of the checkpoint file. 
+
+std::string TrainingAlgorithm::load_checkpoint(void)
+{
+   std::ifstream file(checkpoint_filename.c_str(), std::ios::in | std::ios::binary);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: TrainingAlgorithm class." << std::endl
+                << "std::string load_checkpoint(void) method." << std::endl
+                << "Cannot open checkpoint file " << checkpoint_filename << "." << std::endl;
+
+      exit(1);
+   }
+
+   std::ostringstream buffer;
+
+   buffer << file.rdbuf();
+
+   return(buffer.str());
+}
+
 }
 
 
@@ -37,7 +37,12 @@ public:
 
    /// Available training operators for obtaining the train rate.
 
-   enum TrainingRateMethod{Fixed, GoldenSection, BrentMethod};
+   enum TrainingRateMethod{Fixed, GoldenSection, BrentMethod, StrongWolfe};
+
+   /// Phases of a training epoch whose time can be measured.
+
+   enum ProfilingPhase{EvaluationPhase, GradientPhase, HessianPhase, TrainingDirectionPhase, LineSearchPhase, 
+                       ValidationPhase, TrainingHistoryPhase, EvolutionPhase};
 
 
    // GENERAL CONSTRUCTOR
@@ -57,6 +62,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   virtual TrainingAlgorithm* clone(ObjectiveFunctional*);
+
    // Get methods
 
    ObjectiveFunctional* get_objective_functional_pointer(void);
@@ -72,6 +81,9 @@ public:
    double get_bracketing_factor(void);   
    double get_training_rate_tolerance(void);
 
+   double get_sufficient_decrease_parameter(void);
+   double get_curvature_parameter(void);
+
    double get_warning_parameters_norm(void);
    double get_warning_gradient_norm(void);
    double get_warning_training_rate(void);
@@ -95,6 +107,31 @@ public:
 
    bool get_early_stopping(void);
 
+   // Validation
+
+   int get_validation_interval(void);
+   bool get_asynchronous_validation(void);
+
+   // Checkpoints
+
+   int get_checkpoint_period(void);
+   std::string get_checkpoint_filename(void);
+
+   // Training history sink
+
+   int get_training_history_period(void);
+   int get_training_history_depth(void);
+   std::string get_training_history_filename(void);
+
+   // Profiling
+
+   bool get_profiling(void);
+   bool get_reserve_profiling_trace(void);
+
+   Vector<double>& get_profiling_total_time(void);
+   Vector<int>& get_profiling_calls_number(void);
+   Matrix<int>& get_profiling_histogram(void);
+
    // Reserve training history
 
    bool get_reserve_parameters_history(void);
@@ -149,6 +186,9 @@ public:
    void set_bracketing_factor(double);   
    void set_training_rate_tolerance(double);
 
+   void set_sufficient_decrease_parameter(double);
+   void set_curvature_parameter(double);
+
    void set_warning_parameters_norm(double);
    void set_warning_gradient_norm(double);
    void set_warning_training_rate(double);
@@ -172,6 +212,27 @@ public:
 
    void set_early_stopping(bool);
 
+   // Validation
+
+   void set_validation_interval(int);
+   void set_asynchronous_validation(bool);
+
+   // Checkpoints
+
+   void set_checkpoint_period(int);
+   void set_checkpoint_filename(const std::string&);
+
+   // Training history sink
+
+   void set_training_history_period(int);
+   void set_training_history_depth(int);
+   void set_training_history_filename(const std::string&);
+
+   // Profiling
+
+   void set_profiling(bool);
+   void set_reserve_profiling_trace(bool);
+
    // Reserve training history
 
    void set_reserve_parameters_history(bool);
@@ -218,24 +279,67 @@ public:
 
    virtual void train(void) = 0;
 
+   virtual void resume(void);
+
+   // Validation methods
+
+   Vector<double> calculate_gradient_validation_error(double&);
+
+   void delete_validation_replica(void);
+
    // Training rate method
 
    Vector<double> calculate_training_rate_evaluation(double, const Vector<double>&, double);
+   Vector<double> calculate_training_rate_evaluation(double, const Vector<double>&, const Vector<double>&, double);
 
    Vector<double> calculate_fixed_training_rate_evaluation(double, const Vector<double>&, double);
    Vector<double> calculate_golden_section_training_rate_evaluation(double, const Vector<double>&, double);
    Vector<double> calculate_Brent_method_training_rate_evaluation(double, const Vector<double>&, double);
 
+   Vector<double> calculate_strong_Wolfe_training_rate_evaluation(double, const Vector<double>&, double);
+   Vector<double> calculate_strong_Wolfe_training_rate_evaluation(double, const Vector<double>&, const Vector<double>&, double);
+
+   double calculate_cubic_interpolation_training_rate(double, double, double, double, double, double);
+
    Vector<double> calculate_bracketing_training_rate_evaluation(double, const Vector<double>&, double);
 
    // Training history methods   
 
    virtual void resize_training_history(int);
 
+   int calculate_training_history_size(int);
+   int get_training_history_index(int);
+
+   void initialize_training_history(int);
+   void append_training_history(int);
+   void finish_training_history(int);
+
+   virtual void rotate_training_history(int);
+
+   virtual void write_training_history_header(std::ostream&);
+   virtual void write_training_history_record(std::ostream&, int);
+
    virtual std::string get_training_history_XML(bool);   
    void print_training_history(void);
    void save_training_history(const char*);
 
+   // Profiling methods
+
+   double calculate_monotonic_time(void);
+
+   void initialize_profiling(void);
+
+   void begin_profiling_phase(const ProfilingPhase&);
+   void end_profiling_phase(const ProfilingPhase&);
+
+   std::string get_profiling_phase_name(const ProfilingPhase&);
+
+   std::string get_profiling_report_XML(bool);
+   void print_profiling_report(void);
+   void save_profiling_report(const char*);
+
+   void save_profiling_trace(const char*);
+
    // Utility methods
 
    virtual std::string to_XML(bool);   
@@ -246,6 +350,43 @@ public:
 
 protected:
 
+   // Checkpoint methods
+
+   void write_checkpoint_header(std::ostream&, const std::string&);
+   void read_checkpoint_header(std::istream&, const std::string&);
+
+   void write_binary(std::ostream&, int);
+   void write_binary(std::ostream&, double);
+   void write_binary(std::ostream&, const std::string&);
+   void write_binary(std::ostream&, const Vector<double>&);
+   void write_binary(std::ostream&, const Matrix<double>&);
+   void write_binary(std::ostream&, const Vector< Vector<double> >&);
+   void write_binary(std::ostream&, const Vector< Matrix<double> >&);
+
+   void read_binary(std::istream&, int&);
+   void read_binary(std::istream&, double&);
+   void read_binary(std::istream&, std::string&);
+   void read_binary(std::istream&, Vector<double>&);
+   void read_binary(std::istream&, Matrix<double>&);
+   void read_binary(std::istream&, Vector< Vector<double> >&);
+   void read_binary(std::istream&, Vector< Matrix<double> >&);
+
+   virtual void write_training_history_binary(std::ostream&);
+   virtual void read_training_history_binary(std::istream&);
+
+   void save_checkpoint(const std::string&);
+   std::string load_checkpoint(void);
+
+   // Training history file methods
+
+   void save_training_history_record(int);
+
+   void write_training_history_column_names(std::ostream&, const std::string&, int);
+
+   void write_training_history_values(std::ostream&, double);
+   void write_training_history_values(std::ostream&, const Vector<double>&);
+   void write_training_history_values(std::ostream&, const Matrix<double>&);
+
    // FIELDS
 
    /// Pointer to an objective functional for a multilayer perceptron object.
@@ -270,6 +411,19 @@ protected:
 
    double training_rate_tolerance;
 
+   /// Constant of the sufficient decrease condition in the strong Wolfe line search.
+
+   double sufficient_decrease_parameter;
+
+   /// Constant of the curvature condition in the strong Wolfe line search.
+
+   double curvature_parameter;
+
+   /// Objective function gradient at the training rate found by the last strong Wolfe line search. 
+   /// Training algorithms can reuse it instead of computing the gradient again in the next epoch.
+
+   Vector<double> training_rate_gradient;
+
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
    double warning_parameters_norm;
@@ -325,6 +479,110 @@ protected:
 
    bool early_stopping;
 
+   /// Number of epochs between two calculations of the validation error. 
+   /// In the epochs between them the last validation error is kept, so that early stopping can only take place when
+   /// the validation error is calculated.
+
+   int validation_interval;
+
+   /// True if the validation error is to be calculated on a copy of the multilayer perceptron while the gradient is
+   /// calculated, when compiled with OpenMP, and false otherwise. 
+   /// The objective functional must redefine the clone method.
+
+   bool asynchronous_validation;
+
+   /// Clone of the multilayer perceptron on which the validation error is calculated asynchronously. 
+   /// It is created by the first asynchronous validation of a training process and deleted at the end of it. 
+
+   MultilayerPerceptron* validation_multilayer_perceptron_pointer;
+
+   /// Clone of the objective functional which calculates the validation error asynchronously. 
+
+   ObjectiveFunctional* validation_objective_functional_pointer;
+
+   // CHECKPOINTS
+
+   /// Number of epochs between two checkpoints of the training state. 
+   /// Zero means that no checkpoints are saved.
+
+   int checkpoint_period;
+
+   /// Name of the binary file where the checkpoints are saved, and from which training is resumed.
+
+   std::string checkpoint_filename;
+
+   /// True while training is being resumed from the checkpoint file, and false otherwise.
+
+   bool resume_training;
+
+   // TRAINING HISTORY SINK
+
+   /// Number of epochs between two records of the training history. 
+   /// The last epoch of training is always recorded.
+
+   int training_history_period;
+
+   /// Maximum number of records kept in memory for each training history vector. 
+   /// When it is exceeded the oldest records are overwritten, as in a ring buffer. 
+   /// Zero means that all the records are kept.
+
+   int training_history_depth;
+
+   /// Name of the comma-separated values file to which the training history records are appended while training 
+   /// proceeds. 
+   /// An empty name means that the training history is only kept in memory.
+
+   std::string training_history_filename;
+
+   // PROFILING
+
+   /// True if the time spent in each phase of training is to be measured, false otherwise.
+
+   bool profiling;
+
+   /// True if the beginning and the duration of every timed phase are to be reserved for a trace, false otherwise.
+
+   bool reserve_profiling_trace;
+
+   /// Monotonic time at which profiling began, which is the origin of the trace.
+
+   double profiling_beginning_time;
+
+   /// Monotonic time at which the current call of each phase began.
+
+   Vector<double> profiling_phase_beginning_time;
+
+   /// Total time spent in each phase, in seconds.
+
+   Vector<double> profiling_total_time;
+
+   /// Number of timed calls of each phase.
+
+   Vector<int> profiling_calls_number;
+
+   /// Histogram of the durations of the calls of each phase, with one row per phase. 
+   /// The columns count the calls which last less than 1 microsecond, less than 10 microseconds, and so on up to 
+   /// 10 seconds, and the last one the calls which last 10 seconds or more.
+
+   Matrix<int> profiling_histogram;
+
+   /// Number of timed calls in the trace.
+
+   int profiling_trace_size;
+
+   /// Phase of every timed call in the trace. 
+   /// The trace vectors grow geometrically, so that their size can be greater than the trace size.
+
+   Vector<int> profiling_trace_phase;
+
+   /// Beginning of every timed call in the trace, in seconds since profiling began.
+
+   Vector<double> profiling_trace_beginning_time;
+
+   /// Duration of every timed call in the trace, in seconds.
+
+   Vector<double> profiling_trace_duration;
+
    // TRAINING HISTORY
 
    /// True if the parameters history matrix is to be reserved, false otherwise.
@@ -0,0 +1,1190 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T R U N C A T E D   N E W T O N   M E T H O D   C L A S S                                                  */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <ctime>
+
+// Flood includes
+
+#include "TruncatedNewtonMethod.h"
+
+namespace Flood
+{
+
+// GENERAL CONSTRUCTOR
+
+/// General constructor. It creates a truncated Newton method training algorithm object associated to an
+/// objective functional object.
+/// It also initializes the class members to their default values.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TruncatedNewtonMethod::TruncatedNewtonMethod(ObjectiveFunctional* new_objective_functional_pointer)
+: TrainingAlgorithm(new_objective_functional_pointer)
+{
+   set_default();
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a truncated Newton method training algorithm object not associated to any
+/// objective functional object.
+/// It also initializes the class members to their default values.
+
+TruncatedNewtonMethod::TruncatedNewtonMethod(void) : TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TruncatedNewtonMethod::~TruncatedNewtonMethod(void)
+{
+}
+
+
+// METHODS
+
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+/// This method returns a new truncated Newton method object with the same members as this one, but associated to another
+/// objective functional.
+/// @param new_objective_functional_pointer Pointer to an objective functional object.
+
+TrainingAlgorithm* TruncatedNewtonMethod::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   TruncatedNewtonMethod* truncated_Newton_method_pointer = new TruncatedNewtonMethod(*this);
+
+   truncated_Newton_method_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(truncated_Newton_method_pointer);
+}
+
+
+// PreconditioningMethod get_preconditioning_method(void) method
+
+/// This method returns the preconditioner used in the inner conjugate gradient iterations.
+
+TruncatedNewtonMethod::PreconditioningMethod TruncatedNewtonMethod::get_preconditioning_method(void)
+{
+   return(preconditioning_method);
+}
+
+
+// std::string get_preconditioning_method_name(void) method
+
+/// This method returns the name of the preconditioner used in the inner conjugate gradient iterations.
+
+std::string TruncatedNewtonMethod::get_preconditioning_method_name(void)
+{
+   switch(preconditioning_method)
+   {
+      case None:
+      {
+         return("None");
+	  }
+      break;
+
+      case DiagonalBFGS:
+      {
+         return("DiagonalBFGS");
+	  }
+      break;
+
+	  default:
+      {
+         std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                   << "std::string get_preconditioning_method_name(void) method." << std::endl
+                   << "Unknown preconditioning method." << std::endl;
+
+         exit(1);
+	  }
+      break;
+   }
+}
+
+
+// int get_maximum_conjugate_gradient_iterations_number(void) method
+
+/// This method returns the maximum number of conjugate gradient iterations for solving the Newton system
+/// in each epoch.
+
+int TruncatedNewtonMethod::get_maximum_conjugate_gradient_iterations_number(void)
+{
+   return(maximum_conjugate_gradient_iterations_number);
+}
+
+
+// double get_maximum_forcing_term(void) method
+
+/// This method returns the upper bound of the relative residual at which the conjugate gradient iterations stop.
+
+double TruncatedNewtonMethod::get_maximum_forcing_term(void)
+{
+   return(maximum_forcing_term);
+}
+
+
+// int get_conjugate_gradient_iterations_count(void) method
+
+/// This method returns the number of conjugate gradient iterations performed when computing the last truncated
+/// Newton step.
+
+int TruncatedNewtonMethod::get_conjugate_gradient_iterations_count(void)
+{
+   return(conjugate_gradient_iterations_count);
+}
+
+
+// int get_negative_curvature_count(void) method
+
+/// This method returns the number of times that a direction of negative curvature has been found by the
+/// conjugate gradient iterations during the last training process.
+
+int TruncatedNewtonMethod::get_negative_curvature_count(void)
+{
+   return(negative_curvature_count);
+}
+
+
+// void set_default(void) method
+
+/// This method sets the members of the truncated Newton method object to their default values.
+/// The members of the training algorithm base class are set to their default values, and also:
+/// <ul>
+/// <li> Training rate method: Strong Wolfe
+/// <li> Preconditioning method: Diagonal BFGS
+/// <li> Maximum conjugate gradient iterations number: 100
+/// <li> Maximum forcing term: 0.5
+/// </ul>
+
+void TruncatedNewtonMethod::set_default(void)
+{
+   TrainingAlgorithm::set_default();
+
+   // TRAINING OPERATORS
+
+   // The truncated Newton step has a natural unit length, which the strong Wolfe line search tries first, while 
+   // a line minimization would cost many evaluations per epoch
+
+   training_rate_method = StrongWolfe;
+
+   preconditioning_method = DiagonalBFGS;
+
+   // TRAINING PARAMETERS
+
+   maximum_conjugate_gradient_iterations_number = 100;
+   maximum_forcing_term = 0.5;
+
+   conjugate_gradient_iterations_count = 0;
+   negative_curvature_count = 0;
+}
+
+
+// void set_preconditioning_method(const PreconditioningMethod&) method
+
+/// This method sets a new preconditioner for the inner conjugate gradient iterations.
+/// @param new_preconditioning_method Preconditioning method value.
+
+void TruncatedNewtonMethod::set_preconditioning_method(const TruncatedNewtonMethod::PreconditioningMethod&
+new_preconditioning_method)
+{
+   preconditioning_method = new_preconditioning_method;
+}
+
+
+// void set_preconditioning_method(const std::string&) method
+
+/// This method sets a new preconditioner for the inner conjugate gradient iterations from a string containing
+/// the name.
+/// Possible values are:
+/// <ul>
+/// <li> "None"
+/// <li> "DiagonalBFGS"
+/// <ul>
+/// @param new_preconditioning_method_name Name of preconditioning method.
+
+void TruncatedNewtonMethod::set_preconditioning_method(const std::string& new_preconditioning_method_name)
+{
+   if(new_preconditioning_method_name == "None")
+   {
+      preconditioning_method = None;
+   }
+   else if(new_preconditioning_method_name == "DiagonalBFGS")
+   {
+      preconditioning_method = DiagonalBFGS;
+   }
+   else
+   {
+      std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                << "void set_preconditioning_method(const std::string&) method." << std::endl
+				<< "Unknown preconditioning method: " << new_preconditioning_method_name << "." <<std::endl;
+
+      exit(1);
+   }
+}
+
+
+// void set_maximum_conjugate_gradient_iterations_number(int) method
+
+/// This method sets a new maximum number of conjugate gradient iterations for solving the Newton system
+/// in each epoch.
+/// @param new_maximum_conjugate_gradient_iterations_number Maximum number of conjugate gradient iterations.
+
+void TruncatedNewtonMethod::set_maximum_conjugate_gradient_iterations_number(int new_maximum_conjugate_gradient_iterations_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_maximum_conjugate_gradient_iterations_number <= 0)
+   {
+      std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                << "void set_maximum_conjugate_gradient_iterations_number(int) method." << std::endl
+                << "Maximum number of conjugate gradient iterations must be greater than 0." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   maximum_conjugate_gradient_iterations_number = new_maximum_conjugate_gradient_iterations_number;
+}
+
+
+// void set_maximum_forcing_term(double) method
+
+/// This method sets a new upper bound of the relative residual at which the conjugate gradient iterations stop.
+/// @param new_maximum_forcing_term Maximum forcing term value. It must be comprised between 0 and 1.
+
+void TruncatedNewtonMethod::set_maximum_forcing_term(double new_maximum_forcing_term)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(new_maximum_forcing_term <= 0.0 || new_maximum_forcing_term >= 1.0)
+   {
+      std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                << "void set_maximum_forcing_term(double) method." << std::endl
+                << "Maximum forcing term must be comprised between 0 and 1." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   maximum_forcing_term = new_maximum_forcing_term;
+}
+
+
+// Vector<double> calculate_truncated_Newton_step(const Vector<double>&) method
+
+/// This method returns an approximate solution of the Newton system H*x = -g, computed by preconditioned conjugate
+/// gradients with products of the Hessian matrix and vectors.
+/// The iterations stop when the relative residual falls below the forcing term, when the maximum number of
+/// conjugate gradient iterations is reached, or when a direction of negative curvature is found.
+/// In the last case the current iterate is returned, or the preconditioned steepest descent direction if no
+/// iteration has been completed yet.
+/// @param gradient Objective function gradient at the current point.
+
+Vector<double> TruncatedNewtonMethod::calculate_truncated_Newton_step(const Vector<double>& gradient)
+{
+   int parameters_number = gradient.get_size();
+
+   double gradient_norm = gradient.calculate_norm();
+
+   // Forcing term
+
+   double forcing_term = sqrt(gradient_norm);
+
+   if(forcing_term > maximum_forcing_term)
+   {
+      forcing_term = maximum_forcing_term;
+   }
+
+   double residual_tolerance = forcing_term*gradient_norm;
+
+   // Conjugate gradient stuff
+
+   Vector<double> step(parameters_number, 0.0);
+
+   Vector<double> residual = gradient*(-1.0);
+   Vector<double> preconditioned_residual(parameters_number);
+
+   Vector<double> conjugate_direction(parameters_number);
+   Vector<double> Hessian_dot_conjugate_direction(parameters_number);
+
+   bool preconditioning = (preconditioning_method == DiagonalBFGS && preconditioner_diagonal.get_size() == parameters_number);
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      preconditioned_residual[i] = preconditioning ? residual[i]/preconditioner_diagonal[i] : residual[i];
+   }
+
+   conjugate_direction = preconditioned_residual;
+
+   double residual_dot_preconditioned_residual = residual.dot(preconditioned_residual);
+
+   double curvature;
+   double conjugate_step;
+   double conjugate_factor;
+   double old_residual_dot_preconditioned_residual;
+
+   conjugate_gradient_iterations_count = 0;
+
+   for(int iteration = 0; iteration < maximum_conjugate_gradient_iterations_number; iteration++)
+   {
+      Hessian_dot_conjugate_direction = objective_functional_pointer->calculate_vector_dot_Hessian(conjugate_direction);
+
+      curvature = conjugate_direction.dot(Hessian_dot_conjugate_direction);
+
+      // Negative curvature
+
+      if(curvature <= 1.0e-12*conjugate_direction.dot(conjugate_direction))
+      {
+         negative_curvature_count++;
+
+         if(iteration == 0)
+         {
+            step = conjugate_direction;
+         }
+
+         break;
+      }
+
+      conjugate_step = residual_dot_preconditioned_residual/curvature;
+
+      for(int i = 0; i < parameters_number; i++)
+      {
+         step[i] += conjugate_step*conjugate_direction[i];
+         residual[i] -= conjugate_step*Hessian_dot_conjugate_direction[i];
+      }
+
+      conjugate_gradient_iterations_count++;
+
+      if(residual.calculate_norm() <= residual_tolerance)
+      {
+         break;
+      }
+
+      for(int i = 0; i < parameters_number; i++)
+      {
+         preconditioned_residual[i] = preconditioning ? residual[i]/preconditioner_diagonal[i] : residual[i];
+      }
+
+      old_residual_dot_preconditioned_residual = residual_dot_preconditioned_residual;
+
+      residual_dot_preconditioned_residual = residual.dot(preconditioned_residual);
+
+      conjugate_factor = residual_dot_preconditioned_residual/old_residual_dot_preconditioned_residual;
+
+      for(int i = 0; i < parameters_number; i++)
+      {
+         conjugate_direction[i] = preconditioned_residual[i] + conjugate_factor*conjugate_direction[i];
+      }
+   }
+
+   return(step);
+}
+
+
+// Vector<double> calculate_training_direction(const Vector<double>&) method
+
+/// This method returns the normalized truncated Newton step.
+/// @param gradient Objective function gradient at the current point.
+
+Vector<double> TruncatedNewtonMethod::calculate_training_direction(const Vector<double>& gradient)
+{
+   Vector<double> training_direction = calculate_truncated_Newton_step(gradient);
+
+   double training_direction_norm = training_direction.calculate_norm();
+
+   return(training_direction/training_direction_norm);
+}
+
+
+// Vector<double> calculate_gradient_descent_training_direction(const Vector<double>&) method
+
+/// This method returns the normalized gradient descent training direction, which is used when the truncated Newton
+/// step is not a descent direction.
+/// @param gradient Objective function gradient at the current point.
+
+Vector<double> TruncatedNewtonMethod::calculate_gradient_descent_training_direction(const Vector<double>& gradient)
+{
+   double gradient_norm = gradient.calculate_norm();
+
+   return(gradient/(-1.0*gradient_norm));
+}
+
+
+// void update_preconditioner(const Vector<double>&, const Vector<double>&) method
+
+/// This method updates the diagonal preconditioner with the diagonal of the BFGS update of the Hessian matrix.
+/// The update is skipped when the curvature condition does not hold, and any non positive element is reset to one.
+/// @param parameters_increment Difference between the actual and the previous parameters.
+/// @param gradient_increment Difference between the actual and the previous gradients.
+
+void TruncatedNewtonMethod::update_preconditioner(const Vector<double>& parameters_increment, const Vector<double>& gradient_increment)
+{
+   int parameters_number = parameters_increment.get_size();
+
+   if(preconditioner_diagonal.get_size() != parameters_number)
+   {
+      preconditioner_diagonal.set(parameters_number, 1.0);
+   }
+
+   double parameters_increment_dot_gradient_increment = parameters_increment.dot(gradient_increment);
+
+   if(parameters_increment_dot_gradient_increment <= 1.0e-12*parameters_increment.dot(parameters_increment))
+   {
+      return;
+   }
+
+   double parameters_increment_dot_preconditioner_dot_parameters_increment = 0.0;
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      parameters_increment_dot_preconditioner_dot_parameters_increment
+      += preconditioner_diagonal[i]*parameters_increment[i]*parameters_increment[i];
+   }
+
+   double diagonal_increment;
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      diagonal_increment = gradient_increment[i]*gradient_increment[i]/parameters_increment_dot_gradient_increment
+      - pow(preconditioner_diagonal[i]*parameters_increment[i], 2)/parameters_increment_dot_preconditioner_dot_parameters_increment;
+
+      preconditioner_diagonal[i] += diagonal_increment;
+
+      if(preconditioner_diagonal[i] <= 1.0e-12)
+      {
+         preconditioner_diagonal[i] = 1.0;
+      }
+   }
+}
+
+
+// void train(void) method
+
+/// This method trains a multilayer perceptron with an associated objective functional according to the truncated
+/// Newton method.
+/// Training occurs according to the training operators, training parameters and stopping criteria.
+
+void TruncatedNewtonMethod::train(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef _DEBUG
+
+   if(objective_functional_pointer == NULL)
+   {
+      std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                << "void train(void) method." << std::endl
+                << "Pointer to objective functional object cannot be NULL." << std::endl;
+
+      exit(1);
+   }
+
+   #endif
+
+   // Start training
+
+   if(display)
+   {
+      std::cout << "Training with truncated Newton method..." << std::endl;
+   }
+
+   // Multilayer perceptron stuff
+
+   MultilayerPerceptron* multilayer_perceptron_pointer = objective_functional_pointer->get_multilayer_perceptron_pointer();
+
+   int parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+   Vector<double> parameters(parameters_number);
+   double parameters_norm;
+
+   Vector<double> parameters_increment(parameters_number);
+   double parameters_increment_norm;
+
+   // Objective functional stuff
+
+   double validation_error = 0.0;
+   double old_validation_error = 0.0;
+   double validation_error_increment = 0.0;
+
+   double evaluation = 0.0;
+   double old_evaluation = 0.0;
+   double evaluation_improvement = 0.0;
+
+   Vector<double> gradient(parameters_number);
+   Vector<double> old_gradient(parameters_number);
+   double gradient_norm;
+
+   // Training algorithm stuff
+
+   Vector<double> old_parameters_increment(parameters_number);
+
+   Vector<double> training_direction(parameters_number);
+   double truncated_Newton_step_norm;
+
+   double training_slope;
+
+   double initial_training_rate = 0.0;
+   double training_rate = 0.0;
+
+   Vector<double> training_rate_evaluation(2);
+
+   bool stop_training = false;
+
+   double beginning_time = calculate_monotonic_time();
+   double elapsed_time;
+
+   initialize_profiling();
+
+   preconditioner_diagonal.set(parameters_number, 1.0);
+
+   negative_curvature_count = 0;
+
+   initialize_training_history(maximum_epochs_number+1);
+
+   // Main loop
+
+   for(int epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   {
+      // Multilayer perceptron
+
+      parameters = multilayer_perceptron_pointer->get_parameters();
+
+      parameters_norm = parameters.calculate_norm();
+
+      if(display && parameters_norm >= warning_parameters_norm)
+      {
+         std::cout << "Flood Warning: Parameters norm is " << parameters_norm << "." << std::endl;
+      }
+
+      // Objective functional stuff
+
+      if(epoch == 0)
+      {
+         evaluation = objective_functional_pointer->calculate_evaluation();
+         evaluation_improvement = 0.0;
+      }
+      else
+      {
+         evaluation = training_rate_evaluation[1];
+         evaluation_improvement = old_evaluation - evaluation;
+      }
+
+      if(epoch != 0 && training_rate_method == StrongWolfe)
+      {
+         // The strong Wolfe line search has already computed the gradient at the new parameters
+
+         gradient = training_rate_gradient;
+
+         if(epoch % validation_interval == 0)
+         {
+            validation_error = objective_functional_pointer->calculate_validation_error();
+         }
+      }
+      else if(epoch % validation_interval == 0)
+      {
+         gradient = calculate_gradient_validation_error(validation_error);
+      }
+      else
+      {
+         gradient = objective_functional_pointer->calculate_gradient();
+      }
+
+      if(epoch == 0)
+      {
+         validation_error_increment = 0.0;
+      }
+      else
+      {
+         validation_error_increment = validation_error - old_validation_error;
+      }
+
+      gradient_norm = gradient.calculate_norm();
+
+      if(display && gradient_norm >= warning_gradient_norm)
+      {
+         std::cout << "Flood Warning: Gradient norm is " << gradient_norm << "." << std::endl;
+      }
+
+      if(epoch != 0 && preconditioning_method == DiagonalBFGS)
+      {
+         update_preconditioner(old_parameters_increment, gradient - old_gradient);
+      }
+
+      // Training algorithm
+
+      if(gradient_norm <= gradient_norm_goal)
+      {
+         training_direction = calculate_gradient_descent_training_direction(gradient);
+
+         truncated_Newton_step_norm = 0.0;
+      }
+      else
+      {
+         training_direction = calculate_truncated_Newton_step(gradient);
+
+         truncated_Newton_step_norm = training_direction.calculate_norm();
+
+         training_direction /= truncated_Newton_step_norm;
+      }
+
+      // Calculate evaluation training slope
+
+      training_slope = (gradient/gradient_norm).dot(training_direction);
+
+      // Check for a descent direction
+
+      if(training_slope >= 0.0)
+      {
+         // Reset training direction
+
+         training_direction = calculate_gradient_descent_training_direction(gradient);
+
+         truncated_Newton_step_norm = 0.0;
+      }
+
+      // Get initial training rate
+
+      if(truncated_Newton_step_norm > 0.0)
+      {
+         initial_training_rate = truncated_Newton_step_norm;
+      }
+      else
+      {
+         initial_training_rate = first_training_rate;
+      }
+
+      training_rate_evaluation = calculate_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate);
+
+      training_rate = training_rate_evaluation[0];
+
+      if(epoch != 0 && training_rate < 1.0e-99)
+      {
+         // Reset training direction
+
+         training_direction = calculate_gradient_descent_training_direction(gradient);
+
+         training_rate_evaluation = calculate_training_rate_evaluation(evaluation, gradient, training_direction, first_training_rate);
+
+         training_rate = training_rate_evaluation[0];
+      }
+
+      parameters_increment = training_direction*training_rate;
+      parameters_increment_norm = parameters_increment.calculate_norm();
+
+      // Elapsed time
+
+      elapsed_time = calculate_monotonic_time() - beginning_time;
+
+      // Training history
+
+      int history_index = get_training_history_index(epoch);
+
+      // Training history multilayer perceptron
+
+      if(reserve_parameters_history)
+      {
+         parameters_history[history_index] = parameters;
+      }
+
+      if(reserve_parameters_norm_history)
+      {
+         parameters_norm_history[history_index] = parameters_norm;
+      }
+
+      // Training history objective functional
+
+      if(reserve_evaluation_history)
+      {
+         evaluation_history[history_index] = evaluation;
+      }
+
+      if(reserve_validation_error_history)
+      {
+         if(epoch % validation_interval == 0)
+         {
+            validation_error_history[history_index] = validation_error;
+         }
+         else
+         {
+            validation_error_history[history_index] = -1.0;
+         }
+      }
+
+      if(reserve_gradient_history)
+      {
+         gradient_history[history_index] = gradient;
+      }
+
+      if(reserve_gradient_norm_history)
+      {
+         gradient_norm_history[history_index] = gradient_norm;
+      }
+
+      // Training history training algorithm
+
+      if(reserve_training_direction_history)
+      {
+         training_direction_history[history_index] = training_direction;
+      }
+
+      if(reserve_training_rate_history)
+      {
+         training_rate_history[history_index] = training_rate;
+      }
+
+      if(reserve_elapsed_time_history)
+      {
+         elapsed_time_history[history_index] = elapsed_time;
+      }
+
+      append_training_history(epoch);
+
+      // Stopping Criteria
+
+      if(parameters_increment_norm <= minimum_parameters_increment_norm)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum parameters increment norm reached." << std::endl
+			          << "Parameters increment norm: " << parameters_increment_norm << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch != 0 && evaluation_improvement <= minimum_evaluation_improvement)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum evaluation improvement reached." << std::endl
+                      << "Evaluation improvement: " << evaluation_improvement << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(evaluation <= evaluation_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Evaluation goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(early_stopping && epoch != 0 && validation_error_increment > 0.0)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Validation error stopped improving." << std::endl;
+            std::cout << "Validation error increment: "<< validation_error_increment << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(gradient_norm <= gradient_norm_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Gradient norm goal reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(epoch == maximum_epochs_number)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum number of epochs reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      else if(elapsed_time >= maximum_time)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum training time reached." << std::endl;
+         }
+
+         stop_training = true;
+      }
+
+      if(stop_training)
+      {
+         if(display)
+		 {
+            std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+            std::cout << "Evaluation: " << evaluation << std::endl;
+
+            if(validation_error != 0)
+            {
+               std::cout << "Validation error: " << validation_error << std::endl;
+            }
+
+            std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+            objective_functional_pointer->print_information();
+
+            std::cout << "Conjugate gradient iterations: " << conjugate_gradient_iterations_count << std::endl
+                      << "Negative curvature count: " << negative_curvature_count << std::endl
+                      << "Training rate: " << training_rate << std::endl
+                      << "Elapsed time: " << elapsed_time << std::endl;
+		 }
+
+         finish_training_history(1+epoch);
+
+         break;
+      }
+      else if(display && epoch % display_period == 0)
+      {
+         std::cout << "Epoch " << epoch << ";" << std::endl;
+
+         std::cout << "Parameters norm: " << parameters_norm << std::endl;
+
+         std::cout << "Evaluation: " << evaluation << std::endl;
+
+         if(validation_error != 0)
+         {
+            std::cout << "Validation error: " << validation_error << std::endl;
+         }
+
+         std::cout << "Gradient norm: " << gradient_norm << std::endl;
+
+         objective_functional_pointer->print_information();
+
+         std::cout << "Conjugate gradient iterations: " << conjugate_gradient_iterations_count << std::endl
+                   << "Training rate: " << training_rate << std::endl
+                   << "Elapsed time: " << elapsed_time << std::endl;
+      }
+
+      // Update stuff
+
+      old_evaluation = evaluation;
+
+	  old_gradient = gradient;
+
+      old_parameters_increment = parameters_increment;
+
+      if(early_stopping)
+      {
+         old_validation_error = validation_error;
+      }
+
+      // Set new parameters
+
+      parameters += parameters_increment;
+
+      multilayer_perceptron_pointer->set_parameters(parameters);
+   }
+
+   delete_validation_replica();
+}
+
+
+// void set_reserve_all_training_history(bool) method
+
+/// This method makes the training history of all variables to reseved or not in memory.
+/// The inverse Hessian is never computed by this training algorithm, so its history is not reserved.
+/// @param new_reserve_all_training_history True if the training history of all variables is to be reserved,
+/// false otherwise.
+
+void TruncatedNewtonMethod::set_reserve_all_training_history(bool new_reserve_all_training_history)
+{
+   reserve_parameters_history = new_reserve_all_training_history;
+   reserve_parameters_norm_history = new_reserve_all_training_history;
+
+   reserve_evaluation_history = new_reserve_all_training_history;
+   reserve_validation_error_history = new_reserve_all_training_history;
+   reserve_gradient_history = new_reserve_all_training_history;
+   reserve_gradient_norm_history = new_reserve_all_training_history;
+
+   reserve_training_direction_history = new_reserve_all_training_history;
+   reserve_training_rate_history = new_reserve_all_training_history;
+   reserve_elapsed_time_history = new_reserve_all_training_history;
+}
+
+
+// void resize_training_history(int) method
+
+/// This method resizes all the training history vectors.
+/// @param new_size Size vectors containing the training history variables.
+
+void TruncatedNewtonMethod::resize_training_history(int new_size)
+{
+   // Multilayer perceptron
+
+   if(reserve_parameters_history)
+   {
+      parameters_history.resize(new_size);
+   }
+
+   if(reserve_parameters_norm_history)
+   {
+      parameters_norm_history.resize(new_size);
+   }
+
+   // Objective functional
+
+   if(reserve_evaluation_history)
+   {
+      evaluation_history.resize(new_size);
+   }
+
+   if(reserve_validation_error_history)
+   {
+      validation_error_history.resize(new_size);
+   }
+
+   if(reserve_gradient_history)
+   {
+      gradient_history.resize(new_size);
+   }
+
+   if(reserve_gradient_norm_history)
+   {
+      gradient_norm_history.resize(new_size);
+   }
+
+   // Training algorithm
+
+   if(reserve_training_direction_history)
+   {
+      training_direction_history.resize(new_size);
+   }
+
+   if(reserve_training_rate_history)
+   {
+      training_rate_history.resize(new_size);
+   }
+
+   if(reserve_elapsed_time_history)
+   {
+      elapsed_time_history.resize(new_size);
+   }
+}
+
+
+// std::string get_training_history_XML(bool) method
+
+/// This method returns a string with the history of the training process in XML-type format.
+/// Only that training history variables which have been reserved are included here.
+/// @param show_declaration True if an XML-type declaration is to be included at the beginning.
+
+std::string TruncatedNewtonMethod::get_training_history_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='TruncatedNewtonMethod' content='TrainingHistory'>" << std::endl;
+   }
+
+   buffer << TrainingAlgorithm::get_training_history_XML(false);
+
+   return(buffer.str());
+}
+
+
+// std::string to_XML(bool) method
+
+/// This method returns a XML-type string representation of this truncated Newton method object.
+/// It contains the preconditioner and the limits of the conjugate gradient iterations, together with
+/// the training parameters, stopping criteria and other user stuff of the training algorithm base class.
+/// @param show_declaration True if a XML-type declaration is to be included at the begining of the string.
+
+std::string TruncatedNewtonMethod::to_XML(bool show_declaration)
+{
+   std::stringstream buffer;
+
+   // Declaration
+
+   if(show_declaration)
+   {
+      buffer << "<Flood version='3.0' class='TruncatedNewtonMethod'>" << std::endl;
+   }
+
+   // Training operators
+
+   buffer << "<PreconditioningMethod>" << std::endl
+   	      << get_preconditioning_method_name() << std::endl
+          << "</PreconditioningMethod>" << std::endl;
+
+   // Training parameters
+
+   buffer << "<MaximumConjugateGradientIterationsNumber>" << std::endl
+          << maximum_conjugate_gradient_iterations_number << std::endl
+          << "</MaximumConjugateGradientIterationsNumber>" << std::endl;
+
+   buffer << "<MaximumForcingTerm>" << std::endl
+          << maximum_forcing_term << std::endl
+          << "</MaximumForcingTerm>" << std::endl;
+
+   buffer << TrainingAlgorithm::to_XML(false);
+
+   return(buffer.str());
+}
+
+
+// void load(const char*) method
+
+/// This method loads a truncated Newton method object from a XML-type file.
+/// The members of the training algorithm base class are loaded first.
+/// Please mind about the file format, wich is specified in the User's Guide.
+/// @param filename Name of XML-type file.
+
+void TruncatedNewtonMethod::load(const char* filename)
+{
+   TrainingAlgorithm::load(filename);
+
+   // File
+
+   std::fstream file;
+
+   file.open(filename, std::ios::in);
+
+   if(!file.is_open())
+   {
+      std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                << "void load(const char*) method." << std::endl
+                << "Cannot open truncated Newton method object XML-type file."  << std::endl;
+
+      exit(1);
+   }
+
+   std::string word;
+   std::string line;
+
+   // Declaration
+
+   getline(file, line);
+
+   while(!file.eof())
+   {
+      file >> word;
+
+	  // Training operators
+
+	  if(word == "<PreconditioningMethod>")
+	  {
+		 std::string new_preconditioning_method_name;
+
+         file >> new_preconditioning_method_name;
+
+         file >> word;
+
+		 if(word != "</PreconditioningMethod>")
+         {
+            std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown preconditioning method end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_preconditioning_method(new_preconditioning_method_name);
+	  }
+
+	  // Training parameters
+
+	  else if(word == "<MaximumConjugateGradientIterationsNumber>")
+	  {
+		 int new_maximum_conjugate_gradient_iterations_number;
+
+         file >> new_maximum_conjugate_gradient_iterations_number;
+
+         file >> word;
+
+		 if(word != "</MaximumConjugateGradientIterationsNumber>")
+         {
+            std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown maximum conjugate gradient iterations number end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_maximum_conjugate_gradient_iterations_number(new_maximum_conjugate_gradient_iterations_number);
+	  }
+
+	  else if(word == "<MaximumForcingTerm>")
+	  {
+		 double new_maximum_forcing_term;
+
+         file >> new_maximum_forcing_term;
+
+         file >> word;
+
+		 if(word != "</MaximumForcingTerm>")
+         {
+            std::cerr << "Flood Error: TruncatedNewtonMethod class." << std::endl
+                      << "void load(const char*) method." << std::endl
+          			  << "Unknown maximum forcing term end tag: " << word << std::endl;
+
+            exit(1);
+         }
+
+         set_maximum_forcing_term(new_maximum_forcing_term);
+	  }
+   }
+
+   // Close file
+
+   file.close();
+}
+
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,160 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T R U N C A T E D   N E W T O N   M E T H O D   C L A S S   H E A D E R                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __TRUNCATEDNEWTONMETHOD_H__
+#define __TRUNCATEDNEWTONMETHOD_H__
+
+// Flood includes
+
+#include "TrainingAlgorithm.h"
+#include "../ObjectiveFunctional/ObjectiveFunctional.h"
+
+namespace Flood
+{
+
+/// This concrete class represents the truncated Newton (or Hessian-free Newton) training algorithm
+/// for an objective functional of a multilayer perceptron.
+/// The Newton system is solved approximately by preconditioned conjugate gradients, which only need products of
+/// the Hessian matrix with vectors.
+/// Therefore neither the Hessian nor its inverse are ever stored.
+
+class TruncatedNewtonMethod : public TrainingAlgorithm
+{
+
+public:
+
+   // ENUMERATIONS
+
+   /// Enumeration of the available preconditioners for the inner conjugate gradient iterations.
+
+   enum PreconditioningMethod{None, DiagonalBFGS};
+
+
+   // GENERAL CONSTRUCTOR
+
+   explicit TruncatedNewtonMethod(ObjectiveFunctional*);
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit TruncatedNewtonMethod(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~TruncatedNewtonMethod(void);
+
+
+   // METHODS
+
+   // Clone methods
+
+   TrainingAlgorithm* clone(ObjectiveFunctional*);
+
+   // Get methods
+
+   PreconditioningMethod get_preconditioning_method(void);
+   std::string get_preconditioning_method_name(void);
+
+   int get_maximum_conjugate_gradient_iterations_number(void);
+   double get_maximum_forcing_term(void);
+
+   int get_conjugate_gradient_iterations_count(void);
+   int get_negative_curvature_count(void);
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_preconditioning_method(const PreconditioningMethod&);
+   void set_preconditioning_method(const std::string&);
+
+   void set_maximum_conjugate_gradient_iterations_number(int);
+   void set_maximum_forcing_term(double);
+
+   // Train methods
+
+   Vector<double> calculate_truncated_Newton_step(const Vector<double>&);
+
+   Vector<double> calculate_training_direction(const Vector<double>&);
+   Vector<double> calculate_gradient_descent_training_direction(const Vector<double>&);
+
+   void update_preconditioner(const Vector<double>&, const Vector<double>&);
+
+   void train(void);
+
+   // Training history methods
+
+   void set_reserve_all_training_history(bool);
+   void resize_training_history(int);
+
+   std::string get_training_history_XML(bool);
+
+   // Utility methods
+
+   std::string to_XML(bool);
+   void load(const char*);
+
+private:
+
+   // FIELDS
+
+   /// Preconditioner used in the inner conjugate gradient iterations.
+
+   PreconditioningMethod preconditioning_method;
+
+   /// Maximum number of conjugate gradient iterations for solving the Newton system in each epoch.
+
+   int maximum_conjugate_gradient_iterations_number;
+
+   /// Upper bound of the relative residual at which the conjugate gradient iterations stop.
+   /// The actual forcing term is the minimum of this value and the square root of the gradient norm.
+
+   double maximum_forcing_term;
+
+   /// Number of conjugate gradient iterations performed in the last call to calculate_truncated_Newton_step.
+
+   int conjugate_gradient_iterations_count;
+
+   /// Number of times that negative curvature has been found during the last training process.
+
+   int negative_curvature_count;
+
+   /// Diagonal approximation of the Hessian matrix used as preconditioner.
+
+   Vector<double> preconditioner_diagonal;
+};
+
+}
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -41,6 +41,8 @@ namespace Flood
 
 InputTargetDataSet::InputTargetDataSet(int new_instances_number, int new_input_variables_number, int new_target_variables_number)
 {
+   version = 0;
+
    set(new_instances_number, new_input_variables_number, new_target_variables_number);
 }
 
@@ -56,6 +58,8 @@ InputTargetDataSet::InputTargetDataSet(int new_instances_number, int new_input_v
 
 InputTargetDataSet::InputTargetDataSet(int new_instances_number, int new_variables_number)
 {
+   version = 0;
+
    set(new_instances_number, new_variables_number);
 }
 
@@ -68,6 +72,8 @@ InputTargetDataSet::InputTargetDataSet(int new_instances_number, int new_variabl
 
 InputTargetDataSet::InputTargetDataSet(void)
 {
+   version = 0;
+
    set();  
 }
 
@@ -80,6 +86,8 @@ InputTargetDataSet::InputTargetDataSet(void)
 
 InputTargetDataSet::InputTargetDataSet(const char* filename)
 {
+   version = 0;
+
    set();
    load(filename);
 }
@@ -127,6 +135,8 @@ InputTargetDataSet::InputTargetDataSet(const InputTargetDataSet& other_input_tar
    // Data
 
    data = other_input_target_data_set.data;
+
+   version = 0;
 }
 
 
@@ -173,6 +183,8 @@ InputTargetDataSet& InputTargetDataSet::operator=(const InputTargetDataSet& othe
       // Input and target data
 
       data = other_input_target_data_set.data;
+
+      version++;
    }
 
    return(*this);
@@ -181,6 +193,29 @@ InputTargetDataSet& InputTargetDataSet::operator=(const InputTargetDataSet& othe
 
 // METHODS
 
+// int get_version(void) method
+
+/// This method returns the version of the input-target data set, which is incremented every time that the data, 
+/// the instances indices or the variables indices are modified by this class. 
+/// Objects which cache quantities derived from the data set can compare versions to know when to recompute them.
+
+int InputTargetDataSet::get_version(void)
+{
+   return(version);
+}
+
+
+// void update_version(void) method
+
+/// This method increments the version of the input-target data set. 
+/// It must be called after modifying the data or the indices through the references returned by the get methods.
+
+void InputTargetDataSet::update_version(void)
+{
+   version++;
+}
+
+
 // Vector<int>& get_training_instances_indices(void) method
 
 /// This method returns the indices of the instances which will be used for training.
@@ -1304,6 +1339,8 @@ Vector<double> InputTargetDataSet::get_testing_target_instance(int testing_insta
 void InputTargetDataSet::set(void)
 {
    display = true;
+
+   version++;
 }
 
 
@@ -1332,6 +1369,8 @@ void InputTargetDataSet::set(int new_instances_number, int new_variables_number)
    // Display
 
    display = true;
+
+   version++;
 }
 
 // void set(int, int, int) method
@@ -1368,6 +1407,8 @@ void InputTargetDataSet::set(int new_instances_number, int new_input_variables_n
    target_variables_indices += new_input_variables_number;
 
    display = true;
+
+   version++;
 }
 
 
@@ -1400,6 +1441,8 @@ void InputTargetDataSet::set_training_instances_indices(const Vector<int>& new_t
    #endif
 
    training_instances_indices = new_training_instances_indices;
+
+   version++;
 }
 
 
@@ -1432,6 +1475,8 @@ void InputTargetDataSet::set_validation_instances_indices(const Vector<int>& new
    #endif
 
    validation_instances_indices = new_validation_instances_indices;
+
+   version++;
 }
 
 
@@ -1464,6 +1509,8 @@ void InputTargetDataSet::set_testing_instances_indices(const Vector<int>& new_te
    #endif
 
    testing_instances_indices = new_testing_instances_indices;
+
+   version++;
 }
 
 
@@ -1480,6 +1527,8 @@ void InputTargetDataSet::set_training(void)
    testing_instances_indices.set_size(0);
 
    training_instances_indices.initialize_sequential();
+
+   version++;
 }
 
 
@@ -1496,6 +1545,8 @@ void InputTargetDataSet::set_validation(void)
    testing_instances_indices.set_size(0);
 
    validation_instances_indices.initialize_sequential();
+
+   version++;
 }
 
 
@@ -1512,6 +1563,8 @@ void InputTargetDataSet::set_testing(void)
    testing_instances_indices.set_size(instances_number);
 
    testing_instances_indices.initialize_sequential();
+
+   version++;
 }
 
 
@@ -1525,6 +1578,8 @@ void InputTargetDataSet::set_testing(void)
 void InputTargetDataSet::set_input_variables_indices(const Vector<int>& new_input_variables_indices)
 {
    input_variables_indices = new_input_variables_indices;
+
+   version++;
 }
 
 
@@ -1538,6 +1593,8 @@ void InputTargetDataSet::set_input_variables_indices(const Vector<int>& new_inpu
 void InputTargetDataSet::set_target_variables_indices(const Vector<int>& new_target_variables_indices)
 {
    target_variables_indices = new_target_variables_indices;
+
+   version++;
 }
 
 
@@ -1552,6 +1609,8 @@ void InputTargetDataSet::set_input(void)
    input_variables_indices.resize(variables_number);
 
    input_variables_indices.initialize_sequential();
+
+   version++;
 }
 
 
@@ -1566,6 +1625,8 @@ void InputTargetDataSet::set_target(void)
    target_variables_indices.resize(variables_number);
 
    target_variables_indices.initialize_sequential();
+
+   version++;
 }
 
 
@@ -1855,6 +1916,8 @@ void InputTargetDataSet::set_data(const Matrix<double>& new_data)
    // Set data
    
    data = new_data;   
+
+   version++;
 }
 
 
@@ -1971,6 +2034,8 @@ void InputTargetDataSet::set_instance(int instance_index, const Vector<double>&
    // Set instance
 
    data.set_row(instance_index, instance);
+
+   version++;
 }
 
 
@@ -2149,6 +2214,8 @@ void InputTargetDataSet::set_input_instance(int instance_index, const Vector<dou
 
       data[instance_index][input_variable_index] = input_instance[i];
    }
+
+   version++;
 }
 
 
@@ -2210,6 +2277,8 @@ void InputTargetDataSet::set_target_instance(int instance_index, const Vector<do
 
       data[instance_index][target_variable_index] = target_instance[i];
    }
+
+   version++;
 }
 
 
@@ -2841,6 +2910,8 @@ void InputTargetDataSet::scale_data_mean_standard_deviation(const Vector<double>
    #endif
 
    data.scale_mean_standard_deviation(variables_mean, variables_standard_deviation);
+
+   version++;
 }
 
 
@@ -2884,6 +2955,8 @@ void InputTargetDataSet::scale_data_minimum_maximum(const Vector<double>& variab
    #endif
 
    data.scale_minimum_maximum(variables_minimum, variables_maximum);
+
+   version++;
 }
 
 
@@ -2957,6 +3030,8 @@ const Vector<double>& input_variables_standard_deviation)
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3028,6 +3103,8 @@ void InputTargetDataSet
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3127,6 +3204,8 @@ target_variables_mean, const Vector<double>& target_variables_standard_deviation
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3198,6 +3277,8 @@ const Vector<double>& target_variables_maximum)
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3422,6 +3503,8 @@ Vector< Vector<double> > InputTargetDataSet::scale_variables_minimum_maximum(voi
 void InputTargetDataSet::unscale_data_mean_standard_deviation(const Vector<double>& mean, const Vector<double>& standard_deviation)
 {
    data.unscale_mean_standard_deviation(mean, standard_deviation);
+
+   version++;
 }
 
 
@@ -3436,6 +3519,8 @@ void InputTargetDataSet::unscale_data_mean_standard_deviation(const Vector<doubl
 void InputTargetDataSet::unscale_data_minimum_maximum(const Vector<double>& minimum, const Vector<double>& maximum)
 {
    data.unscale_minimum_maximum(minimum, maximum);
+
+   version++;
 }
 
 
@@ -3477,6 +3562,8 @@ const Vector<double>& input_variables_standard_deviation)
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3518,6 +3605,8 @@ void InputTargetDataSet::unscale_input_variables_minimum_maximum(const Vector<do
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3559,6 +3648,8 @@ const Vector<double>& target_variables_standard_deviation)
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3601,6 +3692,8 @@ const Vector<double>& target_variables_maximum)
          }
       }
    }
+
+   version++;
 }
 
 
@@ -3685,6 +3778,8 @@ void InputTargetDataSet::unscale_variables_minimum_maximum(const Vector< Vector<
 void InputTargetDataSet::initialize_data(double new_value)
 {
    data.initialize(new_value);
+
+   version++;
 }
 
 
@@ -4451,6 +4546,8 @@ void InputTargetDataSet::load(const char* filename)
    }
 
    file.close(); 
+
+   version++;
 }
 
 
@@ -4531,6 +4628,8 @@ void InputTargetDataSet::load_data(const char* filename)
    }
  
    file.close(); 
+
+   version++;
 }
 
 
@@ -4562,6 +4661,8 @@ void InputTargetDataSet::split_given_indices
    training_instances_indices = new_training_instances_indices;
    validation_instances_indices = new_validation_instances_indices;
    testing_instances_indices = new_testing_instances_indices;
+
+   version++;
 }
 
 
@@ -4632,6 +4733,8 @@ void InputTargetDataSet::split_random_indices
    }
 
    std::sort(testing_instances_indices.begin(), testing_instances_indices.end());
+
+   version++;
 }
 
 
@@ -113,6 +113,12 @@ public:
       return(target_variables_indices.get_size());   
    }
 
+   // Version methods
+
+   int get_version(void);
+
+   void update_version(void);
+
    // Instances methods
 
    Vector<int>& get_training_instances_indices(void);
@@ -415,6 +421,10 @@ private:
    /// Display messages to screen.
    
    bool display;
+
+   /// Number of modifications of the data, the instances indices or the variables indices.
+
+   int version;
 };
 
 }
@@ -156,6 +156,8 @@ public:
 
    void resize(int, int);
 
+   void swap(Matrix<Type>&);
+
    void add_row(const Vector<Type>&);
    void add_column(const Vector<Type>&);
 
@@ -1739,6 +1741,29 @@ void Matrix<Type>::set_column(int column_index, const Vector<Type>& new_column)
 }
 
 
+// void swap(Matrix<Type>&) method
+
+/// This method exchanges the contents of this matrix with those of another matrix.
+/// Only the sizes and the pointers to the data are exchanged, so that no element is copied.
+/// @param other_matrix Matrix to be exchanged with this one.
+
+template <class Type>
+void Matrix<Type>::swap(Matrix<Type>& other_matrix)
+{
+   int rows_number_copy = rows_number;
+   int columns_number_copy = columns_number;
+   Type** data_copy = data;
+
+   rows_number = other_matrix.rows_number;
+   columns_number = other_matrix.columns_number;
+   data = other_matrix.data;
+
+   other_matrix.rows_number = rows_number_copy;
+   other_matrix.columns_number = columns_number_copy;
+   other_matrix.data = data_copy;
+}
+
+
 // void add_row(const Vector<Type>&) const method
 
 /// This method appends a new row to the matrix. 
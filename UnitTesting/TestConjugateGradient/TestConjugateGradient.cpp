@@ -16,6 +16,7 @@
 // System includes
 
 #include <iostream>
+#include <cstdio>
 
 // Flood includes
 
@@ -64,6 +65,11 @@ void TestConjugateGradient::test_constructor(void)
 
    ConjugateGradient cg2(&mof); 
    assert_true(cg2.get_objective_functional_pointer() != NULL, LOG);   
+
+   // Default members
+
+   assert_true(cg2.get_training_direction_method() == ConjugateGradient::PolakRibiere, LOG);   
+   assert_true(cg2.get_curvature_parameter() == 0.1, LOG);   
 }
 
 
@@ -327,6 +333,53 @@ void TestConjugateGradient::test_train(void)
    double gradient_norm = mof.calculate_gradient_norm();
 
    assert_true(gradient_norm < gradient_norm_goal, LOG);
+
+   // Strong Wolfe line search
+
+   mlp.initialize_independent_parameters(1.0);
+
+   cg.set_training_rate_method(TrainingAlgorithm::StrongWolfe);
+
+   cg.train();
+
+   gradient_norm = mof.calculate_gradient_norm();
+
+   assert_true(gradient_norm < gradient_norm_goal, LOG);
+}
+
+
+// void test_resume(void) method
+
+void TestConjugateGradient::test_resume(void)
+{
+   message += "test_resume\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   ConjugateGradient cg(&mof);
+   cg.set_display(false);
+   cg.set_maximum_epochs_number(4);
+   cg.set_reserve_evaluation_history(true);
+   cg.set_checkpoint_period(2);
+   cg.set_checkpoint_filename("TestConjugateGradientCheckpoint.bin");
+
+   mlp.initialize_independent_parameters(1.0);
+
+   cg.train();
+
+   Vector<double> parameters = mlp.get_parameters();
+   Vector<double> evaluation_history = cg.get_evaluation_history();
+
+   mlp.initialize_independent_parameters(0.0);
+
+   cg.resume();
+
+   assert_true(mlp.get_parameters() == parameters, LOG);
+   assert_true(cg.get_evaluation_history() == evaluation_history, LOG);
+
+   std::remove("TestConjugateGradientCheckpoint.bin");
 }
 
 
@@ -436,6 +489,7 @@ void TestConjugateGradient::run_test_case(void)
    test_calculate_training_direction();
 
    test_train();
+   test_resume();
 
    // Training history methods
 
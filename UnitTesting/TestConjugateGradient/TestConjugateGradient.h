@@ -68,6 +68,7 @@ public:
    void test_calculate_training_direction(void);
 
    void test_train(void);
+   void test_resume(void);
 
    // Training history methods
 
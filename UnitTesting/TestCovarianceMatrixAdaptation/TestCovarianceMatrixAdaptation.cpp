@@ -0,0 +1,442 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   C O V A R I A N C E   M A T R I X   A D A P T A T I O N   C L A S S                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <cmath>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/TrainingAlgorithm/CovarianceMatrixAdaptation.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "TestCovarianceMatrixAdaptation.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestCovarianceMatrixAdaptation::TestCovarianceMatrixAdaptation(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestCovarianceMatrixAdaptation::~TestCovarianceMatrixAdaptation(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestCovarianceMatrixAdaptation::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   MockObjectiveFunctional mof;
+
+   // Default constructor
+
+   CovarianceMatrixAdaptation cma1;
+   assert_true(cma1.get_objective_functional_pointer() == NULL, LOG);
+
+   // Objective functional constructor
+
+   CovarianceMatrixAdaptation cma2(&mof);
+   assert_true(cma2.get_objective_functional_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestCovarianceMatrixAdaptation::test_destructor(void)
+{
+}
+
+
+// void test_get_initial_step_size(void) method
+
+void TestCovarianceMatrixAdaptation::test_get_initial_step_size(void)
+{
+   message += "test_get_initial_step_size\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   cma.set_initial_step_size(0.1);
+   assert_true(cma.get_initial_step_size() == 0.1, LOG);
+}
+
+
+// void test_get_population_size(void) method
+
+void TestCovarianceMatrixAdaptation::test_get_population_size(void)
+{
+   message += "test_get_population_size\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   assert_true(cma.get_population_size() == 0, LOG);
+
+   cma.set_population_size(20);
+   assert_true(cma.get_population_size() == 20, LOG);
+}
+
+
+// void test_get_eigendecomposition_period(void) method
+
+void TestCovarianceMatrixAdaptation::test_get_eigendecomposition_period(void)
+{
+   message += "test_get_eigendecomposition_period\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   cma.set_eigendecomposition_period(5);
+   assert_true(cma.get_eigendecomposition_period() == 5, LOG);
+}
+
+
+// void test_calculate_population_size(void) method
+
+void TestCovarianceMatrixAdaptation::test_calculate_population_size(void)
+{
+   message += "test_calculate_population_size\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   assert_true(cma.calculate_population_size(1) == 4, LOG);
+   assert_true(cma.calculate_population_size(10) == 10, LOG);
+
+   cma.set_population_size(6);
+
+   assert_true(cma.calculate_population_size(10) == 6, LOG);
+}
+
+
+// void test_calculate_recombination_weights(void) method
+
+void TestCovarianceMatrixAdaptation::test_calculate_recombination_weights(void)
+{
+   message += "test_calculate_recombination_weights\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   Vector<double> recombination_weights = cma.calculate_recombination_weights(10);
+
+   assert_true(recombination_weights.get_size() == 5, LOG);
+
+   double sum = 0.0;
+
+   for(int i = 0; i < 5; i++)
+   {
+      sum += recombination_weights[i];
+   }
+
+   assert_true(fabs(sum - 1.0) < 1.0e-12, LOG);
+
+   for(int i = 1; i < 5; i++)
+   {
+      assert_true(recombination_weights[i] < recombination_weights[i-1], LOG);
+   }
+
+   assert_true(recombination_weights[4] > 0.0, LOG);
+}
+
+
+// void test_calculate_eigensystem(void) method
+
+void TestCovarianceMatrixAdaptation::test_calculate_eigensystem(void)
+{
+   message += "test_calculate_eigensystem\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   Matrix<double> matrix(3, 3);
+
+   matrix[0][0] = 4.0;
+   matrix[0][1] = 1.0;
+   matrix[0][2] = 2.0;
+   matrix[1][0] = 1.0;
+   matrix[1][1] = 3.0;
+   matrix[1][2] = 0.5;
+   matrix[2][0] = 2.0;
+   matrix[2][1] = 0.5;
+   matrix[2][2] = 5.0;
+
+   Matrix<double> eigenvectors;
+   Vector<double> eigenvalues;
+
+   cma.calculate_eigensystem(matrix, eigenvectors, eigenvalues);
+
+   assert_true(eigenvectors.get_rows_number() == 3, LOG);
+   assert_true(eigenvectors.get_columns_number() == 3, LOG);
+   assert_true(eigenvalues.get_size() == 3, LOG);
+
+   // Eigenvectors satisfy A*v = l*v, and they are orthonormal
+
+   Matrix<double> product = eigenvectors.calculate_transpose().dot(eigenvectors);
+
+   for(int j = 0; j < 3; j++)
+   {
+      Vector<double> eigenvector = eigenvectors.get_column(j);
+
+      Vector<double> residual = matrix.dot(eigenvector) - eigenvector*eigenvalues[j];
+
+      assert_true(residual.calculate_norm() < 1.0e-12, LOG);
+
+      for(int k = 0; k < 3; k++)
+      {
+         assert_true(fabs(product[j][k] - (j == k ? 1.0 : 0.0)) < 1.0e-12, LOG);
+      }
+   }
+
+   // Diagonal matrix
+
+   matrix.set(2, 2, 0.0);
+   matrix[0][0] = 2.0;
+   matrix[1][1] = 3.0;
+
+   cma.calculate_eigensystem(matrix, eigenvectors, eigenvalues);
+
+   assert_true(eigenvalues[0] == 2.0, LOG);
+   assert_true(eigenvalues[1] == 3.0, LOG);
+}
+
+
+// void test_train(void) method
+
+void TestCovarianceMatrixAdaptation::test_train(void)
+{
+   message += "test_train\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   CovarianceMatrixAdaptation cma(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double old_evaluation = mof.calculate_evaluation();
+
+   cma.set_evaluation_goal(1.0e-12);
+   cma.set_maximum_epochs_number(500);
+   cma.set_reserve_evaluation_history(true);
+   cma.set_reserve_training_rate_history(true);
+   cma.set_display(false);
+
+   mof.set_calculate_evaluation_count(0);
+
+   cma.train();
+
+   double evaluation = mof.calculate_evaluation();
+
+   int epochs_number = cma.get_evaluation_history().get_size();
+
+   assert_true(evaluation < old_evaluation, LOG);
+   assert_true(evaluation <= 1.0e-12, LOG);
+   assert_true(epochs_number < 501, LOG);
+   assert_true(evaluation == cma.get_evaluation_history()[epochs_number-1], LOG);
+
+   // Each generation evaluates a population of 4 + 3*ln(2) parameter vectors
+
+   assert_true(mof.get_calculate_evaluation_count() == 1 + 6*(epochs_number-1) + 1, LOG);
+
+   // The best evaluation never increases, and the step size shrinks towards the minimum
+
+   for(int i = 1; i < epochs_number; i++)
+   {
+      assert_true(cma.get_evaluation_history()[i] <= cma.get_evaluation_history()[i-1], LOG);
+   }
+
+   assert_true(cma.get_step_size() < cma.get_initial_step_size(), LOG);
+   assert_true(cma.get_training_rate_history()[epochs_number-1] == cma.get_step_size(), LOG);
+
+   // Covariance matrix
+
+   Matrix<double>& covariance_matrix = cma.get_covariance_matrix();
+
+   assert_true(covariance_matrix.get_rows_number() == 2, LOG);
+   assert_true(covariance_matrix.is_symmetric(), LOG);
+   assert_true(covariance_matrix[0][0] > 0.0 && covariance_matrix[1][1] > 0.0, LOG);
+
+   // Maximum number of epochs
+
+   mlp.initialize_independent_parameters(1.0);
+
+   cma.set_evaluation_goal(0.0);
+   cma.set_maximum_epochs_number(3);
+   cma.set_population_size(6);
+   cma.set_eigendecomposition_period(1);
+
+   mof.set_calculate_evaluation_count(0);
+
+   cma.train();
+
+   assert_true(cma.get_evaluation_history().get_size() == 4, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 1 + 6*3, LOG);
+}
+
+
+// void test_set_reserve_all_training_history(void) method
+
+void TestCovarianceMatrixAdaptation::test_set_reserve_all_training_history(void)
+{
+   message += "test_set_reserve_all_training_history\n";
+
+   CovarianceMatrixAdaptation cma;
+   cma.set_reserve_all_training_history(true);
+
+   assert_true(cma.get_reserve_evaluation_history() == true, LOG);
+   assert_true(cma.get_reserve_training_rate_history() == true, LOG);
+   assert_true(cma.get_reserve_gradient_history() == false, LOG);
+   assert_true(cma.get_reserve_inverse_Hessian_history() == false, LOG);
+}
+
+
+// void test_get_training_history_XML(void) method
+
+void TestCovarianceMatrixAdaptation::test_get_training_history_XML(void)
+{
+   message += "test_get_training_history_XML\n";
+
+   MultilayerPerceptron mlp(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   CovarianceMatrixAdaptation cma(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   cma.set_reserve_all_training_history(true);
+   cma.set_maximum_epochs_number(1);
+   cma.set_display(false);
+
+   cma.train();
+
+   std::string training_history_XML = cma.get_training_history_XML(true);
+
+   assert_true(training_history_XML.find("<EvaluationHistory>") != std::string::npos, LOG);
+   assert_true(training_history_XML.find("<TrainingRateHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestCovarianceMatrixAdaptation::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   std::string XML = cma.to_XML(true);
+
+   assert_true(XML.find("<InitialStepSize>") != std::string::npos, LOG);
+   assert_true(XML.find("<EigendecompositionPeriod>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestCovarianceMatrixAdaptation::test_load(void)
+{
+   message += "test_load\n";
+
+   CovarianceMatrixAdaptation cma;
+
+   cma.set_initial_step_size(0.25);
+   cma.set_population_size(12);
+   cma.set_eigendecomposition_period(3);
+   cma.set_maximum_epochs_number(7);
+
+   cma.save("../Data/CovarianceMatrixAdaptation.dat");
+
+   cma.set_default();
+
+   cma.load("../Data/CovarianceMatrixAdaptation.dat");
+
+   assert_true(cma.get_initial_step_size() == 0.25, LOG);
+   assert_true(cma.get_population_size() == 12, LOG);
+   assert_true(cma.get_eigendecomposition_period() == 3, LOG);
+   assert_true(cma.get_maximum_epochs_number() == 7, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestCovarianceMatrixAdaptation::run_test_case(void)
+{
+   message += "Running covariance matrix adaptation test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_initial_step_size();
+   test_get_population_size();
+   test_get_eigendecomposition_period();
+
+   // Train methods
+
+   test_calculate_population_size();
+   test_calculate_recombination_weights();
+   test_calculate_eigensystem();
+
+   test_train();
+
+   // Training history methods
+
+   test_set_reserve_all_training_history();
+   test_get_training_history_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of covariance matrix adaptation test case\n";
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -16,6 +16,9 @@
 // System includes
 
 #include <iostream>
+#include <stdlib.h>
+#include <cstdio>
+#include <cmath>
 
 // Flood includes
 
@@ -232,6 +235,38 @@ void TestEvolutionaryAlgorithm::test_get_mutation_range(void)
 }
 
 
+// void test_get_threads_number(void) method
+
+void TestEvolutionaryAlgorithm::test_get_threads_number(void)
+{
+   message += "test_get_threads_number\n";
+
+   EvolutionaryAlgorithm ea;
+
+   ea.set_threads_number(2);
+
+   assert_true(ea.get_threads_number() == 2, LOG);
+}
+
+
+// void test_get_early_abandon(void) method
+
+void TestEvolutionaryAlgorithm::test_get_early_abandon(void)
+{
+   message += "test_get_early_abandon\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   assert_true(ea.get_early_abandon() == false, LOG);
+
+   ea.set_early_abandon(true);
+
+   assert_true(ea.get_early_abandon() == true, LOG);
+}
+
+
 // void test_get_maximum_generations_number(void) method
 
 void TestEvolutionaryAlgorithm::test_get_maximum_generations_number(void)
@@ -989,6 +1024,43 @@ void TestEvolutionaryAlgorithm::test_evaluate_population(void)
    ea.evaluate_population();
 
    assert_true(ea.get_evaluation() == 0.0, LOG);
+
+   // Serial and parallel evaluation
+
+   ea.set_population_size(20);
+   ea.initialize_population_normal();
+
+   mof.set_calculate_evaluation_count(0);
+
+   ea.set_threads_number(1);
+   ea.evaluate_population();
+
+   Vector<double> evaluation = ea.get_evaluation();
+
+   ea.set_threads_number(4);
+   ea.evaluate_population();
+
+   assert_true(ea.get_evaluation() == evaluation, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 40, LOG);
+
+   // Parallel evaluation does not use random numbers, so that training is repeatable for a given seed
+
+   srand(1);
+   ea.evaluate_population();
+   int random_number = rand();
+
+   ea.set_threads_number(1);
+
+   srand(1);
+   ea.evaluate_population();
+
+   assert_true(rand() == random_number, LOG);
+
+   // Bounded evaluation
+
+   ea.evaluate_population(ea.calculate_median_evaluation());
+
+   assert_true(ea.get_evaluation() == evaluation, LOG);
 }
 
 
@@ -997,6 +1069,32 @@ void TestEvolutionaryAlgorithm::test_evaluate_population(void)
 void TestEvolutionaryAlgorithm::test_perform_linear_ranking_fitness_assignment(void)
 {
    message += "test_perform_linear_ranking_fitness_assignment\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   ea.set_population_size(4);
+   ea.set_selective_pressure(2.0);
+
+   Vector<double> evaluation(4);
+   evaluation[0] = 3.0;
+   evaluation[1] = 1.0;
+   evaluation[2] = 3.0;
+   evaluation[3] = 0.0;
+
+   ea.set_evaluation(evaluation);
+
+   ea.perform_linear_ranking_fitness_assignment();
+
+   // Individuals with equal evaluations share the lowest rank
+
+   Vector<double>& fitness = ea.get_fitness();
+
+   assert_true(fitness[0] == 0.0, LOG);
+   assert_true(fitness[1] == 4.0/3.0, LOG);
+   assert_true(fitness[2] == 0.0, LOG);
+   assert_true(fitness[3] == 2.0, LOG);
 }
 
 
@@ -1005,6 +1103,67 @@ void TestEvolutionaryAlgorithm::test_perform_linear_ranking_fitness_assignment(v
 void TestEvolutionaryAlgorithm::test_perform_roulette_wheel_selection(void)
 {
    message += "test_perform_roulette_wheel_selection\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   int population_size = 1000;
+
+   ea.set_population_size(population_size);
+   ea.set_selective_pressure(2.0);
+   ea.set_elitism(true);
+
+   Vector<double> evaluation(population_size);
+
+   for(int i = 0; i < population_size; i++)
+   {
+      evaluation[i] = population_size - i;
+   }
+
+   ea.set_evaluation(evaluation);
+
+   ea.perform_linear_ranking_fitness_assignment();
+   ea.perform_roulette_wheel_selection();
+
+   Vector<bool>& selection = ea.get_selection();
+
+   int selected_individuals_count = 0;
+
+   for(int i = 0; i < population_size; i++)
+   {
+      if(selection[i])
+      {
+         selected_individuals_count++;
+      }
+   }
+
+   assert_true(selected_individuals_count == population_size/2, LOG);
+   assert_true(selection[population_size-1] == true, LOG);
+
+   // The worst individual has zero fitness
+
+   assert_true(selection[0] == false, LOG);
+
+   // All individuals with zero fitness
+
+   ea.set_population_size(10);
+   ea.set_evaluation(Vector<double>(10, 1.0));
+
+   ea.perform_linear_ranking_fitness_assignment();
+   ea.perform_roulette_wheel_selection();
+
+   selected_individuals_count = 0;
+
+   for(int i = 0; i < 10; i++)
+   {
+      if(ea.get_selection()[i])
+      {
+         selected_individuals_count++;
+      }
+   }
+
+   assert_true(selected_individuals_count == 5, LOG);
 }
 
 
@@ -1013,6 +1172,41 @@ void TestEvolutionaryAlgorithm::test_perform_roulette_wheel_selection(void)
 void TestEvolutionaryAlgorithm::test_perform_stochastic_universal_sampling_selection(void)
 {
    message += "test_perform_stochastic_universal_sampling_selection\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   int population_size = 1000;
+
+   ea.set_population_size(population_size);
+   ea.set_selective_pressure(1.5);
+
+   Vector<double> evaluation(population_size);
+
+   for(int i = 0; i < population_size; i++)
+   {
+      evaluation[i] = i;
+   }
+
+   ea.set_evaluation(evaluation);
+
+   ea.perform_linear_ranking_fitness_assignment();
+   ea.perform_stochastic_universal_sampling_selection();
+
+   Vector<bool>& selection = ea.get_selection();
+
+   int selected_individuals_count = 0;
+
+   for(int i = 0; i < population_size; i++)
+   {
+      if(selection[i])
+      {
+         selected_individuals_count++;
+      }
+   }
+
+   assert_true(selected_individuals_count == population_size/2, LOG);
 }
 
 
@@ -1021,6 +1215,45 @@ void TestEvolutionaryAlgorithm::test_perform_stochastic_universal_sampling_selec
 void TestEvolutionaryAlgorithm::test_perform_intermediate_recombination(void)
 {
    message += "test_perform_intermediate_recombination\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   ea.set_population_size(4);
+   ea.set_recombination_size(0.25);
+
+   // Individuals 0 and 1, with all their parameters equal to 0 and 1, are selected
+
+   Matrix<double> population(4, parameters_number, 5.0);
+
+   population.set_row(0, Vector<double>(parameters_number, 0.0));
+   population.set_row(1, Vector<double>(parameters_number, 1.0));
+
+   ea.set_population(population);
+
+   Vector<bool> selection(4, false);
+   selection[0] = true;
+   selection[1] = true;
+
+   ea.set_selection(selection);
+
+   ea.perform_intermediate_recombination();
+
+   Matrix<double>& new_population = ea.get_population();
+
+   assert_true(new_population.get_rows_number() == 4, LOG);
+   assert_true(new_population.get_columns_number() == parameters_number, LOG);
+
+   for(int i = 0; i < 4; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         assert_true(new_population[i][j] >= -0.25 && new_population[i][j] <= 1.25, LOG);
+      }
+   }
 }
 
 
@@ -1029,6 +1262,49 @@ void TestEvolutionaryAlgorithm::test_perform_intermediate_recombination(void)
 void TestEvolutionaryAlgorithm::test_perform_line_recombination(void)
 {
    message += "test_perform_line_recombination\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   ea.set_population_size(4);
+   ea.set_recombination_size(0.25);
+
+   // Individuals 0 and 1, with all their parameters equal to 0 and 1, are selected
+
+   Matrix<double> population(4, parameters_number, 5.0);
+
+   population.set_row(0, Vector<double>(parameters_number, 0.0));
+   population.set_row(1, Vector<double>(parameters_number, 1.0));
+
+   ea.set_population(population);
+
+   Vector<bool> selection(4, false);
+   selection[0] = true;
+   selection[1] = true;
+
+   ea.set_selection(selection);
+
+   ea.perform_line_recombination();
+
+   Matrix<double>& new_population = ea.get_population();
+
+   assert_true(new_population.get_rows_number() == 4, LOG);
+   assert_true(new_population.get_columns_number() == parameters_number, LOG);
+
+   for(int i = 0; i < 4; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         assert_true(new_population[i][j] >= -0.25 && new_population[i][j] <= 1.25, LOG);
+
+         // The same scaling factor is used for all the parameters
+
+         assert_true(new_population[i][j] == new_population[i][0], LOG);
+      }
+   }
 }
 
 
@@ -1037,6 +1313,77 @@ void TestEvolutionaryAlgorithm::test_perform_line_recombination(void)
 void TestEvolutionaryAlgorithm::test_perform_normal_mutation(void)
 {
    message += "test_perform_normal_mutation\n";
+
+   MultilayerPerceptron mlp(1, 24, 1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   int population_size = 100;
+
+   ea.set_population_size(population_size);
+   ea.set_mutation_range(0.1);
+
+   // Mutation rate
+
+   ea.set_mutation_rate(0.1);
+   ea.initialize_population(0.0);
+
+   ea.perform_normal_mutation();
+
+   Matrix<double>& population = ea.get_population();
+
+   int mutated_parameters_count = 0;
+
+   for(int i = 0; i < population_size; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         if(population[i][j] != 0.0)
+         {
+            mutated_parameters_count++;
+         }
+
+         assert_true(fabs(population[i][j]) < 1.0, LOG);
+      }
+   }
+
+   // About 10 percent of the parameters are mutated
+
+   assert_true(mutated_parameters_count > 0.08*population_size*parameters_number, LOG);
+   assert_true(mutated_parameters_count < 0.12*population_size*parameters_number, LOG);
+
+   // Zero mutation rate
+
+   ea.set_mutation_rate(0.0);
+   ea.initialize_population(0.0);
+
+   ea.perform_normal_mutation();
+
+   assert_true(ea.get_population() == 0.0, LOG);
+
+   // Unity mutation rate
+
+   ea.set_mutation_rate(1.0);
+   ea.initialize_population(0.0);
+
+   ea.perform_normal_mutation();
+
+   mutated_parameters_count = 0;
+
+   for(int i = 0; i < population_size; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         if(population[i][j] != 0.0)
+         {
+            mutated_parameters_count++;
+         }
+      }
+   }
+
+   assert_true(mutated_parameters_count == population_size*parameters_number, LOG);
 }
 
 
@@ -1045,6 +1392,124 @@ void TestEvolutionaryAlgorithm::test_perform_normal_mutation(void)
 void TestEvolutionaryAlgorithm::test_perform_uniform_mutation(void)
 {
    message += "test_perform_uniform_mutation\n";
+
+   MultilayerPerceptron mlp(1, 24, 1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   int population_size = 100;
+
+   ea.set_population_size(population_size);
+   ea.set_mutation_range(0.1);
+
+   // Mutation rate
+
+   ea.set_mutation_rate(0.1);
+   ea.initialize_population(0.0);
+
+   ea.perform_uniform_mutation();
+
+   Matrix<double>& population = ea.get_population();
+
+   int mutated_parameters_count = 0;
+
+   for(int i = 0; i < population_size; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         if(population[i][j] != 0.0)
+         {
+            mutated_parameters_count++;
+         }
+
+         assert_true(fabs(population[i][j]) <= 0.1, LOG);
+      }
+   }
+
+   // About 10 percent of the parameters are mutated
+
+   assert_true(mutated_parameters_count > 0.08*population_size*parameters_number, LOG);
+   assert_true(mutated_parameters_count < 0.12*population_size*parameters_number, LOG);
+
+   // Zero mutation rate
+
+   ea.set_mutation_rate(0.0);
+   ea.initialize_population(0.0);
+
+   ea.perform_uniform_mutation();
+
+   assert_true(ea.get_population() == 0.0, LOG);
+
+   // Unity mutation rate
+
+   ea.set_mutation_rate(1.0);
+   ea.initialize_population(0.0);
+
+   ea.perform_uniform_mutation();
+
+   mutated_parameters_count = 0;
+
+   for(int i = 0; i < population_size; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         if(population[i][j] != 0.0)
+         {
+            mutated_parameters_count++;
+         }
+      }
+   }
+
+   assert_true(mutated_parameters_count == population_size*parameters_number, LOG);
+}
+
+
+// void test_perform_recombination_mutation(void) method
+
+void TestEvolutionaryAlgorithm::test_perform_recombination_mutation(void)
+{
+   message += "test_perform_recombination_mutation\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   ea.set_population_size(4);
+   ea.set_recombination_method(EvolutionaryAlgorithm::Line);
+   ea.set_mutation_method(EvolutionaryAlgorithm::Uniform);
+   ea.set_mutation_rate(1.0);
+   ea.set_mutation_range(0.1);
+
+   ea.initialize_population(1.0);
+
+   Vector<bool> selection(4, false);
+   selection[1] = true;
+   selection[3] = true;
+
+   ea.set_selection(selection);
+
+   ea.perform_recombination_mutation();
+
+   Matrix<double>& population = ea.get_population();
+
+   assert_true(population.get_rows_number() == 4, LOG);
+   assert_true(population.get_columns_number() == parameters_number, LOG);
+
+   // Recombination of equal individuals gives the same individual, which is then mutated
+
+   for(int i = 0; i < 4; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         assert_true(fabs(population[i][j] - 1.0) <= 0.1 + 1.0e-12, LOG);
+      }
+   }
+
+   assert_true(population != 1.0, LOG);
 }
 
 
@@ -1125,6 +1590,132 @@ void TestEvolutionaryAlgorithm::test_train(void)
    double standard_deviation_evaluation = ea.calculate_standard_deviation_evaluation();
 
    assert_true(standard_deviation_evaluation < standard_deviation_evaluation_goal, LOG);  
+
+   // Early abandon. The mean and standard deviation of the evaluation would be underestimated, so that goals which 
+   // any of them reaches must not stop training.
+
+   ea.initialize_population_normal();
+
+   ea.set_early_abandon(true);
+   ea.set_reserve_mean_evaluation_history(true);
+   ea.set_reserve_best_evaluation_history(true);
+
+   ea.set_evaluation_goal(-1.0);
+   ea.set_mean_evaluation_goal(1.0e99);
+   ea.set_standard_deviation_evaluation_goal(1.0e99);
+   ea.set_maximum_generations_number(3);
+
+   ea.train();
+
+   assert_true(ea.get_best_evaluation_history().get_size() == 4, LOG);
+   assert_true(ea.get_mean_evaluation_history().get_size() == 0, LOG);
+
+   // Training history depth smaller than the number of generations, which ends on the maximum number of generations
+
+   ea.set_early_abandon(false);
+
+   ea.set_evaluation_goal(-1.0);
+   ea.set_mean_evaluation_goal(-1.0);
+   ea.set_standard_deviation_evaluation_goal(-1.0);
+   ea.set_maximum_generations_number(9);
+   ea.set_reserve_mean_norm_history(true);
+
+   ea.initialize_population_normal();
+
+   Matrix<double> initial_population = ea.get_population();
+
+   srand(3);
+
+   ea.train();
+
+   Vector<double> mean_norm_history = ea.get_mean_norm_history();
+
+   assert_true(mean_norm_history.get_size() == 10, LOG);
+
+   ea.set_population(initial_population);
+   ea.set_training_history_depth(4);
+
+   srand(3);
+
+   ea.train();
+
+   assert_true(ea.get_mean_norm_history().get_size() == 4, LOG);
+
+   for(int i = 0; i < 4; i++)
+   {
+      assert_true(ea.get_mean_norm_history()[i] == mean_norm_history[6+i], LOG);
+   }
+}
+
+
+// void test_resume(void) method
+
+void TestEvolutionaryAlgorithm::test_resume(void)
+{
+   message += "test_resume\n";
+
+   MultilayerPerceptron mlp(1,2,1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   EvolutionaryAlgorithm ea(&mof);
+   ea.set_display(false);
+   ea.set_population_size(10);
+   ea.set_evaluation_goal(-1.0);
+   ea.set_standard_deviation_evaluation_goal(-1.0);
+   ea.set_maximum_generations_number(12);
+   ea.set_reserve_best_evaluation_history(true);
+
+   ea.initialize_population_normal();
+
+   Matrix<double> initial_population = ea.get_population();
+
+   // Uninterrupted training with checkpoints enabled, but none saved
+
+   ea.set_checkpoint_period(100);
+   ea.set_checkpoint_filename("TestEvolutionaryAlgorithmCheckpoint.bin");
+
+   srand(1);
+
+   ea.train();
+
+   Vector<double> parameters = mlp.get_parameters();
+   Matrix<double> population = ea.get_population();
+   Vector<double> best_evaluation_history = ea.get_best_evaluation_history();
+
+   // Training interrupted after the checkpoint of generation 5
+
+   ea.set_population(initial_population);
+   ea.set_maximum_generations_number(6);
+   ea.set_checkpoint_period(6);
+
+   srand(1);
+
+   ea.train();
+
+   // Training resumed by another training algorithm object
+
+   mlp.initialize_parameters(0.0);
+
+   EvolutionaryAlgorithm resumed_ea(&mof);
+   resumed_ea.set_display(false);
+   resumed_ea.set_population_size(10);
+   resumed_ea.set_evaluation_goal(-1.0);
+   resumed_ea.set_standard_deviation_evaluation_goal(-1.0);
+   resumed_ea.set_maximum_generations_number(12);
+   resumed_ea.set_reserve_best_evaluation_history(true);
+   resumed_ea.set_checkpoint_filename("TestEvolutionaryAlgorithmCheckpoint.bin");
+
+   srand(2);
+
+   resumed_ea.resume();
+
+   assert_true(best_evaluation_history.get_size() == 13, LOG);
+   assert_true(mlp.get_parameters() == parameters, LOG);
+   assert_true(resumed_ea.get_population() == population, LOG);
+   assert_true(resumed_ea.get_best_evaluation_history() == best_evaluation_history, LOG);
+
+   std::remove("TestEvolutionaryAlgorithmCheckpoint.bin");
 }
 
 
@@ -1248,6 +1839,8 @@ void TestEvolutionaryAlgorithm::run_test_case(void)
    test_get_recombination_size();
    test_get_mutation_rate();
    test_get_mutation_range();
+   test_get_threads_number();
+   test_get_early_abandon();
 
    test_get_maximum_generations_number();
 
@@ -1349,10 +1942,12 @@ void TestEvolutionaryAlgorithm::run_test_case(void)
 
    test_perform_normal_mutation();
    test_perform_uniform_mutation();
+   test_perform_recombination_mutation();
 
    // Train methods
 
    test_train();
+   test_resume();
 
    // Training history methods
 
@@ -60,6 +60,8 @@ public:
    void test_get_recombination_size(void);
    void test_get_mutation_rate(void);
    void test_get_mutation_range(void);
+   void test_get_threads_number(void);
+   void test_get_early_abandon(void);
 
    void test_get_maximum_generations_number(void);
 
@@ -166,10 +168,12 @@ public:
 
    void test_perform_normal_mutation(void);
    void test_perform_uniform_mutation(void);
+   void test_perform_recombination_mutation(void);
 
    // Train methods
 
    void test_train(void);
+   void test_resume(void);
 
    // Training history methods
 
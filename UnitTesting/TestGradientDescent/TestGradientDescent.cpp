@@ -17,6 +17,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <string>
+#include <cstdio>
 #include <algorithm>
 #include <functional>
 #include <limits>
@@ -194,6 +196,67 @@ void TestGradientDescent::test_train(void)
    double gradient_norm = mof.calculate_gradient_norm();
 
    assert_true(gradient_norm < gradient_norm_goal, LOG);
+
+   // Training history period and depth
+
+   mlp.initialize_independent_parameters(1.0);
+
+   gd.set_gradient_norm_goal(0.0);
+   gd.set_maximum_epochs_number(6);
+   gd.set_training_rate_method(TrainingAlgorithm::Fixed);
+   gd.set_first_training_rate(0.1);
+   gd.set_reserve_evaluation_history(true);
+
+   gd.train();
+
+   Vector<double> evaluation_history = gd.get_evaluation_history();
+
+   assert_true(evaluation_history.get_size() == 7, LOG);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   gd.set_training_history_period(2);
+   gd.set_training_history_depth(2);
+
+   gd.train();
+
+   assert_true(gd.get_evaluation_history().get_size() == 2, LOG);
+   assert_true(gd.get_evaluation_history()[0] == evaluation_history[4], LOG);
+   assert_true(gd.get_evaluation_history()[1] == evaluation_history[6], LOG);
+
+   // Training history file
+
+   mlp.initialize_independent_parameters(1.0);
+
+   gd.set_training_history_period(4);
+   gd.set_training_history_depth(1);
+   gd.set_training_history_filename("TestGradientDescentHistory.csv");
+
+   gd.train();
+
+   assert_true(gd.get_evaluation_history().get_size() == 1, LOG);
+   assert_true(gd.get_evaluation_history()[0] == evaluation_history[6], LOG);
+
+   std::ifstream file("TestGradientDescentHistory.csv");
+
+   std::string line;
+   Vector<std::string> lines;
+
+   while(std::getline(file, line))
+   {
+      lines.resize(lines.get_size()+1);
+      lines[lines.get_size()-1] = line;
+   }
+
+   file.close();
+
+   assert_true(lines.get_size() == 4, LOG);
+   assert_true(lines[0] == "epoch,evaluation", LOG);
+   assert_true(lines[1].substr(0, 2) == "0,", LOG);
+   assert_true(lines[2].substr(0, 2) == "4,", LOG);
+   assert_true(lines[3].substr(0, 2) == "6,", LOG);
+
+   std::remove("TestGradientDescentHistory.csv");
 }
 
 
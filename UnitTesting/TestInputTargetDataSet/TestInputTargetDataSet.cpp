@@ -139,6 +139,41 @@ void TestInputTargetDataSet::test_get_variables_number(void)
 }
 
 
+// void test_get_version(void) method
+
+void TestInputTargetDataSet::test_get_version(void)
+{
+   message += "test_get_version\n";
+
+   InputTargetDataSet itds(2,1,1);
+
+   int version = itds.get_version();
+
+   itds.initialize_data(1.0);
+
+   assert_true(itds.get_version() > version, LOG);
+
+   version = itds.get_version();
+
+   itds.set_validation();
+
+   assert_true(itds.get_version() > version, LOG);
+
+   version = itds.get_version();
+
+   itds.get_data()[0][0] = 2.0;
+   itds.update_version();
+
+   assert_true(itds.get_version() > version, LOG);
+
+   version = itds.get_version();
+
+   itds.set_variables_name(Vector<std::string>(2, "x"));
+
+   assert_true(itds.get_version() == version, LOG);
+}
+
+
 // void test_get_training_instances_number(void) method
 
 void TestInputTargetDataSet::test_get_training_instances_number(void) 
@@ -2096,6 +2131,7 @@ void TestInputTargetDataSet::run_test_case(void)
 
    test_get_instances_number();
    test_get_variables_number();
+   test_get_version();
 
    // Instances methods 
 
@@ -54,6 +54,7 @@ public:
 
    void test_get_instances_number(void);
    void test_get_variables_number(void);
+   void test_get_version(void);
 
    // Instances methods 
 
@@ -0,0 +1,429 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   I S L A N D   E V O L U T I O N A R Y   A L G O R I T H M   C L A S S                            */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <stdlib.h>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/TrainingAlgorithm/EvolutionaryAlgorithm.h"
+#include "../../Flood/TrainingAlgorithm/IslandEvolutionaryAlgorithm.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "TestIslandEvolutionaryAlgorithm.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestIslandEvolutionaryAlgorithm::TestIslandEvolutionaryAlgorithm(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestIslandEvolutionaryAlgorithm::~TestIslandEvolutionaryAlgorithm(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   EvolutionaryAlgorithm ea;
+
+   // Default constructor
+
+   IslandEvolutionaryAlgorithm iea1;
+   assert_true(iea1.get_evolutionary_algorithm_pointer() == NULL, LOG);
+   assert_true(iea1.get_best_island() == -1, LOG);
+
+   // Evolutionary algorithm constructor
+
+   IslandEvolutionaryAlgorithm iea2(&ea);
+   assert_true(iea2.get_evolutionary_algorithm_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_destructor(void)
+{
+}
+
+
+// void test_get_islands_number(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_get_islands_number(void)
+{
+   message += "test_get_islands_number\n";
+
+   IslandEvolutionaryAlgorithm iea;
+
+   iea.set_islands_number(8);
+   assert_true(iea.get_islands_number() == 8, LOG);
+}
+
+
+// void test_get_migration_topology(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_get_migration_topology(void)
+{
+   message += "test_get_migration_topology\n";
+
+   IslandEvolutionaryAlgorithm iea;
+
+   iea.set_migration_topology(IslandEvolutionaryAlgorithm::Ring);
+   assert_true(iea.get_migration_topology() == IslandEvolutionaryAlgorithm::Ring, LOG);
+
+   iea.set_migration_topology(IslandEvolutionaryAlgorithm::FullyConnected);
+   assert_true(iea.get_migration_topology() == IslandEvolutionaryAlgorithm::FullyConnected, LOG);
+}
+
+
+// void test_get_migration_topology_name(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_get_migration_topology_name(void)
+{
+   message += "test_get_migration_topology_name\n";
+
+   IslandEvolutionaryAlgorithm iea;
+
+   iea.set_migration_topology("Ring");
+   assert_true(iea.get_migration_topology_name() == "Ring", LOG);
+
+   iea.set_migration_topology("FullyConnected");
+   assert_true(iea.get_migration_topology_name() == "FullyConnected", LOG);
+}
+
+
+// void test_get_migration_interval(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_get_migration_interval(void)
+{
+   message += "test_get_migration_interval\n";
+
+   IslandEvolutionaryAlgorithm iea;
+
+   iea.set_migration_interval(5);
+   assert_true(iea.get_migration_interval() == 5, LOG);
+}
+
+
+// void test_get_migrants_number(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_get_migrants_number(void)
+{
+   message += "test_get_migrants_number\n";
+
+   IslandEvolutionaryAlgorithm iea;
+
+   iea.set_migrants_number(2);
+   assert_true(iea.get_migrants_number() == 2, LOG);
+}
+
+
+// void test_perform_migration(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_perform_migration(void)
+{
+   message += "test_perform_migration\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+
+   // Three islands of four individuals, where individual j of island i is i+j
+
+   EvolutionaryAlgorithm ea0(&mof);
+   EvolutionaryAlgorithm ea1(&mof);
+   EvolutionaryAlgorithm ea2(&mof);
+
+   Vector<EvolutionaryAlgorithm*> islands(3);
+   islands[0] = &ea0;
+   islands[1] = &ea1;
+   islands[2] = &ea2;
+
+   for(int i = 0; i < 3; i++)
+   {
+      islands[i]->set_population_size(4);
+
+      for(int j = 0; j < 4; j++)
+      {
+         islands[i]->set_individual(j, Vector<double>(1, i+j));
+      }
+
+      islands[i]->evaluate_population();
+   }
+
+   IslandEvolutionaryAlgorithm iea;
+
+   // Ring
+
+   iea.set_migration_topology(IslandEvolutionaryAlgorithm::Ring);
+   iea.set_migrants_number(1);
+
+   iea.perform_migration(islands);
+
+   assert_true(ea0.get_individual(3) == Vector<double>(1, 2.0), LOG);
+   assert_true(ea0.get_evaluation()[3] == 4.0, LOG);
+   assert_true(ea1.get_individual(3) == Vector<double>(1, 0.0), LOG);
+   assert_true(ea1.get_evaluation()[3] == 0.0, LOG);
+   assert_true(ea2.get_individual(3) == Vector<double>(1, 1.0), LOG);
+   assert_true(ea2.get_evaluation()[3] == 1.0, LOG);
+
+   // Fully connected
+
+   for(int i = 0; i < 3; i++)
+   {
+      for(int j = 0; j < 4; j++)
+      {
+         islands[i]->set_individual(j, Vector<double>(1, i+j));
+      }
+
+      islands[i]->evaluate_population();
+   }
+
+   iea.set_migration_topology(IslandEvolutionaryAlgorithm::FullyConnected);
+
+   iea.perform_migration(islands);
+
+   assert_true(ea0.get_individual(0) == Vector<double>(1, 0.0), LOG);
+   assert_true(ea0.get_individual(1) == Vector<double>(1, 1.0), LOG);
+   assert_true(ea0.get_individual(2) == Vector<double>(1, 2.0), LOG);
+   assert_true(ea0.get_individual(3) == Vector<double>(1, 1.0), LOG);
+
+   assert_true(ea2.get_individual(0) == Vector<double>(1, 2.0), LOG);
+   assert_true(ea2.get_individual(2) == Vector<double>(1, 1.0), LOG);
+   assert_true(ea2.get_individual(3) == Vector<double>(1, 0.0), LOG);
+   assert_true(ea2.get_evaluation()[3] == 0.0, LOG);
+}
+
+
+// void test_train(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_train(void)
+{
+   message += "test_train\n";
+
+   MultilayerPerceptron mlp(2);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   ea.set_population_size(10);
+   ea.initialize_population_normal();
+   ea.set_maximum_generations_number(25);
+
+   mof.set_calculate_evaluation_count(0);
+
+   IslandEvolutionaryAlgorithm iea(&ea);
+   iea.set_islands_number(3);
+   iea.set_migration_interval(10);
+   iea.set_display(false);
+
+   iea.train();
+
+   int best_island = iea.get_best_island();
+
+   assert_true(best_island >= 0 && best_island < 3, LOG);
+   assert_true(iea.get_best_evaluation() == iea.get_final_evaluations().calculate_minimum(), LOG);
+   assert_true(mlp.get_parameters() == iea.get_best_parameters(), LOG);
+   assert_true(mof.calculate_evaluation() == iea.get_best_evaluation(), LOG);
+
+   // The best evaluation never increases
+
+   Vector<double>& best_evaluation_history = iea.get_best_evaluation_history();
+
+   assert_true(best_evaluation_history.get_size() == 26, LOG);
+
+   for(int i = 1; i < 26; i++)
+   {
+      assert_true(best_evaluation_history[i] <= best_evaluation_history[i-1], LOG);
+   }
+
+   // All the islands evaluate their populations once per generation
+
+   assert_true(mof.get_calculate_evaluation_count() == 3*10*26 + 1, LOG);
+
+   // Evaluation goal, which is checked at the migrations
+
+   ea.set_evaluation_goal(1.0e99);
+
+   iea.set_migration_topology(IslandEvolutionaryAlgorithm::FullyConnected);
+
+   iea.train();
+
+   assert_true(iea.get_best_evaluation_history().get_size() == 1, LOG);
+
+   // Training with one thread is repeatable
+
+   ea.set_evaluation_goal(0.0);
+
+   iea.set_threads_number(1);
+
+   srand(1);
+   iea.train();
+
+   Vector<double> best_parameters = iea.get_best_parameters();
+
+   srand(1);
+   iea.train();
+
+   assert_true(iea.get_best_parameters() == best_parameters, LOG);
+}
+
+
+// void test_get_results_XML(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_get_results_XML(void)
+{
+   message += "test_get_results_XML\n";
+
+   MultilayerPerceptron mlp(1);
+   MockObjectiveFunctional mof(&mlp);
+   EvolutionaryAlgorithm ea(&mof);
+
+   ea.set_population_size(4);
+   ea.set_maximum_generations_number(2);
+
+   IslandEvolutionaryAlgorithm iea(&ea);
+   iea.set_islands_number(2);
+   iea.set_display(false);
+
+   iea.train();
+
+   std::string results_XML = iea.get_results_XML(true);
+
+   assert_true(results_XML.find("<BestIsland>") != std::string::npos, LOG);
+   assert_true(results_XML.find("<BestEvaluationHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   IslandEvolutionaryAlgorithm iea;
+
+   std::string XML = iea.to_XML(true);
+
+   assert_true(XML.find("<IslandsNumber>") != std::string::npos, LOG);
+   assert_true(XML.find("<MigrationTopology>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestIslandEvolutionaryAlgorithm::test_load(void)
+{
+   message += "test_load\n";
+
+   IslandEvolutionaryAlgorithm iea;
+
+   iea.set_islands_number(6);
+   iea.set_migration_topology(IslandEvolutionaryAlgorithm::FullyConnected);
+   iea.set_migration_interval(5);
+   iea.set_migrants_number(2);
+   iea.set_threads_number(2);
+   iea.set_display(false);
+
+   iea.save("../Data/IslandEvolutionaryAlgorithm.dat");
+
+   iea.set_default();
+
+   iea.load("../Data/IslandEvolutionaryAlgorithm.dat");
+
+   assert_true(iea.get_islands_number() == 6, LOG);
+   assert_true(iea.get_migration_topology() == IslandEvolutionaryAlgorithm::FullyConnected, LOG);
+   assert_true(iea.get_migration_interval() == 5, LOG);
+   assert_true(iea.get_migrants_number() == 2, LOG);
+   assert_true(iea.get_threads_number() == 2, LOG);
+   assert_true(iea.get_display() == false, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestIslandEvolutionaryAlgorithm::run_test_case(void)
+{
+   message += "Running island evolutionary algorithm test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_islands_number();
+   test_get_migration_topology();
+   test_get_migration_topology_name();
+   test_get_migration_interval();
+   test_get_migrants_number();
+
+   // Migration methods
+
+   test_perform_migration();
+
+   // Train methods
+
+   test_train();
+
+   // Results methods
+
+   test_get_results_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of island evolutionary algorithm test case\n";
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
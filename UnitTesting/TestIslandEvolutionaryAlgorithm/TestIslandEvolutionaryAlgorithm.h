@@ -0,0 +1,102 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   I S L A N D   E V O L U T I O N A R Y   A L G O R I T H M   C L A S S   H E A D E R              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __TESTISLANDEVOLUTIONARYALGORITHM_H__
+#define __TESTISLANDEVOLUTIONARYALGORITHM_H__
+
+// Flood includes
+
+#include "../../Flood/Utilities/UnitTesting.h"
+
+
+using namespace Flood;
+
+
+class TestIslandEvolutionaryAlgorithm : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit TestIslandEvolutionaryAlgorithm(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~TestIslandEvolutionaryAlgorithm(void);
+
+
+   // METHODS
+
+   // Constructor and destructor methods
+
+   void test_constructor(void);
+   void test_destructor(void);
+
+   // Get methods
+
+   void test_get_islands_number(void);
+   void test_get_migration_topology(void);
+   void test_get_migration_topology_name(void);
+   void test_get_migration_interval(void);
+   void test_get_migrants_number(void);
+
+   // Migration methods
+
+   void test_perform_migration(void);
+
+   // Train methods
+
+   void test_train(void);
+
+   // Results methods
+
+   void test_get_results_XML(void);
+
+   // Utility methods
+
+   void test_to_XML(void);
+   void test_load(void);
+
+   // Unit testing methods
+
+   void run_test_case(void);
+};
+
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
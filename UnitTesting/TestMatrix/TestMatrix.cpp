@@ -604,6 +604,30 @@ void TestMatrix::test_resize(void)
 }
 
 
+// void test_swap(void) method
+
+void TestMatrix::test_swap(void)
+{
+   message += "test_swap\n";
+
+   Matrix<int> m1(1, 2, 1);
+   Matrix<int> m2(3, 1, 2);
+
+   int* row = m2[0];
+
+   m1.swap(m2);
+
+   assert_true(m1.get_rows_number() == 3, LOG);
+   assert_true(m1.get_columns_number() == 1, LOG);
+   assert_true(m1 == 2, LOG);
+   assert_true(m1[0] == row, LOG);
+
+   assert_true(m2.get_rows_number() == 1, LOG);
+   assert_true(m2.get_columns_number() == 2, LOG);
+   assert_true(m2 == 1, LOG);
+}
+
+
 // void test_add_row(void) method
 
 void TestMatrix::test_add_row(void)
@@ -1183,6 +1207,7 @@ void TestMatrix::run_test_case(void)
    // Resize methods
 
    test_resize();
+   test_swap();
     
    test_add_row();
    test_add_column();
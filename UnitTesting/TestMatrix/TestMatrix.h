@@ -109,6 +109,7 @@ public:
    // Resize methods
 
    void test_resize(void);
+   void test_swap(void);
 
    void test_add_row(void);
    void test_add_column(void);
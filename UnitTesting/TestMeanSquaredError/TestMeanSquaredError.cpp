@@ -365,6 +365,244 @@ void TestMeanSquaredError::test_calculate_objective_gradient(void)
 
 
 
+// void test_get_training_instances_number(void) method
+
+void TestMeanSquaredError::test_get_training_instances_number(void)
+{
+   message += "test_get_training_instances_number\n";
+
+   MeanSquaredError mse;
+
+   assert_true(mse.get_training_instances_number() == 0, LOG);
+
+   // Test
+
+   InputTargetDataSet itds(4,2,1);
+
+   mse.set_input_target_data_set_pointer(&itds);
+
+   assert_true(mse.get_training_instances_number() == 4, LOG);
+}
+
+
+// void test_calculate_batch_objective_gradient(void) method
+
+void TestMeanSquaredError::test_calculate_batch_objective_gradient(void)
+{
+   message += "test_calculate_batch_objective_gradient\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(4,2,2);
+   itds.get_data().initialize_normal();
+
+   MeanSquaredError mse(&mlp, &itds);
+
+   Vector<double> objective_gradient = mse.calculate_objective_gradient();
+
+   // All training instances
+
+   Vector<int> training_instances_indices(4);
+   training_instances_indices.initialize_sequential();
+
+   Vector<double> batch_objective_gradient = mse.calculate_batch_objective_gradient(training_instances_indices);
+
+   assert_true(batch_objective_gradient.get_size() == mlp.get_neural_parameters_number(), LOG);
+   assert_true((batch_objective_gradient - objective_gradient).calculate_norm() < 1.0e-9*objective_gradient.calculate_norm(), LOG);
+
+   // Two mini-batches, whose mean is the whole objective gradient
+
+   Vector<int> first_batch_indices(2);
+   first_batch_indices[0] = 3;
+   first_batch_indices[1] = 0;
+
+   Vector<int> second_batch_indices(2);
+   second_batch_indices[0] = 1;
+   second_batch_indices[1] = 2;
+
+   batch_objective_gradient = (mse.calculate_batch_objective_gradient(first_batch_indices) 
+   + mse.calculate_batch_objective_gradient(second_batch_indices))/2.0;
+
+   assert_true((batch_objective_gradient - objective_gradient).calculate_norm() < 1.0e-9*objective_gradient.calculate_norm(), LOG);
+}
+
+
+// void test_calculate_vector_dot_Hessian(void) method
+
+void TestMeanSquaredError::test_calculate_vector_dot_Hessian(void)
+{
+   message += "test_calculate_vector_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(3,2,2);
+   itds.initialize_data(0.5);
+
+   MeanSquaredError mse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Vector<double> vector(parameters_number);
+   vector.initialize_normal();
+
+   Vector<double> vector_Hessian_product = mse.calculate_vector_dot_Hessian(vector);
+   Vector<double> vector_Hessian_product_numerical_differentiation = mse.calculate_vector_dot_Hessian_central_differences(vector);
+
+   assert_true(vector_Hessian_product.get_size() == parameters_number, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation < 1.0e-6, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation > -1.0e-6, LOG);
+
+   // Test
+
+   Vector<int> hidden_layers_size(2);
+   hidden_layers_size[0] = 3;
+   hidden_layers_size[1] = 2;
+
+   mlp.set(1,hidden_layers_size,2);
+   mlp.set_output_layer_activation_function(MultilayerPerceptron::Logistic);
+   mlp.initialize_neural_parameters_normal();
+
+   itds.set(4,1,2);
+   itds.initialize_data(0.25);
+
+   mse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+
+   parameters_number = mlp.get_parameters_number();
+
+   vector.set(parameters_number);
+   vector.initialize_normal();
+
+   vector_Hessian_product = mse.calculate_vector_dot_Hessian(vector);
+   Vector<double> Hessian_dot_vector = mse.calculate_Hessian_central_differences().dot(vector);
+
+   assert_true((vector_Hessian_product - Hessian_dot_vector).calculate_norm() < 1.0e-2*Hessian_dot_vector.calculate_norm(), LOG);
+}
+
+
+// void test_calculate_vectors_dot_Hessian(void) method
+
+void TestMeanSquaredError::test_calculate_vectors_dot_Hessian(void)
+{
+   message += "test_calculate_vectors_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(2,2,1);
+   itds.initialize_data(0.5);
+
+   MeanSquaredError mse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> vectors(3, parameters_number);
+   vectors.initialize_normal();
+
+   Matrix<double> vectors_Hessian_product = mse.calculate_vectors_dot_Hessian(vectors);
+
+   assert_true(vectors_Hessian_product.get_rows_number() == 3, LOG);
+   assert_true(vectors_Hessian_product.get_columns_number() == parameters_number, LOG);
+
+   for(int i = 0; i < 3; i++)
+   {
+      Vector<double> difference = vectors_Hessian_product.get_row(i) - mse.calculate_vector_dot_Hessian(vectors.get_row(i));
+
+      assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+   }
+}
+
+
+// void test_calculate_Hessian(void) method
+
+void TestMeanSquaredError::test_calculate_Hessian(void)
+{
+   message += "test_calculate_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(3,2,2);
+   itds.initialize_data(0.5);
+
+   MeanSquaredError mse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> Hessian = mse.calculate_Hessian();
+   Matrix<double> Hessian_numerical_differentiation = mse.calculate_Hessian_numerical_differentiation();
+
+   assert_true(Hessian.get_rows_number() == parameters_number, LOG);
+   assert_true(Hessian.get_columns_number() == parameters_number, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation < 1.0e-2, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation > -1.0e-2, LOG);
+
+   // Test
+
+   mse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+   mse.set_regularization_weight(0.1);
+
+   Hessian = mse.calculate_Hessian();
+   Hessian_numerical_differentiation = mse.calculate_Hessian_numerical_differentiation();
+
+   assert_true(Hessian - Hessian_numerical_differentiation < 1.0e-2, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation > -1.0e-2, LOG);
+}
+
+
+// void test_calculate_Gauss_Newton_Hessian(void) method
+
+void TestMeanSquaredError::test_calculate_Gauss_Newton_Hessian(void)
+{
+   message += "test_calculate_Gauss_Newton_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   // Targets equal to the outputs, so that the Gauss-Newton approximation is exact
+
+   InputTargetDataSet itds(3,2,2);
+
+   Vector<double> input(2);
+
+   for(int i = 0; i < 3; i++)
+   {
+      input[0] = 0.5*i;
+      input[1] = 1.0 - 0.25*i;
+
+      itds.set_training_input_instance(i, input);
+      itds.set_training_target_instance(i, mlp.calculate_output(input));
+   }
+
+   MeanSquaredError mse(&mlp, &itds);
+
+   mse.set_Hessian_approximation_method(ObjectiveFunctional::GaussNewton);
+
+   Matrix<double> Gauss_Newton_Hessian = mse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian == Gauss_Newton_Hessian.calculate_transpose(), LOG);
+
+   mse.set_Hessian_approximation_method(ObjectiveFunctional::ExactHessian);
+
+   Matrix<double> Hessian = mse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian - Hessian < 1.0e-9, LOG);
+   assert_true(Gauss_Newton_Hessian - Hessian > -1.0e-9, LOG);
+
+   // Test
+
+   mse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+   mse.set_regularization_weight(0.1);
+
+   Gauss_Newton_Hessian = mse.calculate_Gauss_Newton_Hessian();
+   Hessian = mse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian - Hessian < 1.0e-9, LOG);
+   assert_true(Gauss_Newton_Hessian - Hessian > -1.0e-9, LOG);
+}
+
+
 // void test_calculate_Jacobian(void) method
 
 void TestMeanSquaredError::test_calculate_Jacobian(void)
@@ -425,6 +663,18 @@ void TestMeanSquaredError::run_test_case(void)
 
    test_calculate_objective_gradient();
 
+   test_get_training_instances_number();
+
+   test_calculate_batch_objective_gradient();
+
+   // Hessian methods
+
+   test_calculate_vector_dot_Hessian();
+   test_calculate_vectors_dot_Hessian();
+
+   test_calculate_Hessian();
+   test_calculate_Gauss_Newton_Hessian();
+
    // Jacobian methods
 
    test_calculate_Jacobian();
@@ -69,6 +69,18 @@ public:
 
    void test_calculate_objective_gradient(void);
 
+   void test_get_training_instances_number(void);
+
+   void test_calculate_batch_objective_gradient(void);
+
+   // Hessian methods
+
+   void test_calculate_vector_dot_Hessian(void);
+   void test_calculate_vectors_dot_Hessian(void);
+
+   void test_calculate_Hessian(void);
+   void test_calculate_Gauss_Newton_Hessian(void);
+
    // Jacobian methods
 
    void test_calculate_Jacobian(void);
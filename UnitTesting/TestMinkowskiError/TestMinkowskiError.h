@@ -76,6 +76,11 @@ public:
 
    void test_calculate_objective_gradient(void);
 
+   // Hessian methods
+
+   void test_calculate_vector_dot_Hessian(void);
+   void test_calculate_vectors_dot_Hessian(void);
+
    // Utility methods
 
    void test_to_XML(void);   
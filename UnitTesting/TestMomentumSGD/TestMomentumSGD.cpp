@@ -0,0 +1,480 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   M O M E N T U M   S G D   C L A S S                                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <cmath>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/Utilities/InputTargetDataSet.h"
+#include "../../Flood/ObjectiveFunctional/SumSquaredError.h"
+#include "../../Flood/TrainingAlgorithm/MomentumSGD.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "TestMomentumSGD.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestMomentumSGD::TestMomentumSGD(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestMomentumSGD::~TestMomentumSGD(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestMomentumSGD::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   MockObjectiveFunctional mof;
+
+   // Default constructor
+
+   MomentumSGD msgd1;
+   assert_true(msgd1.get_objective_functional_pointer() == NULL, LOG);
+
+   // Objective functional constructor
+
+   MomentumSGD msgd2(&mof);
+   assert_true(msgd2.get_objective_functional_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestMomentumSGD::test_destructor(void)
+{
+}
+
+
+// void test_get_momentum(void) method
+
+void TestMomentumSGD::test_get_momentum(void)
+{
+   message += "test_get_momentum\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_momentum(0.5);
+   assert_true(msgd.get_momentum() == 0.5, LOG);
+}
+
+
+// void test_get_Nesterov_momentum(void) method
+
+void TestMomentumSGD::test_get_Nesterov_momentum(void)
+{
+   message += "test_get_Nesterov_momentum\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_Nesterov_momentum(true);
+   assert_true(msgd.get_Nesterov_momentum() == true, LOG);
+}
+
+
+// void test_get_learning_rate_schedule(void) method
+
+void TestMomentumSGD::test_get_learning_rate_schedule(void)
+{
+   message += "test_get_learning_rate_schedule\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::Constant);
+   assert_true(msgd.get_learning_rate_schedule() == StochasticTrainingAlgorithm::Constant, LOG);
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::CosineAnnealing);
+   assert_true(msgd.get_learning_rate_schedule() == StochasticTrainingAlgorithm::CosineAnnealing, LOG);
+}
+
+
+// void test_get_learning_rate_schedule_name(void) method
+
+void TestMomentumSGD::test_get_learning_rate_schedule_name(void)
+{
+   message += "test_get_learning_rate_schedule_name\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::StepDecay);
+   assert_true(msgd.get_learning_rate_schedule_name() == "StepDecay", LOG);
+
+   msgd.set_learning_rate_schedule("InverseTimeDecay");
+   assert_true(msgd.get_learning_rate_schedule_name() == "InverseTimeDecay", LOG);
+}
+
+
+// void test_get_batch_size(void) method
+
+void TestMomentumSGD::test_get_batch_size(void)
+{
+   message += "test_get_batch_size\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_batch_size(8);
+   assert_true(msgd.get_batch_size() == 8, LOG);
+
+   msgd.set_batch_size(0);
+   assert_true(msgd.get_batch_size() == 0, LOG);
+}
+
+
+// void test_calculate_learning_rate(void) method
+
+void TestMomentumSGD::test_calculate_learning_rate(void)
+{
+   message += "test_calculate_learning_rate\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_initial_learning_rate(0.1);
+   msgd.set_learning_rate_decay(0.5);
+   msgd.set_learning_rate_decay_epochs_number(10);
+   msgd.set_maximum_epochs_number(100);
+
+   // Constant
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::Constant);
+
+   assert_true(msgd.calculate_learning_rate(0) == 0.1, LOG);
+   assert_true(msgd.calculate_learning_rate(50) == 0.1, LOG);
+
+   // Step decay
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::StepDecay);
+
+   assert_true(fabs(msgd.calculate_learning_rate(9) - 0.1) < 1.0e-12, LOG);
+   assert_true(fabs(msgd.calculate_learning_rate(10) - 0.05) < 1.0e-12, LOG);
+   assert_true(fabs(msgd.calculate_learning_rate(25) - 0.025) < 1.0e-12, LOG);
+
+   // Exponential decay
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::ExponentialDecay);
+
+   assert_true(fabs(msgd.calculate_learning_rate(5) - 0.1*sqrt(0.5)) < 1.0e-12, LOG);
+   assert_true(fabs(msgd.calculate_learning_rate(20) - 0.025) < 1.0e-12, LOG);
+
+   // Inverse time decay
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::InverseTimeDecay);
+
+   assert_true(fabs(msgd.calculate_learning_rate(10) - 0.1/1.5) < 1.0e-12, LOG);
+
+   // Cosine annealing
+
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::CosineAnnealing);
+
+   assert_true(fabs(msgd.calculate_learning_rate(0) - 0.1) < 1.0e-12, LOG);
+   assert_true(fabs(msgd.calculate_learning_rate(50) - 0.05) < 1.0e-12, LOG);
+   assert_true(fabs(msgd.calculate_learning_rate(100)) < 1.0e-12, LOG);
+}
+
+
+// void test_initialize_optimizer_state(void) method
+
+void TestMomentumSGD::test_initialize_optimizer_state(void)
+{
+   message += "test_initialize_optimizer_state\n";
+
+   MomentumSGD msgd;
+
+   msgd.initialize_optimizer_state(3);
+
+   assert_true(msgd.get_velocity().get_size() == 3, LOG);
+   assert_true(msgd.get_velocity() == 0.0, LOG);
+   assert_true(msgd.get_steps_count() == 0, LOG);
+}
+
+
+// void test_update_parameters(void) method
+
+void TestMomentumSGD::test_update_parameters(void)
+{
+   message += "test_update_parameters\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_momentum(0.9);
+
+   Vector<double> parameters(2, 1.0);
+
+   Vector<double> gradient(2);
+   gradient[0] = 2.0;
+   gradient[1] = -4.0;
+
+   msgd.initialize_optimizer_state(2);
+
+   msgd.update_parameters(parameters, gradient, 0.1);
+
+   assert_true(fabs(parameters[0] - 0.8) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[1] - 1.4) < 1.0e-12, LOG);
+
+   msgd.update_parameters(parameters, gradient, 0.1);
+
+   assert_true(fabs(msgd.get_velocity()[0] + 0.38) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[0] - 0.42) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[1] - 2.16) < 1.0e-12, LOG);
+   assert_true(msgd.get_steps_count() == 2, LOG);
+
+   // Nesterov momentum
+
+   msgd.set_Nesterov_momentum(true);
+
+   parameters.initialize(1.0);
+
+   msgd.initialize_optimizer_state(2);
+
+   msgd.update_parameters(parameters, gradient, 0.1);
+
+   assert_true(fabs(parameters[0] - 0.62) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[1] - 1.76) < 1.0e-12, LOG);
+}
+
+
+// void test_train(void) method
+
+void TestMomentumSGD::test_train(void)
+{
+   message += "test_train\n";
+
+   // Objective functional which cannot be split into mini-batches
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   MomentumSGD msgd(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double old_evaluation = mof.calculate_evaluation();
+
+   msgd.set_initial_learning_rate(0.01);
+   msgd.set_maximum_epochs_number(10);
+   msgd.set_display(false);
+
+   msgd.train();
+
+   double evaluation = mof.calculate_evaluation();
+
+   assert_true(evaluation < old_evaluation, LOG);
+   assert_true(msgd.get_steps_count() == 10, LOG);
+
+   // Mini-batches
+
+   mlp.set(1,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(10,1,1);
+
+   Vector<double> instance(2);
+
+   for(int i = 0; i < 10; i++)
+   {
+      instance[0] = 0.1*i;
+      instance[1] = instance[0]*instance[0];
+
+      itds.set_instance(i, instance);
+   }
+
+   SumSquaredError sse(&mlp, &itds);
+
+   msgd.set_objective_functional_pointer(&sse);
+
+   old_evaluation = sse.calculate_evaluation();
+
+   msgd.set_batch_size(4);
+   msgd.set_maximum_epochs_number(20);
+   msgd.set_reserve_evaluation_history(true);
+
+   msgd.train();
+
+   evaluation = sse.calculate_evaluation();
+
+   assert_true(evaluation < old_evaluation, LOG);
+   assert_true(msgd.get_steps_count() == 60, LOG);
+   assert_true(msgd.get_evaluation_history().get_size() == 21, LOG);
+}
+
+
+// void test_set_reserve_all_training_history(void) method
+
+void TestMomentumSGD::test_set_reserve_all_training_history(void)
+{
+   message += "test_set_reserve_all_training_history\n";
+
+   MomentumSGD msgd;
+   msgd.set_reserve_all_training_history(true);
+
+   assert_true(msgd.get_reserve_evaluation_history() == true, LOG);
+   assert_true(msgd.get_reserve_training_rate_history() == true, LOG);
+   assert_true(msgd.get_reserve_training_direction_history() == false, LOG);
+   assert_true(msgd.get_reserve_inverse_Hessian_history() == false, LOG);
+}
+
+
+// void test_get_training_history_XML(void) method
+
+void TestMomentumSGD::test_get_training_history_XML(void)
+{
+   message += "test_get_training_history_XML\n";
+
+   MultilayerPerceptron mlp(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   MomentumSGD msgd(&mof);
+
+   msgd.set_reserve_all_training_history(true);
+   msgd.set_maximum_epochs_number(1);
+   msgd.set_display(false);
+
+   msgd.train();
+
+   std::string training_history_XML = msgd.get_training_history_XML(true);
+
+   assert_true(training_history_XML.find("<EvaluationHistory>") != std::string::npos, LOG);
+   assert_true(training_history_XML.find("<TrainingRateHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestMomentumSGD::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   MomentumSGD msgd;
+
+   std::string XML = msgd.to_XML(true);
+
+   assert_true(XML.find("<Momentum>") != std::string::npos, LOG);
+   assert_true(XML.find("<BatchSize>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestMomentumSGD::test_load(void)
+{
+   message += "test_load\n";
+
+   MomentumSGD msgd;
+
+   msgd.set_momentum(0.5);
+   msgd.set_Nesterov_momentum(true);
+   msgd.set_learning_rate_schedule(StochasticTrainingAlgorithm::StepDecay);
+   msgd.set_initial_learning_rate(0.2);
+   msgd.set_batch_size(16);
+   msgd.set_maximum_epochs_number(3);
+
+   msgd.save("../Data/MomentumSGD.dat");
+
+   msgd.set_default();
+
+   msgd.load("../Data/MomentumSGD.dat");
+
+   assert_true(msgd.get_momentum() == 0.5, LOG);
+   assert_true(msgd.get_Nesterov_momentum() == true, LOG);
+   assert_true(msgd.get_learning_rate_schedule() == StochasticTrainingAlgorithm::StepDecay, LOG);
+   assert_true(msgd.get_initial_learning_rate() == 0.2, LOG);
+   assert_true(msgd.get_batch_size() == 16, LOG);
+   assert_true(msgd.get_maximum_epochs_number() == 3, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestMomentumSGD::run_test_case(void)
+{
+   message += "Running momentum SGD test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_momentum();
+   test_get_Nesterov_momentum();
+
+   test_get_learning_rate_schedule();
+   test_get_learning_rate_schedule_name();
+
+   test_get_batch_size();
+
+   // Train methods
+
+   test_calculate_learning_rate();
+
+   test_initialize_optimizer_state();
+   test_update_parameters();
+
+   test_train();
+
+   // Training history methods
+
+   test_set_reserve_all_training_history();
+
+   test_get_training_history_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of momentum SGD test case\n";
+}
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,95 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   M O C K   M U L T I - S T A R T   T R A I N I N G   C L A S S                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+
+// Flood includes
+
+#include "../../Flood/TrainingAlgorithm/QuasiNewtonMethod.h"
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "MockMultiStartTraining.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+MockMultiStartTraining::MockMultiStartTraining(TrainingAlgorithm* new_training_algorithm_pointer)
+: MultiStartTraining(new_training_algorithm_pointer)
+{
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+MockMultiStartTraining::MockMultiStartTraining(void) : MultiStartTraining()
+{
+}
+
+
+// DESTRUCTOR
+
+MockMultiStartTraining::~MockMultiStartTraining(void)
+{
+}
+
+
+// METHODS
+
+// ObjectiveFunctional* create_objective_functional(MultilayerPerceptron*) method
+
+ObjectiveFunctional* MockMultiStartTraining::create_objective_functional
+(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   return(new MockObjectiveFunctional(new_multilayer_perceptron_pointer));
+}
+
+
+// TrainingAlgorithm* create_training_algorithm(ObjectiveFunctional*) method
+
+TrainingAlgorithm* MockMultiStartTraining::create_training_algorithm
+(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   QuasiNewtonMethod* quasi_Newton_method_pointer = new QuasiNewtonMethod(new_objective_functional_pointer);
+
+   quasi_Newton_method_pointer->set_evaluation_goal(training_algorithm_pointer->get_evaluation_goal());
+   quasi_Newton_method_pointer->set_maximum_epochs_number(training_algorithm_pointer->get_maximum_epochs_number());
+
+   return(quasi_Newton_method_pointer);
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,389 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   M U L T I - S T A R T   T R A I N I N G   C L A S S                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <stdlib.h>
+#include <cmath>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/Utilities/InputTargetDataSet.h"
+#include "../../Flood/ObjectiveFunctional/SumSquaredError.h"
+#include "../../Flood/TrainingAlgorithm/QuasiNewtonMethod.h"
+#include "../../Flood/TrainingAlgorithm/RandomSearch.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "MockMultiStartTraining.h"
+#include "TestMultiStartTraining.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestMultiStartTraining::TestMultiStartTraining(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestMultiStartTraining::~TestMultiStartTraining(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestMultiStartTraining::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   QuasiNewtonMethod qnm;
+
+   // Default constructor
+
+   MockMultiStartTraining mmst1;
+   assert_true(mmst1.get_training_algorithm_pointer() == NULL, LOG);
+   assert_true(mmst1.get_best_start() == -1, LOG);
+
+   // Training algorithm constructor
+
+   MockMultiStartTraining mmst2(&qnm);
+   assert_true(mmst2.get_training_algorithm_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestMultiStartTraining::test_destructor(void)
+{
+}
+
+
+// void test_get_starts_number(void) method
+
+void TestMultiStartTraining::test_get_starts_number(void)
+{
+   message += "test_get_starts_number\n";
+
+   MockMultiStartTraining mmst;
+
+   mmst.set_starts_number(4);
+   assert_true(mmst.get_starts_number() == 4, LOG);
+}
+
+
+// void test_get_threads_number(void) method
+
+void TestMultiStartTraining::test_get_threads_number(void)
+{
+   message += "test_get_threads_number\n";
+
+   MockMultiStartTraining mmst;
+
+   mmst.set_threads_number(2);
+   assert_true(mmst.get_threads_number() == 2, LOG);
+}
+
+
+// void test_get_cancel_at_evaluation_goal(void) method
+
+void TestMultiStartTraining::test_get_cancel_at_evaluation_goal(void)
+{
+   message += "test_get_cancel_at_evaluation_goal\n";
+
+   MockMultiStartTraining mmst;
+
+   mmst.set_cancel_at_evaluation_goal(false);
+   assert_true(mmst.get_cancel_at_evaluation_goal() == false, LOG);
+}
+
+
+// void test_train(void) method
+
+void TestMultiStartTraining::test_train(void)
+{
+   message += "test_train\n";
+
+   MultilayerPerceptron mlp(3);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   QuasiNewtonMethod qnm(&mof);
+
+   MockMultiStartTraining mmst(&qnm);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double old_evaluation = mof.calculate_evaluation();
+
+   // All starts
+
+   qnm.set_evaluation_goal(0.0);
+   qnm.set_maximum_epochs_number(1);
+
+   mmst.set_starts_number(5);
+   mmst.set_cancel_at_evaluation_goal(false);
+   mmst.set_display(false);
+
+   mmst.train();
+
+   int best_start = mmst.get_best_start();
+
+   assert_true(mmst.get_completed_starts_number() == 5, LOG);
+   assert_true(mmst.get_final_evaluations().get_size() == 5, LOG);
+   assert_true(mmst.get_final_parameters().get_rows_number() == 5, LOG);
+   assert_true(mmst.get_final_parameters().get_columns_number() == 3, LOG);
+   assert_true(mmst.get_evaluation_histories().get_size() == 5, LOG);
+   assert_true(mmst.get_evaluation_histories()[best_start].get_size() > 0, LOG);
+
+   assert_true(mmst.get_best_evaluation() == mmst.get_final_evaluations().calculate_minimum(), LOG);
+   assert_true(mmst.get_best_evaluation() <= old_evaluation, LOG);
+
+   assert_true(mlp.get_parameters() == mmst.get_best_parameters(), LOG);
+   assert_true(mof.calculate_evaluation() == mmst.get_best_evaluation(), LOG);
+
+   // Cancel at evaluation goal
+
+   qnm.set_evaluation_goal(1.0e-6);
+   qnm.set_maximum_epochs_number(100);
+
+   mmst.set_starts_number(8);
+   mmst.set_cancel_at_evaluation_goal(true);
+
+   mmst.train();
+
+   assert_true(mmst.get_completed_starts_number() >= 1, LOG);
+   assert_true(mmst.get_completed_starts_number() <= 8, LOG);
+   assert_true(mmst.get_best_evaluation() <= 1.0e-6, LOG);
+   assert_true(mof.calculate_evaluation() <= 1.0e-6, LOG);
+
+   // Stochastic training algorithm with one thread, where each start draws random numbers from its own seed
+
+   RandomSearch rs(&mof);
+
+   rs.set_maximum_epochs_number(5);
+   rs.set_display(false);
+
+   MultiStartTraining rs_mst(&rs);
+
+   rs_mst.set_starts_number(2);
+   rs_mst.set_threads_number(1);
+   rs_mst.set_display(false);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   srand(1);
+   rs_mst.train();
+
+   Vector<double> final_evaluations = rs_mst.get_final_evaluations();
+
+   mlp.initialize_independent_parameters(1.0);
+
+   rs_mst.set_starts_number(3);
+
+   srand(1);
+   rs_mst.train();
+
+   assert_true(rs_mst.get_final_evaluations()[0] == final_evaluations[0], LOG);
+   assert_true(rs_mst.get_final_evaluations()[1] == final_evaluations[1], LOG);
+
+   // Data modelling, with clones of the objective functional and training algorithm
+
+   mlp.set(1,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(10,1,1);
+
+   Vector<double> instance(2);
+
+   for(int i = 0; i < 10; i++)
+   {
+      instance[0] = 0.1*i;
+      instance[1] = instance[0]*instance[0];
+
+      itds.set_instance(i, instance);
+   }
+
+   SumSquaredError sse(&mlp, &itds);
+
+   QuasiNewtonMethod qnm_sse(&sse);
+
+   qnm_sse.set_maximum_epochs_number(5);
+   qnm_sse.set_display(false);
+
+   MultiStartTraining mst(&qnm_sse);
+
+   mst.set_starts_number(3);
+   mst.set_display(false);
+
+   old_evaluation = sse.calculate_evaluation();
+
+   mst.train();
+
+   assert_true(mst.get_completed_starts_number() == 3, LOG);
+   assert_true(mst.get_best_evaluation() <= mst.get_final_evaluations()[0], LOG);
+   assert_true(mst.get_final_evaluations()[0] < old_evaluation, LOG);
+   assert_true(sse.calculate_evaluation() == mst.get_best_evaluation(), LOG);
+
+   // The starts neither save checkpoints nor write training history files
+
+   qnm_sse.set_checkpoint_period(1);
+   qnm_sse.set_checkpoint_filename("TestMultiStartTrainingCheckpoint.bin");
+   qnm_sse.set_training_history_filename("TestMultiStartTrainingHistory.csv");
+
+   mst.train();
+
+   std::ifstream checkpoint_file("TestMultiStartTrainingCheckpoint.bin");
+   std::ifstream training_history_file("TestMultiStartTrainingHistory.csv");
+
+   assert_true(!checkpoint_file.is_open(), LOG);
+   assert_true(!training_history_file.is_open(), LOG);
+}
+
+
+// void test_get_results_XML(void) method
+
+void TestMultiStartTraining::test_get_results_XML(void)
+{
+   message += "test_get_results_XML\n";
+
+   MultilayerPerceptron mlp(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   QuasiNewtonMethod qnm(&mof);
+
+   MockMultiStartTraining mmst(&qnm);
+
+   qnm.set_maximum_epochs_number(1);
+
+   mmst.set_starts_number(2);
+   mmst.set_display(false);
+
+   mmst.train();
+
+   std::string results_XML = mmst.get_results_XML(true);
+
+   assert_true(results_XML.find("<BestStart>") != std::string::npos, LOG);
+   assert_true(results_XML.find("<FinalEvaluations>") != std::string::npos, LOG);
+   assert_true(results_XML.find("<EvaluationHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestMultiStartTraining::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   MockMultiStartTraining mmst;
+
+   std::string XML = mmst.to_XML(true);
+
+   assert_true(XML.find("<StartsNumber>") != std::string::npos, LOG);
+   assert_true(XML.find("<CancelAtEvaluationGoal>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestMultiStartTraining::test_load(void)
+{
+   message += "test_load\n";
+
+   MockMultiStartTraining mmst;
+
+   mmst.set_starts_number(4);
+   mmst.set_threads_number(2);
+   mmst.set_cancel_at_evaluation_goal(false);
+   mmst.set_display(false);
+
+   mmst.save("../Data/MultiStartTraining.dat");
+
+   mmst.set_default();
+
+   mmst.load("../Data/MultiStartTraining.dat");
+
+   assert_true(mmst.get_starts_number() == 4, LOG);
+   assert_true(mmst.get_threads_number() == 2, LOG);
+   assert_true(mmst.get_cancel_at_evaluation_goal() == false, LOG);
+   assert_true(mmst.get_display() == false, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestMultiStartTraining::run_test_case(void)
+{
+   message += "Running multi-start training test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_starts_number();
+   test_get_threads_number();
+   test_get_cancel_at_evaluation_goal();
+
+   // Train methods
+
+   test_train();
+
+   // Results methods
+
+   test_get_results_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of multi-start training test case\n";
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
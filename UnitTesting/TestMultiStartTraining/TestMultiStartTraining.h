@@ -0,0 +1,96 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   M U L T I - S T A R T   T R A I N I N G   C L A S S   H E A D E R                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __TESTMULTISTARTTRAINING_H__
+#define __TESTMULTISTARTTRAINING_H__
+
+// Flood includes
+
+#include "../../Flood/Utilities/UnitTesting.h"
+
+
+using namespace Flood;
+
+
+class TestMultiStartTraining : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit TestMultiStartTraining(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~TestMultiStartTraining(void);
+
+
+   // METHODS
+
+   // Constructor and destructor methods
+
+   void test_constructor(void);
+   void test_destructor(void);
+
+   // Get methods
+
+   void test_get_starts_number(void);
+   void test_get_threads_number(void);
+   void test_get_cancel_at_evaluation_goal(void);
+
+   // Train methods
+
+   void test_train(void);
+
+   // Results methods
+
+   void test_get_results_XML(void);
+
+   // Utility methods
+
+   void test_to_XML(void);
+   void test_load(void);
+
+   // Unit testing methods
+
+   void run_test_case(void);
+};
+
+
+#endif
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,53 @@
+/****************************************************************************************************************/
+/*                                                                                                              */ 
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   M U L T I - S T A R T   T R A I N I N G   A P P L I C A T I O N                                  */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */ 
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */ 
+/*                                                                                                              */  
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+ 
+// Flood includes
+
+#include "TestMultiStartTraining.h"
+
+using namespace Flood;
+
+int main(void)
+{
+   std::cout << "Flood Neural Network. Test Multi-start Training Application." << std::endl;
+
+   TestMultiStartTraining tmst;
+                  
+   tmst.print_results();
+   
+   return(0);
+}  
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez 
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -54,6 +54,14 @@ MockMultilayerPerceptron::~MockMultilayerPerceptron(void)
 
 // METHODS
 
+// MultilayerPerceptron* clone(void) method
+
+MultilayerPerceptron* MockMultilayerPerceptron::clone(void)
+{
+   return(new MockMultilayerPerceptron(*this));
+}
+
+
 // Boundary conditions: (y_1,y_2) = (y_1,y_2)(x1,x2)
 // x1 = -1, y_1 = -1
 // x1 =  1, y_1 =  1
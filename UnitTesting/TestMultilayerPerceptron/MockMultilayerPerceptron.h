@@ -47,6 +47,10 @@ public:
 
    // METHODS
 
+   // Clone methods
+
+   MultilayerPerceptron* clone(void);
+
    Vector<double> calculate_particular_solution(const Vector<double>&);
    Vector<double> calculate_homogeneous_solution(const Vector<double>&);
 
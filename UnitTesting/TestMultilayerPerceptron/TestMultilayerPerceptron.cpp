@@ -170,6 +170,36 @@ void TestMultilayerPerceptron::test_assignment_operator(void)
 
 
 
+// void test_clone(void) method
+
+void TestMultilayerPerceptron::test_clone(void)
+{
+   message += "test_clone\n";
+
+   MultilayerPerceptron mlp(1,2,3);
+
+   mlp.initialize_parameters_normal();
+
+   Vector<double> parameters = mlp.get_parameters();
+
+   MultilayerPerceptron* mlp_pointer = mlp.clone();
+
+   assert_true(mlp_pointer != &mlp, LOG);
+   assert_true(mlp_pointer->get_inputs_number() == 1, LOG);
+   assert_true(mlp_pointer->get_hidden_layer_size(0) == 2, LOG);
+   assert_true(mlp_pointer->get_outputs_number() == 3, LOG);
+   assert_true(mlp_pointer->get_parameters() == parameters, LOG);
+
+   // The clone does not share the parameters
+
+   mlp_pointer->initialize_parameters(0.0);
+
+   assert_true(mlp.get_parameters() == parameters, LOG);
+
+   delete mlp_pointer;
+}
+
+
 // void test_get_inputs_number(void) method
 
 void TestMultilayerPerceptron::test_get_inputs_number(void)
@@ -1581,6 +1611,47 @@ void TestMultilayerPerceptron::test_get_numerical_epsilon(void)
 }
 
 
+// void test_get_version(void) method
+
+void TestMultilayerPerceptron::test_get_version(void)
+{
+   message += "test_get_version\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+
+   int version = mlp.get_version();
+
+   // Parameters
+
+   mlp.initialize_parameters(1.0);
+   mlp.set_parameters(Vector<double>(mlp.get_parameters_number(), 2.0));
+
+   assert_true(mlp.get_version() == version, LOG);
+
+   // Activation functions
+
+   mlp.set_output_layer_activation_function(MultilayerPerceptron::Logistic);
+
+   assert_true(mlp.get_version() > version, LOG);
+
+   version = mlp.get_version();
+
+   // Scaling methods
+
+   mlp.set_inputs_scaling_method(MultilayerPerceptron::MinimumMaximum);
+
+   assert_true(mlp.get_version() > version, LOG);
+
+   version = mlp.get_version();
+
+   // Update version
+
+   mlp.update_version();
+
+   assert_true(mlp.get_version() == version+1, LOG);
+}
+
+
 // void test_get_display_range_out_warning(void) method
 
 void TestMultilayerPerceptron::test_get_display_range_out_warning(void)
@@ -2872,6 +2943,43 @@ void TestMultilayerPerceptron::test_calculate_unscaled_output(void)
 }
 
 
+// void test_calculate_unscaled_output_derivative(void) method
+
+void TestMultilayerPerceptron::test_calculate_unscaled_output_derivative(void)
+{
+   message += "test_calculate_unscaled_output_derivative\n";
+
+   MultilayerPerceptron mlp(1, 1, 1);
+
+   Vector<double> unscaled_output_derivative;
+
+   mlp.set_outputs_unscaling_method(MultilayerPerceptron::None);
+
+   unscaled_output_derivative = mlp.calculate_unscaled_output_derivative();
+
+   assert_true(unscaled_output_derivative.get_size() == 1, LOG);
+   assert_true(unscaled_output_derivative[0] == 1.0, LOG);
+
+   mlp.set_outputs_unscaling_method(MultilayerPerceptron::MeanStandardDeviation);
+
+   mlp.set_output_variable_mean(0, 1.0);
+   mlp.set_output_variable_standard_deviation(0, 3.0);
+
+   unscaled_output_derivative = mlp.calculate_unscaled_output_derivative();
+
+   assert_true(unscaled_output_derivative[0] == 3.0, LOG);
+
+   mlp.set_outputs_unscaling_method(MultilayerPerceptron::MinimumMaximum);
+
+   mlp.set_output_variable_minimum(0, -1.0);
+   mlp.set_output_variable_maximum(0,  3.0);
+
+   unscaled_output_derivative = mlp.calculate_unscaled_output_derivative();
+
+   assert_true(unscaled_output_derivative[0] == 2.0, LOG);
+}
+
+
 // void test_calculate_bounded_output(void) method
 
 void TestMultilayerPerceptron::test_calculate_bounded_output(void)
@@ -3425,6 +3533,85 @@ void TestMultilayerPerceptron::test_calculate_sensitivity_central_differences(vo
 }
 
 
+// void test_calculate_neural_parameters_gradient(void) method
+
+void TestMultilayerPerceptron::test_calculate_neural_parameters_gradient(void)
+{
+   message += "test_calculate_neural_parameters_gradient\n";
+
+   MultilayerPerceptron mlp(1, 1, 1);
+
+   mlp.initialize_neural_parameters(0.0);
+
+   Vector<double> input(1, 0.0);
+   Vector<double> output_gradient(1, 1.0);
+
+   Vector< Vector<double> > forward_propagation_derivative = mlp.calculate_forward_propagation_derivative(input);
+
+   Vector<double> neural_parameters_gradient
+   = mlp.calculate_neural_parameters_gradient(input, forward_propagation_derivative, output_gradient);
+
+   assert_true(neural_parameters_gradient.get_size() == 4, LOG);
+   assert_true(neural_parameters_gradient[0] == 0.0, LOG);
+   assert_true(neural_parameters_gradient[1] == 0.0, LOG);
+   assert_true(neural_parameters_gradient[2] == 1.0, LOG);
+   assert_true(neural_parameters_gradient[3] == 0.0, LOG);
+}
+
+
+// void test_calculate_neural_parameters_vector_dot_Hessian(void) method
+
+void TestMultilayerPerceptron::test_calculate_neural_parameters_vector_dot_Hessian(void)
+{
+   message += "test_calculate_neural_parameters_vector_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2, 3, 1);
+
+   mlp.initialize_neural_parameters_normal();
+
+   int neural_parameters_number = mlp.get_neural_parameters_number();
+
+   Vector<double> neural_parameters = mlp.get_neural_parameters();
+
+   Vector<double> input(2);
+   input[0] = 0.5;
+   input[1] = -0.5;
+
+   Vector<double> output_gradient(1, 1.0);
+   Vector<double> output_second_derivative(1, 0.0);
+
+   Vector<double> vector(neural_parameters_number);
+   vector.initialize_normal();
+
+   // Exact Hessian of the output times vector
+
+   Vector< Vector<double> > forward_propagation_second_derivative = mlp.calculate_forward_propagation_second_derivative(input);
+
+   Vector<double> vector_dot_Hessian = mlp.calculate_neural_parameters_vector_dot_Hessian(input,
+   forward_propagation_second_derivative, output_gradient, output_second_derivative, vector);
+
+   assert_true(vector_dot_Hessian.get_size() == neural_parameters_number, LOG);
+
+   // Central differences of the gradient of the output along vector
+
+   double epsilon = 1.0e-4;
+
+   mlp.set_neural_parameters(neural_parameters + vector*epsilon);
+
+   Vector<double> gradient_forward = mlp.calculate_neural_parameters_gradient(input,
+   mlp.calculate_forward_propagation_derivative(input), output_gradient);
+
+   mlp.set_neural_parameters(neural_parameters - vector*epsilon);
+
+   Vector<double> gradient_backward = mlp.calculate_neural_parameters_gradient(input,
+   mlp.calculate_forward_propagation_derivative(input), output_gradient);
+
+   Vector<double> difference = vector_dot_Hessian - (gradient_forward - gradient_backward)/(2.0*epsilon);
+
+   assert_true(difference.calculate_norm() < 1.0e-6, LOG);
+}
+
+
 // void test_to_XML(void) method
 
 void TestMultilayerPerceptron::test_to_XML(void)
@@ -3978,6 +4165,10 @@ void TestMultilayerPerceptron::run_test_case(void)
 
    test_assignment_operator();
 
+   // Clone methods
+
+   test_clone();
+
    // Get methods
 
    // Network architecture
@@ -4177,6 +4368,10 @@ void TestMultilayerPerceptron::run_test_case(void)
 
    test_get_numerical_epsilon();
 
+   // Version methods
+
+   test_get_version();
+
    // Display messages
 
    test_get_display();
@@ -4413,6 +4608,7 @@ void TestMultilayerPerceptron::run_test_case(void)
    test_calculate_output_layer_output();
 
    test_calculate_unscaled_output();
+   test_calculate_unscaled_output_derivative();
 
    test_calculate_bounded_output();
 
@@ -4440,6 +4636,14 @@ void TestMultilayerPerceptron::run_test_case(void)
    test_calculate_sensitivity_forward_differences();
    test_calculate_sensitivity_central_differences();
 
+   // Back-propagation methods
+
+   test_calculate_neural_parameters_gradient();
+
+   // Hessian methods
+
+   test_calculate_neural_parameters_vector_dot_Hessian();
+
    // Independent parameters methods   
 
    test_scale_independent_parameters();
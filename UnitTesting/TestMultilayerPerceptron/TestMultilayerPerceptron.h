@@ -55,6 +55,10 @@ public:
 
    void test_assignment_operator(void);
 
+   // Clone methods
+
+   void test_clone(void);
+
    // Get methods
 
    // Network architecture 
@@ -268,6 +272,10 @@ public:
 
    void test_get_numerical_epsilon(void);
 
+   // Version methods
+
+   void test_get_version(void);
+
    // Display messages
 
    void test_get_display_range_out_warning(void);
@@ -518,6 +526,7 @@ public:
    void test_calculate_output_layer_output(void);
 
    void test_calculate_unscaled_output(void);
+   void test_calculate_unscaled_output_derivative(void);
 
    void test_calculate_bounded_output(void);
 
@@ -554,6 +563,14 @@ public:
    void test_calculate_sensitivity_forward_differences(void);   
    void test_calculate_sensitivity_central_differences(void);
 
+   // Back-propagation methods
+
+   void test_calculate_neural_parameters_gradient(void);
+
+   // Hessian methods
+
+   void test_calculate_neural_parameters_vector_dot_Hessian(void);
+
    // Expression methods
 
    void test_get_expression(void);
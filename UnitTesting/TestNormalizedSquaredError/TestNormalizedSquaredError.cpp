@@ -18,6 +18,7 @@
 #include <iostream>
 #include <fstream>
 #include <limits>
+#include <stdlib.h>
 #include <cmath>
 
 // Flood includes
@@ -194,6 +195,39 @@ void TestNormalizedSquaredError::test_calculate_validation_normalization_coeffic
 }
 
 
+// void test_get_training_normalization_coefficient(void) method
+
+void TestNormalizedSquaredError::test_get_training_normalization_coefficient(void)
+{
+   message += "test_get_training_normalization_coefficient\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   mlp.initialize_neural_parameters(0.0);
+
+   InputTargetDataSet itds(2,1,1);
+   itds.initialize_data(0.0);
+
+   NormalizedSquaredError nse(&mlp, &itds); 
+
+   assert_true(nse.get_training_normalization_coefficient() == 0.0, LOG);
+
+   Matrix<double> new_data(2,2);
+   new_data[0][0] = -1.0;
+   new_data[0][1] = -1.0;
+   new_data[1][0] = 1.0;
+   new_data[1][1] = 1.0;
+
+   itds.set_data(new_data);
+
+   assert_true(nse.get_training_normalization_coefficient() == 2.0, LOG);
+   assert_true(nse.get_training_normalization_coefficient() == nse.calculate_training_normalization_coefficient(), LOG);
+
+   itds.set_validation();
+
+   assert_true(nse.get_validation_normalization_coefficient() == 2.0, LOG);
+}
+
+
 // void test_calculate_objective(void) method
 
 void TestNormalizedSquaredError::test_calculate_objective(void)   
@@ -422,6 +456,252 @@ void TestNormalizedSquaredError::test_calculate_objective_gradient(void)
 }
 
 
+// void test_get_training_instances_number(void) method
+
+void TestNormalizedSquaredError::test_get_training_instances_number(void)
+{
+   message += "test_get_training_instances_number\n";
+
+   NormalizedSquaredError nse;
+
+   assert_true(nse.get_training_instances_number() == 0, LOG);
+
+   // Test
+
+   InputTargetDataSet itds(4,2,1);
+
+   nse.set_input_target_data_set_pointer(&itds);
+
+   assert_true(nse.get_training_instances_number() == 4, LOG);
+}
+
+
+// void test_calculate_batch_objective_gradient(void) method
+
+void TestNormalizedSquaredError::test_calculate_batch_objective_gradient(void)
+{
+   message += "test_calculate_batch_objective_gradient\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(4,2,2);
+   itds.get_data().initialize_normal();
+
+   NormalizedSquaredError nse(&mlp, &itds);
+
+   Vector<double> objective_gradient = nse.calculate_objective_gradient();
+
+   // All training instances
+
+   Vector<int> training_instances_indices(4);
+   training_instances_indices.initialize_sequential();
+
+   Vector<double> batch_objective_gradient = nse.calculate_batch_objective_gradient(training_instances_indices);
+
+   assert_true(batch_objective_gradient.get_size() == mlp.get_neural_parameters_number(), LOG);
+   assert_true((batch_objective_gradient - objective_gradient).calculate_norm() < 1.0e-9*objective_gradient.calculate_norm(), LOG);
+
+   // Two mini-batches, whose mean is the whole objective gradient
+
+   Vector<int> first_batch_indices(2);
+   first_batch_indices[0] = 3;
+   first_batch_indices[1] = 0;
+
+   Vector<int> second_batch_indices(2);
+   second_batch_indices[0] = 1;
+   second_batch_indices[1] = 2;
+
+   batch_objective_gradient = (nse.calculate_batch_objective_gradient(first_batch_indices) 
+   + nse.calculate_batch_objective_gradient(second_batch_indices))/2.0;
+
+   assert_true((batch_objective_gradient - objective_gradient).calculate_norm() < 1.0e-9*objective_gradient.calculate_norm(), LOG);
+}
+
+
+// void test_calculate_vector_dot_Hessian(void) method
+
+void TestNormalizedSquaredError::test_calculate_vector_dot_Hessian(void)
+{
+   message += "test_calculate_vector_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(3,2,2);
+   itds.initialize_data(0.5);
+   itds.set_training_target_instance(0, Vector<double>(2, 1.0));
+
+   NormalizedSquaredError nse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Vector<double> vector(parameters_number);
+   vector.initialize_normal();
+
+   Vector<double> vector_Hessian_product = nse.calculate_vector_dot_Hessian(vector);
+   Vector<double> vector_Hessian_product_numerical_differentiation = nse.calculate_vector_dot_Hessian_central_differences(vector);
+
+   assert_true(vector_Hessian_product.get_size() == parameters_number, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation < 1.0e-6, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation > -1.0e-6, LOG);
+
+   // Test
+
+   Vector<int> hidden_layers_size(2);
+   hidden_layers_size[0] = 3;
+   hidden_layers_size[1] = 2;
+
+   mlp.set(1,hidden_layers_size,2);
+   mlp.set_output_layer_activation_function(MultilayerPerceptron::Logistic);
+   mlp.initialize_neural_parameters_normal();
+
+   itds.set(4,1,2);
+   itds.initialize_data(0.25);
+   itds.set_training_target_instance(0, Vector<double>(2, 1.0));
+
+   nse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+
+   parameters_number = mlp.get_parameters_number();
+
+   vector.set(parameters_number);
+   vector.initialize_normal();
+
+   vector_Hessian_product = nse.calculate_vector_dot_Hessian(vector);
+   Vector<double> Hessian_dot_vector = nse.calculate_Hessian_central_differences().dot(vector);
+
+   assert_true((vector_Hessian_product - Hessian_dot_vector).calculate_norm() < 1.0e-2*Hessian_dot_vector.calculate_norm(), LOG);
+}
+
+
+// void test_calculate_vectors_dot_Hessian(void) method
+
+void TestNormalizedSquaredError::test_calculate_vectors_dot_Hessian(void)
+{
+   message += "test_calculate_vectors_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(2,2,1);
+   itds.initialize_data(0.5);
+   itds.set_training_target_instance(0, Vector<double>(2, 1.0));
+
+   NormalizedSquaredError nse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> vectors(3, parameters_number);
+   vectors.initialize_normal();
+
+   Matrix<double> vectors_Hessian_product = nse.calculate_vectors_dot_Hessian(vectors);
+
+   assert_true(vectors_Hessian_product.get_rows_number() == 3, LOG);
+   assert_true(vectors_Hessian_product.get_columns_number() == parameters_number, LOG);
+
+   for(int i = 0; i < 3; i++)
+   {
+      Vector<double> difference = vectors_Hessian_product.get_row(i) - nse.calculate_vector_dot_Hessian(vectors.get_row(i));
+
+      assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+   }
+}
+
+
+// void test_calculate_Hessian(void) method
+
+void TestNormalizedSquaredError::test_calculate_Hessian(void)
+{
+   message += "test_calculate_Hessian\n";
+
+   // Fixed seed, so that the numerical differentiation error does not depend on earlier tests
+
+   srand(2);
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(3,2,2);
+   itds.initialize_data(0.5);
+   itds.set_training_target_instance(0, Vector<double>(2, 1.0));
+
+   NormalizedSquaredError nse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> Hessian = nse.calculate_Hessian();
+   Matrix<double> Hessian_numerical_differentiation = nse.calculate_Hessian_numerical_differentiation();
+
+   assert_true(Hessian.get_rows_number() == parameters_number, LOG);
+   assert_true(Hessian.get_columns_number() == parameters_number, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation < 1.0e-2, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation > -1.0e-2, LOG);
+
+   // Test
+
+   nse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+   nse.set_regularization_weight(0.1);
+
+   Hessian = nse.calculate_Hessian();
+   Hessian_numerical_differentiation = nse.calculate_Hessian_numerical_differentiation();
+
+   assert_true(Hessian - Hessian_numerical_differentiation < 1.0e-2, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation > -1.0e-2, LOG);
+}
+
+
+// void test_calculate_Gauss_Newton_Hessian(void) method
+
+void TestNormalizedSquaredError::test_calculate_Gauss_Newton_Hessian(void)
+{
+   message += "test_calculate_Gauss_Newton_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   // Targets equal to the outputs, so that the Gauss-Newton approximation is exact
+
+   InputTargetDataSet itds(3,2,2);
+
+   Vector<double> input(2);
+
+   for(int i = 0; i < 3; i++)
+   {
+      input[0] = 0.5*i;
+      input[1] = 1.0 - 0.25*i;
+
+      itds.set_training_input_instance(i, input);
+      itds.set_training_target_instance(i, mlp.calculate_output(input));
+   }
+
+   NormalizedSquaredError nse(&mlp, &itds);
+
+   nse.set_Hessian_approximation_method(ObjectiveFunctional::GaussNewton);
+
+   Matrix<double> Gauss_Newton_Hessian = nse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian == Gauss_Newton_Hessian.calculate_transpose(), LOG);
+
+   nse.set_Hessian_approximation_method(ObjectiveFunctional::ExactHessian);
+
+   Matrix<double> Hessian = nse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian - Hessian < 1.0e-9, LOG);
+   assert_true(Gauss_Newton_Hessian - Hessian > -1.0e-9, LOG);
+
+   // Test
+
+   nse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+   nse.set_regularization_weight(0.1);
+
+   Gauss_Newton_Hessian = nse.calculate_Gauss_Newton_Hessian();
+   Hessian = nse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian - Hessian < 1.0e-9, LOG);
+   assert_true(Gauss_Newton_Hessian - Hessian > -1.0e-9, LOG);
+}
+
+
 // void run_test_case(void) method
 
 void TestNormalizedSquaredError::run_test_case(void)
@@ -446,6 +726,7 @@ void TestNormalizedSquaredError::run_test_case(void)
 
    test_calculate_training_normalization_coefficient();
    test_calculate_validation_normalization_coefficient();
+   test_get_training_normalization_coefficient();
 
    test_calculate_objective();   
    test_calculate_validation_error();
@@ -459,6 +740,18 @@ void TestNormalizedSquaredError::run_test_case(void)
 
    test_calculate_objective_gradient();
 
+   test_get_training_instances_number();
+
+   test_calculate_batch_objective_gradient();
+
+   // Hessian methods
+
+   test_calculate_vector_dot_Hessian();
+   test_calculate_vectors_dot_Hessian();
+
+   test_calculate_Hessian();
+   test_calculate_Gauss_Newton_Hessian();
+
    message += "End of normalized squared error test case...\n";
 }
 
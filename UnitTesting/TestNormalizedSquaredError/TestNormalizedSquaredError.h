@@ -62,6 +62,7 @@ public:
 
    void test_calculate_training_normalization_coefficient(void);   
    void test_calculate_validation_normalization_coefficient(void);   
+   void test_get_training_normalization_coefficient(void);
 
    // Evaluation methods
 
@@ -78,6 +79,18 @@ public:
 
    void test_calculate_objective_gradient(void);
 
+   void test_get_training_instances_number(void);
+
+   void test_calculate_batch_objective_gradient(void);
+
+   // Hessian methods
+
+   void test_calculate_vector_dot_Hessian(void);
+   void test_calculate_vectors_dot_Hessian(void);
+
+   void test_calculate_Hessian(void);
+   void test_calculate_Gauss_Newton_Hessian(void);
+
    // Unit testing methods
 
    void run_test_case(void);
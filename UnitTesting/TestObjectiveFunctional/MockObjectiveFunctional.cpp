@@ -61,6 +61,18 @@ MockObjectiveFunctional::~MockObjectiveFunctional(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* MockObjectiveFunctional::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   MockObjectiveFunctional* mock_objective_functional_pointer = new MockObjectiveFunctional(*this);
+
+   mock_objective_functional_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(mock_objective_functional_pointer);
+}
+
+
 // double calculate_objective(void) method
 
 double MockObjectiveFunctional::calculate_objective(void)
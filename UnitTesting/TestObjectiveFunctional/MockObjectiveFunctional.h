@@ -45,6 +45,10 @@ public:
    virtual ~MockObjectiveFunctional(void); 
    // METHODS
 
+   // Clone methods
+
+   ObjectiveFunctional* clone(MultilayerPerceptron*);
+
    double calculate_objective(void);
 
    Vector<double> calculate_objective_gradient(void);
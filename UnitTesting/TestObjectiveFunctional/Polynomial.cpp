@@ -53,6 +53,18 @@ Polynomial::~Polynomial(void)
 
 // METHODS
 
+// ObjectiveFunctional* clone(MultilayerPerceptron*) method
+
+ObjectiveFunctional* Polynomial::clone(MultilayerPerceptron* new_multilayer_perceptron_pointer)
+{
+   Polynomial* polynomial_pointer = new Polynomial(*this);
+
+   polynomial_pointer->set_multilayer_perceptron_pointer(new_multilayer_perceptron_pointer);
+
+   return(polynomial_pointer);
+}
+
+
 // Vector<double> get_coefficients(void) method
 
 Vector<double> Polynomial::get_coefficients(void)
@@ -185,6 +185,20 @@ void TestObjectiveFunctional::test_get_calculate_Hessian_count(void)
 }
 
 
+// void test_get_evaluation_cache_size(void) method
+
+void TestObjectiveFunctional::test_get_evaluation_cache_size(void)
+{
+   message += "test_get_evaluation_cache_size\n";
+
+   MockObjectiveFunctional mof;
+
+   assert_true(mof.get_evaluation_cache_size() == 0, LOG);
+   assert_true(mof.get_evaluation_cache_hits_count() == 0, LOG);
+   assert_true(mof.get_evaluation_cache_misses_count() == 0, LOG);
+}
+
+
 // void test_get_display(void) method
 
 void TestObjectiveFunctional::test_get_display(void)
@@ -201,6 +215,18 @@ void TestObjectiveFunctional::test_get_display(void)
 }
 
 
+// void test_get_training_instances_number(void) method
+
+void TestObjectiveFunctional::test_get_training_instances_number(void)
+{
+   message += "test_get_training_instances_number\n";
+
+   MockObjectiveFunctional mof;
+
+   assert_true(mof.get_training_instances_number() == 0, LOG);
+}
+
+
 // void test_get_numerical_epsilon_method(void) method
 
 void TestObjectiveFunctional::test_get_numerical_epsilon_method(void)
@@ -217,6 +243,25 @@ void TestObjectiveFunctional::test_get_numerical_epsilon_method(void)
 }
 
 
+// void test_get_Hessian_approximation_method(void) method
+
+void TestObjectiveFunctional::test_get_Hessian_approximation_method(void)
+{
+   message += "test_get_Hessian_approximation_method\n";
+
+   MockObjectiveFunctional mof;
+
+   assert_true(mof.get_Hessian_approximation_method() == ObjectiveFunctional::ExactHessian, LOG);
+
+   mof.set_Hessian_approximation_method(ObjectiveFunctional::GaussNewton);
+   assert_true(mof.get_Hessian_approximation_method() == ObjectiveFunctional::GaussNewton, LOG);
+   assert_true(mof.get_Hessian_approximation_method_name() == "GaussNewton", LOG);
+
+   mof.set_Hessian_approximation_method("ExactHessian");
+   assert_true(mof.get_Hessian_approximation_method() == ObjectiveFunctional::ExactHessian, LOG);
+}
+
+
 // void test_get_numerical_epsilon_method_name(void) method
 
 void TestObjectiveFunctional::test_get_numerical_epsilon_method_name(void)
@@ -377,6 +422,20 @@ void TestObjectiveFunctional::test_set_calculate_Hessian_count(void)
 }
 
 
+// void test_set_evaluation_cache_size(void) method
+
+void TestObjectiveFunctional::test_set_evaluation_cache_size(void)
+{
+   message += "test_set_evaluation_cache_size\n";
+
+   MockObjectiveFunctional mof;
+
+   mof.set_evaluation_cache_size(4);
+
+   assert_true(mof.get_evaluation_cache_size() == 4, LOG);
+}
+
+
 // void test_set_display(void) method
 
 void TestObjectiveFunctional::test_set_display(void)
@@ -472,6 +531,172 @@ void TestObjectiveFunctional::test_calculate_potential_evaluation(void)
    potential_evaluation = mof.calculate_potential_evaluation(parameters);
 
    assert_true(evaluation == potential_evaluation, LOG);
+
+   // Multilayer perceptron not modified
+
+   mlp.initialize_parameters(1.0);
+
+   mof.calculate_potential_evaluation(Vector<double>(mlp.get_parameters_number(), 2.0));
+   mof.calculate_potential_evaluation(Vector<double>(mlp.get_parameters_number(), 3.0), 0.0);
+
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+}
+
+
+// void test_calculate_potential_evaluation_batch(void) method
+
+void TestObjectiveFunctional::test_calculate_potential_evaluation_batch(void)
+{
+   message += "test_calculate_potential_evaluation_batch\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   mlp.set_independent_parameters_number(1);
+
+   mlp.initialize_parameters(1.0);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> potential_parameters(5, parameters_number);
+
+   for(int i = 0; i < 5; i++)
+   {
+      potential_parameters.set_row(i, Vector<double>(parameters_number, (double)i));
+   }
+
+   Vector<double> potential_evaluation;
+
+   // Serial
+
+   mof.set_calculate_evaluation_count(0);
+
+   potential_evaluation = mof.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(potential_evaluation.get_size() == 5, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 5, LOG);
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+
+   for(int i = 0; i < 5; i++)
+   {
+      assert_true(potential_evaluation[i] == mof.calculate_potential_evaluation(potential_parameters.get_row(i)), LOG);
+   }
+
+   // Threads
+
+   for(int threads_number = 0; threads_number <= 3; threads_number++)
+   {
+      mof.set_calculate_evaluation_count(0);
+
+      assert_true(mof.calculate_potential_evaluation(potential_parameters, threads_number) == potential_evaluation, LOG);
+      assert_true(mof.get_calculate_evaluation_count() == 5, LOG);
+      assert_true(mlp.get_parameters() == 1.0, LOG);
+   }
+
+   // Threads after changing the objective, which the clones of the threads must not miss
+
+   mof.set_objective_weight(2.0);
+
+   assert_true(mof.calculate_potential_evaluation(potential_parameters, 2) == potential_evaluation*2.0, LOG);
+
+   mof.set_objective_weight(1.0);
+
+   // Threads after changing the architecture
+
+   mlp.set_network_architecture(1,2,1);
+   mlp.initialize_parameters(1.0);
+
+   parameters_number = mlp.get_parameters_number();
+
+   potential_parameters.set(5, parameters_number);
+
+   for(int i = 0; i < 5; i++)
+   {
+      potential_parameters.set_row(i, Vector<double>(parameters_number, (double)i));
+   }
+
+   potential_evaluation = mof.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(mof.calculate_potential_evaluation(potential_parameters, 2) == potential_evaluation, LOG);
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+
+   // Empty batch
+
+   Matrix<double> empty;
+
+   assert_true(mof.calculate_potential_evaluation(empty).get_size() == 0, LOG);
+}
+
+
+// void test_calculate_evaluation_cache(void) method
+
+void TestObjectiveFunctional::test_calculate_evaluation_cache(void)
+{
+   message += "test_calculate_evaluation_cache\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   MockObjectiveFunctional mof(&mlp);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   mlp.initialize_parameters(1.0);
+
+   mof.set_evaluation_cache_size(2);
+
+   // Repeated evaluation
+
+   double evaluation = mof.calculate_evaluation();
+
+   assert_true(mof.calculate_evaluation() == evaluation, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 1, LOG);
+   assert_true(mof.get_evaluation_cache_hits_count() == 1, LOG);
+   assert_true(mof.get_evaluation_cache_misses_count() == 1, LOG);
+
+   // Repeated potential evaluation
+
+   Vector<double> potential_parameters(parameters_number, 2.0);
+
+   double potential_evaluation = mof.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(mof.calculate_potential_evaluation(potential_parameters) == potential_evaluation, LOG);
+   assert_true(mof.calculate_evaluation() == evaluation, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 2, LOG);
+   assert_true(mof.get_evaluation_cache_hits_count() == 3, LOG);
+
+   // The least recently used parameters are forgotten first
+
+   mof.calculate_potential_evaluation(Vector<double>(parameters_number, 3.0));
+
+   assert_true(mof.calculate_evaluation() == evaluation, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 3, LOG);
+
+   assert_true(mof.calculate_potential_evaluation(potential_parameters) == potential_evaluation, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 4, LOG);
+
+   // Repeated gradient
+
+   Vector<double> gradient = mof.calculate_gradient();
+
+   assert_true(mof.calculate_gradient() == gradient, LOG);
+   assert_true(mof.get_calculate_gradient_count() == 1, LOG);
+
+   // Clear
+
+   mof.set_objective_weight(2.0);
+
+   assert_true(mof.calculate_evaluation() == 2.0*evaluation, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 5, LOG);
+
+   // No cache
+
+   mof.set_evaluation_cache_size(0);
+   mof.set_evaluation_cache_hits_count(0);
+
+   mof.calculate_evaluation();
+   mof.calculate_evaluation();
+
+   assert_true(mof.get_calculate_evaluation_count() == 7, LOG);
+   assert_true(mof.get_evaluation_cache_hits_count() == 0, LOG);
 }
 
 
@@ -574,6 +799,12 @@ void TestObjectiveFunctional::test_calculate_potential_gradient(void)
    parameters = mlp.get_parameters();
 
    assert_true(mof.calculate_potential_gradient(parameters) == 0.0, LOG);
+
+   // Multilayer perceptron not modified
+
+   mof.calculate_potential_gradient(Vector<double>(mlp.get_parameters_number(), 1.0));
+
+   assert_true(mlp.get_parameters() == 0.0, LOG);
 }
 
 
@@ -585,6 +816,34 @@ void TestObjectiveFunctional::test_calculate_gradient_norm(void)
 }
 
 
+// void test_calculate_batch_gradient(void) method
+
+void TestObjectiveFunctional::test_calculate_batch_gradient(void)
+{
+   message += "test_calculate_batch_gradient\n";
+
+   MultilayerPerceptron mlp(2);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   Vector<int> training_instances_indices(1, 0);
+
+   // The mock objective functional cannot be split into mini-batches
+
+   assert_true(mof.calculate_batch_gradient(training_instances_indices) == mof.calculate_gradient(), LOG);
+
+   // Test
+
+   mof.set_calculate_gradient_count(0);
+
+   mof.calculate_batch_gradient(training_instances_indices);
+
+   assert_true(mof.get_calculate_gradient_count() == 1, LOG);
+}
+
+
 // void test_calculate_objective_gradient(void) method
 
 void TestObjectiveFunctional::test_calculate_objective_gradient(void)
@@ -721,6 +980,36 @@ void TestObjectiveFunctional::test_calculate_neural_parameters_gradient_numerica
 void TestObjectiveFunctional::test_calculate_neural_parameters_gradient_forward_differences(void)
 {
    message += "test_calculate_neural_parameters_gradient_forward_differences\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   MockObjectiveFunctional mof(&mlp);
+
+   mlp.initialize_parameters(1.0);
+
+   int neural_parameters_number = mlp.get_neural_parameters_number();
+
+   mof.set_calculate_evaluation_count(0);
+
+   Vector<double> neural_parameters_gradient = mof.calculate_neural_parameters_gradient_forward_differences();
+
+   assert_true(neural_parameters_gradient.get_size() == neural_parameters_number, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == neural_parameters_number+1, LOG);
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+
+   for(int i = 0; i < neural_parameters_number; i++)
+   {
+      assert_true(fabs(neural_parameters_gradient[i] - 2.0) < 1.0e-3, LOG);
+   }
+
+   // Threads
+
+   for(int threads_number = 0; threads_number <= 2; threads_number++)
+   {
+      mof.set_threads_number(threads_number);
+
+      assert_true(mof.calculate_neural_parameters_gradient_forward_differences() == neural_parameters_gradient, LOG);
+      assert_true(mlp.get_parameters() == 1.0, LOG);
+   }
 }
 
 
@@ -729,6 +1018,36 @@ void TestObjectiveFunctional::test_calculate_neural_parameters_gradient_forward_
 void TestObjectiveFunctional::test_calculate_neural_parameters_gradient_central_differences(void)
 {
    message += "test_calculate_neural_parameters_gradient_central_differences\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   MockObjectiveFunctional mof(&mlp);
+
+   mlp.initialize_parameters(1.0);
+
+   int neural_parameters_number = mlp.get_neural_parameters_number();
+
+   mof.set_calculate_evaluation_count(0);
+
+   Vector<double> neural_parameters_gradient = mof.calculate_neural_parameters_gradient_central_differences();
+
+   assert_true(neural_parameters_gradient.get_size() == neural_parameters_number, LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 2*neural_parameters_number, LOG);
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+
+   for(int i = 0; i < neural_parameters_number; i++)
+   {
+      assert_true(fabs(neural_parameters_gradient[i] - 2.0) < 1.0e-6, LOG);
+   }
+
+   // Threads
+
+   for(int threads_number = 0; threads_number <= 2; threads_number++)
+   {
+      mof.set_threads_number(threads_number);
+
+      assert_true(mof.calculate_neural_parameters_gradient_central_differences() == neural_parameters_gradient, LOG);
+      assert_true(mlp.get_parameters() == 1.0, LOG);
+   }
 }
 
 
@@ -773,6 +1092,25 @@ void TestObjectiveFunctional::test_calculate_independent_parameters_gradient_for
    independent_parameters_gradient = mof.calculate_independent_parameters_gradient_forward_differences();
    assert_true(independent_parameters_gradient.get_size() == independent_parameters_number, LOG);
 
+   // Test 
+
+   mlp.set_independent_parameters_number(2);
+   mlp.initialize_independent_parameters(0.5);
+
+   Vector<double> lower_bound(2, -1.0);
+   lower_bound[1] = 0.5;
+
+   Vector<double> upper_bound(2, 1.0);
+   upper_bound[1] = 0.5;
+
+   mlp.set_independent_parameters_lower_bound(lower_bound);
+   mlp.set_independent_parameters_upper_bound(upper_bound);
+
+   independent_parameters_gradient = mof.calculate_independent_parameters_gradient_forward_differences();
+   assert_true(independent_parameters_gradient.get_size() == 2, LOG);
+   assert_true(independent_parameters_gradient[0] != 0.0, LOG);
+   assert_true(independent_parameters_gradient[1] == 0.0, LOG);
+
 }
 
 
@@ -808,6 +1146,25 @@ void TestObjectiveFunctional::test_calculate_independent_parameters_gradient_cen
    independent_parameters_number = mlp.get_independent_parameters_number();
    independent_parameters_gradient = mof.calculate_independent_parameters_gradient_central_differences();
    assert_true(independent_parameters_gradient.get_size() == independent_parameters_number, LOG);
+
+   // Test 
+
+   mlp.set_independent_parameters_number(2);
+   mlp.initialize_independent_parameters(0.5);
+
+   Vector<double> lower_bound(2, -1.0);
+   lower_bound[1] = 0.5;
+
+   Vector<double> upper_bound(2, 1.0);
+   upper_bound[1] = 0.5;
+
+   mlp.set_independent_parameters_lower_bound(lower_bound);
+   mlp.set_independent_parameters_upper_bound(upper_bound);
+
+   independent_parameters_gradient = mof.calculate_independent_parameters_gradient_central_differences();
+   assert_true(independent_parameters_gradient.get_size() == 2, LOG);
+   assert_true(independent_parameters_gradient[0] != 0.0, LOG);
+   assert_true(independent_parameters_gradient[1] == 0.0, LOG);
 }
 
 
@@ -888,6 +1245,45 @@ void TestObjectiveFunctional::test_calculate_potential_Hessian(void)
 }
 
 
+// void test_calculate_regularization_Hessian(void) method
+
+void TestObjectiveFunctional::test_calculate_regularization_Hessian(void)
+{
+   message += "test_calculate_regularization_Hessian\n";
+
+   MultilayerPerceptron mlp(1, 2, 1);
+   mlp.set_independent_parameters_number(1);
+   mlp.initialize_parameters_normal();
+
+   int parameters_number = mlp.get_parameters_number();
+
+   MockObjectiveFunctional mof(&mlp);
+
+   Matrix<double> regularization_Hessian = mof.calculate_regularization_Hessian();
+
+   assert_true(regularization_Hessian.get_rows_number() == parameters_number, LOG);
+   assert_true(regularization_Hessian == 0.0, LOG);
+
+   // Test
+
+   mof.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+
+   regularization_Hessian = mof.calculate_regularization_Hessian();
+
+   Vector<double> unit(parameters_number);
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      unit.initialize(0.0);
+      unit[i] = 1.0;
+
+      Vector<double> difference = regularization_Hessian.get_row(i) - mof.calculate_regularization_vector_dot_Hessian(unit);
+
+      assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+   }
+}
+
+
 // void test_calculate_Hessian_numerical_differentiation(void) method
 
 void TestObjectiveFunctional::test_calculate_Hessian_numerical_differentiation(void)
@@ -902,6 +1298,41 @@ void TestObjectiveFunctional::test_calculate_Hessian_forward_differences(void)
 {
    message += "test_calculate_Hessian_forward_differences\n";
 
+   MultilayerPerceptron mlp(1,1,1);
+   mlp.set_independent_parameters_number(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   mlp.initialize_parameters(1.0);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   mof.set_calculate_evaluation_count(0);
+
+   Matrix<double> Hessian = mof.calculate_Hessian_forward_differences();
+
+   assert_true(Hessian.get_rows_number() == parameters_number, LOG);
+   assert_true(Hessian.get_columns_number() == parameters_number, LOG);
+   assert_true(Hessian.is_symmetric(), LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 1 + parameters_number + parameters_number*(parameters_number+1)/2, LOG);
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         assert_true(fabs(Hessian[i][j] - (i == j ? 2.0 : 0.0)) < 1.0e-2, LOG);
+      }
+   }
+
+   // Threads
+
+   for(int threads_number = 0; threads_number <= 2; threads_number++)
+   {
+      mof.set_threads_number(threads_number);
+
+      assert_true(mof.calculate_Hessian_forward_differences() == Hessian, LOG);
+   }
 }
 
 
@@ -910,6 +1341,42 @@ void TestObjectiveFunctional::test_calculate_Hessian_forward_differences(void)
 void TestObjectiveFunctional::test_calculate_Hessian_central_differences(void)
 {
    message += "test_calculate_Hessian_central_differences\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   mlp.set_independent_parameters_number(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   mlp.initialize_parameters(1.0);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   mof.set_calculate_evaluation_count(0);
+
+   Matrix<double> Hessian = mof.calculate_Hessian_central_differences();
+
+   assert_true(Hessian.get_rows_number() == parameters_number, LOG);
+   assert_true(Hessian.get_columns_number() == parameters_number, LOG);
+   assert_true(Hessian.is_symmetric(), LOG);
+   assert_true(mof.get_calculate_evaluation_count() == 1 + 2*parameters_number*parameters_number, LOG);
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+
+   for(int i = 0; i < parameters_number; i++)
+   {
+      for(int j = 0; j < parameters_number; j++)
+      {
+         assert_true(fabs(Hessian[i][j] - (i == j ? 2.0 : 0.0)) < 1.0e-2, LOG);
+      }
+   }
+
+   // Threads
+
+   for(int threads_number = 0; threads_number <= 2; threads_number++)
+   {
+      mof.set_threads_number(threads_number);
+
+      assert_true(mof.calculate_Hessian_central_differences() == Hessian, LOG);
+   }
 }
 
 
@@ -1041,6 +1508,166 @@ void TestObjectiveFunctional::test_calculate_BFGS_inverse_Hessian_approximation(
 }
 
 
+// void test_update_DFP_inverse_Hessian(void) method
+
+void TestObjectiveFunctional::test_update_DFP_inverse_Hessian(void)
+{
+   message += "test_update_DFP_inverse_Hessian\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   Vector<double> old_parameters(2);
+   old_parameters[0] = 1.0;
+   old_parameters[1] = 2.0;
+
+   Vector<double> parameters(2);
+   parameters[0] = 0.5;
+   parameters[1] = -1.0;
+
+   Vector<double> old_gradient(2);
+   old_gradient[0] = 1.0;
+   old_gradient[1] = -1.0;
+
+   Vector<double> gradient(2);
+   gradient[0] = 0.2;
+   gradient[1] = 0.3;
+
+   Matrix<double> old_inverse_Hessian(2, 2);
+   old_inverse_Hessian[0][0] = 0.75;
+   old_inverse_Hessian[0][1] = -0.25;
+   old_inverse_Hessian[1][0] = -0.25;
+   old_inverse_Hessian[1][1] = 0.75;
+
+   Vector<double> parameters_difference = parameters - old_parameters;
+   Vector<double> gradient_difference = gradient - old_gradient;
+
+   Matrix<double> DFP_inverse_Hessian = old_inverse_Hessian
+   + parameters_difference.outer(parameters_difference)
+   /parameters_difference.dot(gradient_difference)
+   - (old_inverse_Hessian.dot(gradient_difference)).outer(old_inverse_Hessian.dot(gradient_difference))
+   /gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference);
+
+   Matrix<double> inverse_Hessian(old_inverse_Hessian);
+
+   mof.update_DFP_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian);
+
+   assert_true(inverse_Hessian.is_symmetric(), LOG);
+   Matrix<double> difference = inverse_Hessian - DFP_inverse_Hessian;
+
+   assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+
+   // Work vectors of the caller
+
+   Vector<double> work_parameters_difference(5, 0.0);
+   Vector<double> work_gradient_difference;
+   Vector<double> work_inverse_Hessian_dot_gradient_difference;
+
+   inverse_Hessian = old_inverse_Hessian;
+
+   mof.update_DFP_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+   work_parameters_difference, work_gradient_difference, work_inverse_Hessian_dot_gradient_difference);
+
+   difference = inverse_Hessian - DFP_inverse_Hessian;
+
+   assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+   assert_true(work_parameters_difference == parameters_difference, LOG);
+   assert_true(work_gradient_difference == gradient_difference, LOG);
+}
+
+
+// void test_update_BFGS_inverse_Hessian(void) method
+
+void TestObjectiveFunctional::test_update_BFGS_inverse_Hessian(void)
+{
+   message += "test_update_BFGS_inverse_Hessian\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   // Test 
+
+   mlp.initialize_parameters(1.0);
+
+   Vector<double> old_parameters = mlp.get_parameters();
+   Vector<double> old_gradient = mof.calculate_gradient();
+   Matrix<double> inverse_Hessian = mof.calculate_inverse_Hessian();
+
+   mlp.initialize_parameters(-0.5);
+
+   Vector<double> parameters = mlp.get_parameters();
+   Vector<double> gradient = mof.calculate_gradient();
+
+   mof.update_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian);
+
+   Matrix<double> difference = inverse_Hessian - mof.calculate_inverse_Hessian();
+
+   assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+
+   // Test 
+
+   old_parameters[0] = 1.0;
+   old_parameters[1] = 2.0;
+
+   parameters[0] = 0.5;
+   parameters[1] = -1.0;
+
+   old_gradient[0] = 1.0;
+   old_gradient[1] = -1.0;
+
+   gradient[0] = 0.2;
+   gradient[1] = 0.3;
+
+   Matrix<double> old_inverse_Hessian(2, 2);
+   old_inverse_Hessian[0][0] = 0.75;
+   old_inverse_Hessian[0][1] = -0.25;
+   old_inverse_Hessian[1][0] = -0.25;
+   old_inverse_Hessian[1][1] = 0.75;
+
+   Vector<double> parameters_difference = parameters - old_parameters;
+   Vector<double> gradient_difference = gradient - old_gradient;
+
+   Vector<double> BFGS = parameters_difference/parameters_difference.dot(gradient_difference) 
+   - old_inverse_Hessian.dot(gradient_difference)
+   /gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference);
+
+   Matrix<double> BFGS_inverse_Hessian = old_inverse_Hessian
+   + parameters_difference.outer(parameters_difference)
+   /parameters_difference.dot(gradient_difference) 
+   - (old_inverse_Hessian.dot(gradient_difference)).outer(gradient_difference.dot(old_inverse_Hessian))
+   /gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference)
+   + (BFGS.outer(BFGS))*(gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference));   
+
+   inverse_Hessian = old_inverse_Hessian;
+
+   mof.update_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian);
+
+   assert_true(inverse_Hessian.is_symmetric(), LOG);
+   difference = inverse_Hessian - BFGS_inverse_Hessian;
+
+   assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+
+   // Work vectors of the caller
+
+   Vector<double> work_parameters_difference(5, 0.0);
+   Vector<double> work_gradient_difference;
+   Vector<double> work_inverse_Hessian_dot_gradient_difference;
+
+   inverse_Hessian = old_inverse_Hessian;
+
+   mof.update_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, inverse_Hessian, 
+   work_parameters_difference, work_gradient_difference, work_inverse_Hessian_dot_gradient_difference);
+
+   difference = inverse_Hessian - BFGS_inverse_Hessian;
+
+   assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+   assert_true(work_parameters_difference == parameters_difference, LOG);
+   assert_true(work_gradient_difference == gradient_difference, LOG);
+}
+
+
 // void test_calculate_vector_dot_Hessian(void) method
 
 void TestObjectiveFunctional::test_calculate_vector_dot_Hessian(void)
@@ -1076,6 +1703,27 @@ void TestObjectiveFunctional::test_calculate_vector_dot_Hessian_numerical_differ
 void TestObjectiveFunctional::test_calculate_vector_dot_Hessian_forward_differences(void)
 {
    message += "test_calculate_vector_dot_Hessian_forward_differences\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   mlp.set_independent_parameters_number(1);
+   mlp.initialize_parameters(0.5);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   MockObjectiveFunctional mof(&mlp);
+
+   Vector<double> vector(parameters_number);
+   vector.initialize_sequential();
+
+   Vector<double> difference = mof.calculate_vector_dot_Hessian_forward_differences(vector) - vector*2.0;
+
+   assert_true(difference < 1.0e-3 && difference > -1.0e-3, LOG);
+
+   // Test 
+
+   vector.initialize(0.0);
+
+   assert_true(mof.calculate_vector_dot_Hessian_forward_differences(vector) == 0.0, LOG);
 }
 
 
@@ -1084,6 +1732,27 @@ void TestObjectiveFunctional::test_calculate_vector_dot_Hessian_forward_differen
 void TestObjectiveFunctional::test_calculate_vector_dot_Hessian_central_differences(void)
 {
    message += "test_calculate_vector_dot_Hessian_central_differences\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   mlp.set_independent_parameters_number(1);
+   mlp.initialize_parameters(0.5);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   MockObjectiveFunctional mof(&mlp);
+
+   Vector<double> vector(parameters_number);
+   vector.initialize_sequential();
+
+   Vector<double> difference = mof.calculate_vector_dot_Hessian_central_differences(vector) - vector*2.0;
+
+   assert_true(difference < 1.0e-6 && difference > -1.0e-6, LOG);
+
+   // Test 
+
+   vector.initialize(0.0);
+
+   assert_true(mof.calculate_vector_dot_Hessian_central_differences(vector) == 0.0, LOG);
 }
 
 
@@ -1212,14 +1881,23 @@ void TestObjectiveFunctional::run_test_case(void)
 
    test_get_numerical_epsilon();
 
+   // Hessian approximation methods
+
+   test_get_Hessian_approximation_method();
+
    // Counter methods
 
    test_get_calculate_evaluation_count();
    test_get_calculate_gradient_count();
    test_get_calculate_Hessian_count();
+   test_get_evaluation_cache_size();
 
    test_get_display();
 
+   // Data set methods
+
+   test_get_training_instances_number();
+
    // Set methods
 
    test_set_multilayer_perceptron_pointer();
@@ -1252,6 +1930,7 @@ void TestObjectiveFunctional::run_test_case(void)
    test_set_calculate_evaluation_count();
    test_set_calculate_gradient_count();
    test_set_calculate_Hessian_count();
+   test_set_evaluation_cache_size();
 
    test_set_display();
 
@@ -1259,6 +1938,8 @@ void TestObjectiveFunctional::run_test_case(void)
 
    test_calculate_evaluation();
    test_calculate_potential_evaluation();
+   test_calculate_potential_evaluation_batch();
+   test_calculate_evaluation_cache();
 
    test_calculate_objective();
    test_calculate_regularization();
@@ -1270,6 +1951,8 @@ void TestObjectiveFunctional::run_test_case(void)
 
    test_calculate_gradient_norm();
 
+   test_calculate_batch_gradient();
+
    test_calculate_objective_gradient(); 
    test_calculate_regularization_gradient(); 
 
@@ -1293,6 +1976,8 @@ void TestObjectiveFunctional::run_test_case(void)
    test_calculate_Hessian();
    test_calculate_potential_Hessian();
 
+   test_calculate_regularization_Hessian();
+
    // Objective function Hessian numerical differentiation methods
 
    test_calculate_Hessian_numerical_differentiation();
@@ -1307,6 +1992,10 @@ void TestObjectiveFunctional::run_test_case(void)
 
    test_calculate_BFGS_inverse_Hessian_approximation();
 
+   test_update_DFP_inverse_Hessian();
+
+   test_update_BFGS_inverse_Hessian();
+
    // Objective function vector Hessian product methods
 
    test_calculate_vector_dot_Hessian();
@@ -75,14 +75,23 @@ public:
 
    void test_get_numerical_epsilon(void);
 
+   // Hessian approximation methods
+
+   void test_get_Hessian_approximation_method(void);
+
    // Counter methods
 
    void test_get_calculate_evaluation_count(void);
    void test_get_calculate_gradient_count(void);
    void test_get_calculate_Hessian_count(void);
+   void test_get_evaluation_cache_size(void);
 
    void test_get_display(void);
 
+   // Data set methods
+
+   void test_get_training_instances_number(void);
+
    // Set methods
 
    void test_set_multilayer_perceptron_pointer(void);
@@ -112,6 +121,7 @@ public:
    void test_set_calculate_evaluation_count(void);
    void test_set_calculate_gradient_count(void);
    void test_set_calculate_Hessian_count(void);
+   void test_set_evaluation_cache_size(void);
 
    void test_set_display(void);
 
@@ -119,6 +129,8 @@ public:
 
    void test_calculate_evaluation(void);
    void test_calculate_potential_evaluation(void);
+   void test_calculate_potential_evaluation_batch(void);
+   void test_calculate_evaluation_cache(void);
 
    void test_calculate_objective(void);
    void test_calculate_regularization(void); 
@@ -130,6 +142,8 @@ public:
 
    void test_calculate_gradient_norm(void);
 
+   void test_calculate_batch_gradient(void);
+
    void test_calculate_objective_gradient(void); 
    void test_calculate_regularization_gradient(void); 
 
@@ -153,6 +167,8 @@ public:
    void test_calculate_Hessian(void);
    void test_calculate_potential_Hessian(void);
 
+   void test_calculate_regularization_Hessian(void);
+
    // Objective function Hessian numerical differentiation methods
 
    void test_calculate_Hessian_numerical_differentiation(void);
@@ -168,6 +184,10 @@ public:
 
    void test_calculate_BFGS_inverse_Hessian_approximation(void);
 
+   void test_update_DFP_inverse_Hessian(void);
+
+   void test_update_BFGS_inverse_Hessian(void);
+
    // Objective function vector Hessian product methods
 
    void test_calculate_vector_dot_Hessian(void);
@@ -761,6 +761,7 @@ void TestPerceptron::test_calculate_activation_second_derivative(void)
 
    combination = -1.55;
    activation_second_derivative = p.calculate_activation_second_derivative(combination);
+   assert_true(fabs(activation_second_derivative - 0.0938553) < 1.0e-6, LOG);
 
    // Hyperbolic tangent activation function 
 
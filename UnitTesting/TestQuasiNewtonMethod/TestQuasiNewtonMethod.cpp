@@ -16,6 +16,7 @@
 // System includes
 
 #include <iostream>
+#include <cstdio>
 
 // Flood includes
 
@@ -79,6 +80,32 @@ void TestQuasiNewtonMethod::test_destructor(void)
 }
 
 
+// void test_clone(void) method
+
+void TestQuasiNewtonMethod::test_clone(void)
+{
+   message += "test_clone\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+   MockObjectiveFunctional mof_copy(&mlp);
+
+   QuasiNewtonMethod qnm(&mof);
+
+   qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::DFP);
+   qnm.set_maximum_epochs_number(3);
+
+   QuasiNewtonMethod* qnm_pointer = (QuasiNewtonMethod*)qnm.clone(&mof_copy);
+
+   assert_true(qnm_pointer->get_objective_functional_pointer() == &mof_copy, LOG);
+   assert_true(qnm_pointer->get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::DFP, LOG);
+   assert_true(qnm_pointer->get_maximum_epochs_number() == 3, LOG);
+
+   delete qnm_pointer;
+}
+
+
 // void test_get_inverse_Hessian_approximation_method(void) method
 
 void TestQuasiNewtonMethod::test_get_inverse_Hessian_approximation_method(void)
@@ -217,6 +244,57 @@ void TestQuasiNewtonMethod::test_train(void)
 
    assert_true(evaluation < old_evaluation, LOG);
 
+   // Validation interval and asynchronous validation
+
+   Vector<double> parameters = mlp.get_parameters();
+
+   mlp.initialize_independent_parameters(1.0);
+
+   qnm.set_validation_interval(2);
+   qnm.set_asynchronous_validation(true);
+   qnm.set_reserve_validation_error_history(true);
+
+   qnm.train();
+
+   assert_true(mlp.get_parameters() == parameters, LOG);
+
+   Vector<double> validation_error_history = qnm.get_validation_error_history();
+
+   assert_true(validation_error_history.get_size() == 3, LOG);
+   assert_true(validation_error_history[0] == 0.0, LOG);
+   assert_true(validation_error_history[1] == -1.0, LOG);
+   assert_true(validation_error_history[2] == 0.0, LOG);
+
+   qnm.set_validation_interval(1);
+   qnm.set_asynchronous_validation(false);
+   qnm.set_reserve_validation_error_history(false);
+
+   // Profiling
+
+   mlp.initialize_independent_parameters(1.0);
+
+   qnm.set_profiling(true);
+   qnm.set_reserve_profiling_trace(true);
+
+   qnm.train();
+
+   assert_true(qnm.get_profiling_calls_number()[TrainingAlgorithm::EvaluationPhase] == 1, LOG);
+   assert_true(qnm.get_profiling_calls_number()[TrainingAlgorithm::GradientPhase] >= 2, LOG);
+   assert_true(qnm.get_profiling_calls_number()[TrainingAlgorithm::LineSearchPhase] > 0, LOG);
+   assert_true(qnm.get_profiling_calls_number()[TrainingAlgorithm::LineSearchPhase] 
+            == qnm.get_profiling_calls_number()[TrainingAlgorithm::TrainingDirectionPhase], LOG);
+   assert_true(qnm.get_profiling_calls_number()[TrainingAlgorithm::EvolutionPhase] == 0, LOG);
+   assert_true(qnm.get_profiling_total_time() >= 0.0, LOG);
+
+   qnm.save_profiling_report("TestQuasiNewtonMethodProfilingReport.xml");
+   qnm.save_profiling_trace("TestQuasiNewtonMethodProfilingTrace.json");
+
+   std::remove("TestQuasiNewtonMethodProfilingReport.xml");
+   std::remove("TestQuasiNewtonMethodProfilingTrace.json");
+
+   qnm.set_profiling(false);
+   qnm.set_reserve_profiling_trace(false);
+
    // Minimum parameters increment norm
 
    mlp.initialize_independent_parameters(1.0);
@@ -285,6 +363,88 @@ void TestQuasiNewtonMethod::test_train(void)
 
    assert_true(gradient_norm < gradient_norm_goal, LOG);
 
+   // Strong Wolfe line search
+
+   mlp.initialize_independent_parameters(1.0);
+
+   qnm.set_training_rate_method(TrainingAlgorithm::StrongWolfe);
+
+   qnm.train();
+
+   gradient_norm = mof.calculate_gradient_norm();
+
+   assert_true(gradient_norm < gradient_norm_goal, LOG);
+
+}
+
+
+// void test_resume(void) method
+
+void TestQuasiNewtonMethod::test_resume(void)
+{
+   message += "test_resume\n";
+
+   MultilayerPerceptron mlp(2,3,1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   mlp.initialize_parameters_normal();
+
+   Vector<double> initial_parameters = mlp.get_parameters();
+
+   // Uninterrupted training
+
+   QuasiNewtonMethod qnm(&mof);
+   qnm.set_display(false);
+   qnm.set_training_rate_method(TrainingAlgorithm::Fixed);
+   qnm.set_first_training_rate(0.05);
+   qnm.set_minimum_parameters_increment_norm(0.0);
+   qnm.set_minimum_evaluation_improvement(0.0);
+   qnm.set_evaluation_goal(0.0);
+   qnm.set_gradient_norm_goal(0.0);
+   qnm.set_maximum_epochs_number(12);
+   qnm.set_reserve_evaluation_history(true);
+
+   qnm.train();
+
+   Vector<double> parameters = mlp.get_parameters();
+   Vector<double> evaluation_history = qnm.get_evaluation_history();
+
+   // Training interrupted after the checkpoint of epoch 5
+
+   mlp.set_parameters(initial_parameters);
+
+   qnm.set_maximum_epochs_number(6);
+   qnm.set_checkpoint_period(6);
+   qnm.set_checkpoint_filename("TestQuasiNewtonMethodCheckpoint.bin");
+
+   qnm.train();
+
+   assert_true(mlp.get_parameters() != parameters, LOG);
+
+   // Training resumed by another training algorithm object
+
+   mlp.initialize_parameters(0.0);
+
+   QuasiNewtonMethod resumed_qnm(&mof);
+   resumed_qnm.set_display(false);
+   resumed_qnm.set_training_rate_method(TrainingAlgorithm::Fixed);
+   resumed_qnm.set_first_training_rate(0.05);
+   resumed_qnm.set_minimum_parameters_increment_norm(0.0);
+   resumed_qnm.set_minimum_evaluation_improvement(0.0);
+   resumed_qnm.set_evaluation_goal(0.0);
+   resumed_qnm.set_gradient_norm_goal(0.0);
+   resumed_qnm.set_maximum_epochs_number(12);
+   resumed_qnm.set_reserve_evaluation_history(true);
+   resumed_qnm.set_checkpoint_filename("TestQuasiNewtonMethodCheckpoint.bin");
+
+   resumed_qnm.resume();
+
+   assert_true(evaluation_history.get_size() == 13, LOG);
+   assert_true(mlp.get_parameters() == parameters, LOG);
+   assert_true(resumed_qnm.get_evaluation_history() == evaluation_history, LOG);
+
+   std::remove("TestQuasiNewtonMethodCheckpoint.bin");
 }
 
 
@@ -363,6 +523,10 @@ void TestQuasiNewtonMethod::run_test_case(void)
    test_constructor();
    test_destructor(); 
 
+   // Clone methods
+
+   test_clone();
+
    // Get methods
 
    test_get_inverse_Hessian_approximation_method();
@@ -378,6 +542,7 @@ void TestQuasiNewtonMethod::run_test_case(void)
    test_calculate_training_direction();
 
    test_train();
+   test_resume();
 
    // Training history methods
 
@@ -50,6 +50,10 @@ public:
    void test_constructor(void);
    void test_destructor(void); 
 
+   // Clone methods
+
+   void test_clone(void);
+
    // Get methods
 
    void test_get_inverse_Hessian_approximation_method(void);
@@ -65,6 +69,7 @@ public:
    void test_calculate_training_direction(void);
 
    void test_train(void);
+   void test_resume(void);
 
    // Training history methods
 
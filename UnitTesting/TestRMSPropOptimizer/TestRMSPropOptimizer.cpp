@@ -0,0 +1,338 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   R M S P R O P   O P T I M I Z E R   C L A S S                                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <cmath>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/Utilities/InputTargetDataSet.h"
+#include "../../Flood/ObjectiveFunctional/SumSquaredError.h"
+#include "../../Flood/TrainingAlgorithm/RMSPropOptimizer.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "TestRMSPropOptimizer.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestRMSPropOptimizer::TestRMSPropOptimizer(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestRMSPropOptimizer::~TestRMSPropOptimizer(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestRMSPropOptimizer::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   MockObjectiveFunctional mof;
+
+   // Default constructor
+
+   RMSPropOptimizer rmspo1;
+   assert_true(rmspo1.get_objective_functional_pointer() == NULL, LOG);
+
+   // Objective functional constructor
+
+   RMSPropOptimizer rmspo2(&mof);
+   assert_true(rmspo2.get_objective_functional_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestRMSPropOptimizer::test_destructor(void)
+{
+}
+
+
+// void test_get_decay_rate(void) method
+
+void TestRMSPropOptimizer::test_get_decay_rate(void)
+{
+   message += "test_get_decay_rate\n";
+
+   RMSPropOptimizer rmspo;
+
+   rmspo.set_decay_rate(0.5);
+   assert_true(rmspo.get_decay_rate() == 0.5, LOG);
+}
+
+
+// void test_get_epsilon(void) method
+
+void TestRMSPropOptimizer::test_get_epsilon(void)
+{
+   message += "test_get_epsilon\n";
+
+   RMSPropOptimizer rmspo;
+
+   rmspo.set_epsilon(1.0e-6);
+   assert_true(rmspo.get_epsilon() == 1.0e-6, LOG);
+}
+
+
+// void test_initialize_optimizer_state(void) method
+
+void TestRMSPropOptimizer::test_initialize_optimizer_state(void)
+{
+   message += "test_initialize_optimizer_state\n";
+
+   RMSPropOptimizer rmspo;
+
+   rmspo.initialize_optimizer_state(3);
+
+   assert_true(rmspo.get_squared_gradient_average().get_size() == 3, LOG);
+   assert_true(rmspo.get_squared_gradient_average() == 0.0, LOG);
+   assert_true(rmspo.get_steps_count() == 0, LOG);
+}
+
+
+// void test_update_parameters(void) method
+
+void TestRMSPropOptimizer::test_update_parameters(void)
+{
+   message += "test_update_parameters\n";
+
+   RMSPropOptimizer rmspo;
+
+   rmspo.set_decay_rate(0.9);
+
+   Vector<double> parameters(2, 1.0);
+
+   Vector<double> gradient(2);
+   gradient[0] = 2.0;
+   gradient[1] = -4.0;
+
+   rmspo.initialize_optimizer_state(2);
+
+   rmspo.update_parameters(parameters, gradient, 0.1);
+
+   assert_true(fabs(rmspo.get_squared_gradient_average()[0] - 0.4) < 1.0e-12, LOG);
+   assert_true(fabs(rmspo.get_squared_gradient_average()[1] - 1.6) < 1.0e-12, LOG);
+
+   // The first step has the same length for all the parameters
+
+   assert_true(fabs(parameters[0] - (1.0 - 0.1/sqrt(0.1))) < 1.0e-6, LOG);
+   assert_true(fabs(parameters[1] - (1.0 + 0.1/sqrt(0.1))) < 1.0e-6, LOG);
+   assert_true(rmspo.get_steps_count() == 1, LOG);
+}
+
+
+// void test_train(void) method
+
+void TestRMSPropOptimizer::test_train(void)
+{
+   message += "test_train\n";
+
+   // Objective functional which cannot be split into mini-batches
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   RMSPropOptimizer rmspo(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double old_evaluation = mof.calculate_evaluation();
+
+   rmspo.set_initial_learning_rate(0.01);
+   rmspo.set_maximum_epochs_number(10);
+   rmspo.set_display(false);
+
+   rmspo.train();
+
+   double evaluation = mof.calculate_evaluation();
+
+   assert_true(evaluation < old_evaluation, LOG);
+   assert_true(rmspo.get_steps_count() == 10, LOG);
+
+   // Mini-batches
+
+   mlp.set(1,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(10,1,1);
+
+   Vector<double> instance(2);
+
+   for(int i = 0; i < 10; i++)
+   {
+      instance[0] = 0.1*i;
+      instance[1] = instance[0]*instance[0];
+
+      itds.set_instance(i, instance);
+   }
+
+   SumSquaredError sse(&mlp, &itds);
+
+   rmspo.set_objective_functional_pointer(&sse);
+
+   old_evaluation = sse.calculate_evaluation();
+
+   rmspo.set_batch_size(4);
+   rmspo.set_maximum_epochs_number(20);
+   rmspo.set_reserve_evaluation_history(true);
+
+   rmspo.train();
+
+   evaluation = sse.calculate_evaluation();
+
+   assert_true(evaluation < old_evaluation, LOG);
+   assert_true(rmspo.get_steps_count() == 60, LOG);
+   assert_true(rmspo.get_evaluation_history().get_size() == 21, LOG);
+}
+
+
+// void test_get_training_history_XML(void) method
+
+void TestRMSPropOptimizer::test_get_training_history_XML(void)
+{
+   message += "test_get_training_history_XML\n";
+
+   MultilayerPerceptron mlp(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   RMSPropOptimizer rmspo(&mof);
+
+   rmspo.set_reserve_all_training_history(true);
+   rmspo.set_maximum_epochs_number(1);
+   rmspo.set_display(false);
+
+   rmspo.train();
+
+   std::string training_history_XML = rmspo.get_training_history_XML(true);
+
+   assert_true(training_history_XML.find("<EvaluationHistory>") != std::string::npos, LOG);
+   assert_true(training_history_XML.find("<TrainingRateHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestRMSPropOptimizer::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   RMSPropOptimizer rmspo;
+
+   std::string XML = rmspo.to_XML(true);
+
+   assert_true(XML.find("<DecayRate>") != std::string::npos, LOG);
+   assert_true(XML.find("<BatchSize>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestRMSPropOptimizer::test_load(void)
+{
+   message += "test_load\n";
+
+   RMSPropOptimizer rmspo;
+
+   rmspo.set_decay_rate(0.5);
+   rmspo.set_epsilon(1.0e-6);
+   rmspo.set_batch_size(16);
+   rmspo.set_maximum_epochs_number(3);
+
+   rmspo.save("../Data/RMSPropOptimizer.dat");
+
+   rmspo.set_default();
+
+   rmspo.load("../Data/RMSPropOptimizer.dat");
+
+   assert_true(rmspo.get_decay_rate() == 0.5, LOG);
+   assert_true(rmspo.get_epsilon() == 1.0e-6, LOG);
+   assert_true(rmspo.get_batch_size() == 16, LOG);
+   assert_true(rmspo.get_maximum_epochs_number() == 3, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestRMSPropOptimizer::run_test_case(void)
+{
+   message += "Running RMSProp optimizer test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_decay_rate();
+   test_get_epsilon();
+
+   // Train methods
+
+   test_initialize_optimizer_state();
+   test_update_parameters();
+
+   test_train();
+
+   // Training history methods
+
+   test_get_training_history_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of RMSProp optimizer test case\n";
+}
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -16,6 +16,7 @@
 // System includes
 
 #include <iostream>
+#include <stdlib.h>
 
 // Flood includes
 
@@ -84,6 +85,34 @@ void TestRandomSearch::test_get_training_rate_reduction_factor(void)
 }
 
 
+// void test_get_candidates_number(void) method
+
+void TestRandomSearch::test_get_candidates_number(void)
+{
+   message += "test_get_candidates_number\n";
+
+   RandomSearch rs;
+
+   assert_true(rs.get_candidates_number() == 1, LOG);
+}
+
+
+// void test_get_early_abandon(void) method
+
+void TestRandomSearch::test_get_early_abandon(void)
+{
+   message += "test_get_early_abandon\n";
+
+   RandomSearch rs;
+
+   assert_true(rs.get_early_abandon() == false, LOG);
+
+   rs.set_early_abandon(true);
+
+   assert_true(rs.get_early_abandon() == true, LOG);
+}
+
+
 // void test_get_reserve_potential_parameters_history(void) method
 
 void TestRandomSearch::test_get_reserve_potential_parameters_history(void)
@@ -141,6 +170,20 @@ void TestRandomSearch::test_set_training_rate_reduction_factor(void)
 }
 
 
+// void test_set_candidates_number(void) method
+
+void TestRandomSearch::test_set_candidates_number(void)
+{
+   message += "test_set_candidates_number\n";
+
+   RandomSearch rs;
+
+   rs.set_candidates_number(4);
+
+   assert_true(rs.get_candidates_number() == 4, LOG);
+}
+
+
 // void test_set_reserve_potential_parameters_history(void) method
 
 void TestRandomSearch::test_set_reserve_potential_parameters_history(void)
@@ -216,6 +259,68 @@ void TestRandomSearch::test_train(void)
 
    rs.set_display_period(1),
    rs.train();
+
+   // Candidates
+
+   mlp.initialize_parameters(1.0);
+
+   rs.set_maximum_epochs_number(10);
+   rs.set_candidates_number(4);
+
+   mof.set_calculate_evaluation_count(0);
+
+   rs.train();
+
+   assert_true(mof.get_calculate_evaluation_count() == 1 + 4*10, LOG);
+
+   Vector<double> evaluation_history = rs.get_evaluation_history();
+   Vector<double> potential_evaluation_history = rs.get_potential_evaluation_history();
+   Vector< Vector<double> > potential_parameters_history = rs.get_potential_parameters_history();
+
+   assert_true(evaluation_history.get_size() == 11, LOG);
+
+   for(int i = 1; i <= 10; i++)
+   {
+      assert_true(evaluation_history[i] <= evaluation_history[i-1], LOG);
+      assert_true(evaluation_history[i] <= potential_evaluation_history[i], LOG);
+
+      assert_true(potential_evaluation_history[i] == mof.calculate_potential_evaluation(potential_parameters_history[i]), LOG);
+   }
+
+   assert_true(mlp.get_parameters() == rs.get_parameters_history()[10], LOG);
+
+   // Serial and parallel evaluation of the candidates give the same results
+
+   mlp.initialize_parameters(1.0);
+
+   rs.set_threads_number(1);
+
+   srand(3);
+   rs.train();
+
+   Vector<double> serial_parameters = mlp.get_parameters();
+
+   mlp.initialize_parameters(1.0);
+
+   rs.set_threads_number(2);
+
+   srand(3);
+   rs.train();
+
+   assert_true(mlp.get_parameters() == serial_parameters, LOG);
+
+   // Early abandon gives the same parameters, but no potential evaluation history
+
+   mlp.initialize_parameters(1.0);
+
+   rs.set_early_abandon(true);
+
+   srand(3);
+   rs.train();
+
+   assert_true(mlp.get_parameters() == serial_parameters, LOG);
+   assert_true(rs.get_potential_evaluation_history().get_size() == 0, LOG);
+   assert_true(rs.get_evaluation_history().get_size() == 11, LOG);
 }
 
 
@@ -281,6 +386,8 @@ void TestRandomSearch::run_test_case(void)
    // Get methods
 
    test_get_training_rate_reduction_factor();
+   test_get_candidates_number();
+   test_get_early_abandon();
 
    test_get_reserve_potential_parameters_history();
    test_get_reserve_potential_parameters_norm_history();
@@ -295,6 +402,7 @@ void TestRandomSearch::run_test_case(void)
    // Set methods
 
    test_set_training_rate_reduction_factor();
+   test_set_candidates_number();
 
    test_set_reserve_potential_parameters_history();
    test_set_reserve_potential_parameters_norm_history();
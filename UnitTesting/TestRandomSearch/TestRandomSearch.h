@@ -53,6 +53,8 @@ public:
    // Get methods
 
    void test_get_training_rate_reduction_factor(void);
+   void test_get_candidates_number(void);
+   void test_get_early_abandon(void);
 
    void test_get_reserve_potential_parameters_history(void);
    void test_get_reserve_potential_parameters_norm_history(void);
@@ -67,6 +69,7 @@ public:
    // Set methods
 
    void test_set_training_rate_reduction_factor(void);
+   void test_set_candidates_number(void);
 
    void test_set_reserve_potential_parameters_history(void);
    void test_set_reserve_potential_parameters_norm_history(void);
@@ -0,0 +1,454 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   R E S I L I E N T   B A C K P R O P A G A T I O N   C L A S S                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <cmath>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/Utilities/InputTargetDataSet.h"
+#include "../../Flood/ObjectiveFunctional/SumSquaredError.h"
+#include "../../Flood/TrainingAlgorithm/ResilientBackpropagation.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "TestResilientBackpropagation.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestResilientBackpropagation::TestResilientBackpropagation(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestResilientBackpropagation::~TestResilientBackpropagation(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestResilientBackpropagation::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   MockObjectiveFunctional mof;
+
+   // Default constructor
+
+   ResilientBackpropagation rb1;
+   assert_true(rb1.get_objective_functional_pointer() == NULL, LOG);
+
+   // Objective functional constructor
+
+   ResilientBackpropagation rb2(&mof);
+   assert_true(rb2.get_objective_functional_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestResilientBackpropagation::test_destructor(void)
+{
+}
+
+
+// void test_get_increase_factor(void) method
+
+void TestResilientBackpropagation::test_get_increase_factor(void)
+{
+   message += "test_get_increase_factor\n";
+
+   ResilientBackpropagation rb;
+
+   rb.set_increase_factor(1.5);
+   assert_true(rb.get_increase_factor() == 1.5, LOG);
+}
+
+
+// void test_get_decrease_factor(void) method
+
+void TestResilientBackpropagation::test_get_decrease_factor(void)
+{
+   message += "test_get_decrease_factor\n";
+
+   ResilientBackpropagation rb;
+
+   rb.set_decrease_factor(0.25);
+   assert_true(rb.get_decrease_factor() == 0.25, LOG);
+}
+
+
+// void test_get_initial_step_size(void) method
+
+void TestResilientBackpropagation::test_get_initial_step_size(void)
+{
+   message += "test_get_initial_step_size\n";
+
+   ResilientBackpropagation rb;
+
+   rb.set_initial_step_size(0.01);
+   assert_true(rb.get_initial_step_size() == 0.01, LOG);
+}
+
+
+// void test_get_minimum_step_size(void) method
+
+void TestResilientBackpropagation::test_get_minimum_step_size(void)
+{
+   message += "test_get_minimum_step_size\n";
+
+   ResilientBackpropagation rb;
+
+   rb.set_minimum_step_size(1.0e-3);
+   assert_true(rb.get_minimum_step_size() == 1.0e-3, LOG);
+}
+
+
+// void test_get_maximum_step_size(void) method
+
+void TestResilientBackpropagation::test_get_maximum_step_size(void)
+{
+   message += "test_get_maximum_step_size\n";
+
+   ResilientBackpropagation rb;
+
+   rb.set_maximum_step_size(10.0);
+   assert_true(rb.get_maximum_step_size() == 10.0, LOG);
+}
+
+
+// void test_initialize_step_sizes(void) method
+
+void TestResilientBackpropagation::test_initialize_step_sizes(void)
+{
+   message += "test_initialize_step_sizes\n";
+
+   ResilientBackpropagation rb;
+
+   rb.set_initial_step_size(0.5);
+
+   rb.initialize_step_sizes(3);
+
+   assert_true(rb.get_step_sizes().get_size() == 3, LOG);
+   assert_true(rb.get_step_sizes() == 0.5, LOG);
+   assert_true(rb.get_old_gradient() == 0.0, LOG);
+   assert_true(rb.get_parameters_increment() == 0.0, LOG);
+}
+
+
+// void test_update_parameters(void) method
+
+void TestResilientBackpropagation::test_update_parameters(void)
+{
+   message += "test_update_parameters\n";
+
+   ResilientBackpropagation rb;
+
+   Vector<double> parameters(2, 1.0);
+
+   Vector<double> gradient(2);
+   gradient[0] = 2.0;
+   gradient[1] = -4.0;
+
+   rb.initialize_step_sizes(2);
+
+   // First step, with the initial step sizes
+
+   rb.update_parameters(parameters, gradient, false);
+
+   assert_true(fabs(parameters[0] - 0.9) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[1] - 1.1) < 1.0e-12, LOG);
+
+   // Same signs, so that the step sizes are increased
+
+   rb.update_parameters(parameters, gradient, false);
+
+   assert_true(fabs(rb.get_step_sizes()[0] - 0.12) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[0] - 0.78) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[1] - 1.22) < 1.0e-12, LOG);
+
+   // Sign change of the first gradient component with an evaluation increase, so that its step is reverted
+
+   gradient[0] = -2.0;
+
+   rb.update_parameters(parameters, gradient, true);
+
+   assert_true(fabs(rb.get_step_sizes()[0] - 0.06) < 1.0e-12, LOG);
+   assert_true(rb.get_old_gradient()[0] == 0.0, LOG);
+   assert_true(fabs(parameters[0] - 0.9) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[1] - 1.364) < 1.0e-12, LOG);
+
+   // The first step size is not adapted after a sign change
+
+   rb.update_parameters(parameters, gradient, false);
+
+   assert_true(fabs(rb.get_step_sizes()[0] - 0.06) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[0] - 0.96) < 1.0e-12, LOG);
+
+   // Test
+
+   rb.set_maximum_step_size(0.1);
+
+   gradient[0] = 0.0;
+
+   rb.update_parameters(parameters, gradient, false);
+
+   assert_true(fabs(rb.get_step_sizes()[1] - 0.1) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[0] - 0.96) < 1.0e-12, LOG);
+}
+
+
+// void test_train(void) method
+
+void TestResilientBackpropagation::test_train(void)
+{
+   message += "test_train\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   ResilientBackpropagation rb(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double old_evaluation = mof.calculate_evaluation();
+
+   mof.set_calculate_evaluation_count(0);
+   mof.set_calculate_gradient_count(0);
+
+   rb.set_maximum_epochs_number(10);
+   rb.set_display(false);
+
+   rb.train();
+
+   double evaluation = mof.calculate_evaluation();
+
+   assert_true(evaluation < old_evaluation, LOG);
+
+   // One evaluation and one gradient per epoch
+
+   assert_true(mof.get_calculate_evaluation_count() == 12, LOG);
+   assert_true(mof.get_calculate_gradient_count() == 11, LOG);
+
+   // Evaluation goal
+
+   mlp.initialize_independent_parameters(1.0);
+
+   rb.set_evaluation_goal(1.0e-3);
+   rb.set_maximum_epochs_number(1000);
+
+   rb.train();
+
+   evaluation = mof.calculate_evaluation();
+
+   assert_true(evaluation <= 1.0e-3, LOG);
+
+   // Data modelling
+
+   mlp.set(1,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(10,1,1);
+
+   Vector<double> instance(2);
+
+   for(int i = 0; i < 10; i++)
+   {
+      instance[0] = 0.1*i;
+      instance[1] = instance[0]*instance[0];
+
+      itds.set_instance(i, instance);
+   }
+
+   SumSquaredError sse(&mlp, &itds);
+
+   rb.set_objective_functional_pointer(&sse);
+
+   old_evaluation = sse.calculate_evaluation();
+
+   rb.set_evaluation_goal(0.0);
+   rb.set_maximum_epochs_number(20);
+   rb.set_reserve_evaluation_history(true);
+
+   rb.train();
+
+   evaluation = sse.calculate_evaluation();
+
+   assert_true(evaluation < old_evaluation, LOG);
+   assert_true(rb.get_evaluation_history().get_size() == 21, LOG);
+}
+
+
+// void test_set_reserve_all_training_history(void) method
+
+void TestResilientBackpropagation::test_set_reserve_all_training_history(void)
+{
+   message += "test_set_reserve_all_training_history\n";
+
+   ResilientBackpropagation rb;
+   rb.set_reserve_all_training_history(true);
+
+   assert_true(rb.get_reserve_evaluation_history() == true, LOG);
+   assert_true(rb.get_reserve_gradient_norm_history() == true, LOG);
+   assert_true(rb.get_reserve_training_rate_history() == false, LOG);
+   assert_true(rb.get_reserve_training_direction_history() == false, LOG);
+   assert_true(rb.get_reserve_inverse_Hessian_history() == false, LOG);
+}
+
+
+// void test_get_training_history_XML(void) method
+
+void TestResilientBackpropagation::test_get_training_history_XML(void)
+{
+   message += "test_get_training_history_XML\n";
+
+   MultilayerPerceptron mlp(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   ResilientBackpropagation rb(&mof);
+
+   rb.set_reserve_all_training_history(true);
+   rb.set_maximum_epochs_number(1);
+   rb.set_display(false);
+
+   rb.train();
+
+   std::string training_history_XML = rb.get_training_history_XML(true);
+
+   assert_true(training_history_XML.find("<EvaluationHistory>") != std::string::npos, LOG);
+   assert_true(training_history_XML.find("<GradientNormHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestResilientBackpropagation::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   ResilientBackpropagation rb;
+
+   std::string XML = rb.to_XML(true);
+
+   assert_true(XML.find("<IncreaseFactor>") != std::string::npos, LOG);
+   assert_true(XML.find("<MaximumStepSize>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestResilientBackpropagation::test_load(void)
+{
+   message += "test_load\n";
+
+   ResilientBackpropagation rb;
+
+   rb.set_increase_factor(1.5);
+   rb.set_decrease_factor(0.25);
+   rb.set_initial_step_size(0.01);
+   rb.set_minimum_step_size(1.0e-3);
+   rb.set_maximum_step_size(10.0);
+   rb.set_maximum_epochs_number(3);
+
+   rb.save("../Data/ResilientBackpropagation.dat");
+
+   rb.set_default();
+
+   rb.load("../Data/ResilientBackpropagation.dat");
+
+   assert_true(rb.get_increase_factor() == 1.5, LOG);
+   assert_true(rb.get_decrease_factor() == 0.25, LOG);
+   assert_true(rb.get_initial_step_size() == 0.01, LOG);
+   assert_true(rb.get_minimum_step_size() == 1.0e-3, LOG);
+   assert_true(rb.get_maximum_step_size() == 10.0, LOG);
+   assert_true(rb.get_maximum_epochs_number() == 3, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestResilientBackpropagation::run_test_case(void)
+{
+   message += "Running resilient backpropagation test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_increase_factor();
+   test_get_decrease_factor();
+
+   test_get_initial_step_size();
+   test_get_minimum_step_size();
+   test_get_maximum_step_size();
+
+   // Train methods
+
+   test_initialize_step_sizes();
+   test_update_parameters();
+
+   test_train();
+
+   // Training history methods
+
+   test_set_reserve_all_training_history();
+   test_get_training_history_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of resilient backpropagation test case\n";
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
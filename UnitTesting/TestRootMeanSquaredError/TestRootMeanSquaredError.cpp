@@ -144,6 +144,18 @@ void TestRootMeanSquaredError::test_calculate_objective(void)
    RootMeanSquaredError rmse(&mlp, &itds);
 
    assert_true(rmse.calculate_objective() == 0.0, LOG);
+
+   // Bounded objective
+
+   itds.set(10,1,1);
+   itds.initialize_data(1.0);
+
+   assert_true(rmse.calculate_objective() == 1.0, LOG);
+   assert_true(rmse.calculate_objective(2.0) == 1.0, LOG);
+
+   double objective = rmse.calculate_objective(0.5);
+
+   assert_true(objective > 0.5 && objective < 1.0, LOG);
 }
 
 
@@ -203,6 +215,92 @@ void TestRootMeanSquaredError::test_calculate_objective_gradient(void)
 }
 
 
+// void test_calculate_vector_dot_Hessian(void) method
+
+void TestRootMeanSquaredError::test_calculate_vector_dot_Hessian(void)
+{
+   message += "test_calculate_vector_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(3,2,2);
+   itds.initialize_data(0.5);
+
+   RootMeanSquaredError rmse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Vector<double> vector(parameters_number);
+   vector.initialize_normal();
+
+   Vector<double> vector_Hessian_product = rmse.calculate_vector_dot_Hessian(vector);
+   Vector<double> vector_Hessian_product_numerical_differentiation = rmse.calculate_vector_dot_Hessian_central_differences(vector);
+
+   assert_true(vector_Hessian_product.get_size() == parameters_number, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation < 1.0e-6, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation > -1.0e-6, LOG);
+
+   // Test
+
+   Vector<int> hidden_layers_size(2);
+   hidden_layers_size[0] = 3;
+   hidden_layers_size[1] = 2;
+
+   mlp.set(1,hidden_layers_size,2);
+   mlp.set_output_layer_activation_function(MultilayerPerceptron::Logistic);
+   mlp.initialize_neural_parameters_normal();
+
+   itds.set(4,1,2);
+   itds.initialize_data(0.25);
+
+   rmse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+
+   parameters_number = mlp.get_parameters_number();
+
+   vector.set(parameters_number);
+   vector.initialize_normal();
+
+   vector_Hessian_product = rmse.calculate_vector_dot_Hessian(vector);
+   Vector<double> Hessian_dot_vector = rmse.calculate_Hessian_central_differences().dot(vector);
+
+   assert_true((vector_Hessian_product - Hessian_dot_vector).calculate_norm() < 1.0e-2*Hessian_dot_vector.calculate_norm(), LOG);
+}
+
+
+// void test_calculate_vectors_dot_Hessian(void) method
+
+void TestRootMeanSquaredError::test_calculate_vectors_dot_Hessian(void)
+{
+   message += "test_calculate_vectors_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(2,2,1);
+   itds.initialize_data(0.5);
+
+   RootMeanSquaredError rmse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> vectors(3, parameters_number);
+   vectors.initialize_normal();
+
+   Matrix<double> vectors_Hessian_product = rmse.calculate_vectors_dot_Hessian(vectors);
+
+   assert_true(vectors_Hessian_product.get_rows_number() == 3, LOG);
+   assert_true(vectors_Hessian_product.get_columns_number() == parameters_number, LOG);
+
+   for(int i = 0; i < 3; i++)
+   {
+      Vector<double> difference = vectors_Hessian_product.get_row(i) - rmse.calculate_vector_dot_Hessian(vectors.get_row(i));
+
+      assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+   }
+}
+
+
 // void test_calculate_validation_error(void) method
 
 void TestRootMeanSquaredError::test_calculate_validation_error(void)   
@@ -283,6 +381,11 @@ void TestRootMeanSquaredError::run_test_case(void)
 
    test_calculate_objective_gradient();
 
+   // Hessian methods
+
+   test_calculate_vector_dot_Hessian();
+   test_calculate_vectors_dot_Hessian();
+
    test_calculate_output_errors();
    test_calculate_hidden_errors();
    test_calculate_hidden_layers_error_gradient();
@@ -69,6 +69,11 @@ public:
 
    void test_calculate_objective_gradient(void);
 
+   // Hessian methods
+
+   void test_calculate_vector_dot_Hessian(void);
+   void test_calculate_vectors_dot_Hessian(void);
+
    void test_calculate_output_errors(void);
    void test_calculate_hidden_errors(void);
    void test_calculate_hidden_layers_error_gradient(void);
@@ -0,0 +1,337 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   S C A L E D   C O N J U G A T E   G R A D I E N T   C L A S S                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <cmath>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/Utilities/InputTargetDataSet.h"
+#include "../../Flood/ObjectiveFunctional/SumSquaredError.h"
+#include "../../Flood/TrainingAlgorithm/ScaledConjugateGradient.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "TestScaledConjugateGradient.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestScaledConjugateGradient::TestScaledConjugateGradient(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestScaledConjugateGradient::~TestScaledConjugateGradient(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestScaledConjugateGradient::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   MockObjectiveFunctional mof;
+
+   // Default constructor
+
+   ScaledConjugateGradient scg1;
+   assert_true(scg1.get_objective_functional_pointer() == NULL, LOG);
+
+   // Objective functional constructor
+
+   ScaledConjugateGradient scg2(&mof);
+   assert_true(scg2.get_objective_functional_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestScaledConjugateGradient::test_destructor(void)
+{
+}
+
+
+// void test_get_initial_scaling_parameter(void) method
+
+void TestScaledConjugateGradient::test_get_initial_scaling_parameter(void)
+{
+   message += "test_get_initial_scaling_parameter\n";
+
+   ScaledConjugateGradient scg;
+
+   scg.set_initial_scaling_parameter(1.0e-3);
+   assert_true(scg.get_initial_scaling_parameter() == 1.0e-3, LOG);
+}
+
+
+// void test_calculate_training_direction(void) method
+
+void TestScaledConjugateGradient::test_calculate_training_direction(void)
+{
+   message += "test_calculate_training_direction\n";
+
+   ScaledConjugateGradient scg;
+
+   Vector<double> old_gradient(2);
+   old_gradient[0] = 1.0;
+   old_gradient[1] = 0.0;
+
+   Vector<double> gradient(2);
+   gradient[0] = 0.0;
+   gradient[1] = 1.0;
+
+   Vector<double> old_training_direction(2);
+   old_training_direction[0] = -1.0;
+   old_training_direction[1] = 0.0;
+
+   Vector<double> training_direction
+   = scg.calculate_training_direction(old_gradient, gradient, old_training_direction);
+
+   assert_true(training_direction.get_size() == 2, LOG);
+   assert_true(fabs(training_direction[0] + 1.0) < 1.0e-12, LOG);
+   assert_true(fabs(training_direction[1] + 1.0) < 1.0e-12, LOG);
+
+   // Test
+
+   old_gradient = gradient;
+
+   training_direction = scg.calculate_training_direction(old_gradient, gradient, old_training_direction);
+
+   assert_true(training_direction == gradient*(-1.0), LOG);
+}
+
+
+// void test_train(void) method
+
+void TestScaledConjugateGradient::test_train(void)
+{
+   message += "test_train\n";
+
+   // Quadratic objective, which is minimized in as many steps as parameters
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   ScaledConjugateGradient scg(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   scg.set_evaluation_goal(1.0e-12);
+   scg.set_maximum_epochs_number(10);
+   scg.set_reserve_evaluation_history(true);
+   scg.set_display(false);
+
+   scg.train();
+
+   double evaluation = mof.calculate_evaluation();
+
+   assert_true(evaluation <= 1.0e-12, LOG);
+   assert_true(scg.get_evaluation_history().get_size() <= 3, LOG);
+   assert_true(scg.get_unsuccessful_steps_count() == 0, LOG);
+
+   // Data modelling, with exact Hessian-vector products
+
+   mlp.set(1,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(10,1,1);
+
+   Vector<double> instance(2);
+
+   for(int i = 0; i < 10; i++)
+   {
+      instance[0] = 0.1*i;
+      instance[1] = instance[0]*instance[0];
+
+      itds.set_instance(i, instance);
+   }
+
+   SumSquaredError sse(&mlp, &itds);
+
+   scg.set_objective_functional_pointer(&sse);
+
+   double old_evaluation = sse.calculate_evaluation();
+
+   scg.set_evaluation_goal(0.0);
+   scg.set_maximum_epochs_number(20);
+   scg.set_reserve_parameters_history(true);
+
+   scg.train();
+
+   evaluation = sse.calculate_evaluation();
+
+   int epochs_number = scg.get_evaluation_history().get_size();
+
+   assert_true(evaluation < old_evaluation, LOG);
+   assert_true(evaluation == scg.get_evaluation_history()[epochs_number-1], LOG);
+   assert_true(scg.get_parameters_history()[epochs_number-1] == mlp.get_parameters(), LOG);
+
+   // The evaluation never increases, since the rejected steps are reverted
+
+   for(int i = 1; i < epochs_number; i++)
+   {
+      assert_true(scg.get_evaluation_history()[i] <= scg.get_evaluation_history()[i-1], LOG);
+   }
+}
+
+
+// void test_set_reserve_all_training_history(void) method
+
+void TestScaledConjugateGradient::test_set_reserve_all_training_history(void)
+{
+   message += "test_set_reserve_all_training_history\n";
+
+   ScaledConjugateGradient scg;
+   scg.set_reserve_all_training_history(true);
+
+   assert_true(scg.get_reserve_evaluation_history() == true, LOG);
+   assert_true(scg.get_reserve_training_direction_history() == true, LOG);
+   assert_true(scg.get_reserve_training_rate_history() == true, LOG);
+   assert_true(scg.get_reserve_inverse_Hessian_history() == false, LOG);
+}
+
+
+// void test_get_training_history_XML(void) method
+
+void TestScaledConjugateGradient::test_get_training_history_XML(void)
+{
+   message += "test_get_training_history_XML\n";
+
+   MultilayerPerceptron mlp(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   ScaledConjugateGradient scg(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   scg.set_reserve_all_training_history(true);
+   scg.set_maximum_epochs_number(1);
+   scg.set_display(false);
+
+   scg.train();
+
+   std::string training_history_XML = scg.get_training_history_XML(true);
+
+   assert_true(training_history_XML.find("<EvaluationHistory>") != std::string::npos, LOG);
+   assert_true(training_history_XML.find("<TrainingRateHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestScaledConjugateGradient::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   ScaledConjugateGradient scg;
+
+   std::string XML = scg.to_XML(true);
+
+   assert_true(XML.find("<InitialScalingParameter>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestScaledConjugateGradient::test_load(void)
+{
+   message += "test_load\n";
+
+   ScaledConjugateGradient scg;
+
+   scg.set_initial_scaling_parameter(1.0e-3);
+   scg.set_maximum_epochs_number(3);
+
+   scg.save("../Data/ScaledConjugateGradient.dat");
+
+   scg.set_default();
+
+   scg.load("../Data/ScaledConjugateGradient.dat");
+
+   assert_true(scg.get_initial_scaling_parameter() == 1.0e-3, LOG);
+   assert_true(scg.get_maximum_epochs_number() == 3, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestScaledConjugateGradient::run_test_case(void)
+{
+   message += "Running scaled conjugate gradient test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_initial_scaling_parameter();
+
+   // Train methods
+
+   test_calculate_training_direction();
+
+   test_train();
+
+   // Training history methods
+
+   test_set_reserve_all_training_history();
+   test_get_training_history_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of scaled conjugate gradient test case\n";
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
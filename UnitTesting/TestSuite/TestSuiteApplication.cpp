@@ -57,6 +57,15 @@
 #include "../TestGradientDescent/TestGradientDescent.h"
 #include "../TestConjugateGradient/TestConjugateGradient.h"
 #include "../TestQuasiNewtonMethod/TestQuasiNewtonMethod.h"
+#include "../TestTruncatedNewtonMethod/TestTruncatedNewtonMethod.h"
+#include "../TestMomentumSGD/TestMomentumSGD.h"
+#include "../TestRMSPropOptimizer/TestRMSPropOptimizer.h"
+#include "../TestAdamOptimizer/TestAdamOptimizer.h"
+#include "../TestResilientBackpropagation/TestResilientBackpropagation.h"
+#include "../TestScaledConjugateGradient/TestScaledConjugateGradient.h"
+#include "../TestCovarianceMatrixAdaptation/TestCovarianceMatrixAdaptation.h"
+#include "../TestMultiStartTraining/TestMultiStartTraining.h"
+#include "../TestIslandEvolutionaryAlgorithm/TestIslandEvolutionaryAlgorithm.h"
 
 using namespace Flood;
 
@@ -257,6 +266,87 @@ int main(void)
    tests_passed_count += test_quasi_Newton_method.get_tests_passed_count();
    tests_failed_count += test_quasi_Newton_method.get_tests_failed_count();
 
+   // Test truncated Newton method
+
+   TestTruncatedNewtonMethod test_truncated_Newton_method;
+   test_truncated_Newton_method.run_test_case();
+   message += test_truncated_Newton_method.get_message();
+   tests_count += test_truncated_Newton_method.get_tests_count(); 
+   tests_passed_count += test_truncated_Newton_method.get_tests_passed_count();
+   tests_failed_count += test_truncated_Newton_method.get_tests_failed_count();
+
+   // Test momentum SGD
+
+   TestMomentumSGD test_momentum_SGD;
+   test_momentum_SGD.run_test_case();
+   message += test_momentum_SGD.get_message();
+   tests_count += test_momentum_SGD.get_tests_count(); 
+   tests_passed_count += test_momentum_SGD.get_tests_passed_count();
+   tests_failed_count += test_momentum_SGD.get_tests_failed_count();
+
+   // Test RMSProp optimizer
+
+   TestRMSPropOptimizer test_RMSProp_optimizer;
+   test_RMSProp_optimizer.run_test_case();
+   message += test_RMSProp_optimizer.get_message();
+   tests_count += test_RMSProp_optimizer.get_tests_count(); 
+   tests_passed_count += test_RMSProp_optimizer.get_tests_passed_count();
+   tests_failed_count += test_RMSProp_optimizer.get_tests_failed_count();
+
+   // Test Adam optimizer
+
+   TestAdamOptimizer test_Adam_optimizer;
+   test_Adam_optimizer.run_test_case();
+   message += test_Adam_optimizer.get_message();
+   tests_count += test_Adam_optimizer.get_tests_count(); 
+   tests_passed_count += test_Adam_optimizer.get_tests_passed_count();
+   tests_failed_count += test_Adam_optimizer.get_tests_failed_count();
+
+   // Test resilient backpropagation
+
+   TestResilientBackpropagation test_resilient_backpropagation;
+   test_resilient_backpropagation.run_test_case();
+   message += test_resilient_backpropagation.get_message();
+   tests_count += test_resilient_backpropagation.get_tests_count(); 
+   tests_passed_count += test_resilient_backpropagation.get_tests_passed_count();
+   tests_failed_count += test_resilient_backpropagation.get_tests_failed_count();
+
+   // Test scaled conjugate gradient
+
+   TestScaledConjugateGradient test_scaled_conjugate_gradient;
+   test_scaled_conjugate_gradient.run_test_case();
+   message += test_scaled_conjugate_gradient.get_message();
+   tests_count += test_scaled_conjugate_gradient.get_tests_count(); 
+   tests_passed_count += test_scaled_conjugate_gradient.get_tests_passed_count();
+   tests_failed_count += test_scaled_conjugate_gradient.get_tests_failed_count();
+
+   // Test multi-start training
+
+   TestMultiStartTraining tmst;
+   tmst.run_test_case();
+   message += tmst.get_message();
+   tests_count += tmst.get_tests_count(); 
+   tests_passed_count += tmst.get_tests_passed_count();
+   tests_failed_count += tmst.get_tests_failed_count();
+
+   // Test island evolutionary algorithm
+
+   TestIslandEvolutionaryAlgorithm tiea;
+   tiea.run_test_case();
+   message += tiea.get_message();
+   tests_count += tiea.get_tests_count(); 
+   tests_passed_count += tiea.get_tests_passed_count();
+   tests_failed_count += tiea.get_tests_failed_count();
+
+   // Test covariance matrix adaptation
+
+   TestCovarianceMatrixAdaptation tcma;
+   tcma.run_test_case();
+   message += tcma.get_message();
+   tests_count += tcma.get_tests_count(); 
+   tests_passed_count += tcma.get_tests_passed_count();
+   tests_failed_count += tcma.get_tests_failed_count();
+
    // Test suite
 
    std::cout << message << std::endl;
@@ -93,6 +93,36 @@ void TestSumSquaredError::test_destructor(void)
 }
 
 
+// void test_clone(void) method
+
+void TestSumSquaredError::test_clone(void)
+{
+   message += "test_clone\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+
+   mlp.initialize_parameters_normal();
+
+   InputTargetDataSet itds(2,1,1);
+   itds.initialize_data(1.0);
+
+   SumSquaredError sse(&mlp, &itds);
+
+   sse.set_objective_weight(2.0);
+
+   MultilayerPerceptron mlp_copy(mlp);
+
+   SumSquaredError* sse_pointer = (SumSquaredError*)sse.clone(&mlp_copy);
+
+   assert_true(sse_pointer->get_multilayer_perceptron_pointer() == &mlp_copy, LOG);
+   assert_true(sse_pointer->get_input_target_data_set_pointer() == &itds, LOG);
+   assert_true(sse_pointer->get_objective_weight() == 2.0, LOG);
+   assert_true(sse_pointer->calculate_evaluation() == sse.calculate_evaluation(), LOG);
+
+   delete sse_pointer;
+}
+
+
 // void test_get_input_target_data_set_pointer(void) method
 
 void TestSumSquaredError::test_get_input_target_data_set_pointer(void)
@@ -134,6 +164,105 @@ void TestSumSquaredError::test_calculate_objective(void)
    SumSquaredError sse(&mlp, &itds);
 
    assert_true(sse.calculate_objective() == 0.0, LOG);
+
+   // Bounded objective
+
+   itds.set(10,1,1);
+   itds.initialize_data(1.0);
+
+   assert_true(sse.calculate_objective() == 10.0, LOG);
+   assert_true(sse.calculate_objective(20.0) == 10.0, LOG);
+   assert_true(sse.calculate_objective(3.5) == 4.0, LOG);
+
+   // Bounded evaluation
+
+   sse.set_objective_weight(2.0);
+   sse.set_evaluation_cache_size(1);
+
+   assert_true(sse.calculate_evaluation(7.0) == 8.0, LOG);
+   assert_true(sse.calculate_evaluation() == 20.0, LOG);
+   assert_true(sse.calculate_evaluation(7.0) == 20.0, LOG);
+
+   // Evaluation cache with changing data
+
+   itds.initialize_data(2.0);
+
+   assert_true(sse.calculate_evaluation() == 80.0, LOG);
+
+   InputTargetDataSet other_itds(10,1,1);
+   other_itds.initialize_data(0.0);
+
+   sse.set_input_target_data_set_pointer(&other_itds);
+
+   assert_true(sse.calculate_evaluation() == 0.0, LOG);
+
+   // Evaluation cache with changing multilayer perceptron
+
+   mlp.set_output_layer_activation_function(MultilayerPerceptron::Logistic);
+
+   assert_true(sse.calculate_evaluation() == 5.0, LOG);
+}
+
+
+// void test_calculate_potential_evaluation(void) method
+
+void TestSumSquaredError::test_calculate_potential_evaluation(void)
+{
+   message += "test_calculate_potential_evaluation\n";
+
+   MultilayerPerceptron mlp(1,2,1);
+
+   InputTargetDataSet itds(3,1,1);
+   itds.initialize_data(1.0);
+
+   SumSquaredError sse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> potential_parameters(4, parameters_number);
+
+   for(int i = 0; i < 4; i++)
+   {
+      potential_parameters.set_row(i, Vector<double>(parameters_number, 0.1*(i+1)));
+   }
+
+   Vector<double> potential_evaluation = sse.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(sse.calculate_potential_evaluation(potential_parameters, 2) == potential_evaluation, LOG);
+
+   // Activation function modified between batched evaluations
+
+   mlp.set_output_layer_activation_function(MultilayerPerceptron::Logistic);
+
+   potential_evaluation = sse.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(sse.calculate_potential_evaluation(potential_parameters, 2) == potential_evaluation, LOG);
+
+   // Bounds modified between batched evaluations
+
+   mlp.set_output_variables_lower_bound(Vector<double>(1, 0.0));
+   mlp.set_output_variables_upper_bound(Vector<double>(1, 0.6));
+
+   potential_evaluation = sse.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(sse.calculate_potential_evaluation(potential_parameters, 2) == potential_evaluation, LOG);
+
+   // Objective functional modified between batched evaluations
+
+   sse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+   sse.set_regularization_weight(0.5);
+
+   potential_evaluation = sse.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(sse.calculate_potential_evaluation(potential_parameters, 2) == potential_evaluation, LOG);
+
+   // Data set modified between batched evaluations
+
+   itds.initialize_data(2.0);
+
+   potential_evaluation = sse.calculate_potential_evaluation(potential_parameters);
+
+   assert_true(sse.calculate_potential_evaluation(potential_parameters, 2) == potential_evaluation, LOG);
 }
 
 
@@ -397,6 +526,281 @@ void TestSumSquaredError::test_calculate_objective_gradient(void)
 }
 
 
+// void test_get_training_instances_number(void) method
+
+void TestSumSquaredError::test_get_training_instances_number(void)
+{
+   message += "test_get_training_instances_number\n";
+
+   SumSquaredError sse;
+
+   assert_true(sse.get_training_instances_number() == 0, LOG);
+
+   // Test
+
+   InputTargetDataSet itds(4,2,1);
+
+   sse.set_input_target_data_set_pointer(&itds);
+
+   assert_true(sse.get_training_instances_number() == 4, LOG);
+}
+
+
+// void test_calculate_batch_objective_gradient(void) method
+
+void TestSumSquaredError::test_calculate_batch_objective_gradient(void)
+{
+   message += "test_calculate_batch_objective_gradient\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(4,2,2);
+   itds.get_data().initialize_normal();
+
+   SumSquaredError sse(&mlp, &itds);
+
+   Vector<double> objective_gradient = sse.calculate_objective_gradient();
+
+   // All training instances
+
+   Vector<int> training_instances_indices(4);
+   training_instances_indices.initialize_sequential();
+
+   Vector<double> batch_objective_gradient = sse.calculate_batch_objective_gradient(training_instances_indices);
+
+   assert_true(batch_objective_gradient.get_size() == mlp.get_neural_parameters_number(), LOG);
+   assert_true((batch_objective_gradient - objective_gradient).calculate_norm() < 1.0e-9*objective_gradient.calculate_norm(), LOG);
+
+   // Two mini-batches, whose mean is the whole objective gradient
+
+   Vector<int> first_batch_indices(2);
+   first_batch_indices[0] = 3;
+   first_batch_indices[1] = 0;
+
+   Vector<int> second_batch_indices(2);
+   second_batch_indices[0] = 1;
+   second_batch_indices[1] = 2;
+
+   batch_objective_gradient = (sse.calculate_batch_objective_gradient(first_batch_indices) 
+   + sse.calculate_batch_objective_gradient(second_batch_indices))/2.0;
+
+   assert_true((batch_objective_gradient - objective_gradient).calculate_norm() < 1.0e-9*objective_gradient.calculate_norm(), LOG);
+
+   // Preallocated batch objective gradient
+
+   Vector<double> preallocated_batch_objective_gradient(mlp.get_parameters_number(), 1.0);
+
+   sse.calculate_batch_objective_gradient(first_batch_indices, preallocated_batch_objective_gradient);
+
+   assert_true(preallocated_batch_objective_gradient == sse.calculate_batch_objective_gradient(first_batch_indices), LOG);
+}
+
+
+// void test_calculate_vector_dot_Hessian(void) method
+
+void TestSumSquaredError::test_calculate_vector_dot_Hessian(void)
+{
+   message += "test_calculate_vector_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(3,2,2);
+   itds.initialize_data(0.5);
+
+   SumSquaredError sse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Vector<double> vector(parameters_number);
+   vector.initialize_normal();
+
+   Vector<double> vector_Hessian_product = sse.calculate_vector_dot_Hessian(vector);
+   Vector<double> vector_Hessian_product_numerical_differentiation = sse.calculate_vector_dot_Hessian_central_differences(vector);
+
+   assert_true(vector_Hessian_product.get_size() == parameters_number, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation < 1.0e-6, LOG);
+   assert_true(vector_Hessian_product - vector_Hessian_product_numerical_differentiation > -1.0e-6, LOG);
+
+   // Test
+
+   Vector<int> hidden_layers_size(2);
+   hidden_layers_size[0] = 3;
+   hidden_layers_size[1] = 2;
+
+   mlp.set(1,hidden_layers_size,2);
+   mlp.set_output_layer_activation_function(MultilayerPerceptron::Logistic);
+   mlp.initialize_neural_parameters_normal();
+
+   itds.set(4,1,2);
+   itds.initialize_data(0.25);
+
+   sse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+
+   parameters_number = mlp.get_parameters_number();
+
+   vector.set(parameters_number);
+   vector.initialize_normal();
+
+   vector_Hessian_product = sse.calculate_vector_dot_Hessian(vector);
+   Vector<double> Hessian_dot_vector = sse.calculate_Hessian_central_differences().dot(vector);
+
+   assert_true((vector_Hessian_product - Hessian_dot_vector).calculate_norm() < 1.0e-2*Hessian_dot_vector.calculate_norm(), LOG);
+
+   // Test
+
+   mlp.set(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   mlp.set_inputs_scaling_method(MultilayerPerceptron::MeanStandardDeviation);
+   mlp.set_outputs_unscaling_method(MultilayerPerceptron::MinimumMaximum);
+
+   mlp.set_input_variables_mean(Vector<double>(2, 0.5));
+   mlp.set_input_variables_standard_deviation(Vector<double>(2, 2.0));
+
+   mlp.set_output_variables_minimum(Vector<double>(2, -2.0));
+   mlp.set_output_variables_maximum(Vector<double>(2, 4.0));
+
+   itds.set(3,2,2);
+   itds.initialize_data(0.5);
+
+   sse.set_regularization_method(ObjectiveFunctional::None);
+
+   parameters_number = mlp.get_parameters_number();
+
+   vector.set(parameters_number);
+   vector.initialize_normal();
+
+   vector_Hessian_product = sse.calculate_vector_dot_Hessian(vector);
+   Hessian_dot_vector = sse.calculate_Hessian_central_differences().dot(vector);
+
+   assert_true((vector_Hessian_product - Hessian_dot_vector).calculate_norm() < 1.0e-2*Hessian_dot_vector.calculate_norm(), LOG);
+}
+
+
+// void test_calculate_vectors_dot_Hessian(void) method
+
+void TestSumSquaredError::test_calculate_vectors_dot_Hessian(void)
+{
+   message += "test_calculate_vectors_dot_Hessian\n";
+
+   MultilayerPerceptron mlp(2,2,1);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(2,2,1);
+   itds.initialize_data(0.5);
+
+   SumSquaredError sse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> vectors(3, parameters_number);
+   vectors.initialize_normal();
+
+   Matrix<double> vectors_Hessian_product = sse.calculate_vectors_dot_Hessian(vectors);
+
+   assert_true(vectors_Hessian_product.get_rows_number() == 3, LOG);
+   assert_true(vectors_Hessian_product.get_columns_number() == parameters_number, LOG);
+
+   for(int i = 0; i < 3; i++)
+   {
+      Vector<double> difference = vectors_Hessian_product.get_row(i) - sse.calculate_vector_dot_Hessian(vectors.get_row(i));
+
+      assert_true(difference < 1.0e-12 && difference > -1.0e-12, LOG);
+   }
+}
+
+
+// void test_calculate_Hessian(void) method
+
+void TestSumSquaredError::test_calculate_Hessian(void)
+{
+   message += "test_calculate_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   InputTargetDataSet itds(3,2,2);
+   itds.initialize_data(0.5);
+
+   SumSquaredError sse(&mlp, &itds);
+
+   int parameters_number = mlp.get_parameters_number();
+
+   Matrix<double> Hessian = sse.calculate_Hessian();
+   Matrix<double> Hessian_numerical_differentiation = sse.calculate_Hessian_numerical_differentiation();
+
+   assert_true(Hessian.get_rows_number() == parameters_number, LOG);
+   assert_true(Hessian.get_columns_number() == parameters_number, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation < 1.0e-2, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation > -1.0e-2, LOG);
+
+   // Test
+
+   sse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+   sse.set_regularization_weight(0.1);
+
+   Hessian = sse.calculate_Hessian();
+   Hessian_numerical_differentiation = sse.calculate_Hessian_numerical_differentiation();
+
+   assert_true(Hessian - Hessian_numerical_differentiation < 1.0e-2, LOG);
+   assert_true(Hessian - Hessian_numerical_differentiation > -1.0e-2, LOG);
+}
+
+
+// void test_calculate_Gauss_Newton_Hessian(void) method
+
+void TestSumSquaredError::test_calculate_Gauss_Newton_Hessian(void)
+{
+   message += "test_calculate_Gauss_Newton_Hessian\n";
+
+   MultilayerPerceptron mlp(2,3,2);
+   mlp.initialize_neural_parameters_normal();
+
+   // Targets equal to the outputs, so that the Gauss-Newton approximation is exact
+
+   InputTargetDataSet itds(3,2,2);
+
+   Vector<double> input(2);
+
+   for(int i = 0; i < 3; i++)
+   {
+      input[0] = 0.5*i;
+      input[1] = 1.0 - 0.25*i;
+
+      itds.set_training_input_instance(i, input);
+      itds.set_training_target_instance(i, mlp.calculate_output(input));
+   }
+
+   SumSquaredError sse(&mlp, &itds);
+
+   sse.set_Hessian_approximation_method(ObjectiveFunctional::GaussNewton);
+
+   Matrix<double> Gauss_Newton_Hessian = sse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian == Gauss_Newton_Hessian.calculate_transpose(), LOG);
+
+   sse.set_Hessian_approximation_method(ObjectiveFunctional::ExactHessian);
+
+   Matrix<double> Hessian = sse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian - Hessian < 1.0e-9, LOG);
+   assert_true(Gauss_Newton_Hessian - Hessian > -1.0e-9, LOG);
+
+   // Test
+
+   sse.set_regularization_method(ObjectiveFunctional::NeuralParametersNorm);
+   sse.set_regularization_weight(0.1);
+
+   Gauss_Newton_Hessian = sse.calculate_Gauss_Newton_Hessian();
+   Hessian = sse.calculate_Hessian();
+
+   assert_true(Gauss_Newton_Hessian - Hessian < 1.0e-9, LOG);
+   assert_true(Gauss_Newton_Hessian - Hessian > -1.0e-9, LOG);
+}
+
+
 // void test_calculate_Jacobian(void) method
 
 void TestSumSquaredError::test_calculate_Jacobian(void)
@@ -596,6 +1000,10 @@ void TestSumSquaredError::run_test_case(void)
    test_constructor();
    test_destructor();
 
+   // Clone methods
+
+   test_clone();
+
    // Get methods
 
    test_get_input_target_data_set_pointer();
@@ -607,6 +1015,7 @@ void TestSumSquaredError::run_test_case(void)
    // Evaluation methods
 
    test_calculate_objective();   
+   test_calculate_potential_evaluation();
 
    test_calculate_validation_error();
 
@@ -614,6 +1023,18 @@ void TestSumSquaredError::run_test_case(void)
 
    test_calculate_objective_gradient();
 
+   test_get_training_instances_number();
+
+   test_calculate_batch_objective_gradient();
+
+   // Hessian methods
+
+   test_calculate_vector_dot_Hessian();
+   test_calculate_vectors_dot_Hessian();
+
+   test_calculate_Hessian();
+   test_calculate_Gauss_Newton_Hessian();
+
    test_calculate_output_errors();
    test_calculate_hidden_errors();
    test_calculate_hidden_layers_error_gradient();
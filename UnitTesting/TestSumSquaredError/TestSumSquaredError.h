@@ -47,6 +47,10 @@ public:
    void test_constructor(void);
    void test_destructor(void);
 
+   // Clone methods
+
+   void test_clone(void);
+
    // Get methods
 
    void test_get_input_target_data_set_pointer(void);
@@ -58,6 +62,7 @@ public:
    // Evaluation methods
 
    void test_calculate_objective(void);   
+   void test_calculate_potential_evaluation(void);
 
    void test_calculate_validation_error(void);
 
@@ -65,6 +70,18 @@ public:
 
    void test_calculate_objective_gradient(void);
 
+   void test_get_training_instances_number(void);
+
+   void test_calculate_batch_objective_gradient(void);
+
+   // Hessian methods
+
+   void test_calculate_vector_dot_Hessian(void);
+   void test_calculate_vectors_dot_Hessian(void);
+
+   void test_calculate_Hessian(void);
+   void test_calculate_Gauss_Newton_Hessian(void);
+
    void test_calculate_output_errors(void);
    void test_calculate_hidden_errors(void);
    void test_calculate_hidden_layers_error_gradient(void);
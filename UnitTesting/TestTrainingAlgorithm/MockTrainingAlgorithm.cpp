@@ -49,6 +49,18 @@ MockTrainingAlgorithm::~MockTrainingAlgorithm(void)
 // METHODS
 
 
+// TrainingAlgorithm* clone(ObjectiveFunctional*) method
+
+TrainingAlgorithm* MockTrainingAlgorithm::clone(ObjectiveFunctional* new_objective_functional_pointer)
+{
+   MockTrainingAlgorithm* mock_training_algorithm_pointer = new MockTrainingAlgorithm(*this);
+
+   mock_training_algorithm_pointer->set_objective_functional_pointer(new_objective_functional_pointer);
+
+   return(mock_training_algorithm_pointer);
+}
+
+
 // void train(void) method
 
 void MockTrainingAlgorithm::train(void)
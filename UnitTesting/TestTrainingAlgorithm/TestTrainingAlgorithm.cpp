@@ -221,6 +221,46 @@ void TestTrainingAlgorithm::test_get_early_stopping(void)
 }
 
 
+// void test_get_validation_interval(void) method
+
+void TestTrainingAlgorithm::test_get_validation_interval(void)
+{
+   message += "test_get_validation_interval\n";
+
+   MockTrainingAlgorithm mta;
+
+   assert_true(mta.get_validation_interval() == 1, LOG);
+   assert_true(mta.get_asynchronous_validation() == false, LOG);
+}
+
+
+// void test_get_checkpoint_period(void) method
+
+void TestTrainingAlgorithm::test_get_checkpoint_period(void)
+{
+   message += "test_get_checkpoint_period\n";
+
+   MockTrainingAlgorithm mta;
+
+   assert_true(mta.get_checkpoint_period() == 0, LOG);
+   assert_true(mta.get_checkpoint_filename() == "Checkpoint.bin", LOG);
+}
+
+
+// void test_get_training_history_period(void) method
+
+void TestTrainingAlgorithm::test_get_training_history_period(void)
+{
+   message += "test_get_training_history_period\n";
+
+   MockTrainingAlgorithm mta;
+
+   assert_true(mta.get_training_history_period() == 1, LOG);
+   assert_true(mta.get_training_history_depth() == 0, LOG);
+   assert_true(mta.get_training_history_filename() == "", LOG);
+}
+
+
 // void test_get_warning_parameters_norm(void) method
 
 void TestTrainingAlgorithm::test_get_warning_parameters_norm(void)
@@ -377,6 +417,19 @@ void TestTrainingAlgorithm::test_get_reserve_elapsed_time_history(void)
 }
 
 
+// void test_get_profiling(void) method
+
+void TestTrainingAlgorithm::test_get_profiling(void)
+{
+   message += "test_get_profiling\n";
+
+   MockTrainingAlgorithm mta;
+
+   assert_true(mta.get_profiling() == false, LOG);
+   assert_true(mta.get_reserve_profiling_trace() == false, LOG);
+}
+
+
 // void test_get_reserve_parameters_history(void) method
 
 void TestTrainingAlgorithm::test_get_reserve_parameters_history(void)
@@ -692,6 +745,56 @@ void TestTrainingAlgorithm::test_set_early_stopping(void)
 }
 
 
+// void test_set_validation_interval(void) method
+
+void TestTrainingAlgorithm::test_set_validation_interval(void)
+{
+   message += "test_set_validation_interval\n";
+
+   MockTrainingAlgorithm mta;
+
+   mta.set_validation_interval(5);
+   mta.set_asynchronous_validation(true);
+
+   assert_true(mta.get_validation_interval() == 5, LOG);
+   assert_true(mta.get_asynchronous_validation() == true, LOG);
+}
+
+
+// void test_set_checkpoint_period(void) method
+
+void TestTrainingAlgorithm::test_set_checkpoint_period(void)
+{
+   message += "test_set_checkpoint_period\n";
+
+   MockTrainingAlgorithm mta;
+
+   mta.set_checkpoint_period(10);
+   mta.set_checkpoint_filename("TrainingCheckpoint.bin");
+
+   assert_true(mta.get_checkpoint_period() == 10, LOG);
+   assert_true(mta.get_checkpoint_filename() == "TrainingCheckpoint.bin", LOG);
+}
+
+
+// void test_set_training_history_period(void) method
+
+void TestTrainingAlgorithm::test_set_training_history_period(void)
+{
+   message += "test_set_training_history_period\n";
+
+   MockTrainingAlgorithm mta;
+
+   mta.set_training_history_period(10);
+   mta.set_training_history_depth(100);
+   mta.set_training_history_filename("TrainingHistory.csv");
+
+   assert_true(mta.get_training_history_period() == 10, LOG);
+   assert_true(mta.get_training_history_depth() == 100, LOG);
+   assert_true(mta.get_training_history_filename() == "TrainingHistory.csv", LOG);
+}
+
+
 // void test_set_warning_parameters_norm(void) method
 
 void TestTrainingAlgorithm::test_set_warning_parameters_norm(void)
@@ -724,6 +827,26 @@ void TestTrainingAlgorithm::test_set_display_period(void)
 }
 
 
+// void test_set_profiling(void) method
+
+void TestTrainingAlgorithm::test_set_profiling(void)
+{
+   message += "test_set_profiling\n";
+
+   MockTrainingAlgorithm mta;
+
+   mta.set_profiling(true);
+
+   assert_true(mta.get_profiling() == true, LOG);
+   assert_true(mta.get_profiling_total_time().get_size() == 8, LOG);
+   assert_true(mta.get_profiling_calls_number() == 0, LOG);
+
+   mta.set_reserve_profiling_trace(true);
+
+   assert_true(mta.get_reserve_profiling_trace() == true, LOG);
+}
+
+
 // void test_set_reserve_parameters_history(void) method
 
 void TestTrainingAlgorithm::test_set_reserve_parameters_history(void)
@@ -949,6 +1072,56 @@ void TestTrainingAlgorithm::test_set_training_rate_history(void)
 }
 
 
+// void test_calculate_gradient_validation_error(void) method
+
+void TestTrainingAlgorithm::test_calculate_gradient_validation_error(void)
+{
+   message += "test_calculate_gradient_validation_error\n";
+
+   MultilayerPerceptron mlp(1,1,1);
+   mlp.initialize_parameters(1.0);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   MockTrainingAlgorithm mta(&mof);
+
+   double validation_error = -1.0;
+
+   Vector<double> gradient = mta.calculate_gradient_validation_error(validation_error);
+
+   assert_true(gradient == mof.calculate_gradient(), LOG);
+   assert_true(validation_error == 0.0, LOG);
+
+   // Asynchronous validation
+
+   mta.set_asynchronous_validation(true);
+
+   validation_error = -1.0;
+
+   assert_true(mta.calculate_gradient_validation_error(validation_error) == gradient, LOG);
+   assert_true(validation_error == 0.0, LOG);
+   assert_true(mlp.get_parameters() == 1.0, LOG);
+
+   // Reused copies
+
+   mlp.initialize_parameters(2.0);
+
+   gradient = mof.calculate_gradient();
+
+   validation_error = -1.0;
+
+   assert_true(mta.calculate_gradient_validation_error(validation_error) == gradient, LOG);
+   assert_true(validation_error == 0.0, LOG);
+
+   mta.delete_validation_replica();
+
+   validation_error = -1.0;
+
+   assert_true(mta.calculate_gradient_validation_error(validation_error) == gradient, LOG);
+   assert_true(validation_error == 0.0, LOG);
+}
+
+
 // void test_calculate_training_rate_evaluation(void) method
 
 void TestTrainingAlgorithm::test_calculate_training_rate_evaluation(void)
@@ -1020,6 +1193,84 @@ void TestTrainingAlgorithm::test_calculate_Brent_method_training_rate_evaluation
 }
 
 
+// void test_calculate_strong_Wolfe_training_rate_evaluation(void) method
+
+void TestTrainingAlgorithm::test_calculate_strong_Wolfe_training_rate_evaluation(void)
+{
+   message += "test_calculate_strong_Wolfe_training_rate_evaluation\n";
+
+   MultilayerPerceptron mlp(2);
+   MockObjectiveFunctional mof(&mlp);
+   MockTrainingAlgorithm mta(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   Vector<double> parameters = mlp.get_parameters();
+
+   double evaluation = mof.calculate_evaluation();
+   Vector<double> gradient = mof.calculate_gradient();
+
+   Vector<double> training_direction = gradient*(-1.0);
+   double initial_slope = gradient.dot(training_direction);
+
+   double initial_training_rate = 0.001;
+
+   Vector<double> training_rate_evaluation 
+   = mta.calculate_strong_Wolfe_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate);
+
+   double training_rate = training_rate_evaluation[0];
+
+   double sufficient_decrease_parameter = mta.get_sufficient_decrease_parameter();
+   double curvature_parameter = mta.get_curvature_parameter();
+
+   Vector<double> potential_gradient = mof.calculate_potential_gradient(parameters + training_direction*training_rate);
+
+   assert_true(training_rate > 0.0, LOG);
+   assert_true(training_rate_evaluation[1] <= evaluation + sufficient_decrease_parameter*training_rate*initial_slope, LOG);
+   assert_true(fabs(potential_gradient.dot(training_direction)) <= -curvature_parameter*initial_slope, LOG);
+   assert_true(mlp.get_parameters() == parameters, LOG);
+
+   // Test
+
+   mta.set_curvature_parameter(0.1);
+
+   training_rate_evaluation 
+   = mta.calculate_strong_Wolfe_training_rate_evaluation(evaluation, gradient, training_direction, initial_training_rate);
+
+   training_rate = training_rate_evaluation[0];
+
+   assert_true(fabs(training_rate - 0.5) < 0.05, LOG);
+
+   // Test
+
+   training_rate_evaluation 
+   = mta.calculate_strong_Wolfe_training_rate_evaluation(evaluation, gradient, gradient, initial_training_rate);
+
+   assert_true(training_rate_evaluation[0] == 0.0, LOG);
+   assert_true(training_rate_evaluation[1] == evaluation, LOG);
+}
+
+
+// void test_calculate_cubic_interpolation_training_rate(void) method
+
+void TestTrainingAlgorithm::test_calculate_cubic_interpolation_training_rate(void)
+{
+   message += "test_calculate_cubic_interpolation_training_rate\n";
+
+   MockTrainingAlgorithm mta;
+
+   // Quadratic function (x-1)^2 
+
+   double training_rate = mta.calculate_cubic_interpolation_training_rate(0.0, 1.0, -2.0, 3.0, 4.0, 4.0);
+
+   assert_true(fabs(training_rate - 1.0) < 1.0e-12, LOG);
+
+   training_rate = mta.calculate_cubic_interpolation_training_rate(3.0, 4.0, 4.0, 0.0, 1.0, -2.0);
+
+   assert_true(fabs(training_rate - 1.0) < 1.0e-12, LOG);
+}
+
+
 // void test_train(void) method
 
 void TestTrainingAlgorithm::test_train(void)
@@ -1048,6 +1299,63 @@ void TestTrainingAlgorithm::test_resize_training_history(void)
 }
 
 
+// void test_calculate_training_history_size(void) method
+
+void TestTrainingAlgorithm::test_calculate_training_history_size(void)
+{
+   message += "test_calculate_training_history_size\n";
+
+   MockTrainingAlgorithm mta;
+
+   assert_true(mta.calculate_training_history_size(0) == 0, LOG);
+   assert_true(mta.calculate_training_history_size(7) == 7, LOG);
+
+   // Training history period
+
+   mta.set_training_history_period(3);
+
+   assert_true(mta.calculate_training_history_size(1) == 1, LOG);
+   assert_true(mta.calculate_training_history_size(7) == 3, LOG);
+   assert_true(mta.calculate_training_history_size(8) == 4, LOG);
+
+   // Training history depth
+
+   mta.set_training_history_depth(2);
+
+   assert_true(mta.calculate_training_history_size(1) == 1, LOG);
+   assert_true(mta.calculate_training_history_size(8) == 2, LOG);
+}
+
+
+// void test_get_training_history_index(void) method
+
+void TestTrainingAlgorithm::test_get_training_history_index(void)
+{
+   message += "test_get_training_history_index\n";
+
+   MockTrainingAlgorithm mta;
+
+   assert_true(mta.get_training_history_index(5) == 5, LOG);
+
+   // Training history period
+
+   mta.set_training_history_period(3);
+
+   assert_true(mta.get_training_history_index(0) == 0, LOG);
+   assert_true(mta.get_training_history_index(1) == 1, LOG);
+   assert_true(mta.get_training_history_index(3) == 1, LOG);
+   assert_true(mta.get_training_history_index(7) == 3, LOG);
+
+   // Training history depth
+
+   mta.set_training_history_depth(2);
+
+   assert_true(mta.get_training_history_index(3) == 1, LOG);
+   assert_true(mta.get_training_history_index(6) == 0, LOG);
+   assert_true(mta.get_training_history_index(7) == 1, LOG);
+}
+
+
 // void test_get_training_history_XML(void) method
 
 void TestTrainingAlgorithm::test_get_training_history_XML(void)
@@ -1073,6 +1381,67 @@ void TestTrainingAlgorithm::test_save_training_history(void)
 }
 
 
+// void test_calculate_monotonic_time(void) method
+
+void TestTrainingAlgorithm::test_calculate_monotonic_time(void)
+{
+   message += "test_calculate_monotonic_time\n";
+
+   MockTrainingAlgorithm mta;
+
+   double first_time = mta.calculate_monotonic_time();
+   double second_time = mta.calculate_monotonic_time();
+
+   assert_true(second_time >= first_time, LOG);
+}
+
+
+// void test_end_profiling_phase(void) method
+
+void TestTrainingAlgorithm::test_end_profiling_phase(void)
+{
+   message += "test_end_profiling_phase\n";
+
+   MockTrainingAlgorithm mta;
+
+   // Test
+
+   mta.begin_profiling_phase(TrainingAlgorithm::GradientPhase);
+   mta.end_profiling_phase(TrainingAlgorithm::GradientPhase);
+
+   assert_true(mta.get_profiling_calls_number().get_size() == 0, LOG);
+
+   // Test
+
+   mta.set_profiling(true);
+   mta.set_reserve_profiling_trace(true);
+
+   for(int i = 0; i < 3; i++)
+   {
+      mta.begin_profiling_phase(TrainingAlgorithm::GradientPhase);
+      mta.end_profiling_phase(TrainingAlgorithm::GradientPhase);
+   }
+
+   assert_true(mta.get_profiling_calls_number()[TrainingAlgorithm::GradientPhase] == 3, LOG);
+   assert_true(mta.get_profiling_calls_number()[TrainingAlgorithm::HessianPhase] == 0, LOG);
+   assert_true(mta.get_profiling_total_time()[TrainingAlgorithm::GradientPhase] >= 0.0, LOG);
+   assert_true(mta.get_profiling_histogram().get_row(TrainingAlgorithm::GradientPhase).calculate_sum() == 3, LOG);
+}
+
+
+// void test_get_profiling_phase_name(void) method
+
+void TestTrainingAlgorithm::test_get_profiling_phase_name(void)
+{
+   message += "test_get_profiling_phase_name\n";
+
+   MockTrainingAlgorithm mta;
+
+   assert_true(mta.get_profiling_phase_name(TrainingAlgorithm::EvaluationPhase) == "Evaluation", LOG);
+   assert_true(mta.get_profiling_phase_name(TrainingAlgorithm::LineSearchPhase) == "LineSearch", LOG);
+}
+
+
 // void test_to_XML(void) method
 
 void TestTrainingAlgorithm::test_to_XML(void)
@@ -1161,6 +1530,19 @@ void TestTrainingAlgorithm::run_test_case(void)
    // Early stopping
 
    test_get_early_stopping();
+   test_get_validation_interval();
+
+   // Checkpoints
+
+   test_get_checkpoint_period();
+
+   // Training history sink
+
+   test_get_training_history_period();
+
+   // Profiling
+
+   test_get_profiling();
 
    // Reserve training history
 
@@ -1235,6 +1617,19 @@ void TestTrainingAlgorithm::run_test_case(void)
    // Early stopping
 
    test_set_early_stopping();
+   test_set_validation_interval();
+
+   // Checkpoints
+
+   test_set_checkpoint_period();
+
+   // Training history sink
+
+   test_set_training_history_period();
+
+   // Profiling
+
+   test_set_profiling();
 
    // Reserve training history
 
@@ -1277,19 +1672,36 @@ void TestTrainingAlgorithm::run_test_case(void)
 
    test_train();
 
+   // Validation methods
+
+   test_calculate_gradient_validation_error();
+
+   // Training rate methods
+
    test_calculate_training_rate_evaluation();
    test_calculate_fixed_training_rate_evaluation();
    test_calculate_golden_section_training_rate_evaluation();
    test_calculate_Brent_method_training_rate_evaluation();
+   test_calculate_strong_Wolfe_training_rate_evaluation();
+
+   test_calculate_cubic_interpolation_training_rate();
 
    // Training history methods   
 
    test_resize_training_history();
+   test_calculate_training_history_size();
+   test_get_training_history_index();
 
    test_get_training_history_XML();   
    test_print_training_history();
    test_save_training_history();
 
+   // Profiling methods
+
+   test_calculate_monotonic_time();
+   test_end_profiling_phase();
+   test_get_profiling_phase_name();
+
    // Utility methods
 
    test_to_XML();
@@ -84,6 +84,19 @@ public:
    // Early stopping
 
    void test_get_early_stopping(void);
+   void test_get_validation_interval(void);
+
+   // Checkpoints
+
+   void test_get_checkpoint_period(void);
+
+   // Training history sink
+
+   void test_get_training_history_period(void);
+
+   // Profiling
+
+   void test_get_profiling(void);
 
    // Reserve training history
 
@@ -159,6 +172,19 @@ public:
    // Early stopping
 
    void test_set_early_stopping(void);
+   void test_set_validation_interval(void);
+
+   // Checkpoints
+
+   void test_set_checkpoint_period(void);
+
+   // Training history sink
+
+   void test_set_training_history_period(void);
+
+   // Profiling
+
+   void test_set_profiling(void);
 
    // Reserve training history
 
@@ -201,19 +227,36 @@ public:
 
    void test_train(void);
 
+   // Validation methods
+
+   void test_calculate_gradient_validation_error(void);
+
+   // Training rate methods
+
    void test_calculate_training_rate_evaluation(void);
    void test_calculate_fixed_training_rate_evaluation(void);
    void test_calculate_golden_section_training_rate_evaluation(void);
    void test_calculate_Brent_method_training_rate_evaluation(void);
+   void test_calculate_strong_Wolfe_training_rate_evaluation(void);
+
+   void test_calculate_cubic_interpolation_training_rate(void);
 
    // Training history methods
    
    void test_resize_training_history(void);
+   void test_calculate_training_history_size(void);
+   void test_get_training_history_index(void);
 
    void test_get_training_history_XML(void);
    void test_print_training_history(void);
    void test_save_training_history(void);
 
+   // Profiling methods
+
+   void test_calculate_monotonic_time(void);
+   void test_end_profiling_phase(void);
+   void test_get_profiling_phase_name(void);
+
    // Utility methods
 
    void test_to_XML(void);
@@ -0,0 +1,490 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   Flood: An Open Source Neural Networks C++ Library                                                          */
+/*   www.cimne.com/flood                                                                                        */
+/*                                                                                                              */
+/*   T E S T   T R U N C A T E D   N E W T O N   M E T H O D   C L A S S                                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   International Center for Numerical Methods in Engineering (CIMNE)                                          */
+/*   Technical University of Catalonia (UPC)                                                                    */
+/*   Barcelona, Spain                                                                                           */
+/*   E-mail: rlopez@cimne.upc.edu                                                                               */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+
+// Flood includes
+
+#include "../../Flood/MultilayerPerceptron/MultilayerPerceptron.h"
+#include "../../Flood/TrainingAlgorithm/TruncatedNewtonMethod.h"
+
+
+// Unit testing includes
+
+#include "../TestObjectiveFunctional/MockObjectiveFunctional.h"
+#include "../TestObjectiveFunctional/Polynomial.h"
+#include "TestTruncatedNewtonMethod.h"
+
+
+using namespace Flood;
+
+
+// GENERAL CONSTRUCTOR
+
+TestTruncatedNewtonMethod::TestTruncatedNewtonMethod(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TestTruncatedNewtonMethod::~TestTruncatedNewtonMethod(void)
+{
+}
+
+
+// METHODS
+
+// void test_constructor(void) method
+
+void TestTruncatedNewtonMethod::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   MockObjectiveFunctional mof;
+
+   // Default constructor
+
+   TruncatedNewtonMethod tnm1;
+   assert_true(tnm1.get_objective_functional_pointer() == NULL, LOG);
+
+   // Objective functional constructor
+
+   TruncatedNewtonMethod tnm2(&mof);
+   assert_true(tnm2.get_objective_functional_pointer() != NULL, LOG);
+}
+
+
+// void test_destructor(void) method
+
+void TestTruncatedNewtonMethod::test_destructor(void)
+{
+}
+
+
+// void test_get_preconditioning_method(void) method
+
+void TestTruncatedNewtonMethod::test_get_preconditioning_method(void)
+{
+   message += "test_get_preconditioning_method\n";
+
+   TruncatedNewtonMethod tnm;
+
+   tnm.set_preconditioning_method(TruncatedNewtonMethod::None);
+   assert_true(tnm.get_preconditioning_method() == TruncatedNewtonMethod::None, LOG);
+
+   tnm.set_preconditioning_method(TruncatedNewtonMethod::DiagonalBFGS);
+   assert_true(tnm.get_preconditioning_method() == TruncatedNewtonMethod::DiagonalBFGS, LOG);
+}
+
+
+// void test_get_preconditioning_method_name(void) method
+
+void TestTruncatedNewtonMethod::test_get_preconditioning_method_name(void)
+{
+   message += "test_get_preconditioning_method_name\n";
+
+   TruncatedNewtonMethod tnm;
+
+   tnm.set_preconditioning_method(TruncatedNewtonMethod::None);
+   assert_true(tnm.get_preconditioning_method_name() == "None", LOG);
+
+   tnm.set_preconditioning_method(TruncatedNewtonMethod::DiagonalBFGS);
+   assert_true(tnm.get_preconditioning_method_name() == "DiagonalBFGS", LOG);
+}
+
+
+// void test_get_maximum_conjugate_gradient_iterations_number(void) method
+
+void TestTruncatedNewtonMethod::test_get_maximum_conjugate_gradient_iterations_number(void)
+{
+   message += "test_get_maximum_conjugate_gradient_iterations_number\n";
+
+   TruncatedNewtonMethod tnm;
+
+   tnm.set_maximum_conjugate_gradient_iterations_number(10);
+   assert_true(tnm.get_maximum_conjugate_gradient_iterations_number() == 10, LOG);
+}
+
+
+// void test_get_maximum_forcing_term(void) method
+
+void TestTruncatedNewtonMethod::test_get_maximum_forcing_term(void)
+{
+   message += "test_get_maximum_forcing_term\n";
+
+   TruncatedNewtonMethod tnm;
+
+   tnm.set_maximum_forcing_term(0.1);
+   assert_true(tnm.get_maximum_forcing_term() == 0.1, LOG);
+}
+
+
+// void test_set_preconditioning_method(void) method
+
+void TestTruncatedNewtonMethod::test_set_preconditioning_method(void)
+{
+   message += "test_set_preconditioning_method\n";
+
+   TruncatedNewtonMethod tnm;
+
+   tnm.set_preconditioning_method("None");
+   assert_true(tnm.get_preconditioning_method() == TruncatedNewtonMethod::None, LOG);
+
+   tnm.set_preconditioning_method("DiagonalBFGS");
+   assert_true(tnm.get_preconditioning_method() == TruncatedNewtonMethod::DiagonalBFGS, LOG);
+}
+
+
+// void test_calculate_truncated_Newton_step(void) method
+
+void TestTruncatedNewtonMethod::test_calculate_truncated_Newton_step(void)
+{
+   message += "test_calculate_truncated_Newton_step\n";
+
+   // Test
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   TruncatedNewtonMethod tnm(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   Vector<double> gradient = mof.calculate_gradient();
+
+   Vector<double> step = tnm.calculate_truncated_Newton_step(gradient);
+
+   assert_true(step == -1.0, LOG);
+   assert_true(tnm.get_conjugate_gradient_iterations_count() == 1, LOG);
+
+   // Test
+
+   MultilayerPerceptron mlp2(1);
+
+   Polynomial polynomial(&mlp2);
+
+   Vector<double> coefficients(3, 0.0);
+   coefficients[2] = -1.0;
+
+   polynomial.set_coefficients(coefficients);
+
+   TruncatedNewtonMethod tnm2(&polynomial);
+
+   mlp2.initialize_independent_parameters(1.0);
+
+   gradient = polynomial.calculate_gradient();
+
+   step = tnm2.calculate_truncated_Newton_step(gradient);
+
+   assert_true(step.dot(gradient) < 0.0, LOG);
+   assert_true(tnm2.get_negative_curvature_count() == 1, LOG);
+}
+
+
+// void test_calculate_training_direction(void) method
+
+void TestTruncatedNewtonMethod::test_calculate_training_direction(void)
+{
+   message += "test_calculate_training_direction\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   TruncatedNewtonMethod tnm(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   Vector<double> gradient = mof.calculate_gradient();
+
+   Vector<double> training_direction = tnm.calculate_training_direction(gradient);
+
+   assert_true(fabs(training_direction.calculate_norm() - 1.0) < 1.0e-12, LOG);
+   assert_true(training_direction.dot(gradient) < 0.0, LOG);
+}
+
+
+// void test_update_preconditioner(void) method
+
+void TestTruncatedNewtonMethod::test_update_preconditioner(void)
+{
+   message += "test_update_preconditioner\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   TruncatedNewtonMethod tnm(&mof);
+
+   Vector<double> parameters_increment(2, 1.0);
+   Vector<double> gradient_increment = parameters_increment*2.0;
+
+   tnm.update_preconditioner(parameters_increment, gradient_increment);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   Vector<double> gradient = mof.calculate_gradient();
+
+   Vector<double> step = tnm.calculate_truncated_Newton_step(gradient);
+
+   assert_true(step == -1.0, LOG);
+}
+
+
+// void test_train(void) method
+
+void TestTruncatedNewtonMethod::test_train(void)
+{
+   message += "test_train\n";
+
+   MultilayerPerceptron mlp(2);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   TruncatedNewtonMethod tnm(&mof);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double old_evaluation = mof.calculate_evaluation();
+
+   tnm.set_maximum_epochs_number(2),
+   tnm.set_display(false);
+
+   tnm.train();
+
+   double evaluation = mof.calculate_evaluation();
+
+   assert_true(evaluation < old_evaluation, LOG);
+
+   // Strong Wolfe line search. The unit truncated Newton step is exact for a quadratic objective, and it is 
+   // accepted at the first trial instead of running a line minimization
+
+   assert_true(tnm.get_training_rate_method() == TrainingAlgorithm::StrongWolfe, LOG);
+
+   mlp.initialize_independent_parameters(1.0);
+
+   mof.set_calculate_evaluation_count(0);
+
+   tnm.set_maximum_epochs_number(0);
+
+   tnm.train();
+
+   assert_true(mof.get_calculate_evaluation_count() == 2, LOG);
+
+   // Evaluation goal
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double evaluation_goal = 0.1;
+
+   tnm.set_minimum_parameters_increment_norm(0.0);
+   tnm.set_evaluation_goal(evaluation_goal);
+   tnm.set_minimum_evaluation_improvement(0.0);
+   tnm.set_gradient_norm_goal(0.0);
+   tnm.set_maximum_epochs_number(1000);
+   tnm.set_maximum_time(1000.0);
+
+   tnm.train();
+
+   evaluation = mof.calculate_evaluation();
+
+   assert_true(evaluation < evaluation_goal, LOG);
+
+   // Gradient norm goal
+
+   mlp.initialize_independent_parameters(1.0);
+
+   double gradient_norm_goal = 0.1;
+
+   tnm.set_minimum_parameters_increment_norm(0.0);
+   tnm.set_evaluation_goal(0.0);
+   tnm.set_minimum_evaluation_improvement(0.0);
+   tnm.set_gradient_norm_goal(gradient_norm_goal);
+   tnm.set_maximum_epochs_number(1000);
+   tnm.set_maximum_time(1000.0);
+
+   tnm.train();
+
+   double gradient_norm = mof.calculate_gradient_norm();
+
+   assert_true(gradient_norm < gradient_norm_goal, LOG);
+}
+
+
+// void test_resize_training_history(void) method
+
+void TestTruncatedNewtonMethod::test_resize_training_history(void)
+{
+   message += "test_resize_training_history\n";
+
+   TruncatedNewtonMethod tnm;
+
+   tnm.set_reserve_all_training_history(true);
+
+   tnm.resize_training_history(1);
+
+   assert_true(tnm.get_evaluation_history().get_size() == 1, LOG);
+}
+
+
+// void test_set_reserve_all_training_history(void) method
+
+void TestTruncatedNewtonMethod::test_set_reserve_all_training_history(void)
+{
+   message += "test_set_reserve_all_training_history\n";
+
+   TruncatedNewtonMethod tnm;
+   tnm.set_reserve_all_training_history(true);
+
+   assert_true(tnm.get_reserve_evaluation_history() == true, LOG);
+   assert_true(tnm.get_reserve_inverse_Hessian_history() == false, LOG);
+}
+
+
+// void test_get_training_history_XML(void) method
+
+void TestTruncatedNewtonMethod::test_get_training_history_XML(void)
+{
+   message += "test_get_training_history_XML\n";
+
+   MultilayerPerceptron mlp(1);
+
+   MockObjectiveFunctional mof(&mlp);
+
+   TruncatedNewtonMethod tnm(&mof);
+
+   tnm.set_reserve_all_training_history(true);
+   tnm.set_maximum_epochs_number(1);
+   tnm.set_display(false);
+
+   tnm.train();
+
+   std::string training_history_XML = tnm.get_training_history_XML(true);
+
+   assert_true(training_history_XML.find("<EvaluationHistory>") != std::string::npos, LOG);
+}
+
+
+// void test_to_XML(void) method
+
+void TestTruncatedNewtonMethod::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   TruncatedNewtonMethod tnm;
+
+   std::string XML = tnm.to_XML(true);
+
+   assert_true(XML.find("<MaximumForcingTerm>") != std::string::npos, LOG);
+}
+
+
+// void test_load(void) method
+
+void TestTruncatedNewtonMethod::test_load(void)
+{
+   message += "test_load\n";
+
+   TruncatedNewtonMethod tnm;
+
+   tnm.set_preconditioning_method(TruncatedNewtonMethod::None);
+   tnm.set_maximum_conjugate_gradient_iterations_number(7);
+   tnm.set_maximum_forcing_term(0.25);
+   tnm.set_maximum_epochs_number(3);
+
+   tnm.save("../Data/TruncatedNewtonMethod.dat");
+
+   tnm.set_default();
+
+   tnm.load("../Data/TruncatedNewtonMethod.dat");
+
+   assert_true(tnm.get_preconditioning_method() == TruncatedNewtonMethod::None, LOG);
+   assert_true(tnm.get_maximum_conjugate_gradient_iterations_number() == 7, LOG);
+   assert_true(tnm.get_maximum_forcing_term() == 0.25, LOG);
+   assert_true(tnm.get_maximum_epochs_number() == 3, LOG);
+}
+
+
+// void run_test_case(void) method
+
+void TestTruncatedNewtonMethod::run_test_case(void)
+{
+   message += "Running truncated Newton method test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_get_preconditioning_method();
+   test_get_preconditioning_method_name();
+
+   test_get_maximum_conjugate_gradient_iterations_number();
+   test_get_maximum_forcing_term();
+
+   // Set methods
+
+   test_set_preconditioning_method();
+
+   // Train methods
+
+   test_calculate_truncated_Newton_step();
+   test_calculate_training_direction();
+
+   test_update_preconditioner();
+
+   test_train();
+
+   // Training history methods
+
+   test_resize_training_history();
+
+   test_set_reserve_all_training_history();
+
+   test_get_training_history_XML();
+
+   // Utility methods
+
+   test_to_XML();
+   test_load();
+
+   message += "End of truncated Newton method test case\n";
+}
+
+
+// Flood: An Open Source Neural Networks C++ Library.
+// Copyright (C) 2005-2010 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the s of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA